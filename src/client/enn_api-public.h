@@ -251,6 +251,17 @@ extern EnnReturn EnnGetBufferInfoByIndex(const EnnModelId model_id, const enn_bu
  */
 extern EnnReturn EnnGetBufferInfoByLabel(const EnnModelId model_id, const char *label, EnnBufferInfo *out_buf_info);
 
+/**
+ * @brief Get latency distributions of the opened model: open, commit, execute, queue wait of asynchronous
+ *        executions and device time of each subgraph and userdriver. They are always recorded by the framework
+ *        from open to close of the model, without profiler.
+ *
+ * @param model_id model ID from load_model
+ * @param statistics output of count, mean, max and p50/p90/p99/p99.9 in nanoseconds
+ * @return EnnReturn zero if successful
+ */
+extern EnnReturn EnnGetModelStatistics(const EnnModelId model_id, EnnModelStatistics *statistics);
+
 
 
 /*************************
@@ -369,6 +380,24 @@ extern EnnReturn EnnExecuteModelWithSessionIdAsync(const EnnModelId model_id, co
  */
 extern EnnReturn EnnExecuteModelWithSessionIdWait(const EnnModelId model_id, const int session_id);
 
+/**
+ * @brief Enable pipelined execution of the model for streaming workloads.
+ *        Each subgraph of the model becomes a stage of the pipeline, and executions requested with
+ *        different session IDs overlap with each other on different devices.
+ *        Client should generate sessions with EnnGenerateBufferSpace(const EnnModelId, const int) and
+ *        request executions with EnnExecuteModelWithSessionIdAsync(const EnnModelId, const int)
+ *        for each session in turn. A session can be in the pipeline only once at a time.
+ *        Subgraphs of an execution are run one after another in topological order, so independent
+ *        subgraphs of a model which run concurrently without pipeline don't overlap within an execution.
+ *        Pipelined execution fits a model whose subgraphs form a chain.
+ *
+ * @param model_id model ID to be pipelined.
+ * @param queue_depth max number of executions in the pipeline. More requests are blocked until
+ *                    an execution is complete. Zero disables pipelined execution.
+ * @return EnnReturn ENN_RET_SUCCESS if successful.
+ */
+extern EnnReturn EnnSetExecutionPipeline(const EnnModelId model_id, const uint32_t queue_depth);
+
 
 
 /************************
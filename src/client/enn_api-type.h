@@ -109,4 +109,42 @@ typedef struct _ennModelPreference {
     PerfModePreference pref_mode;  // Default preset for the model
 } EnnModelPreference;
 
+#define ENN_STATISTICS_OPERATOR_LIST_MAX (32)
+
+/* NOTE: userdrivers are listed in the order that an OperatorList is dispatched to them */
+typedef enum _enn_userdriver_e {
+    ENN_USERDRIVER_NPU,
+    ENN_USERDRIVER_DSP,
+    ENN_USERDRIVER_CPU,
+    ENN_USERDRIVER_GPU,
+    ENN_USERDRIVER_UNIFIED,
+    ENN_USERDRIVER_SIZE,
+} enn_userdriver_e;
+
+// Latency distribution in nanoseconds. Percentiles are accurate within 6.25%.
+typedef struct _ennLatencyStatistics {
+    uint64_t count;
+    uint64_t mean_ns;
+    uint64_t max_ns;
+    uint64_t p50_ns;
+    uint64_t p90_ns;
+    uint64_t p99_ns;
+    uint64_t p999_ns;
+} EnnLatencyStatistics;
+
+typedef struct _ennModelStatistics {
+    EnnLatencyStatistics open;        // EnnOpenModel in the framework
+    EnnLatencyStatistics commit;      // EnnBufferCommit in the framework, of all sessions
+    EnnLatencyStatistics execute;     // execution of the model in the framework, of all sessions
+    EnnLatencyStatistics queue_wait;  // wait of an asynchronous execution until it starts
+    uint32_t n_operator_list;
+    // device time of each OperatorList(subgraph) in topological order, measured around its userdriver
+    EnnLatencyStatistics operator_list[ENN_STATISTICS_OPERATOR_LIST_MAX];
+    uint32_t operator_list_userdriver[ENN_STATISTICS_OPERATOR_LIST_MAX];  // enn_userdriver_e
+    // latency of each OperatorList predicted by the static scheduler, 0 if it is not predicted
+    uint64_t operator_list_predicted_ns[ENN_STATISTICS_OPERATOR_LIST_MAX];
+    // device time of OperatorLists of all models opened in the framework, per userdriver
+    EnnLatencyStatistics userdriver[ENN_USERDRIVER_SIZE];
+} EnnModelStatistics;
+
 #endif  // SRC_CLIENT_INCLUDE_ENN_API_TYPE_H_
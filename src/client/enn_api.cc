@@ -14,6 +14,7 @@
 #include <future>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <cinttypes>
 #include <unistd.h>
@@ -141,8 +142,19 @@ static std::vector<std::shared_ptr<enn::EnnBufferCore>> EnnOpenFile(enn::util::B
         uint32_t size = section.second - section.first;
         uint32_t offset = section.first;
 
-        // Create ION Memory and load model to the space
-        auto loaded_mem = enn_context.ccMemoryManager->CreateMemory(size, enn::EnnMmType::kEnnMmTypeIon);
+#ifndef ENN_ANDROID_BUILD
+        // Refer to the mapped model in place. Device drivers are not used, so the model does not need to be in ION.
+        auto mapping = modelbuf->get_mapping();
+#else
+        std::shared_ptr<char> mapping;
+#endif
+        std::shared_ptr<enn::EnnBufferCore> loaded_mem;
+        if (mapping) {
+            loaded_mem = enn_context.ccMemoryManager->CreateMemoryFromMapping(mapping, size, offset);
+        } else {
+            // Create ION Memory and load model to the space
+            loaded_mem = enn_context.ccMemoryManager->CreateMemory(size, enn::EnnMmType::kEnnMmTypeIon);
+        }
 
         if (loaded_mem) {
             result.push_back(loaded_mem);
@@ -150,12 +162,13 @@ static std::vector<std::shared_ptr<enn::EnnBufferCore>> EnnOpenFile(enn::util::B
             THROW_OPEN_FILE_ERR("CreateMemory error");
         }
 
-        if (modelbuf->copy_buffer(reinterpret_cast<char *>(loaded_mem->va), size, offset)) {
-            THROW_OPEN_FILE_ERR("File Loading Error");   
+        if (!mapping && modelbuf->copy_buffer(reinterpret_cast<char *>(loaded_mem->va), size, offset)) {
+            THROW_OPEN_FILE_ERR("File Loading Error");
         }
 
         if (model_type == enn::model::ModelType::CGO) {
-            if (!EnnClientCgoParse(enn_context.ccMemoryManager, modelbuf, loaded_mem->va, size, offset, &result)) {
+            if (!EnnClientCgoParse(enn_context.ccMemoryManager, modelbuf, loaded_mem->va, size, offset, &result,
+                                   mapping)) {
                 THROW_OPEN_FILE_ERR("Cgo client parsing error");
             }
         }
@@ -234,7 +247,7 @@ static EnnReturn EnnOpenModelCore(enn::util::BufferReader::UPtrType & model, Enn
 
 EnnReturn EnnOpenModel(const char *model_file, EnnModelId *model_id) {
     // generate buffer_reader object = model
-    enn::util::BufferReader::UPtrType model = std::make_unique<enn::util::FileBufferReader>(std::string(model_file));
+    enn::util::BufferReader::UPtrType model = std::make_unique<enn::util::MmapBufferReader>(std::string(model_file));
     CHECK_AND_RETURN_ERR(!model->is_valid(), ENN_RET_INVAL, "Model loading failed(file invalid: %s)\n", model_file);
     return EnnOpenModelCore(model, model_id);
 }
@@ -321,21 +334,8 @@ EnnReturn EnnExecuteModelWithSessionIdAsync(const EnnModelId model_id, const int
 
     CHECK_AND_RETURN_ERR(enn_context.hasAsyncFuture(exec_model_id), ENN_RET_INVAL,
                          "Execute Model ID(0x%" PRIX64 "): already exists.\n", exec_model_id);
-#if 0
-    // It should start immediately if std::launch::async is set,
-    // but it doesn't conform to the C++11 standard.
-    auto future = std::async(std::launch::async,
-                            &EnnExecuteModelWithSessionId, model_id, session_id);
-#else
-    std::promise<EnnReturn> promise;
-    auto future = promise.get_future();
-    std::thread thread(
-        [model_id, session_id](std::promise<EnnReturn> &&promise) {
-            promise.set_value(EnnExecuteModelWithSessionId(model_id, session_id));
-        },
-        std::move(promise));
-    thread.detach();
-#endif
+    // Execution is queued to the bounded worker pool of the runtime, not to a new thread.
+    auto future = enn_context.GetMediumInterface()->execute_model_async({exec_model_id});
     ENN_DBG_PRINT("EnnExecuteModelId 0x%" PRIX64 "\n", exec_model_id);
 
     CHECK_AND_RETURN_ERR(!enn_context.putAysncFuture(exec_model_id, std::move(future)), ENN_RET_FAILED,
@@ -359,6 +359,11 @@ EnnReturn EnnExecuteModelWithSessionIdWait(const EnnModelId model_id, const int
     auto ret = future.get();
     ENN_DBG_PRINT("EnnExecuteModelId 0x%" PRIX64 ", R %d\n", exec_model_id, ret);
 
+    if (ret == ENN_RET_SUCCESS && enn_context.ShouldDumpSessionMemory()) {
+        ENN_DBG_PRINT(" ## Start to dump after Execution..\n");
+        enn_context.ccModelContainer->DumpSessionToFile(model_id, "dump", session_id);
+    }
+
     return ret;
 }
 
@@ -366,6 +371,20 @@ EnnReturn EnnExecuteModelWait(const EnnModelId model_id) {
     return EnnExecuteModelWithSessionIdWait(model_id, 0);
 }
 
+EnnReturn EnnSetExecutionPipeline(const EnnModelId model_id, const uint32_t queue_depth) {
+    CHECK_AND_RETURN_ERR(enn_context.get_ref_cnt() < 1, ENN_RET_FAILED, "Context is not initialized\n");
+
+    ENN_INFO_PRINT_FORCE("SetExecutionPipeline: 0x%" PRIX64 ", depth %u\n", model_id, queue_depth);
+    return enn_context.GetMediumInterface()->set_execution_pipeline(model_id, queue_depth);
+}
+
+EnnReturn EnnGetModelStatistics(const EnnModelId model_id, EnnModelStatistics *statistics) {
+    CHECK_AND_RETURN_ERR(enn_context.get_ref_cnt() < 1, ENN_RET_FAILED, "Context is not initialized\n");
+    CHECK_AND_RETURN_ERR(statistics == nullptr, ENN_RET_INVAL, "statistics is null\n");
+
+    return enn_context.GetMediumInterface()->get_model_statistics(model_id, statistics);
+}
+
 EnnReturn EnnDeinitialize(void) {
     auto ret = enn_context.deinit();
     CHECK_AND_RETURN_ERR(ret, ret, "Error from context deinitialize\n");
@@ -395,17 +414,16 @@ static EnnReturn EnnGetBufferInfo(const EnnModelId model_id, const char *label,
                                   const uint32_t index, EnnBufferInfo *out_buf_info) {
     CHECK_AND_RETURN_ERR(enn_context.get_ref_cnt() < 1, ENN_RET_FAILED, "Context is not initialized\n");
     CHECK_AND_RETURN_ERR(out_buf_info == nullptr, ENN_RET_FAILED, "out buffer is nullptr\n");
-    auto &session_buf = enn_context.ccModelContainer->GetSession(model_id);
-    CHECK_AND_RETURN_ERR(session_buf == nullptr, ENN_RET_INVAL, "Doesn't have any session data of ModelID(0x%" PRIX64 ")\n",
-                         model_id);
-
-    for (auto &buf_ele : session_buf->buffers) {
-        if ((label == nullptr && (static_cast<enn_buf_dir_e>(buf_ele.dir) == direction && buf_ele.buf_index == index)) ||
-            (label != nullptr && (std::string(label) == std::string(buf_ele.name.c_str())))) {
-            return EnnAssignBufferInfo(out_buf_info, buf_ele);
-        }
-    }
-    return ENN_RET_FAILED;
+    const Buffer *buf_ele = nullptr;
+    EnnReturn ret;
+    if (label == nullptr)
+        ret = enn_context.ccModelContainer->FindBuffer(
+            model_id, std::tuple<uint32_t, int32_t>(static_cast<uint32_t>(direction), index), &buf_ele);
+    else
+        ret = enn_context.ccModelContainer->FindBuffer(model_id, std::string_view(label), &buf_ele);
+    CHECK_AND_RETURN_ERR(ret, ret, "Cannot find the buffer of ModelID(0x%" PRIX64 ")\n", model_id);
+
+    return EnnAssignBufferInfo(out_buf_info, *buf_ele);
 }
 
 EnnReturn EnnGetBufferInfoByIndex(const EnnModelId model_id, const enn_buf_dir_e direction, const uint32_t index,
@@ -668,7 +686,7 @@ EnnReturn EnnSetBufferByLabelWithSessionId(const EnnModelId model_id, const char
     }
 
     auto sendBuf = reinterpret_cast<enn::EnnBufferCore *>(buf);
-    return enn_context.ccModelContainer->SetInferenceData(model_id, session_id, std::string(label), sendBuf);
+    return enn_context.ccModelContainer->SetInferenceData(model_id, session_id, std::string_view(label), sendBuf);
 }
 
 EnnReturn EnnSetBufferByLabel(const EnnModelId model_id, const char *label, EnnBufferPtr buf) {
@@ -16,9 +16,11 @@
 #include "model/parser/parser_utils.hpp"
 #include "model/parser/cgo/cgo_utils.hpp"
 
+// Parameters are referred in the mapping in place if it is given, otherwise they are loaded to ION memory.
 static bool EnnClientCgoParse(std::unique_ptr<enn::EnnMemoryManager> &emm, enn::util::BufferReader::UPtrType &modelbuf,
                               const void *va, uint32_t size, uint32_t offset,
-                              std::vector<std::shared_ptr<enn::EnnBufferCore>> *result) {
+                              std::vector<std::shared_ptr<enn::EnnBufferCore>> *result,
+                              const std::shared_ptr<char> &mapping = nullptr) {
     auto parsed_params = enn::model::CgoUtils::parse_parameters(va, size);
 
     if (parsed_params == nullptr || parsed_params->size() == 0) {
@@ -31,16 +33,25 @@ static bool EnnClientCgoParse(std::unique_ptr<enn::EnnMemoryManager> &emm, enn::
     for (auto& param : *parsed_params) {
         std::shared_ptr<enn::EnnBufferCore> mem;
 
-
-        if (param.size != 0 && param.is_loaded_from_file) {
+        uint32_t param_offset = param.offset + fbs_section + sizeof(enn::model::CGO::FileHeader::magic);
+        if (param.size != 0 && param.is_loaded_from_file && mapping) {
+            if (static_cast<uint64_t>(param_offset) + param.size > modelbuf->get_size()) {
+                ENN_DBG_COUT << "Error: Parameter is out of file: " << param.name << std::endl;
+                return false;
+            }
+            mem = emm->CreateMemoryFromMapping(mapping, param.size, param_offset);
+            if (!mem) {
+                ENN_DBG_COUT << "Error: CreateMemoryFromMapping" << std::endl;
+                return false;
+            }
+        } else if (param.size != 0 && param.is_loaded_from_file) {
             mem = emm->CreateMemory(param.size, enn::EnnMmType::kEnnMmTypeIon);
             if (!mem) {
                 ENN_DBG_COUT << "Error: CreateMemory" << std::endl;
                 return false;
             }
             ENN_DBG_COUT << "Load data from file for: " << param.name << std::endl;
-            if (modelbuf->copy_buffer(reinterpret_cast<char *>(mem->va), param.size,
-                                      param.offset + fbs_section + sizeof(enn::model::CGO::FileHeader::magic))) {
+            if (modelbuf->copy_buffer(reinterpret_cast<char *>(mem->va), param.size, param_offset)) {
                 ENN_DBG_COUT << "Error: Memory Load from file" << std::endl;
                 return false;
             }
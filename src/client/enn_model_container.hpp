@@ -29,6 +29,9 @@
 #include <tuple>
 #include <vector>
 #include <set>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
 
 #include <sys/mman.h>
 
@@ -47,29 +50,37 @@ template <typename T1, typename T2> constexpr auto ENN_STL_ITER_IS_IN(T1 obj, T2
 
 template <typename idType, typename sessionType, typename execType, typename InferenceData> class EnnModelContainer {
   public:
-    EnnModelContainer() {
-        session_map.clear();
-        exec_map.clear();
-    }
+    EnnModelContainer() {}
 
     /* TODO: requires to return reference or pointer? */
     const std::shared_ptr<sessionType> GetSession(idType model_id) {
-        auto iter = session_map.find(model_id);
-        if (iter == session_map.end())
+        auto model = FindModel(model_id);
+        if (model == nullptr)
             return nullptr;
-        else
-            return iter->second;
+        std::shared_lock<std::shared_mutex> guard(model->mutex);
+        return model->session;
     }
 
     EnnReturn SetSessionData(std::shared_ptr<sessionType> session, std::shared_ptr<EnnBufferCore> buf = nullptr) {
-        std::lock_guard<std::mutex> guard(mdl_ctrl_mutex);
         auto model_id = session->model_id;
         CHECK_AND_RETURN_ERR((model_id == 0), ENN_RET_INVAL, "model ID (0x%" PRIX64 ") is incorrent\n", model_id);
-        if (ENN_STL_ITER_IS_IN(session_map, model_id))
+        std::shared_ptr<ModelData> model;
+        {
+            auto &shard = GetShard(model_id);
+            std::unique_lock<std::shared_mutex> guard(shard.mutex);
+            auto &slot = shard.models[model_id];
+            if (slot == nullptr)
+                slot = std::make_shared<ModelData>();
+            model = slot;
+        }
+
+        std::unique_lock<std::shared_mutex> guard(model->mutex);
+        if (model->session != nullptr)
             ENN_WARN_PRINT(" Session is already set. overwrite it\n");
 
-        session_map[model_id] = session;
-        loaded_buf_map[model_id] = buf;
+        model->session = session;
+        model->loaded_buf = buf;
+        BuildBufferIndex(*model);
         ENN_INFO_PRINT("Set session with model_id(0x%" PRIX64 ")\n", model_id);
 
         return ENN_RET_SUCCESS;
@@ -77,38 +88,44 @@ template <typename idType, typename sessionType, typename execType, typename Inf
 
     EnnReturn SetAutoAllocatedExtBuffersToSession(idType model_id, int32_t session_id,
                                                   std::shared_ptr<EnnBufferCore> mem_obj) {
-        std::lock_guard<std::mutex> guard(mdl_ctrl_mutex);
-        auto &ext_buffer_map = auto_allocated_ext_buffer_lists[model_id];
-        auto &ext_buffer_session_vec = ext_buffer_map[session_id];
-        ext_buffer_session_vec.push_back(mem_obj);
+        auto model = FindModel(model_id);
+        CHECK_AND_RETURN_ERR(model == nullptr, ENN_RET_INVAL, "Doesn't have any session data of ModelID(0x%" PRIX64 ")\n",
+                             model_id);
+        std::unique_lock<std::shared_mutex> guard(model->mutex);
+        model->auto_allocated_ext_buffers[session_id].push_back(mem_obj);
 
         return ENN_RET_SUCCESS;
     }
 
     std::vector<std::shared_ptr<EnnBufferCore>> GetAutoAllocatedExtBuffersFromSession(idType model_id, int32_t session_id) {
-        std::lock_guard<std::mutex> guard(mdl_ctrl_mutex);
-        auto &ext_buffer_map = auto_allocated_ext_buffer_lists[model_id];
-        return ext_buffer_map[session_id];
+        auto model = FindModel(model_id);
+        if (model == nullptr)
+            return {};
+        std::shared_lock<std::shared_mutex> guard(model->mutex);
+        auto iter = model->auto_allocated_ext_buffers.find(session_id);
+        if (iter == model->auto_allocated_ext_buffers.end())
+            return {};
+        return iter->second;
     }
 
     void ShowAutoAllocatedExtBuffers() {
         ENN_TST_PRINT("Show Ext Buffers...\n");
-        for (auto &buf_map : auto_allocated_ext_buffer_lists) {
-            ENN_TST_PRINT("model ID (0x%" PRIX64 ")... \n", buf_map.first);
-            for (auto &buf_session_map : buf_map.second) {
+        ForEachModel([](idType model_id, ModelData &model) {
+            ENN_TST_PRINT("model ID (0x%" PRIX64 ")... \n", model_id);
+            for (auto &buf_session_map : model.auto_allocated_ext_buffers) {
                 ENN_TST_PRINT("  session ID (0x%" PRIX64 ")... \n", buf_session_map.first);
                 for (auto &buffs : buf_session_map.second) {
                     ENN_TST_PRINT("    buffer: size(%d), offset(%d), va(%p)\n", buffs->size, buffs->offset, buffs->va);
                 }
             }
-        }
+        });
     }
 
     void ShowSessionData() {
-        std::lock_guard<std::mutex> guard(mdl_ctrl_mutex);
-        for (auto &session_ele : session_map) {
-            auto &m_id = session_ele.first;
-            auto &session_buf = session_ele.second;
+        ForEachModel([](idType m_id, ModelData &model) {
+            auto &session_buf = model.session;
+            if (session_buf == nullptr)
+                return;
             ENN_DBG_PRINT("# Session.Model_ID: 0x%" PRIX64 " / 0x%" PRIX64 "(buf: %zu, reg: %zu):::: \n", m_id,
                           session_buf->model_id, session_buf->buffers.size(), session_buf->regions.size());
             for (auto &buf_ele : session_buf->buffers) {
@@ -122,18 +139,19 @@ template <typename idType, typename sessionType, typename execType, typename Inf
                 ENN_DBG_PRINT("# [Region] attr(%d), req_size(%d), name(%s)\n", reg_ele.attr, reg_ele.req_size,
                               reg_ele.name.c_str());
             }
-        }
+        });
     }
 
     // This function returns 'empty' ext buffers.
     std::set<int> GetExtRegionIndexes(idType model_id, int32_t session_id) {
-        std::lock_guard<std::mutex> guard(mdl_ctrl_mutex);
         std::set<int> return_index_set;
-        auto session_buf = GetSession(model_id);
-        auto &inf_data = exec_map[model_id]->inference_set[session_id];
+        auto model = FindModel(model_id);
+        CHECK_AND_RETURN_ERR(model == nullptr, {}, "Doesn't have any session data of ModelID(0x%" PRIX64 ")\n", model_id);
+        std::shared_lock<std::shared_mutex> guard(model->mutex);
+        CHECK_AND_RETURN_ERR(CheckReadyToSetExec(*model, model_id, session_id), {}, "Failed\n");
+        auto &session_buf = model->session;
+        auto &inf_data = model->exec->inference_set[session_id];
 
-        CHECK_AND_RETURN_ERR(session_buf == nullptr, {}, "Doesn't have any session data of ModelID(0x%" PRIX64 ")\n",
-                             model_id);
         for (auto &buf_ele : session_buf->buffers) {
             if (buf_ele.dir == DirType::ENN_BUF_DIR_EXT) {
                 ENN_DBG_COUT << "ridx: " << buf_ele.region_idx << ", Ext [" << buf_ele.buf_index
@@ -153,8 +171,10 @@ template <typename idType, typename sessionType, typename execType, typename Inf
     }
 
     uint32_t GetRegionSizes(idType model_id, int region_idx) {
-        std::lock_guard<std::mutex> guard(mdl_ctrl_mutex);
-        auto session_buf = GetSession(model_id);
+        auto model = FindModel(model_id);
+        CHECK_AND_RETURN_ERR(model == nullptr, 0, "Doesn't have any session data of ModelID(0x%" PRIX64 ")\n", model_id);
+        std::shared_lock<std::shared_mutex> guard(model->mutex);
+        auto &session_buf = model->session;
         CHECK_AND_RETURN_ERR(session_buf == nullptr, 0, "Doesn't have any session data of ModelID(0x%" PRIX64 ")\n",
                              model_id);
         CHECK_AND_RETURN_ERR(session_buf->regions.size() <= region_idx, 0, "Region_idx(%d) is invalid (max:%d)\n",
@@ -163,18 +183,21 @@ template <typename idType, typename sessionType, typename execType, typename Inf
     }
 
     EnnReturn GenerateInferenceData(idType model_id, int32_t num = 1) {
-        std::lock_guard<std::mutex> guard(mdl_ctrl_mutex);
-        auto session_buf = GetSession(model_id);
+        auto model = FindModel(model_id);
+        CHECK_AND_RETURN_ERR(model == nullptr, ENN_RET_INVAL,
+                             "Doesn't have any session data of ModelID(0x%" PRIX64 ")\n", model_id);
+        std::unique_lock<std::shared_mutex> guard(model->mutex);
+        auto &session_buf = model->session;
         CHECK_AND_RETURN_ERR(session_buf == nullptr, ENN_RET_INVAL,
                              "Doesn't have any session data of ModelID(0x%" PRIX64 ")\n", model_id);
         CHECK_AND_RETURN_ERR(num <= 0, ENN_RET_INVAL, "Number of inference data should be over zero\n");
 
-        if (!ENN_STL_ITER_IS_IN(exec_map, model_id))
+        if (model->exec == nullptr)
             ENN_INFO_PRINT("No inference data. generate it.\n");
         else
             ENN_INFO_PRINT("There's inference data on Model ID(0x%" PRIX64 "), clear and overwrite it.\n", model_id);
 
-        GenerateInferenceSetAtExecMap(model_id, num, session_buf);
+        GenerateInferenceSet(*model, model_id, num);
 
         ENN_INFO_PRINT("Generate Inference Data: ModelID(0x%" PRIX64 "), num(%d)\n", model_id, num);
 
@@ -182,14 +205,16 @@ template <typename idType, typename sessionType, typename execType, typename Inf
     }
 
     uint32_t GetNumInferenceData(idType model_id) {
-        std::lock_guard<std::mutex> guard(mdl_ctrl_mutex);
-        auto session_buf = GetSession(model_id);
-        CHECK_AND_RETURN_ERR(session_buf == nullptr, ENN_RET_INVAL,
+        auto model = FindModel(model_id);
+        CHECK_AND_RETURN_ERR(model == nullptr, ENN_RET_INVAL,
+                             "Doesn't have any session data of ModelID(0x%" PRIX64 ")\n", model_id);
+        std::shared_lock<std::shared_mutex> guard(model->mutex);
+        CHECK_AND_RETURN_ERR(model->session == nullptr, ENN_RET_INVAL,
                              "Doesn't have any session data of ModelID(0x%" PRIX64 ")\n", model_id);
-        if (!ENN_STL_ITER_IS_IN(exec_map, model_id))
+        if (model->exec == nullptr)
             return 0;
         else
-            return exec_map[model_id]->n_inference;
+            return model->exec->n_inference;
     }
 
     /**
@@ -197,21 +222,22 @@ template <typename idType, typename sessionType, typename execType, typename Inf
      *
      * @param model_id    model id
      * @param session_id  session id
-     * @param buffer_name if buffer_name == "", try to find buffer with {dir, index}
-     * @param dir         IN or OUT
-     * @param index       index number
+     * @param key         label(std::string or std::string_view), or {dir, index}(std::tuple<uint32_t, int32_t>)
      * @param mem_object  memory object to insert
      * @return EnnReturn  ENN_RET_SUCCESS(0), otheres are failed
      */
     template <typename KeyType>
     EnnReturn SetInferenceData(idType model_id, int32_t session_id, KeyType key, EnnBufferCore *mem_object) {
         CHECK_AND_RETURN_ERR(mem_object == nullptr, ENN_RET_INVAL, "Invalid memory object\n");
-        auto ret = CheckReadyToSetExec(model_id, session_id);
+        auto model = FindModel(model_id);
+        CHECK_AND_RETURN_ERR(model == nullptr, ENN_RET_INVAL, "Doesn't have any session data. openModel First.\n");
+        std::unique_lock<std::shared_mutex> guard(model->mutex);
+        auto ret = CheckReadyToSetExec(*model, model_id, session_id);
         CHECK_AND_RETURN_ERR(ret, ret, "Failed\n");
 
         // 1. check model_id have session
-        auto session_buf = GetSession(model_id);
-        auto inf_data = &(exec_map[model_id]->inference_set[session_id]);
+        auto &session_buf = model->session;
+        auto inf_data = &(model->exec->inference_set[session_id]);
 
         // *. If data is already committed, cannot set inference before release commit
         CHECK_AND_RETURN_ERR((inf_data->is_commit == true), ENN_RET_FAILED,
@@ -219,25 +245,7 @@ template <typename idType, typename sessionType, typename execType, typename Inf
 
         // 2. get buffer: take buffer in inference data
         //                For indexing, user can put label(string), or {direction, index}
-        // TODO(hoon98.choi): make function to get_buffer()
-        Buffer *select_buffer = nullptr;
-        if constexpr (std::is_same<KeyType, std::string>::value) {
-            for (auto &buf : session_buf->buffers) {
-                if (buf.name == key) {
-                    select_buffer = &buf;
-                    break;
-                }
-            }
-        } else if constexpr (std::is_same<KeyType, std::tuple<uint32_t, int32_t>>::value) {
-            for (auto &buf : session_buf->buffers) {
-                if (static_cast<uint32_t>(buf.dir) == std::get<0>(key) && buf.buf_index == std::get<1>(key)) {
-                    select_buffer = &buf;
-                    break;
-                }
-            }
-        } else {
-            ENN_WARN_PRINT("Cannot process with the parameter type\n");
-        }
+        const Buffer *select_buffer = FindBufferInModel(*model, key);
 
         // 3. check found buffer can insert to session list or not.
         CHECK_AND_RETURN_ERR(select_buffer == nullptr, ENN_RET_INVAL,
@@ -263,37 +271,57 @@ template <typename idType, typename sessionType, typename execType, typename Inf
      *
      * @param model_id    model id
      * @param session_id  session id
-     * @param buffer_name if buffer_name == "", try to find buffer with {dir, index}
-     * @param dir         IN or OUT
-     * @param index       index number
+     * @param region_idx  index of region
      * @param mem_object  memory object to insert
      * @return EnnReturn  ENN_RET_SUCCESS(0), otheres are failed
      */
     EnnReturn SetInferenceData(idType model_id, int32_t session_id, int region_idx, EnnBufferCore *mem_object) {
         CHECK_AND_RETURN_ERR(mem_object == nullptr, ENN_RET_INVAL, "Invalid memory object\n");
-        auto ret = CheckReadyToSetExec(model_id, session_id);
+        auto model = FindModel(model_id);
+        CHECK_AND_RETURN_ERR(model == nullptr, ENN_RET_INVAL, "Doesn't have any session data. openModel First.\n");
+        std::unique_lock<std::shared_mutex> guard(model->mutex);
+        auto ret = CheckReadyToSetExec(*model, model_id, session_id);
         CHECK_AND_RETURN_ERR(ret, ret, "Failed\n");
 
-        // 1. check model_id have session
-        auto session_buf = GetSession(model_id);
-        auto inf_data = &(exec_map[model_id]->inference_set[session_id]);
-
-        // 2. Set inference data
+        // 1. Set inference data
+        auto inf_data = &(model->exec->inference_set[session_id]);
         ret = setInferenceData(inf_data, region_idx, mem_object);
         inf_data->exec_model_id = EXEC_MODEL_ID_NOT_DEFINED;
 
         return ret;
     }
 
+    /**
+     * @brief Find the buffer of the label or {dir, index}, which is valid until the model is cleared
+     *
+     * @param model_id    model id
+     * @param key         label(std::string or std::string_view), or {dir, index}(std::tuple<uint32_t, int32_t>)
+     * @param out_buffer  buffer found
+     * @return EnnReturn  ENN_RET_SUCCESS(0), ENN_RET_INVAL if the model has no session, ENN_RET_FAILED if not found
+     */
+    template <typename KeyType>
+    EnnReturn FindBuffer(idType model_id, KeyType key, const Buffer **out_buffer) {
+        auto model = FindModel(model_id);
+        CHECK_AND_RETURN_ERR(model == nullptr, ENN_RET_INVAL,
+                             "Doesn't have any session data of ModelID(0x%" PRIX64 ")\n", model_id);
+        std::shared_lock<std::shared_mutex> guard(model->mutex);
+        CHECK_AND_RETURN_ERR(model->session == nullptr, ENN_RET_INVAL,
+                             "Doesn't have any session data of ModelID(0x%" PRIX64 ")\n", model_id);
+        *out_buffer = FindBufferInModel(*model, key);
+        return (*out_buffer == nullptr) ? ENN_RET_FAILED : ENN_RET_SUCCESS;
+    }
+
     EnnReturn VerifyInferenceData(idType model_id, int32_t session_id) {
-        std::lock_guard<std::mutex> guard(mdl_ctrl_mutex);
+        auto model = FindModel(model_id);
+        CHECK_AND_RETURN_ERR(model == nullptr, ENN_RET_INVAL, "Doesn't have any session data. openModel First.\n");
+        std::shared_lock<std::shared_mutex> guard(model->mutex);
 
-        auto ret = CheckReadyToSetExec(model_id, session_id);
+        auto ret = CheckReadyToSetExec(*model, model_id, session_id);
         CHECK_AND_RETURN_ERR(ret, ret, "Failed\n");
 
         // 1. check model_id have session
-        auto regions = GetSession(model_id)->regions;
-        const auto &inference_data = exec_map[model_id]->inference_set[session_id].inference_data;
+        const auto &regions = model->session->regions;
+        const auto &inference_data = model->exec->inference_set[session_id].inference_data;
 
         // 2. Check region size and inference data vector size
         CHECK_AND_RETURN_ERR(regions.size() != inference_data.size(), ENN_RET_INVAL,
@@ -314,15 +342,19 @@ template <typename idType, typename sessionType, typename execType, typename Inf
 
     // SetCommitFlag -> SetExecuteModelId
     EnnReturn SetExecuteModelId(idType model_id, idType session_id, EnnExecuteModelId exec_id) {
-        std::lock_guard<std::mutex> guard(mdl_ctrl_mutex);
-        if (!ENN_STL_ITER_IS_IN(exec_map, model_id))
+        auto model = FindModel(model_id);
+        if (model == nullptr)
             return ENN_RET_FAILED;
-        CHECK_AND_RETURN_ERR(session_id >= exec_map[model_id]->inference_set.size(), ENN_RET_FAILED,
-                             "session_id(%ju) should be in {0, %zu}\n", session_id, exec_map[model_id]->inference_set.size());
-        auto &&exec_model_id_ref = exec_map[model_id]->inference_set[session_id].exec_model_id;
+        std::unique_lock<std::shared_mutex> guard(model->mutex);
+        if (model->exec == nullptr)
+            return ENN_RET_FAILED;
+        auto &inference_set = model->exec->inference_set;
+        CHECK_AND_RETURN_ERR(session_id >= inference_set.size(), ENN_RET_FAILED,
+                             "session_id(%ju) should be in {0, %zu}\n", session_id, inference_set.size());
+        auto &&exec_model_id_ref = inference_set[session_id].exec_model_id;
         CHECK_AND_RETURN_ERR((exec_id != 0 && exec_model_id_ref != 0), ENN_RET_FAILED, "exec_id(%ju) is already set!\n",
                              exec_model_id_ref);
-        exec_map[model_id]->inference_set[session_id].is_commit = true;
+        inference_set[session_id].is_commit = true;
         exec_model_id_ref = exec_id;
 
         return ENN_RET_SUCCESS;
@@ -330,86 +362,94 @@ template <typename idType, typename sessionType, typename execType, typename Inf
 
     // GetCommitFlag
     bool GetExecuteModelId(idType model_id, idType session_id, EnnExecuteModelId *exec_id) {
-        std::lock_guard<std::mutex> guard(mdl_ctrl_mutex);
-        if (!ENN_STL_ITER_IS_IN(exec_map, model_id))
+        auto model = FindModel(model_id);
+        if (model == nullptr)
+            return ENN_RET_FAILED;
+        std::shared_lock<std::shared_mutex> guard(model->mutex);
+        if (model->exec == nullptr)
             return ENN_RET_FAILED;
-        CHECK_AND_RETURN_ERR(session_id >= exec_map[model_id]->inference_set.size(), ENN_RET_FAILED,
-                             "session_id(%ju) should be in {0, %zu}\n", session_id, exec_map[model_id]->inference_set.size());
-        *exec_id = exec_map[model_id]->inference_set[session_id].exec_model_id;
+        const auto &inference_set = model->exec->inference_set;
+        CHECK_AND_RETURN_ERR(session_id >= inference_set.size(), ENN_RET_FAILED,
+                             "session_id(%ju) should be in {0, %zu}\n", session_id, inference_set.size());
+        *exec_id = inference_set[session_id].exec_model_id;
         return ENN_RET_SUCCESS;
     }
 
     const InferenceData *GetInferenceData(idType model_id, int session_id = 0) {
-        std::lock_guard<std::mutex> guard(mdl_ctrl_mutex);
-        if (CheckReadyToSetExec(model_id, session_id))
+        auto model = FindModel(model_id);
+        if (model == nullptr)
             return nullptr;
-        CHECK_AND_RETURN_ERR(session_id >= exec_map[model_id]->inference_set.size(), nullptr,
-                             "session_id(%u) should be in {0, %zu}\n", session_id, exec_map[model_id]->inference_set.size());
+        std::shared_lock<std::shared_mutex> guard(model->mutex);
+        if (CheckReadyToSetExec(*model, model_id, session_id))
+            return nullptr;
+        CHECK_AND_RETURN_ERR(session_id >= model->exec->inference_set.size(), nullptr,
+                             "session_id(%u) should be in {0, %zu}\n", session_id, model->exec->inference_set.size());
 
-        return &(exec_map[model_id]->inference_set[session_id]);
+        return &(model->exec->inference_set[session_id]);
     }
 
     const std::shared_ptr<execType> GetInferenceSet(idType model_id) {
-        std::lock_guard<std::mutex> guard(mdl_ctrl_mutex);
-        auto session_buf = GetSession(model_id);
-        CHECK_AND_RETURN_ERR(session_buf == nullptr, nullptr, "Doesn't have any session data of ModelID(0x%" PRIX64 ")\n",
+        auto model = FindModel(model_id);
+        CHECK_AND_RETURN_ERR(model == nullptr, nullptr, "Doesn't have any session data of ModelID(0x%" PRIX64 ")\n",
                              model_id);
-        if (!ENN_STL_ITER_IS_IN(exec_map, model_id))
-            return nullptr;
-        else
-            return exec_map[model_id];
+        std::shared_lock<std::shared_mutex> guard(model->mutex);
+        CHECK_AND_RETURN_ERR(model->session == nullptr, nullptr, "Doesn't have any session data of ModelID(0x%" PRIX64 ")\n",
+                             model_id);
+        return model->exec;
     }
 
     EnnReturn GetBufferInfo(idType model_id, uint32_t *n_in, uint32_t *n_out) {
-        std::lock_guard<std::mutex> guard(mdl_ctrl_mutex);
-        auto session_buf = GetSession(model_id);
-        CHECK_AND_RETURN_ERR(session_buf == nullptr, ENN_RET_INVAL,
+        auto model = FindModel(model_id);
+        CHECK_AND_RETURN_ERR(model == nullptr, ENN_RET_INVAL,
+                             "Doesn't have any session data of ModelID(0x%" PRIX64 ")\n", model_id);
+        std::shared_lock<std::shared_mutex> guard(model->mutex);
+        CHECK_AND_RETURN_ERR(model->session == nullptr, ENN_RET_INVAL,
                              "Doesn't have any session data of ModelID(0x%" PRIX64 ")\n", model_id);
         /* NOTE(hoon98.choi) : Assume that all buffer indexes are numbered sequentially */
-        uint32_t i = 0, o = 0;
-        for (auto &buf_ele : session_buf->buffers) {
-            if (static_cast<enn_buf_dir_e>(buf_ele.dir) == ENN_DIR_IN)
-                i++;
-            if (static_cast<enn_buf_dir_e>(buf_ele.dir) == ENN_DIR_OUT)
-                o++;
-        }
-        *n_in = i;
-        *n_out = o;
+        *n_in = model->n_in_buf;
+        *n_out = model->n_out_buf;
 
         return ENN_RET_SUCCESS;
     }
 
     EnnReturn ClearInferenceData(idType model_id) {
-        if (!ENN_STL_ITER_IS_IN(exec_map, model_id)) {
-            ENN_INFO_PRINT("Model ID(0x%" PRIX64 ") has no inference data\n", model_id);
-            return ENN_RET_FAILED;
+        auto model = FindModel(model_id);
+        if (model != nullptr) {
+            std::unique_lock<std::shared_mutex> guard(model->mutex);
+            if (model->exec != nullptr) {
+                model->exec.reset();
+                return ENN_RET_SUCCESS;
+            }
         }
-        exec_map.erase(model_id);
-        return ENN_RET_SUCCESS;
+        ENN_INFO_PRINT("Model ID(0x%" PRIX64 ") has no inference data\n", model_id);
+        return ENN_RET_FAILED;
     }
 
     std::shared_ptr<EnnBufferCore> GetModelLoadedBuf(idType model_id) {
-        if (loaded_buf_map.find(model_id) != loaded_buf_map.end())
-            return loaded_buf_map[model_id];
-        return nullptr;
+        auto model = FindModel(model_id);
+        if (model == nullptr)
+            return nullptr;
+        std::shared_lock<std::shared_mutex> guard(model->mutex);
+        return model->loaded_buf;
     }
 
     EnnReturn ClearModelData(idType model_id) {
         ClearInferenceData(model_id);
-        CHECK_AND_RETURN_ERR((!ENN_STL_ITER_IS_IN(session_map, model_id)), ENN_RET_INVAL,
-                             "No session data of model ID(0x%" PRIX64 ").\n", model_id);
-        session_map.erase(model_id);
-        auto_allocated_ext_buffer_lists.erase(model_id);
-        // hara:TODO: clear ext_buffer_map
+        auto &shard = GetShard(model_id);
+        std::unique_lock<std::shared_mutex> guard(shard.mutex);
+        auto iter = shard.models.find(model_id);
+        CHECK_AND_RETURN_ERR(iter == shard.models.end(), ENN_RET_INVAL, "No session data of model ID(0x%" PRIX64 ").\n",
+                             model_id);
+        // threads holding the model data go on with it until they return
+        shard.models.erase(iter);
         return ENN_RET_SUCCESS;
     }
 
     EnnReturn ClearModelAll(void) {
-        session_map.clear();
-        exec_map.clear();
-        auto_allocated_ext_buffer_lists.clear();
-
-        // hara:TODO: ext_buffer_map clear
+        for (auto &shard : model_shards) {
+            std::unique_lock<std::shared_mutex> guard(shard.mutex);
+            shard.models.clear();
+        }
         return ENN_RET_SUCCESS;
     }
 
@@ -460,26 +500,104 @@ template <typename idType, typename sessionType, typename execType, typename Inf
     }
 
   private:
-    std::map<idType, std::shared_ptr<sessionType>> session_map;
-    std::map<idType, std::shared_ptr<execType>> exec_map;
-    std::map<idType, std::shared_ptr<EnnBufferCore>> loaded_buf_map;
-    std::map<idType, std::map<idType, std::vector<std::shared_ptr<EnnBufferCore>>>> auto_allocated_ext_buffer_lists;
-    std::mutex mdl_ctrl_mutex;
+    /* Data of a model, which has its own lock so that threads working on different models do not contend */
+    struct ModelData {
+        std::shared_mutex mutex;
+        std::shared_ptr<sessionType> session;
+        std::shared_ptr<execType> exec;
+        std::shared_ptr<EnnBufferCore> loaded_buf;
+        std::map<idType, std::vector<std::shared_ptr<EnnBufferCore>>> auto_allocated_ext_buffers;  // by session id
+        /* built when the session is set, and refers to buffers of the session */
+        std::unordered_map<std::string_view, size_t> label_index;
+        std::unordered_map<uint64_t, size_t> dir_index;
+        uint32_t n_in_buf = 0;
+        uint32_t n_out_buf = 0;
+    };
+
+    /* Models are sharded by model ID, and a shard is locked only to find, add or remove a model */
+    struct ModelShard {
+        std::shared_mutex mutex;
+        std::unordered_map<idType, std::shared_ptr<ModelData>> models;
+    };
+
+    static constexpr size_t MODEL_SHARD_NUM = 16;
+    ModelShard model_shards[MODEL_SHARD_NUM];
 
     static const EnnExecuteModelId EXEC_MODEL_ID_NOT_DEFINED = 0;
 
-    EnnReturn GenerateInferenceSetAtExecMap(idType model_id, int32_t num, const std::shared_ptr<sessionType> session_buf) {
-        exec_map[model_id] = std::make_shared<execType>();
-        exec_map[model_id]->inference_set.resize(0);  // equals to clear()
-        exec_map[model_id]->inference_set.resize(num);
-        exec_map[model_id]->n_inference = num;
+    ModelShard &GetShard(idType model_id) {
+        auto key = static_cast<uint64_t>(model_id);
+        return model_shards[((key ^ (key >> 32)) * 0x9E3779B97F4A7C15ULL >> 32) % MODEL_SHARD_NUM];
+    }
+
+    std::shared_ptr<ModelData> FindModel(idType model_id) {
+        auto &shard = GetShard(model_id);
+        std::shared_lock<std::shared_mutex> guard(shard.mutex);
+        auto iter = shard.models.find(model_id);
+        return (iter == shard.models.end()) ? nullptr : iter->second;
+    }
+
+    template <typename Func> void ForEachModel(Func func) {
+        for (auto &shard : model_shards) {
+            std::shared_lock<std::shared_mutex> shard_guard(shard.mutex);
+            for (auto &model_ele : shard.models) {
+                std::shared_lock<std::shared_mutex> guard(model_ele.second->mutex);
+                func(model_ele.first, *model_ele.second);
+            }
+        }
+    }
+
+    static uint64_t GetDirIndexKey(uint32_t dir, int32_t index) {
+        return (static_cast<uint64_t>(dir) << 32) | static_cast<uint32_t>(index);
+    }
+
+    // NOTE: The first buffer is taken if labels or {dir, index} are duplicated, as the buffers were scanned before.
+    void BuildBufferIndex(ModelData &model) {
+        model.label_index.clear();
+        model.dir_index.clear();
+        model.n_in_buf = 0;
+        model.n_out_buf = 0;
+        const auto &buffers = model.session->buffers;
+        model.label_index.reserve(buffers.size());
+        model.dir_index.reserve(buffers.size());
+        for (size_t i = 0; i < buffers.size(); i++) {
+            model.label_index.emplace(std::string_view(buffers[i].name.c_str()), i);
+            model.dir_index.emplace(GetDirIndexKey(static_cast<uint32_t>(buffers[i].dir), buffers[i].buf_index), i);
+            if (static_cast<enn_buf_dir_e>(buffers[i].dir) == ENN_DIR_IN)
+                model.n_in_buf++;
+            if (static_cast<enn_buf_dir_e>(buffers[i].dir) == ENN_DIR_OUT)
+                model.n_out_buf++;
+        }
+    }
+
+    template <typename KeyType> const Buffer *FindBufferInModel(const ModelData &model, const KeyType &key) {
+        if constexpr (std::is_same<KeyType, std::string>::value || std::is_same<KeyType, std::string_view>::value) {
+            auto iter = model.label_index.find(std::string_view(key));
+            if (iter != model.label_index.end())
+                return &model.session->buffers[iter->second];
+        } else if constexpr (std::is_same<KeyType, std::tuple<uint32_t, int32_t>>::value) {
+            auto iter = model.dir_index.find(GetDirIndexKey(std::get<0>(key), std::get<1>(key)));
+            if (iter != model.dir_index.end())
+                return &model.session->buffers[iter->second];
+        } else {
+            ENN_WARN_PRINT("Cannot process with the parameter type\n");
+        }
+        return nullptr;
+    }
+
+    EnnReturn GenerateInferenceSet(ModelData &model, idType model_id, int32_t num) {
+        const auto &session_buf = model.session;
+        model.exec = std::make_shared<execType>();
+        model.exec->inference_set.resize(0);  // equals to clear()
+        model.exec->inference_set.resize(num);
+        model.exec->n_inference = num;
 
         ENN_INFO_PRINT("Model_id: 0x%" PRIX64 ", num: %d\n", model_id, num);
 
         // NOTE(hoon98.choi): Because inference_set class is auto-generated by HIDL,
         //                    This object should be initialized here.
         for (int i = 0; i < num; i++) {
-            auto & inf_set = (exec_map[model_id]->inference_set)[i];
+            auto & inf_set = (model.exec->inference_set)[i];
             inf_set.n_region = session_buf->regions.size();
             inf_set.is_commit = false;
             inf_set.inference_data.resize(session_buf->regions.size());
@@ -515,15 +633,14 @@ template <typename idType, typename sessionType, typename execType, typename Inf
         return setInferenceData(inf_data, select_buffer->region_idx, mem_object);
     }
 
-    EnnReturn CheckReadyToSetExec(idType model_id, int32_t session_id) {
-        CHECK_AND_RETURN_ERR(GetSession(model_id) == nullptr, ENN_RET_INVAL,
+    // NOTE: called with the lock of the model held
+    EnnReturn CheckReadyToSetExec(const ModelData &model, idType model_id, int32_t session_id) {
+        CHECK_AND_RETURN_ERR(model.session == nullptr, ENN_RET_INVAL,
                              "Doesn't have any session data. openModel First.\n");
-        CHECK_AND_RETURN_ERR(!ENN_STL_ITER_IS_IN(session_map, model_id), ENN_RET_INVAL,
-                             "model_id(%" PRIX64 " doesn't have session map\n", model_id);
-        CHECK_AND_RETURN_ERR(!ENN_STL_ITER_IS_IN(exec_map, model_id), ENN_RET_INVAL,
+        CHECK_AND_RETURN_ERR(model.exec == nullptr, ENN_RET_INVAL,
                              "Inference data of model_id(0x%" PRIX64 ") is not generated!\n", model_id);
-        CHECK_AND_RETURN_ERR((exec_map[model_id]->n_inference) <= session_id, ENN_RET_INVAL,
-                             "session_id(%d) should be in [0, %d]\n", session_id, exec_map[model_id]->n_inference - 1);
+        CHECK_AND_RETURN_ERR((model.exec->n_inference) <= session_id, ENN_RET_INVAL,
+                             "session_id(%d) should be in [0, %d]\n", session_id, model.exec->n_inference - 1);
 
         return ENN_RET_SUCCESS;
     }
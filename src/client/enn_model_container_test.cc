@@ -25,6 +25,11 @@
 
 #include <tuple>
 #include <string>
+#include <string_view>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <iostream>
 #include <stdio.h>
 
 #ifndef __ANDROID__
@@ -203,6 +208,30 @@ TEST_F(ENN_GT_MODEL_CONTAINER_TEST, container_set_inference_data_set_by_dir_and_
     EXPECT_EQ(container.SetInferenceData(1, 1, std::string("correctBuffer0"), mem_object.get()), ENN_RET_SUCCESS);
 }
 
+TEST_F(ENN_GT_MODEL_CONTAINER_TEST, container_find_buffer_by_label_and_index) {
+    const Buffer *buffer = nullptr;
+    EXPECT_EQ(container.FindBuffer(1, std::string_view("correctBuffer1"), &buffer), ENN_RET_SUCCESS);
+    ASSERT_NE(buffer, nullptr);
+    EXPECT_EQ(buffer->region_idx, 1);
+    EXPECT_EQ(container.FindBuffer(1, std::tuple<uint32_t, int32_t>(DirType::ENN_BUF_DIR_IN, 0), &buffer), ENN_RET_SUCCESS);
+    ASSERT_NE(buffer, nullptr);
+    EXPECT_EQ(buffer->name, "correctBuffer0");
+    // the first one is found if labels are duplicated, as with linear search
+    EXPECT_EQ(container.FindBuffer(1, std::string("buffer0"), &buffer), ENN_RET_SUCCESS);
+    EXPECT_EQ(buffer->buf_index, 0);
+    EXPECT_EQ(container.FindBuffer(1, std::string_view("noBuffer"), &buffer), ENN_RET_FAILED);
+    EXPECT_EQ(container.FindBuffer(1, std::tuple<uint32_t, int32_t>(DirType::ENN_BUF_DIR_OUT, 1), &buffer), ENN_RET_FAILED);
+    EXPECT_EQ(container.FindBuffer(2, std::string_view("correctBuffer1"), &buffer), ENN_RET_INVAL);
+
+    uint32_t n_in, n_out;
+    EXPECT_EQ(container.GetBufferInfo(1, &n_in, &n_out), ENN_RET_SUCCESS);
+    EXPECT_EQ(n_in, 1);
+    EXPECT_EQ(n_out, 1);
+
+    EXPECT_EQ(container.ClearModelData(1), ENN_RET_SUCCESS);
+    EXPECT_EQ(container.FindBuffer(1, std::string_view("correctBuffer1"), &buffer), ENN_RET_INVAL);
+}
+
 TEST_F(ENN_GT_MODEL_CONTAINER_TEST, container_set_inference_data_verify_failure_test) {
     // Default: Generate 2 inf_data at ModelID(1), clear and resize: Success
     EXPECT_EQ(container.GenerateInferenceData(1, 2), ENN_RET_SUCCESS);
@@ -580,3 +609,71 @@ TEST_F(ENN_GT_MODEL_CONTAINER_TEST2, multi_session_id_test) {
     EXPECT_EQ(container.VerifyInferenceData(2, 1), ENN_RET_SUCCESS);
 }
 
+
+/* Label lookups and buffer settings of threads, on a model of each thread or on a model shared by all threads */
+TEST(ENN_GT_MODEL_CONTAINER_BENCHMARK, DISABLED_benchmark_label_lookup_and_set_buffer) {
+    constexpr int kBufferNum = 64;
+    constexpr int kIteration = 200;
+    constexpr int kMaxThreadNum = 8;
+    /* logs of setting buffers would be measured otherwise */
+    auto &print_manager = enn::debug::DbgPrintManager::GetInstance();
+    const auto mask = print_manager.get_print_mask();
+    print_manager.set_mask(ZONE_BIT_MASK(enn::debug::DbgPartition::kError));
+
+    std::vector<std::string> labels;
+    for (int i = 0; i < kBufferNum; i++) labels.push_back("model/layer_" + std::to_string(i) + "/output_tensor");
+    auto make_session = [&](uint64_t model_id) {
+        auto session = std::make_shared<SessionBufInfo>();
+        session->model_id = model_id;
+        session->buffers.resize(kBufferNum);
+        session->regions.resize(kBufferNum);
+        for (int i = 0; i < kBufferNum; i++) {
+            session->buffers[i].region_idx = i;
+            session->buffers[i].dir = (i % 2 == 0) ? ENN_BUF_DIR_IN : ENN_BUF_DIR_OUT;
+            session->buffers[i].buf_index = i / 2;
+            session->buffers[i].size = 64;
+            session->buffers[i].offset = 0;
+            session->buffers[i].shape = {1, 4, 4, 4};
+            session->buffers[i].name = labels[i];
+            session->regions[i].req_size = 64;
+            session->regions[i].name = "region" + std::to_string(i);
+        }
+        return session;
+    };
+    char data[64];
+    EnnBufferCore mem_object{};
+    mem_object.va = reinterpret_cast<void *>(data);
+    mem_object.size = sizeof(data);
+
+    for (bool shared_model : {false, true}) {
+        for (int thread_num = 1; thread_num <= kMaxThreadNum; thread_num *= 2) {
+            enn::client::EnnModelContainer<uint64_t, SessionBufInfo, InferenceSet, InferenceData> container;
+            for (int t = 0; t < kMaxThreadNum; t++) {
+                ASSERT_EQ(container.SetSessionData(make_session(t + 1)), ENN_RET_SUCCESS);
+                ASSERT_EQ(container.GenerateInferenceData(t + 1, kMaxThreadNum), ENN_RET_SUCCESS);
+            }
+            auto start = std::chrono::steady_clock::now();
+            std::vector<std::thread> threads;
+            for (int t = 0; t < thread_num; t++) {
+                threads.emplace_back([&, t]() {
+                    const uint64_t model_id = shared_model ? 1 : t + 1;
+                    const Buffer *buffer = nullptr;
+                    for (int i = 0; i < kIteration; i++) {
+                        for (auto &label : labels) {
+                            EXPECT_EQ(container.FindBuffer(model_id, std::string_view(label), &buffer), ENN_RET_SUCCESS);
+                            EXPECT_EQ(container.SetInferenceData(model_id, t, std::string_view(label), &mem_object),
+                                      ENN_RET_SUCCESS);
+                        }
+                    }
+                });
+            }
+            for (auto &thread : threads) thread.join();
+            double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            std::cout << "[          ] " << (shared_model ? "shared model   " : "model of thread") << " threads "
+                      << thread_num << ": " << elapsed / (thread_num * kIteration * kBufferNum)
+                      << " ns per lookup and set" << std::endl;
+            EXPECT_EQ(container.VerifyInferenceData(1, 0), ENN_RET_SUCCESS);
+        }
+    }
+    print_manager.set_mask(mask);
+}
@@ -71,6 +71,8 @@ enum class CustomFunctionTypeId: uint32_t {
     SECURE_INITIALIZE = 11,
     SECURE_DEINITIALIZE = 12,
     GET_DEVICE_SW_VERSION = 13,
+    SET_EXECUTION_PIPELINE = 14,
+    GET_MODEL_STATISTICS = 15,
 };
 
 #endif  // SRC_COMMON_INCLUDE_ENN_COMMON_TYPE_H_
@@ -95,13 +95,15 @@ enn_print_with_check(const char *log_tag, DbgPartition zone, DbgPrintOption chec
 #ifdef ENN_BUILD_RELEASE
     if (check == DbgPrintOption::kEnnPrintRelease) return ENN_RET_FILTERED;
 #endif
-    auto dbg_info = DbgPrintManager::GetInstance().get_debug_zone_info();
+    /* filtered before copying the zone info, as messages filtered are on hot paths such as memory allocation */
     auto print_mask = DbgPrintManager::GetInstance().get_print_mask();
+    if (check != DbgPrintOption::kEnnPrintFalse && !(print_mask & ZONE_BIT(static_cast<uint64_t>(zone))))
+        return ENN_RET_FILTERED; /* filtered */
+
+    auto dbg_info = DbgPrintManager::GetInstance().get_debug_zone_info();
     char string[MAX_PRINT_LINE];
 
     if (dbg_info.find(zone) == dbg_info.end()) return ENN_RET_FILTERED;
-    if (check != DbgPrintOption::kEnnPrintFalse && !(print_mask & ZONE_BIT(static_cast<uint64_t>(zone))))
-        return ENN_RET_FILTERED; /* filtered */
 
     va_list ap;
     va_start(ap, format);
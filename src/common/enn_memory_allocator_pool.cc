@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2021 Samsung Electronics Co. LTD
+ *
+ * This software is proprietary of Samsung Electronics.
+ * No part of this software, either material or conceptual may be copied or
+ * distributed, transmitted, transcribed, stored in a retrieval system or
+ * translated into any human or computer language in any form by any means,
+ * electronic, mechanical, manual or otherwise, or disclosed to third parties
+ * without the express written permission of Samsung Electronics.
+ */
+
+#include "common/enn_memory_allocator_pool.h"
+
+#include <cinttypes>
+#include <cstring>
+#include <iterator>
+
+namespace enn {
+
+EnnMemoryAllocatorPool::EnnMemoryAllocatorPool(std::unique_ptr<EnnMemoryAllocator> allocator_, uint64_t high_water_)
+    : allocator(std::move(allocator_)), high_water(high_water_), cached_size(0) {
+}
+
+EnnMemoryAllocatorPool::~EnnMemoryAllocatorPool() {
+    Trim();
+    for (auto &size_class : size_classes) {
+        std::lock_guard<std::mutex> guard(size_class.mutex);
+        for (auto &used : size_class.used) {
+            ENN_WARN_PRINT("Memory(%p) is released while in use\n", used.first);
+            Release(used.second);
+        }
+        size_class.used.clear();
+    }
+}
+
+uint32_t EnnMemoryAllocatorPool::GetSizeClass(uint32_t size) {
+    if (size <= (1u << SIZE_CLASS_MIN_BITS)) {
+        return 0;
+    }
+    const uint32_t value = size - 1;
+    const uint32_t bits = 31 - __builtin_clz(value);
+    if (bits >= SIZE_CLASS_MAX_BITS) {
+        return SIZE_CLASS_NUM;
+    }
+    const uint32_t sub = (value >> (bits - SIZE_CLASS_SUB_BITS)) & BIT_MASK(SIZE_CLASS_SUB_BITS);
+    return ((bits - SIZE_CLASS_MIN_BITS) << SIZE_CLASS_SUB_BITS) + sub + 1;
+}
+
+uint32_t EnnMemoryAllocatorPool::GetClassSize(uint32_t size_class) {
+    if (size_class == 0) {
+        return 1u << SIZE_CLASS_MIN_BITS;
+    }
+    const uint32_t bits = ((size_class - 1) >> SIZE_CLASS_SUB_BITS) + SIZE_CLASS_MIN_BITS;
+    const uint32_t sub = (size_class - 1) & BIT_MASK(SIZE_CLASS_SUB_BITS);
+    return ((1u << SIZE_CLASS_SUB_BITS) + sub + 1) << (bits - SIZE_CLASS_SUB_BITS);
+}
+
+std::shared_ptr<EnnBufferCore> EnnMemoryAllocatorPool::CreateMemory(uint32_t size, enn::EnnMmType type, uint32_t flag) {
+    const uint32_t size_class = GetSizeClass(size);
+    if (size_class == SIZE_CLASS_NUM) {
+        return allocator->CreateMemory(size, type, flag);
+    }
+
+    auto &pool = size_classes[size_class];
+    std::shared_ptr<EnnBufferCore> recycled;
+    {
+        std::lock_guard<std::mutex> guard(pool.mutex);
+        for (auto iter = pool.idle.rbegin(); iter != pool.idle.rend(); ++iter) {
+            if (iter->flag != flag) {
+                continue;
+            }
+            recycled = HandOut(*iter, size);
+            pool.used.emplace(recycled->va, std::move(*iter));
+            pool.idle.erase(std::next(iter).base());
+            cached_size.fetch_sub(GetClassSize(size_class), std::memory_order_relaxed);
+            break;
+        }
+    }
+    if (recycled != nullptr) {
+        /* cleared out of the lock, not to leak the data of the previous owner */
+        std::memset(recycled->va, 0, size);
+        return recycled;
+    }
+
+    /* allocates out of the lock, as allocators have their own */
+    Block block{allocator->CreateMemory(GetClassSize(size_class), type, flag), flag};
+    CHECK_AND_RETURN_ERR(block.memory == nullptr, nullptr, "Failed to allocate memory of class %u(%u)\n", size_class,
+                         GetClassSize(size_class));
+    auto buffer = HandOut(block, size);
+    {
+        std::lock_guard<std::mutex> guard(pool.mutex);
+        pool.used.emplace(buffer->va, std::move(block));
+    }
+    return buffer;
+}
+
+EnnReturn EnnMemoryAllocatorPool::DeleteMemory(std::shared_ptr<EnnBufferCore> buffer) {
+    CHECK_AND_RETURN_ERR(buffer == nullptr, ENN_RET_FAILED, "Parameter Buffer is nullptr\n");
+    const uint32_t size_class = GetSizeClass(buffer->size);
+    if (size_class == SIZE_CLASS_NUM) {
+        return allocator->DeleteMemory(buffer);
+    }
+
+    auto &pool = size_classes[size_class];
+    std::unique_lock<std::mutex> lock(pool.mutex);
+    auto iter = pool.used.find(buffer->va);
+    if (iter == pool.used.end()) {
+        lock.unlock();
+        /* not allocated by the pool, such as imported memory */
+        return allocator->DeleteMemory(buffer);
+    }
+    Block block = std::move(iter->second);
+    pool.used.erase(iter);
+    EnnMemoryReset(buffer);
+
+    const uint64_t class_size = GetClassSize(size_class);
+    if (cached_size.load(std::memory_order_relaxed) + class_size <= high_water) {
+        cached_size.fetch_add(class_size, std::memory_order_relaxed);
+        pool.idle.push_back(std::move(block));
+        return ENN_RET_SUCCESS;
+    }
+    lock.unlock();
+
+    ENN_MEM_PRINT("Memory pool is over high water(%" PRIu64 "), release class %u\n", high_water, size_class);
+    Release(block);
+    return ENN_RET_SUCCESS;
+}
+
+EnnReturn EnnMemoryAllocatorPool::EnnMemoryReset(std::shared_ptr<EnnBufferCore> buffer) {
+    /* detaches the object handed out from the memory, which stays in the pool */
+    buffer->va = nullptr;
+    buffer->base_va = nullptr;
+    buffer->fd = ENN_MM_FD_NOT_DEFINED;
+    buffer->s_va.reset();
+    buffer->status = enn::EnnBufferStatus::kEnnMmStatusFreed;
+#ifdef __ANDROID__
+    if (buffer->ntv_handle != nullptr) {
+        native_handle_delete(buffer->ntv_handle);  // fd is owned by the memory of the pool
+        buffer->ntv_handle = nullptr;
+    }
+#endif
+
+    return ENN_RET_SUCCESS;
+}
+
+void EnnMemoryAllocatorPool::Trim() {
+    for (uint32_t size_class = 0; size_class < SIZE_CLASS_NUM; ++size_class) {
+        std::vector<Block> idle;
+        {
+            std::lock_guard<std::mutex> guard(size_classes[size_class].mutex);
+            idle.swap(size_classes[size_class].idle);
+        }
+        for (auto &block : idle) {
+            Release(block);
+        }
+        cached_size.fetch_sub(idle.size() * GetClassSize(size_class), std::memory_order_relaxed);
+    }
+}
+
+std::shared_ptr<EnnBufferCore> EnnMemoryAllocatorPool::HandOut(const Block &block, uint32_t size) {
+    const auto &memory = block.memory;
+    auto buffer = std::make_shared<EnnBufferCore>();
+    buffer->va = memory->va;
+    buffer->size = size;
+    buffer->offset = memory->offset;
+    buffer->type = memory->type;
+    buffer->fd = memory->fd;
+    buffer->base_va = memory->base_va;
+    buffer->cache_flag = block.flag;
+    buffer->status = memory->status;
+    /* keeps the memory object of the pool while handed out */
+    buffer->s_va = std::shared_ptr<char>(memory, reinterpret_cast<char *>(memory->va));
+#ifdef __ANDROID__
+    if (memory->ntv_handle != nullptr) {
+        buffer->SetNativeHandle(memory->fd);
+    }
+#endif
+
+    return buffer;
+}
+
+void EnnMemoryAllocatorPool::Release(Block &block) {
+    void *va = block.memory->va;
+    if (allocator->DeleteMemory(block.memory) != ENN_RET_SUCCESS) {
+        ENN_WARN_PRINT("Failed to release memory(%p) of pool\n", va);
+    }
+    block.memory.reset();
+}
+
+}  // namespace enn
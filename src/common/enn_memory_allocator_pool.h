@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2021 Samsung Electronics Co. LTD
+ *
+ * This software is proprietary of Samsung Electronics.
+ * No part of this software, either material or conceptual may be copied or
+ * distributed, transmitted, transcribed, stored in a retrieval system or
+ * translated into any human or computer language in any form by any means,
+ * electronic, mechanical, manual or otherwise, or disclosed to third parties
+ * without the express written permission of Samsung Electronics.
+ */
+
+#ifndef SRC_COMMON_INCLUDE_ENN_MEMORY_ALLOCATOR_POOL_H_
+#define SRC_COMMON_INCLUDE_ENN_MEMORY_ALLOCATOR_POOL_H_
+
+/**
+ * @brief Memory management modules
+ *
+ * @file enn_memory_allocator_pool.h
+ * @date 2021-09-13
+ */
+
+#include <cstdint>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <unordered_map>
+
+#include "common/enn_debug.h"
+#include "common/enn_utils.h"
+#include "common/enn_memory_manager-type.h"
+#include "common/enn_memory_allocator.h"
+
+namespace enn {
+
+/**
+ * @brief Allocator caching memory of another allocator in size classes
+ *
+ * Requested sizes are rounded up to a size class, 4 classes per power of two from 256 bytes to 16 MB,
+ * and freed memory is kept in the recycle list of its class and flag to serve the next request of the class,
+ * as long as idle memory is under high water. Memory served again is cleared, as it may have been of another client.
+ * Each class has its own lock, so that requests of different classes do not contend.
+ * Each request gets a new memory object referring to the cached memory, which is detached when freed.
+ * Sizes above the classes are passed through to the allocator.
+ */
+class EnnMemoryAllocatorPool : public EnnMemoryAllocator {
+public:
+    static constexpr uint32_t SIZE_CLASS_MIN_BITS = 8;
+    static constexpr uint32_t SIZE_CLASS_MAX_BITS = 24;
+    static constexpr uint32_t SIZE_CLASS_SUB_BITS = 2;
+    static constexpr uint32_t SIZE_CLASS_NUM = ((SIZE_CLASS_MAX_BITS - SIZE_CLASS_MIN_BITS) << SIZE_CLASS_SUB_BITS) + 1;
+
+    /* high_water: bytes of idle memory kept for reuse, above which freed memory is released to the allocator */
+    EnnMemoryAllocatorPool(std::unique_ptr<EnnMemoryAllocator> allocator, uint64_t high_water);
+    virtual ~EnnMemoryAllocatorPool();
+
+    std::shared_ptr<EnnBufferCore> CreateMemory(uint32_t size, enn::EnnMmType type, uint32_t flag);
+    EnnReturn DeleteMemory(std::shared_ptr<EnnBufferCore> buffer);
+    EnnReturn EnnMemoryReset(std::shared_ptr<EnnBufferCore> buffer);
+
+    /* release idle memory to the allocator */
+    void Trim();
+    uint64_t GetCachedSize() const { return cached_size.load(std::memory_order_relaxed); }
+
+    /* returns SIZE_CLASS_NUM if the size is not pooled */
+    static uint32_t GetSizeClass(uint32_t size);
+    static uint32_t GetClassSize(uint32_t size_class);
+
+private:
+    struct Block {
+        std::shared_ptr<EnnBufferCore> memory;  // allocated with the size of the class
+        uint32_t flag;
+    };
+
+    struct SizeClass {
+        std::mutex mutex;
+        std::vector<Block> idle;                  // recycle list, reused from the most recent
+        std::unordered_map<void *, Block> used;  // handed out, by va
+    };
+
+    std::shared_ptr<EnnBufferCore> HandOut(const Block &block, uint32_t size);
+    void Release(Block &block);
+
+    std::unique_ptr<EnnMemoryAllocator> allocator;
+    const uint64_t high_water;
+    std::atomic<uint64_t> cached_size;
+    SizeClass size_classes[SIZE_CLASS_NUM];
+};
+
+}  // namespace enn
+#endif  // SRC_COMMON_INCLUDE_ENN_MEMORY_ALLOCATOR_POOL_H_
@@ -63,6 +63,7 @@ enum class EnnMmType {
     kEnnMmTypeExternalIon,
     kEnnMmTypeCloned,
     kEnnMmTypeHeap,
+    kEnnMmTypeMapped,  // refers to a mapped file in place
     kEnnMmTypeExternalMax,
 };
 
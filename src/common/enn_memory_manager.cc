@@ -12,7 +12,7 @@
 #include "common/enn_memory_manager.h"
 #include "common/enn_debug.h"
 
-#include <algorithm>
+#include <cinttypes>
 
 namespace enn {
 
@@ -25,21 +25,36 @@ EnnMemoryManager::EnnMemoryManager() {
 
 EnnMemoryManager::~EnnMemoryManager() {
     ENN_DBG_PRINT("(-)\n");
-    if (memory_pool.size() != 0) {
+    if (GetMemoryNum() != 0) {
         ENN_WARN_PRINT("deinit() of Memory Manager is not called\n");
         deinit();
     }
 }
 
 EnnReturn EnnMemoryManager::init() {
+    uint64_t cache_high_water = 0;
+    if (enn::util::get_environment_property(ENN_MEMORY_POOL_HIGH_WATER_PROPERTY, &cache_high_water) ==
+        ENN_RET_SUCCESS) {
+        ENN_INFO_PRINT("%s = %" PRIu64 "\n", ENN_MEMORY_POOL_HIGH_WATER_PROPERTY, cache_high_water);
+    }
+    return init(cache_high_water);
+}
+
+EnnReturn EnnMemoryManager::init(uint64_t cache_high_water) {
     std::lock_guard<std::mutex> guard(mm_mutex);
 
     /* initialize member variables */
 #ifdef __ANDROID__
-    emm_allocator = std::make_unique<enn::EnnMemoryAllocatorDeviceBuffer>();  // Allocator can be changed in build time
+    auto allocator = std::make_unique<enn::EnnMemoryAllocatorDeviceBuffer>();  // Allocator can be changed in build time
 #else
-    emm_allocator = std::make_unique<enn::EnnMemoryAllocatorHeap>();
+    auto allocator = std::make_unique<enn::EnnMemoryAllocatorHeap>();
 #endif
+    /* without cache, sizes are not rounded up to the classes and no bookkeeping of the pool is paid */
+    if (cache_high_water > 0) {
+        emm_allocator = std::make_unique<enn::EnnMemoryAllocatorPool>(std::move(allocator), cache_high_water);
+    } else {
+        emm_allocator = std::move(allocator);
+    }
     return (emm_allocator != nullptr) ? ENN_RET_SUCCESS : ENN_RET_FAILED;
 }
 
@@ -48,22 +63,30 @@ EnnReturn EnnMemoryManager::deinit() {
     /* NOTE(hoon98.choi): lock_guard should be set in API level */
     CHECK_AND_RETURN_ERR(GetAllocator() == nullptr, ENN_RET_FAILED, "Emm_allocator is not set\n");
     int try_max = TRY_DEINIT_POOL_MAX;
-    while (memory_pool.size() > 0 && (--try_max) > 0) {
-        ENN_MEM_PRINT("MemoryPool has %zu non-freed buffers(smart_ptr). Please check.\n", memory_pool.size());
-        auto &buf = memory_pool[0];
+    size_t memory_num;
+    while ((memory_num = GetMemoryNum()) > 0 && (--try_max) > 0) {
+        ENN_MEM_PRINT("MemoryPool has %zu non-freed buffers(smart_ptr). Please check.\n", memory_num);
+        std::vector<std::shared_ptr<EnnBufferCore>> buffers;
+        for (auto &shard : memory_index) {
+            std::lock_guard<std::mutex> guard(shard.mutex);
+            for (auto &entry : shard.memory_objects) buffers.push_back(entry.second);
+        }
         ENN_MEM_PRINT("Buffers to be removed: \n");
-        buf->show();
-        DeleteMemory(buf);
+        for (auto &buf : buffers) {
+            buf->show();
+            DeleteMemory(buf);
+        }
+    }
+    emm_allocator = nullptr;  // releases memory cached
+    for (auto &shard : memory_index) {
+        std::lock_guard<std::mutex> guard(shard.mutex);
+        shard.memory_objects.clear();
     }
-    emm_allocator = nullptr;
-    memory_pool.clear();
 
     return ENN_RET_SUCCESS;
 }
 
 std::shared_ptr<EnnBufferCore> EnnMemoryManager::CreateMemory(int32_t size, enn::EnnMmType type, uint32_t flag) {
-    std::lock_guard<std::mutex> guard(mm_mutex);
-
     CHECK_AND_RETURN_ERR(GetAllocator() == nullptr, mem_obj(), "Emm_allocator is not set\n");
     auto ebc = GetAllocator()->CreateMemory(size, type, flag);
 
@@ -71,13 +94,12 @@ std::shared_ptr<EnnBufferCore> EnnMemoryManager::CreateMemory(int32_t size, enn:
 
     /* generate magic and update magic */
     GenerateMagic(ebc->va, ebc->size, ebc->offset, &(ebc->magic));
-    memory_pool.push_back(ebc);
+    AddToIndex(ebc);
 
     return ebc;
 }
 
 std::shared_ptr<EnnBufferCore> EnnMemoryManager::CreateMemoryObject(fd_type fd, uint32_t size, void *va, uint32_t offset) {
-    std::lock_guard<std::mutex> guard(mm_mutex);
     ENN_MEM_PRINT("Create Memory Object with fd(%d), size(%d), va(%p)\n", fd, size, va);
     auto ebc = std::make_shared<EnnBufferCore>(reinterpret_cast<void *>(reinterpret_cast<char *>(va) + offset),
                                                EnnMmType::kEnnMmTypeCloned, size, fd, ION_FLAG_CACHED, va, offset);
@@ -85,7 +107,22 @@ std::shared_ptr<EnnBufferCore> EnnMemoryManager::CreateMemoryObject(fd_type fd,
 
     /* generate magic and update magic */
     GenerateMagic(ebc->va, ebc->size, ebc->offset, &(ebc->magic));
-    memory_pool.push_back(ebc);
+    AddToIndex(ebc);
+
+    return ebc;
+}
+
+std::shared_ptr<EnnBufferCore> EnnMemoryManager::CreateMemoryFromMapping(std::shared_ptr<char> mapping, uint32_t size,
+                                                                        uint32_t offset) {
+    CHECK_AND_RETURN_ERR(mapping == nullptr, mem_obj(), "Mapping is nullptr\n");
+    ENN_MEM_PRINT("Create Memory Object from mapping(%p) with size(%d), offset(%d)\n", mapping.get(), size, offset);
+    auto ebc = std::make_shared<EnnBufferCore>(reinterpret_cast<void *>(mapping.get() + offset), size, mapping, offset);
+    CHECK_AND_RETURN_ERR(ebc == nullptr, mem_obj(), "Memory Allocation Err\n");
+    ebc->type = EnnMmType::kEnnMmTypeMapped;
+
+    /* generate magic and update magic */
+    GenerateMagic(ebc->va, ebc->size, ebc->offset, &(ebc->magic));
+    AddToIndex(ebc);
 
     return ebc;
 }
@@ -94,14 +131,17 @@ EnnReturn EnnMemoryManager::DeleteMemory(EnnBuffer *raw_buffer) {
     CHECK_AND_RETURN_ERR(raw_buffer == nullptr, ENN_RET_FAILED, "Parameter Buffer is nullptr\n");
     std::shared_ptr<EnnBufferCore> buffer = nullptr;
     {
-        std::lock_guard<std::mutex> guard(mm_mutex);
-        for (auto &buf : memory_pool) {
-            if (buf->va == raw_buffer->va && buf->size == raw_buffer->size && buf->offset == raw_buffer->offset) {
+        auto &shard = GetShard(raw_buffer->va);
+        std::lock_guard<std::mutex> guard(shard.mutex);
+        auto range = shard.memory_objects.equal_range(raw_buffer->va);
+        for (auto iter = range.first; iter != range.second; ++iter) {
+            auto &buf = iter->second;
+            if (buf->size == raw_buffer->size && buf->offset == raw_buffer->offset) {
                 buffer = buf;
             }
         }
     }
-    CHECK_AND_RETURN_WARN(raw_buffer == nullptr, ENN_RET_FAILED, "There's no buffer in memory pool(%p, %d, %d)\n",
+    CHECK_AND_RETURN_WARN(buffer == nullptr, ENN_RET_FAILED, "There's no buffer in memory pool(%p, %d, %d)\n",
                           raw_buffer->va, raw_buffer->size, raw_buffer->offset);
     return DeleteMemory(buffer);
 }
@@ -125,20 +165,22 @@ EnnReturn EnnMemoryManager::DeleteMemory(std::shared_ptr<EnnBufferCore> buffer)
         ENN_MEM_PRINT("Magic: %X = %X, passed\n", out, buffer->magic);
     }
 
-    {
-        std::lock_guard<std::mutex> guard(mm_mutex);
-        auto iter = std::find(memory_pool.begin(), memory_pool.end(), buffer);
-        if (iter == memory_pool.end()) {
-            ENN_WARN_PRINT("Buffer %p is not in memory pool!\n", buffer->va);
-        } else {
-            memory_pool.erase(iter);
-        }
+    if (!RemoveFromIndex(buffer)) {
+        ENN_WARN_PRINT("Buffer %p is not in memory pool!\n", buffer->va);
     }
 
     if (buffer->type == enn::EnnMmType::kEnnMmTypeCloned) {
         return result;
     }
 
+    if (buffer->type == enn::EnnMmType::kEnnMmTypeMapped) {
+        // The mapping is unmapped when the last memory object sharing it is deleted.
+        buffer->va = nullptr;
+        buffer->s_va.reset();
+        buffer->status = enn::EnnBufferStatus::kEnnMmStatusFreed;
+        return result;
+    }
+
     auto result_dm = GetAllocator()->DeleteMemory(buffer);
 
     return result == ENN_RET_SUCCESS ? result_dm : result;
@@ -151,8 +193,6 @@ std::shared_ptr<EnnBufferCore> EnnMemoryManager::CreateMemoryFromFd(fd_type fd,
 
 std::shared_ptr<EnnBufferCore> EnnMemoryManager::CreateMemoryFromFdWithOffset(fd_type fd, uint32_t size, uint32_t offset,
                                                                               const native_handle_t *_handle) {
-    std::lock_guard<std::mutex> guard(mm_mutex);
-
     void *va = mmap(NULL, size + offset, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
     if ((void *)-1 == va) {
         ENN_ERR_PRINT(" MMAP(%d ++ %d) occurs an error (%d): pid(%d), fd(%d)\n", size, offset, errno, enn::util::get_pid(),
@@ -174,7 +214,7 @@ std::shared_ptr<EnnBufferCore> EnnMemoryManager::CreateMemoryFromFdWithOffset(fd
 
     /* generate magic and update magic */
     GenerateMagic(ebc->va, ebc->size, ebc->offset, &(ebc->magic));
-    memory_pool.push_back(ebc);
+    AddToIndex(ebc);
 
     return ebc;
 }
@@ -192,12 +232,42 @@ EnnReturn EnnMemoryManager::GetMemoryMeta(const std::shared_ptr<EnnBufferCore> &
 
 /* for debug */
 EnnReturn EnnMemoryManager::ShowMemoryPool(void) {
-    std::lock_guard<std::mutex> guard(mm_mutex);
-    ENN_MEM_PRINT(" # memory pool has %zu element(s). \n", memory_pool.size());
-    for (auto &buf : memory_pool) { buf->show(); }
+    ENN_MEM_PRINT(" # memory pool has %zu element(s). \n", GetMemoryNum());
+    for (auto &shard : memory_index) {
+        std::lock_guard<std::mutex> guard(shard.mutex);
+        for (auto &entry : shard.memory_objects) { entry.second->show(); }
+    }
     return ENN_RET_SUCCESS;
 }
 
+size_t EnnMemoryManager::GetMemoryNum(void) {
+    size_t memory_num = 0;
+    for (auto &shard : memory_index) {
+        std::lock_guard<std::mutex> guard(shard.mutex);
+        memory_num += shard.memory_objects.size();
+    }
+    return memory_num;
+}
+
+void EnnMemoryManager::AddToIndex(const std::shared_ptr<EnnBufferCore> &buffer) {
+    auto &shard = GetShard(buffer->va);
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    shard.memory_objects.emplace(buffer->va, buffer);
+}
+
+bool EnnMemoryManager::RemoveFromIndex(const std::shared_ptr<EnnBufferCore> &buffer) {
+    auto &shard = GetShard(buffer->va);
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    auto range = shard.memory_objects.equal_range(buffer->va);
+    for (auto iter = range.first; iter != range.second; ++iter) {
+        if (iter->second == buffer) {
+            shard.memory_objects.erase(iter);
+            return true;
+        }
+    }
+    return false;
+}
+
 EnnReturn EnnMemoryManager::GenerateMagic(const void *va, const uint32_t size, const uint32_t offset, uint32_t *out) {
     CHECK_AND_RETURN_ERR(out == nullptr, ENN_RET_FAILED, "output ptr is nullptr\n");
     uint64_t par = ENN_MM_GEN_MAGIC(va, size, offset);
@@ -25,9 +25,11 @@
 #include <mutex>
 #include <atomic>
 #include <memory>
+#include <unordered_map>
 #include "common/enn_debug.h"
 #include "common/enn_utils.h"
 #include "common/ienn_memory_manager.hpp"
+#include "common/enn_memory_allocator_pool.h"
 
 #ifdef __ANDROID__
 #include "common/enn_memory_allocator_device_buffer.h"
@@ -37,6 +39,8 @@
 
 /* this is only for ion allocator */
 constexpr uint32_t ENN_ALLOC_FLAG_CACHED = ION_FLAG_CACHED;
+/* bytes of freed memory cached for reuse, see EnnMemoryManager::init() */
+constexpr char ENN_MEMORY_POOL_HIGH_WATER_PROPERTY[] = "vendor.enn.memory.pool_high_water";
 namespace enn {
 class EnnMemoryManager : public IEnnMemoryManager {
 public:
@@ -45,6 +49,10 @@ public:
     EnnMemoryManager();
     ~EnnMemoryManager();
 
+    /* memory freed is cached for reuse up to cache_high_water by the pool of size classes,
+     * and 0 allocates from the allocator directly without the pool */
+    EnnReturn init(uint64_t cache_high_water);
+    /* cache_high_water is read from ENN_MEMORY_POOL_HIGH_WATER_PROPERTY, 0 if not set */
     EnnReturn init();
     EnnReturn deinit();
 
@@ -52,6 +60,9 @@ public:
     EnnReturn DeleteMemory(std::shared_ptr<EnnBufferCore> buffer) override;
     EnnReturn DeleteMemory(EnnBuffer *raw_buffer);
     std::shared_ptr<EnnBufferCore> CreateMemoryObject(fd_type fd, uint32_t size, void *va, uint32_t offset = 0);
+    /* refers to [offset, offset + size) of the mapping in place, which is shared by the memory object */
+    std::shared_ptr<EnnBufferCore> CreateMemoryFromMapping(std::shared_ptr<char> mapping, uint32_t size,
+                                                           uint32_t offset = 0);
 #ifdef ENN_ANDROID_BUILD
     std::shared_ptr<EnnBufferCore> CreateMemoryFromFd(fd_type fd, uint32_t size, const native_handle_t *_handle = nullptr);
     std::shared_ptr<EnnBufferCore> CreateMemoryFromFdWithOffset(fd_type fd, uint32_t size, uint32_t offset,
@@ -72,14 +83,29 @@ public:
 
     /* for debug */
     EnnReturn ShowMemoryPool(void);
+    size_t GetMemoryNum(void);
 
 private:
     EnnMemoryAllocator *GetAllocator() {
         return emm_allocator.get();
     }
 
+    /* memory objects created are indexed by va in shards, so that threads of different buffers do not contend */
+    static constexpr size_t MEMORY_INDEX_SHARD_NUM = 16;
+    struct MemoryIndexShard {
+        std::mutex mutex;
+        std::unordered_multimap<const void *, std::shared_ptr<EnnBufferCore>> memory_objects;
+    };
+
+    MemoryIndexShard &GetShard(const void *va) {
+        auto key = reinterpret_cast<uintptr_t>(va);
+        return memory_index[((key >> 4) ^ (key >> 12)) % MEMORY_INDEX_SHARD_NUM];
+    }
+    void AddToIndex(const std::shared_ptr<EnnBufferCore> &buffer);
+    bool RemoveFromIndex(const std::shared_ptr<EnnBufferCore> &buffer);
+
     EnnReturn GenerateMagic(const void *va, const uint32_t size, const uint32_t offset, uint32_t *out);
-    std::vector<std::shared_ptr<EnnBufferCore>> memory_pool;
+    MemoryIndexShard memory_index[MEMORY_INDEX_SHARD_NUM];
     std::mutex mm_mutex;
     std::unique_ptr<EnnMemoryAllocator> emm_allocator;
 
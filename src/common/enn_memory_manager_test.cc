@@ -21,11 +21,21 @@
 #include "common/enn_debug.h"
 #include "common/enn_utils.h"
 #include "common/enn_memory_manager.h"
+#include "common/enn_utils_buffer.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
 
 namespace enn {
 namespace test {
 namespace internal {
 
+using mem_ptr = std::shared_ptr<EnnBufferCore>;
+
 class ENN_GT_UNITTEST_MEMORY : public testing::Test {};
 
 TEST_F(ENN_GT_UNITTEST_MEMORY, memory_alloc_dealloc_test) {
@@ -70,6 +80,221 @@ TEST_F(ENN_GT_UNITTEST_MEMORY, memory_alloc_dealloc_one_missing_test) {
     delete emm;
 }
 
+TEST_F(ENN_GT_UNITTEST_MEMORY, memory_from_mapping_test) {
+    const std::string filename = "mapping_test.bin";
+    {
+        std::ofstream file(filename, std::ios::binary);
+        for (int i = 0; i < 256; i++) file.put(static_cast<char>(i));
+    }
+    enn::EnnMemoryManager *emm = new enn::EnnMemoryManager();
+    emm->init();
+
+    std::shared_ptr<EnnBufferCore> test_mem1, test_mem2;
+    {
+        enn::util::MmapBufferReader reader(filename);
+        test_mem1 = emm->CreateMemoryFromMapping(reader.get_mapping(), 100, 50);
+        test_mem2 = emm->CreateMemoryFromMapping(reader.get_mapping(), 10, 0);
+    }
+    std::remove(filename.c_str());
+    ASSERT_NE(nullptr, test_mem1);
+    ASSERT_NE(nullptr, test_mem2);
+    EXPECT_EQ(test_mem1->type, enn::EnnMmType::kEnnMmTypeMapped);
+    EXPECT_EQ(test_mem1->size, 100);
+
+    /* Memory objects refer to the file in place after the reader is released */
+    for (int i = 0; i < 100; i++) EXPECT_EQ(reinterpret_cast<uint8_t *>(test_mem1->va)[i], i + 50);
+    EXPECT_EQ(nullptr, emm->CreateMemoryFromMapping(nullptr, 10, 0));
+
+    EXPECT_EQ(0, emm->DeleteMemory(test_mem1));
+    EXPECT_EQ(nullptr, test_mem1->s_va);
+    /* The mapping is still shared by test_mem2 */
+    EXPECT_EQ(reinterpret_cast<uint8_t *>(test_mem2->va)[9], 9);
+    EXPECT_EQ(0, emm->DeleteMemory(test_mem2));
+
+    delete emm;
+}
+
+TEST_F(ENN_GT_UNITTEST_MEMORY, memory_pool_size_class_test) {
+    uint32_t last_class = 0;
+    for (uint32_t size = 1; size <= (1u << EnnMemoryAllocatorPool::SIZE_CLASS_MAX_BITS); size += size / 7 + 1) {
+        uint32_t size_class = EnnMemoryAllocatorPool::GetSizeClass(size);
+        ASSERT_LT(size_class, EnnMemoryAllocatorPool::SIZE_CLASS_NUM);
+        EXPECT_LE(last_class, size_class);
+        uint32_t class_size = EnnMemoryAllocatorPool::GetClassSize(size_class);
+        EXPECT_LE(size, class_size);
+        if (size_class > 0) {
+            EXPECT_GT(size, EnnMemoryAllocatorPool::GetClassSize(size_class - 1));
+            EXPECT_LE(class_size - size, size / 4);  // 4 classes per power of two
+        }
+        last_class = size_class;
+    }
+    const uint32_t max_size = 1u << EnnMemoryAllocatorPool::SIZE_CLASS_MAX_BITS;
+    EXPECT_EQ(EnnMemoryAllocatorPool::GetClassSize(EnnMemoryAllocatorPool::SIZE_CLASS_NUM - 1), max_size);
+    EXPECT_EQ(EnnMemoryAllocatorPool::GetSizeClass(max_size + 1), EnnMemoryAllocatorPool::SIZE_CLASS_NUM);
+}
+
+TEST_F(ENN_GT_UNITTEST_MEMORY, memory_pool_recycle_test) {
+    enn::EnnMemoryManager emm;
+    emm.init(64 * 1024);
+
+    /* memory freed serves the next request of the class and flag */
+    auto test_mem1 = emm.CreateMemory(1000, enn::EnnMmType::kEnnMmTypeIon, 0);
+    ASSERT_NE(nullptr, test_mem1);
+    void *va = test_mem1->va;
+    for (int i = 0; i < 1000; i++) reinterpret_cast<char *>(va)[i] = static_cast<char>(i);
+    EXPECT_EQ(0, emm.DeleteMemory(reinterpret_cast<EnnBuffer *>(test_mem1->return_ptr())));
+    EXPECT_EQ(nullptr, test_mem1->va);
+    EXPECT_EQ(0u, emm.GetMemoryNum());
+
+    auto test_mem2 = emm.CreateMemory(900, enn::EnnMmType::kEnnMmTypeIon, 0);
+    ASSERT_NE(nullptr, test_mem2);
+    EXPECT_NE(test_mem1, test_mem2);
+    EXPECT_EQ(va, test_mem2->va);
+    EXPECT_EQ(900u, test_mem2->size);
+    /* data of the previous owner is cleared */
+    for (int i = 0; i < 900; i++) ASSERT_EQ(0, reinterpret_cast<char *>(va)[i]);
+    auto test_mem3 = emm.CreateMemory(900, enn::EnnMmType::kEnnMmTypeIon, ENN_ALLOC_FLAG_CACHED + 1);
+    ASSERT_NE(nullptr, test_mem3);
+    EXPECT_NE(va, test_mem3->va);
+    EXPECT_EQ(2u, emm.GetMemoryNum());
+
+    /* raw buffers are looked up by va, size and offset */
+    EnnBuffer wrong = {test_mem2->va, 1000, 0};
+    EXPECT_NE(0, emm.DeleteMemory(&wrong));
+    EXPECT_EQ(0, emm.DeleteMemory(reinterpret_cast<EnnBuffer *>(test_mem2->return_ptr())));
+    EXPECT_EQ(0, emm.DeleteMemory(test_mem3));
+    EXPECT_EQ(0u, emm.GetMemoryNum());
+    emm.deinit();
+}
+
+TEST_F(ENN_GT_UNITTEST_MEMORY, memory_pool_high_water_test) {
+    EnnMemoryAllocatorPool pool(std::make_unique<EnnMemoryAllocatorHeap>(), 2048);
+    std::vector<mem_ptr> buffers;
+    for (int i = 0; i < 3; i++) {
+        buffers.push_back(pool.CreateMemory(1024, enn::EnnMmType::kEnnMmTypeIon, 0));
+        ASSERT_NE(nullptr, buffers.back());
+    }
+    for (auto &buffer : buffers) EXPECT_EQ(0, pool.DeleteMemory(buffer));
+    /* the third is released over high water */
+    EXPECT_EQ(2048u, pool.GetCachedSize());
+
+    /* sizes over the classes are not cached */
+    const uint32_t max_size = 1u << EnnMemoryAllocatorPool::SIZE_CLASS_MAX_BITS;
+    auto large = pool.CreateMemory(max_size + 1, enn::EnnMmType::kEnnMmTypeIon, 0);
+    ASSERT_NE(nullptr, large);
+    EXPECT_EQ(0, pool.DeleteMemory(large));
+    EXPECT_EQ(2048u, pool.GetCachedSize());
+
+    pool.Trim();
+    EXPECT_EQ(0u, pool.GetCachedSize());
+}
+
+/* Churn of allocating and releasing buffers of a request, with and without the cache */
+TEST_F(ENN_GT_UNITTEST_MEMORY, DISABLED_benchmark_alloc_free_churn) {
+    const std::vector<uint32_t> sizes = {4 * 1024, 150 * 1024, 600, 32 * 1024, 224 * 224 * 3, 1001};
+    constexpr int kIteration = 1000;
+    /* logs of memory objects would be measured otherwise */
+    auto &print_manager = enn::debug::DbgPrintManager::GetInstance();
+    const auto mask = print_manager.get_print_mask();
+    print_manager.set_mask(ZONE_BIT_MASK(enn::debug::DbgPartition::kError));
+    for (uint64_t high_water : {static_cast<uint64_t>(0), static_cast<uint64_t>(32 * 1024 * 1024)}) {
+        for (int thread_num : {1, 2, 4, 8, 16}) {
+            enn::EnnMemoryManager emm;
+            emm.init(high_water);
+            auto start = std::chrono::steady_clock::now();
+            std::vector<std::thread> threads;
+            for (int t = 0; t < thread_num; t++) {
+                threads.emplace_back([&]() {
+                    std::vector<EnnBuffer *> buffers(sizes.size());
+                    for (int i = 0; i < kIteration; i++) {
+                        for (size_t idx = 0; idx < sizes.size(); idx++) {
+                            auto mem = emm.CreateMemory(sizes[idx], enn::EnnMmType::kEnnMmTypeIon, 0);
+                            ASSERT_NE(nullptr, mem);
+                            buffers[idx] = reinterpret_cast<EnnBuffer *>(mem->return_ptr());
+                        }
+                        for (auto buffer : buffers) EXPECT_EQ(0, emm.DeleteMemory(buffer));
+                    }
+                });
+            }
+            for (auto &thread : threads) thread.join();
+            double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            std::cout << "[          ] " << (high_water ? "cached  " : "uncached") << " threads " << thread_num << ": "
+                      << elapsed / (thread_num * kIteration * sizes.size()) << " ns per alloc/free" << std::endl;
+            EXPECT_EQ(0u, emm.GetMemoryNum());
+            emm.deinit();
+        }
+    }
+    print_manager.set_mask(mask);
+}
+
+/* Compare open latency and memory of loading a model by fread into allocated memory and mapping it in place */
+class ENN_GT_UNITTEST_MODEL_LOAD : public testing::Test {
+ protected:
+    void SetUp() override {
+        std::vector<char> chunk(1024 * 1024);
+        for (size_t i = 0; i < chunk.size(); i++) chunk[i] = static_cast<char>(i * 31);
+        std::ofstream file(filename, std::ios::binary);
+        for (size_t i = 0; i < model_size / chunk.size(); i++) file.write(chunk.data(), chunk.size());
+    }
+
+    void TearDown() override {
+        std::remove(filename.c_str());
+    }
+
+    /* RssAnon and RssFile in kB */
+    static std::pair<long, long> get_rss() {
+        std::ifstream status("/proc/self/status");
+        std::string line;
+        long anon = 0, file = 0;
+        while (std::getline(status, line)) {
+            if (line.compare(0, 8, "RssAnon:") == 0) anon = std::stol(line.substr(8));
+            if (line.compare(0, 8, "RssFile:") == 0) file = std::stol(line.substr(8));
+        }
+        return {anon, file};
+    }
+
+    /* Parser reads the whole model */
+    static uint64_t touch(const std::shared_ptr<EnnBufferCore> &mem) {
+        uint64_t sum = 0;
+        for (uint32_t i = 0; i < mem->size; i += 4096) sum += reinterpret_cast<uint8_t *>(mem->va)[i];
+        return sum;
+    }
+
+    template <typename Load>
+    void measure(const char *title, Load load) {
+        enn::EnnMemoryManager emm;
+        emm.init();
+        auto before = get_rss();
+        auto start = std::chrono::steady_clock::now();
+        auto mem = load(emm);
+        ASSERT_NE(nullptr, mem);
+        volatile uint64_t sum = touch(mem);
+        ENN_UNUSED(sum);
+        double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        auto after = get_rss();
+        std::cout << "[          ] " << title << ": open " << elapsed << " ms, RssAnon +" << (after.first - before.first)
+                  << " kB, RssFile +" << (after.second - before.second) << " kB" << std::endl;
+        emm.DeleteMemory(mem);
+        emm.deinit();
+    }
+
+    const std::string filename = "model_load_benchmark.bin";
+    const uint32_t model_size = 64 * 1024 * 1024;
+};
+
+TEST_F(ENN_GT_UNITTEST_MODEL_LOAD, DISABLED_benchmark_open_latency_and_rss) {
+    measure("fread to memory", [this](enn::EnnMemoryManager &emm) {
+        enn::util::FileBufferReader reader(filename);
+        auto mem = emm.CreateMemory(reader.get_size(), enn::EnnMmType::kEnnMmTypeIon, 0);
+        if (mem == nullptr || reader.copy_buffer(reinterpret_cast<char *>(mem->va), reader.get_size())) return mem_ptr();
+        return mem;
+    });
+    measure("mmap in place  ", [this](enn::EnnMemoryManager &emm) {
+        enn::util::MmapBufferReader reader(filename);
+        return emm.CreateMemoryFromMapping(reader.get_mapping(), reader.get_size());
+    });
+}
+
 /* CreateMemoryFromFd() is used in Android */
 #ifdef __ANDROID__
 TEST_F(ENN_GT_UNITTEST_MEMORY, android_memory_fd_import_test) {
@@ -11,6 +11,7 @@
 
 #include "common/enn_utils.h"
 #include "common/enn_utils_buffer.hpp"
+#include <cstdlib>
 #include <cstring>
 #include <sys/syscall.h>
 
@@ -117,9 +118,34 @@ EnnReturn get_environment_property(const std::string &prop_name, uint64_t *val)
         *val = ret;
         return ENN_RET_SUCCESS;
     }
-#else  // TODO(hoon98.choi, TBD): get environment variable in linux
-    ENN_UNUSED(prop_name);
-    ENN_UNUSED(val);
+#else
+    // Environment variable of the same name in linux, e.g. `env vendor.enn.xxx=1 <command>`
+    const char* env = std::getenv(prop_name.c_str());
+    if (env != nullptr && *env != '\0') {
+        char* end = nullptr;
+        uint64_t ret = std::strtoull(env, &end, 0);
+        if (*end == '\0') {
+            *val = ret;
+            return ENN_RET_SUCCESS;
+        }
+    }
+#endif
+    return ENN_RET_IO;
+}
+
+EnnReturn get_environment_property(const std::string &prop_name, std::string *val) {
+#ifdef __ANDROID__
+    char value[PROPERTY_VALUE_MAX];
+    if (property_get(prop_name.c_str(), value, "") > 0) {
+        *val = value;
+        return ENN_RET_SUCCESS;
+    }
+#else
+    const char* env = std::getenv(prop_name.c_str());
+    if (env != nullptr && *env != '\0') {
+        *val = env;
+        return ENN_RET_SUCCESS;
+    }
 #endif
     return ENN_RET_IO;
 }
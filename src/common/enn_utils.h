@@ -51,6 +51,7 @@ extern EnnReturn import_file_to_mem(const char *filename, char **result, uint32_
 extern EnnReturn get_file_size(const char *filename, uint32_t *out_size);
 extern EnnReturn memory_compare(const char *mem1, const char *mem2, size_t num);
 extern EnnReturn get_environment_property(const std::string & prop_name, uint64_t *val);
+extern EnnReturn get_environment_property(const std::string & prop_name, std::string *val);
 extern EnnReturn export_mem_to_file(const char *filename, const void *va, uint32_t size);
 extern void      show_raw_memory_to_hex(uint8_t *va, uint32_t size, const int line_max, const int32_t size_max = 0);
 
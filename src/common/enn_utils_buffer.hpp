@@ -13,9 +13,15 @@
 #define SRC_COMMON_ENN_UTILS_BUFFER_HPP_
 
 #include "common/enn_utils.h"
+#include <cstdint>
 #include <cstdio>
 #include <memory>
 #include <cstring>
+#include <string>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 namespace enn {
 namespace util {
@@ -63,6 +69,12 @@ class BufferReader {
         return ENN_RET_SUCCESS;
     }
 
+    // Return the whole content mapped in memory, which memory objects can share to refer the content in place.
+    //  nullptr if the reader cannot keep the content alive beyond itself.
+    virtual std::shared_ptr<char> get_mapping() {
+        return nullptr;
+    }
+
     virtual ~BufferReader() {}
 
   protected:
@@ -114,6 +126,51 @@ class FileBufferReader : public BufferReader {
     }
 };
 
+// MmapBufferReader maps the file instead of reading it with fread.
+//  The mapping is private(copy-on-write), so that writing to it never changes the file.
+//  It is unmapped after the reader and all memory objects sharing it by get_mapping() are released.
+class MmapBufferReader : public BufferReader {
+  public:
+    MmapBufferReader() = delete;
+    explicit MmapBufferReader(std::string filename) : _filename(filename) {
+        int fd = open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+        CHECK_AND_RETURN_VOID(fd < 0, "File open error(%s)\n", filename.c_str());
+        struct stat file_stat;
+        // The size of BufferReader is 32 bits.
+        if (fstat(fd, &file_stat) == 0 && file_stat.st_size > 0 && file_stat.st_size <= UINT32_MAX) {
+            size_t length = file_stat.st_size;
+            void *va = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            if (va != MAP_FAILED) {
+                _mapping = std::shared_ptr<char>(static_cast<char *>(va), [length](char *addr) { munmap(addr, length); });
+                BufferReader::_size = length;
+            }
+        }
+        close(fd);  // The mapping is still valid after the fd is closed.
+        ENN_INFO_COUT << "File " << filename << " mapped. (va: " << static_cast<void *>(_mapping.get())
+                      << ", size: " << _size << ")" << std::endl;
+    }
+
+    bool is_valid() {
+        return _mapping != nullptr;
+    }
+
+    EnnReturn copy_buffer(char *out_addr, uint32_t size = 0, uint32_t offset = 0) override {
+        if (BufferReader::copy_buffer(out_addr, size, offset)) return ENN_RET_INVAL;
+        if (size == 0) size = BufferReader::_size;
+
+        memcpy(out_addr, _mapping.get() + offset, size);
+        return ENN_RET_SUCCESS;
+    }
+
+    std::shared_ptr<char> get_mapping() override {
+        return _mapping;
+    }
+
+  private:
+    std::string _filename;
+    std::shared_ptr<char> _mapping;
+};
+
 class MemoryBufferReader : public BufferReader {
   public:
     MemoryBufferReader() = delete;
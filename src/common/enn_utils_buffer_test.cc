@@ -29,6 +29,11 @@ TEST_F(ENN_GT_UTIL_BUFFER_TEST, open_test_file_and_memory_load_and_check_size) {
 
     EXPECT_EQ(memoryobject->get_size(), testinput_str.size());  // doesn't contain newline char
     EXPECT_EQ(fileobject->get_size(), testinput_str.size() + 1);
+
+    enn::util::BufferReader::UPtrType mmapobject = std::make_unique<enn::util::MmapBufferReader>(filename);
+    EXPECT_TRUE(mmapobject->is_valid());
+    EXPECT_EQ(mmapobject->get_size(), testinput_str.size() + 1);
+    EXPECT_FALSE(enn::util::MmapBufferReader("not_exist.txt").is_valid());
 }
 
 TEST_F(ENN_GT_UTIL_BUFFER_TEST, open_test_load_to_buffer_full_size) {
@@ -56,6 +61,25 @@ TEST_F(ENN_GT_UTIL_BUFFER_TEST, open_test_load_to_buffer_partial_compare) {
     fileobject->copy_buffer(out_test2, 10, 10);
 
     EXPECT_EQ(memcmp(out_test, out_test2, 10), 0);
+
+    char out_test3[100];
+    enn::util::BufferReader::UPtrType mmapobject = std::make_unique<enn::util::MmapBufferReader>(filename);
+    mmapobject->copy_buffer(out_test3, 10, 10);
+    EXPECT_EQ(memcmp(out_test, out_test3, 10), 0);
+}
+
+TEST_F(ENN_GT_UTIL_BUFFER_TEST, mapping_outlives_reader) {
+    std::shared_ptr<char> mapping;
+    {
+        enn::util::BufferReader::UPtrType mmapobject = std::make_unique<enn::util::MmapBufferReader>(filename);
+        mapping = mmapobject->get_mapping();
+    }
+    ASSERT_NE(mapping, nullptr);
+    EXPECT_EQ(memcmp(mapping.get(), testinput, testinput_str.size()), 0);
+
+    // Readers which cannot keep the content alive do not share it.
+    EXPECT_EQ(enn::util::FileBufferReader(filename).get_mapping(), nullptr);
+    EXPECT_EQ(enn::util::MemoryBufferReader(testinput, testinput_str.size()).get_mapping(), nullptr);
 }
 
 static void testCursor(std::unique_ptr<enn::util::BufferReader>& obj) {
@@ -83,6 +107,8 @@ static void testCursor(std::unique_ptr<enn::util::BufferReader>& obj) {
 TEST_F(ENN_GT_UTIL_BUFFER_TEST, test_cursor_set_get) {
     enn::util::BufferReader::UPtrType memoryobject = std::make_unique<enn::util::MemoryBufferReader>(testinput, testinput_str.size());
     enn::util::BufferReader::UPtrType fileObject = std::make_unique<enn::util::FileBufferReader>(filename);
+    enn::util::BufferReader::UPtrType mmapObject = std::make_unique<enn::util::MmapBufferReader>(filename);
     testCursor(memoryobject);
     testCursor(fileObject);
+    testCursor(mmapObject);
 }
@@ -14,6 +14,8 @@
 #include "client/enn_api-type.h"
 #include "client/enn_api.h"
 #include "common/enn_debug.h"
+#include "common/identifier_chopper.hpp"
+#include "runtime/metrics/model_statistics.hpp"
 
 #ifdef ENN_MEDIUM_IF_HIDL
 #include <hwbinder/IPCThreadState.h>
@@ -27,6 +29,7 @@ namespace interface {
 
 EnnMediumInterface::EnnMediumInterface() {
     HIDL_IF(service = IEnnInterface::getService());
+    HIDL_IF(async_executor = std::make_unique<::enn::runtime::execute::AsyncExecutor>());
     LIB_IF(service = ::enn::runtime::Engine::get_instance());
     CHECK_AND_RETURN_ERR(service == nullptr, , "Service is empty\n");
 }
@@ -164,5 +167,69 @@ EnnReturn EnnMediumInterface::execute_model(const std::vector<EnnModelId> & exec
     return static_cast<EnnReturn>(ret);
 }
 
+std::future<EnnReturn> EnnMediumInterface::execute_model_async(const std::vector<EnnModelId> & exec_id_list) {
+#ifdef ENN_MEDIUM_IF_HIDL
+    // The model id is used as a key so that executions of a model keep the requested order.
+    uint64_t key = util::chop_into_model_id(exec_id_list[0]);
+    {
+        std::lock_guard<std::mutex> guard(pipelined_models_mutex);
+        if (pipelined_models.count(key)) key = exec_id_list[0];
+    }
+    return async_executor->submit(key, [this, exec_id_list]() {
+        return execute_model(exec_id_list);
+    });
+#else
+    return service->execute_model_async(exec_id_list);
+#endif
+}
+
+EnnReturn EnnMediumInterface::set_execution_pipeline(const EnnModelId model_id, const uint32_t queue_depth) {
+    int32_t ret = ENN_RET_FAILED;
+    __START_SERVICE();
+#ifdef ENN_MEDIUM_IF_HIDL
+    uint32_t modelid_low = static_cast<uint32_t>(model_id >> 32);
+    uint32_t modelid_high = static_cast<uint32_t>(model_id & 0xFFFFFFFF);
+    service->custom_interface(static_cast<uint32_t>(CustomFunctionTypeId::SET_EXECUTION_PIPELINE),
+                              {{modelid_low, modelid_high, queue_depth}, {}},
+                              [&](GeneralParameterReturn ret_service) { ret = ret_service.i32_v[0]; });
+    if (ret == ENN_RET_SUCCESS) {
+        std::lock_guard<std::mutex> guard(pipelined_models_mutex);
+        if (queue_depth) pipelined_models.insert(model_id);
+        else pipelined_models.erase(model_id);
+    }
+#else
+    ret = service->set_execution_pipeline(model_id, queue_depth);
+#endif
+    __FINISH_SERVICE();
+    return static_cast<EnnReturn>(ret);
+}
+
+EnnReturn EnnMediumInterface::get_model_statistics(const EnnModelId model_id, EnnModelStatistics *statistics) {
+    int32_t ret = ENN_RET_FAILED;
+    __START_SERVICE();
+#ifdef ENN_MEDIUM_IF_HIDL
+    uint32_t modelid_low = static_cast<uint32_t>(model_id >> 32);
+    uint32_t modelid_high = static_cast<uint32_t>(model_id & 0xFFFFFFFF);
+    service->custom_interface(static_cast<uint32_t>(CustomFunctionTypeId::GET_MODEL_STATISTICS),
+                              {{modelid_low, modelid_high}, {}},
+                              [&](GeneralParameterReturn ret_service) {
+                                  if (ret_service.i32_v.size() == 0) {
+                                      ENN_ERR_PRINT("Empty return of get_model_statistics\n");
+                                      return;  // ret remains ENN_RET_FAILED
+                                  }
+                                  ret = ret_service.i32_v[0];
+                                  if (ret == ENN_RET_SUCCESS &&
+                                      !::enn::runtime::metrics::deserialize(ret_service.i32_v.data() + 1,
+                                                                            ret_service.i32_v.size() - 1, statistics)) {
+                                      ret = ENN_RET_FAILED;
+                                  }
+                              });
+#else
+    ret = service->get_model_statistics(model_id, statistics);
+#endif
+    __FINISH_SERVICE();
+    return static_cast<EnnReturn>(ret);
+}
+
 }  // namespace interface
 }  // namespace enn
@@ -21,7 +21,10 @@
 #define SRC_MEDIUM_ENN_MEDIUM_INTERFACE_H_
 
 #include <iostream>
+#include <future>
 #include <unordered_map>
+#include <unordered_set>
+#include <mutex>
 #include <vector>
 
 #include <unistd.h>
@@ -31,6 +34,7 @@
 #include "common/enn_debug.h"
 #include "common/enn_utils.h"
 #include "common/enn_memory_manager-type.h"
+#include "runtime/execute_request/async_executor.hpp"
 
 #ifdef ENN_MEDIUM_IF_HIDL
 #define HIDL_IF(st) st
@@ -97,6 +101,9 @@ public:
 
     EnnExecuteModelId commit_execution_data(const EnnModelId model_id, const InferenceData &);
     EnnReturn execute_model(const std::vector<EnnModelId> &);
+    std::future<EnnReturn> execute_model_async(const std::vector<EnnModelId> &);
+    EnnReturn set_execution_pipeline(const EnnModelId model_id, const uint32_t queue_depth);
+    EnnReturn get_model_statistics(const EnnModelId model_id, EnnModelStatistics *statistics);
 
     DeviceSessionID get_dsp_session_id(const EnnModelId model_id);
 
@@ -104,6 +111,12 @@ public:
     HIDL_IF(android::sp<IEnnInterface> service);
     HIDL_IF(android::sp<EnnCallback> enn_callback);
     HIDL_IF(android::sp<EnnCallback> cb_sp);
+    // Service call via HIDL is blocking, so asynchronous execution is driven by the worker pool of client.
+    HIDL_IF(std::unique_ptr<::enn::runtime::execute::AsyncExecutor> async_executor);
+    // Executions of pipelined models are keyed by session instead of model so that they can reach the service
+    //  concurrently, where the pipeline of the model keeps their order.
+    HIDL_IF(std::mutex pipelined_models_mutex);
+    HIDL_IF(std::unordered_set<EnnModelId> pipelined_models);
     LIB_IF(::enn::runtime::Engine *service);
 };
 
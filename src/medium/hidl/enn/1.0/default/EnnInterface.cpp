@@ -16,6 +16,7 @@
 #include "medium/enn_medium_interface.h"
 #include "medium/enn_medium_utils.hpp"
 #include "runtime/engine.hpp"
+#include "runtime/metrics/model_statistics.hpp"
 
 #include <hwbinder/IPCThreadState.h>
 
@@ -161,6 +162,24 @@ Return<void> EnnInterface::custom_interface(const uint32_t identifier,
         rettype.i32_v.resize(1);
         rettype.i32_v[0] = ret;
         _hidl_cb(rettype);
+    } else if (identifier == static_cast<uint32_t>(CustomFunctionTypeId::SET_EXECUTION_PIPELINE)) {
+        uint64_t id = static_cast<uint64_t>(parameter.u32_v[0]) << 32 | static_cast<uint64_t>(parameter.u32_v[1]);
+        auto ret = ::enn::runtime::Engine::get_instance()->set_execution_pipeline(id, parameter.u32_v[2]);
+        rettype.i32_v.resize(1);
+        rettype.i32_v[0] = ret;
+        _hidl_cb(rettype);
+    } else if (identifier == static_cast<uint32_t>(CustomFunctionTypeId::GET_MODEL_STATISTICS)) {
+        // i32_v[0] is the result, followed by EnnModelStatistics serialized.
+        uint64_t id = static_cast<uint64_t>(parameter.u32_v[0]) << 32 | static_cast<uint64_t>(parameter.u32_v[1]);
+        EnnModelStatistics statistics;
+        auto ret = ::enn::runtime::Engine::get_instance()->get_model_statistics(id, &statistics);
+        rettype.i32_v.resize(1);
+        rettype.i32_v[0] = ret;
+        if (ret == ENN_RET_SUCCESS) {
+            auto serialized = ::enn::runtime::metrics::serialize(statistics);
+            rettype.i32_v.insert(rettype.i32_v.end(), serialized.begin(), serialized.end());
+        }
+        _hidl_cb(rettype);
     }
     return Void();
 }
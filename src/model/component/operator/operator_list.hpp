@@ -96,12 +96,18 @@ class OperatorList : public IOperator, public runtime::dispatch::Dispatchable {
         return priority_;
     }
 
+    // Latency(us) the static scheduler expects for an execution of this OperatorList, 0 if not predicted.
+    uint32_t get_predicted_latency() const {
+        return predicted_latency_;
+    }
+
  private:
     friend class OperatorListBuilder;  // delcare Builder class as friend, which only has creation right.
     // OperatorListBuilder only can create OperatorList object
     explicit OperatorList(const IdentifierBase<FullIDType>& base_id)
         : id_(std::make_unique<UniqueID>(base_id)),
-          preset_id_(0), pref_mode_(0), target_latency_(0), tile_num_(1), core_affinity_(0), priority_(0) {
+          preset_id_(0), pref_mode_(0), target_latency_(0), tile_num_(1), core_affinity_(0), priority_(0),
+          predicted_latency_(0) {
             ENN_DBG_COUT << "An OperatorList(ID: 0x" << *id_ << ") is created." << std::endl;
     }
 
@@ -120,6 +126,8 @@ class OperatorList : public IOperator, public runtime::dispatch::Dispatchable {
     uint32_t tile_num_;         // for batch processing hint
     uint32_t core_affinity_;
     uint32_t priority_;
+
+    uint32_t predicted_latency_;  // from cost model of static scheduler
 };
 
 
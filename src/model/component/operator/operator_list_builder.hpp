@@ -83,6 +83,12 @@ class OperatorListBuilder : public IOperatorBuilder<OperatorListBuilder, Operato
         this->operator_->priority_ = priority;
         return *this;
     }
+
+    OperatorListBuilder& set_predicted_latency(uint32_t predicted_latency) {
+        this->operator_->predicted_latency_ = predicted_latency;
+        return *this;
+    }
+
     void print() {
         if (this->operator_->vertices_.size() != 0) {
             ENN_DBG_COUT << "=======================================" << std::endl;
@@ -3,7 +3,12 @@
 #include <sys/types.h>
 #include <unistd.h>
 #include <atomic>
+#include <cinttypes>
+#include <map>
 #include <memory>
+#include <set>
+#include <string>
+#include <unordered_set>
 #include "common/enn_debug.h"
 #include "common/identifier.hpp"
 #include "model/graph/iterator/methods/topological_sort.hpp"
@@ -433,6 +438,106 @@ inline bool is_tensor_between_gpu_ops(const component::FeatureMap::Ptr& fm) {
     return true;
 }
 
+// Userdrivers of CPU and GPU access a buffer by its address, so that it can be placed at any offset of a region.
+//  Others import the buffer by fd of the region.
+inline bool is_accessed_by_va(const component::Operator::Ptr& opr_ptr) {
+    return opr_ptr->get_accelerator() == Accelerator::CPU || opr_ptr->get_accelerator() == Accelerator::GPU;
+}
+
+// The CPU userdriver keeps the output of these operators at the address of their first input: reshapes are views,
+//  and element-wise operators run in place when the input dies at them.
+// Normalizations are element-wise here: ENN_NormalizationOptions and the Normalization custom carry only mean and
+//  scale, so the CPU userdriver never creates one with bgr_transpose, which moves planes and can't run in place.
+inline bool get_cpu_alias(const component::Operator::Ptr& opr_ptr, metadata::MemoryPlanner::Alias* alias) {
+    static const std::set<std::string> views = {"ENN_FLATTEN"};
+    static const std::set<std::string> in_places = {"DEQUANTIZE", "QUANTIZE", "ENN_NORMALIZATION",
+                                                    "Normalization", "Quantization", "Dequantization",
+                                                    "AsymmQuantization", "AsymmDequantization"};
+    if (opr_ptr->get_accelerator() != Accelerator::CPU || opr_ptr->in_tensors.count() == 0) return false;
+    if (views.count(opr_ptr->get_name())) {
+        *alias = metadata::MemoryPlanner::Alias::VIEW;
+    } else if (in_places.count(opr_ptr->get_name())) {
+        *alias = metadata::MemoryPlanner::Alias::IN_PLACE;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+void Generator::plan_intermediate_buffers(metadata::MemoryPlanner& planner, const OperatorSteps& steps,
+                                          const std::vector<IntermediateBuffer>& intermediates) {
+    auto& meta_data_vector = this->enn_model->get_buffer_meta_data();
+    std::map<uint32_t, uint32_t> region_buffer_count;
+    for (auto& meta_data : meta_data_vector) ++region_buffer_count[meta_data->get_region_index()];
+
+    // Bound buffers and the ones userdrivers import by fd keep their own regions.
+    std::vector<metadata::BufferMetaData::Ptr> candidates;
+    std::unordered_map<const component::Tensor*, metadata::BufferMetaData::Ptr> candidate_of;
+    for (auto& intermediate : intermediates) {
+        auto& meta_data = intermediate.first;
+        if (region_buffer_count[meta_data->get_region_index()] != 1) continue;
+
+        std::vector<uint32_t> uses;
+        bool is_plannable = true;
+        for (auto& next : intermediate.second->next()) {
+            auto step = steps.find(next.get());
+            if (step == steps.end() || !is_accessed_by_va(std::static_pointer_cast<component::Operator>(next))) {
+                is_plannable = false;
+                break;
+            }
+            uses.push_back(step->second);
+        }
+        if (!is_plannable) continue;
+        auto opr_ptr = std::static_pointer_cast<component::Operator>(intermediate.second->prev());
+        auto source = candidate_of.end();
+        metadata::MemoryPlanner::Alias alias;
+        if (get_cpu_alias(opr_ptr, &alias) && opr_ptr->out_tensors[0] == intermediate.second) {
+            source = candidate_of.find(opr_ptr->in_tensors[0].get());
+        }
+        if (source != candidate_of.end()) {
+            planner.add_alias(meta_data, steps.at(opr_ptr.get()), uses, source->second, alias);
+        } else {
+            planner.add_buffer(meta_data, steps.at(opr_ptr.get()), uses);
+        }
+        candidates.push_back(meta_data);
+        candidate_of.emplace(intermediate.second.get(), meta_data);
+    }
+
+    std::unordered_set<const metadata::BufferMetaData*> planned;
+    if (candidates.size() > 1) {
+        auto report = planner.plan();
+        uint32_t shared_region_index = candidates.front()->get_region_index();
+        for (auto& meta_data : candidates) {
+            shared_region_index = std::min(shared_region_index, meta_data->get_region_index());
+        }
+        for (auto& meta_data : candidates) {
+            meta_data->set_region_index(shared_region_index);
+            planned.insert(meta_data.get());
+        }
+        this->enn_model->set_memory_plan_report(report);
+        ENN_INFO_PRINT("Memory plan of %zu intermediate buffers(%zu aliased): %" PRIu64 " bytes planned, %" PRIu64
+                       " bytes naive(%.1f%% saved), %" PRIu64 " bytes live at peak\n",
+                       report.buffer_num, report.aliased_num, report.planned_bytes, report.naive_bytes,
+                       100.0 * report.saving(), report.peak_live_bytes);
+    }
+
+    // Renumber regions without gaps left by planning and binding. Buffers of a region not planned
+    //  are placed in a row, like as bound buffers.
+    std::map<uint32_t, uint32_t> region_indexes;
+    for (auto& meta_data : meta_data_vector) region_indexes.emplace(meta_data->get_region_index(), 0);
+    uint32_t region_count = 0;
+    for (auto& region_index : region_indexes) region_index.second = region_count++;
+
+    std::vector<uint32_t> region_sizes(region_count, 0);
+    for (auto& meta_data : meta_data_vector) {
+        uint32_t region_index = region_indexes[meta_data->get_region_index()];
+        meta_data->set_region_index(region_index);
+        if (planned.count(meta_data.get())) continue;
+        meta_data->set_offset(region_sizes[region_index]);
+        region_sizes[region_index] += meta_data->get_size();
+    }
+}
+
 void Generator::generate_buffer_meta_data(std::shared_ptr<raw::Model> const& raw_model) {
     ENN_DBG_COUT << "Generate Buffer Meta Data" << std::endl;
     std::vector<int32_t> input_ids;
@@ -450,7 +555,17 @@ void Generator::generate_buffer_meta_data(std::shared_ptr<raw::Model> const& raw
     uint32_t region_index = 0;
     uint32_t binding_ofm_count = 0;
     uint32_t binding_ifm_count = 0;
+    metadata::MemoryPlanner planner;
+    OperatorSteps steps;
+    std::vector<IntermediateBuffer> intermediates;
     for (auto& opr_ptr : this->enn_model->get_origin_graph()->order<enn::model::graph::iterator::TopologicalSort>()) {
+        std::vector<uint32_t> deps;
+        for (auto& in_tensor : opr_ptr->in_tensors) {
+            auto dep = steps.find(in_tensor->prev().get());
+            if (dep != steps.end()) deps.push_back(dep->second);
+        }
+        steps.emplace(opr_ptr.get(), planner.add_step(deps));
+
         if ((opr_ptr->get_accelerator() == Accelerator::NPU) && opr_ptr->is_ifm_bound()) {
             input_bind(opr_ptr, binding_ifm_count, region_index);
         }
@@ -532,6 +647,7 @@ void Generator::generate_buffer_meta_data(std::shared_ptr<raw::Model> const& raw
             } else {
                 buffer_meta_data->set_direction(Direction::EXT)
                                 ->set_direction_index(direction_index[static_cast<uint32_t>(Direction::EXT)]++);
+                if (is_accessed_by_va(opr_ptr)) intermediates.emplace_back(buffer_meta_data, fm);
             }
 
             if ((opr_ptr->get_accelerator() == Accelerator::NPU || opr_ptr->get_accelerator() == Accelerator::DSP)
@@ -546,6 +662,9 @@ void Generator::generate_buffer_meta_data(std::shared_ptr<raw::Model> const& raw
             buffer_meta_data->print();
         }
     }
+
+    // Intermediate buffers of lifetimes not overlapped share a region.
+    plan_intermediate_buffers(planner, steps, intermediates);
     ENN_DBG_COUT << "Generate Buffer Meta Data Completed" << std::endl;
 }
 
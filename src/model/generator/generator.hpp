@@ -4,8 +4,11 @@
 #include <map>
 #include <vector>
 #include <string>
+#include <unordered_map>
+#include <utility>
 
 #include "model/model.hpp"
+#include "model/meta_data/memory_planner.hpp"
 #include "model/graph/graph.hpp"
 #include "model/component/tensor/feature_map.hpp"
 #include "model/component/tensor/parameter.hpp"
@@ -76,6 +79,12 @@ class Generator {
     inline void output_bind(component::Operator::Ptr& opr_ptr, metadata::BufferMetaData::Ptr& buffer_meta_data,
         uint32_t& binding_ofm_count, uint32_t& region_index);
 
+    using OperatorSteps = std::unordered_map<const component::IOperator*, uint32_t>;
+    using IntermediateBuffer = std::pair<metadata::BufferMetaData::Ptr, component::FeatureMap::Ptr>;
+
+    void plan_intermediate_buffers(metadata::MemoryPlanner& planner, const OperatorSteps& steps,
+        const std::vector<IntermediateBuffer>& intermediates);
+
     Model::Ptr enn_model;
     std::unordered_map<int32_t, component::Tensor::Ptr> tensor_map;
     std::vector<component::Operator::Ptr> operator_vector;
@@ -0,0 +1,155 @@
+#ifndef SRC_MODEL_MEMORY_PARAMETER_PREFETCHER_HPP_
+#define SRC_MODEL_MEMORY_PARAMETER_PREFETCHER_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "model/component/operator/operator_list.hpp"
+#include "model/component/tensor/parameter.hpp"
+#include "common/enn_debug.h"
+
+namespace enn {
+namespace model {
+namespace memory {
+
+// ParameterPrefetcher materializes parameters(weights) of a model on demand.
+//  Parameters referred in place of the mapped model file are loaded by page faults on the first access.
+//  - advise() asks the kernel to read ahead parameters of an OperatorList right before its userdriver prepares it,
+//    so that parameters no scheduled operator refers to are never loaded.
+//  - warm_up() touches the parameters in background, so that the first inference does not wait for page faults.
+//    It is stopped by stop() or the destructor, which should be called before the memory is released.
+//    wait() blocks until it is completed or stopped.
+class ParameterPrefetcher {
+ public:
+    using UPtr = std::unique_ptr<ParameterPrefetcher>;
+    using Parameter = component::Parameter;
+
+    ParameterPrefetcher() : stop_{false}, touched_bytes_{0}, running_{false}, completed_{false} {}
+
+    ParameterPrefetcher(const ParameterPrefetcher&) = delete;
+    ParameterPrefetcher& operator=(const ParameterPrefetcher&) = delete;
+
+    ~ParameterPrefetcher() {
+        stop();
+    }
+
+    // Parameters(not Scalars) the operators of the list refer to, without duplicates.
+    static std::vector<Parameter::Ptr> collect(const component::OperatorList& opr_list) {
+        std::vector<Parameter::Ptr> parameters;
+        std::unordered_set<const void*> addrs;
+        for (auto& opr : opr_list) {
+            for (auto& tensor : opr->in_tensors) {
+                auto parameter = std::dynamic_pointer_cast<Parameter>(tensor);
+                if (parameter != nullptr && parameter->get_buffer_addr() != nullptr &&
+                    addrs.insert(parameter->get_buffer_addr()).second) {
+                    parameters.push_back(parameter);
+                }
+            }
+        }
+        return parameters;
+    }
+
+    // Return the bytes advised. Failure of madvise() is ignored because it is only a hint,
+    //  e.g. for device memory which is not backed by a file.
+    static size_t advise(const std::vector<Parameter::Ptr>& parameters) {
+        size_t bytes = 0;
+        for (auto& parameter : parameters) {
+            auto range = get_page_range(*parameter);
+            if (range.second == 0) continue;
+            madvise(range.first, range.second, MADV_WILLNEED);
+            bytes += parameter->get_buffer_size();
+        }
+        return bytes;
+    }
+
+    // Touch a byte per page of parameters in a background thread. Previous warm up is stopped.
+    void warm_up(std::vector<Parameter::Ptr> parameters) {
+        stop();
+        stop_ = false;
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            running_ = true;
+            completed_ = false;
+        }
+        worker_ = std::thread([this, parameters = std::move(parameters)]() {
+            bool completed = touch(parameters);
+            if (completed) ENN_DBG_PRINT("Parameters of %zu bytes are warmed up\n", touched_bytes_.load());
+            std::lock_guard<std::mutex> guard(mutex_);
+            running_ = false;
+            completed_ = completed;
+            done_cv_.notify_all();
+        });
+    }
+
+    void stop() {
+        stop_ = true;
+        if (worker_.joinable()) worker_.join();
+    }
+
+    // Return true if the last warm up touched every parameter, or false if it was stopped.
+    bool wait() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [this] { return !running_; });
+        return completed_;
+    }
+
+    bool is_warming_up() {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return running_;
+    }
+
+    // Bytes of parameters touched by warm_up() so far.
+    size_t get_touched_bytes() const {
+        return touched_bytes_.load();
+    }
+
+ private:
+    bool touch(const std::vector<Parameter::Ptr>& parameters) {
+        const size_t page_size = get_page_size();
+        for (auto& parameter : parameters) {
+            auto addr = static_cast<const volatile uint8_t*>(parameter->get_buffer_addr());
+            for (size_t offset = 0; offset < parameter->get_buffer_size(); offset += page_size) {
+                if (stop_.load(std::memory_order_relaxed)) return false;
+                (void)addr[offset];
+            }
+            touched_bytes_ += parameter->get_buffer_size();
+        }
+        return true;
+    }
+
+    static size_t get_page_size() {
+        static const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        return page_size;
+    }
+
+    static std::pair<void*, size_t> get_page_range(const Parameter& parameter) {
+        auto begin = reinterpret_cast<uintptr_t>(parameter.get_buffer_addr());
+        if (begin == 0 || parameter.get_buffer_size() == 0) return {nullptr, 0};
+        auto end = begin + parameter.get_buffer_size();
+        auto aligned = begin & ~(static_cast<uintptr_t>(get_page_size()) - 1);
+        return {reinterpret_cast<void*>(aligned), end - aligned};
+    }
+
+ private:
+    std::atomic<bool> stop_;
+    std::atomic<size_t> touched_bytes_;
+    std::mutex mutex_;
+    std::condition_variable done_cv_;  // notified when the worker finishes
+    bool running_;
+    bool completed_;
+    std::thread worker_;
+};
+
+};  // namespace memory
+};  // namespace model
+};  // namespace enn
+
+#endif  // SRC_MODEL_MEMORY_PARAMETER_PREFETCHER_HPP_
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "model/memory/parameter_prefetcher.hpp"
+#include "model/component/operator/operator_builder.hpp"
+#include "model/component/operator/operator_list_builder.hpp"
+#include "model/component/tensor/parameter_builder.hpp"
+#include "model/component/tensor/scalar_builder.hpp"
+#include "model/component/tensor/feature_map_builder.hpp"
+#include "model/model.hpp"
+#include "runtime/client_process/client_process.hpp"
+#include "common/enn_utils_buffer.hpp"
+
+using namespace enn::model;
+using namespace enn::model::component;
+using namespace enn::model::memory;
+
+class ParameterPrefetcherTest : public testing::Test {
+ protected:
+    void SetUp() override {
+        std::vector<char> chunk(1024 * 1024, 0x5a);
+        std::ofstream file(filename, std::ios::binary);
+        for (int i = 0; i < kFileMB; i++) file.write(chunk.data(), chunk.size());
+        file.close();
+        reader = std::make_unique<enn::util::MmapBufferReader>(filename);
+        mapping = reader->get_mapping();
+        model = std::make_unique<Model>(std::make_shared<enn::runtime::ClientProcess>());
+    }
+
+    void TearDown() override {
+        std::remove(filename.c_str());
+    }
+
+    Parameter::Ptr create_parameter(size_t offset, size_t size) {
+        return ParameterBuilder().set_buffer_addr(mapping.get() + offset).set_buffer_size(size).create();
+    }
+
+    OperatorList::Ptr create_operator_list(const std::vector<std::vector<Tensor::Ptr>>& op_inputs) {
+        OperatorListBuilder builder;
+        builder.build(model->get_id());
+        for (auto& inputs : op_inputs) {
+            auto op = OperatorBuilder().set_id(0).create();
+            for (auto& input : inputs) OperatorBuilder(op).add_in_tensor(input);
+            builder.add_operator(op);
+        }
+        return builder.create();
+    }
+
+    static constexpr int kFileMB = 8;
+    const std::string filename = "parameter_prefetcher_test.bin";
+    std::unique_ptr<enn::util::BufferReader> reader;
+    std::shared_ptr<char> mapping;
+    std::unique_ptr<Model> model;
+};
+
+TEST_F(ParameterPrefetcherTest, collects_parameters_of_operator_list) {
+    auto weight = create_parameter(0, 4096);
+    auto bias = create_parameter(4096, 64);
+    auto scalar = ScalarBuilder().create();
+    auto input = FeatureMapBuilder().create();
+    // The weight is shared by two operators.
+    auto opr_list = create_operator_list({{input, weight, bias, scalar}, {input, weight}});
+
+    auto parameters = ParameterPrefetcher::collect(*opr_list);
+    ASSERT_EQ(parameters.size(), 2);
+    EXPECT_EQ(parameters[0], weight);
+    EXPECT_EQ(parameters[1], bias);
+    EXPECT_EQ(ParameterPrefetcher::advise(parameters), 4096 + 64);
+}
+
+TEST_F(ParameterPrefetcherTest, warms_up_parameters_in_background) {
+    std::vector<Parameter::Ptr> parameters{create_parameter(100, 1024 * 1024), create_parameter(3 * 1024 * 1024, 5000)};
+    ParameterPrefetcher prefetcher;
+    prefetcher.warm_up(parameters);
+    EXPECT_TRUE(prefetcher.wait());
+    EXPECT_FALSE(prefetcher.is_warming_up());
+    EXPECT_EQ(prefetcher.get_touched_bytes(), 1024 * 1024 + 5000);
+}
+
+TEST_F(ParameterPrefetcherTest, stops_warming_up_on_release) {
+    std::vector<Parameter::Ptr> parameters;
+    for (int i = 0; i < kFileMB; ++i) parameters.push_back(create_parameter(i * 1024 * 1024, 1024 * 1024));
+    {
+        ParameterPrefetcher prefetcher;
+        prefetcher.warm_up(parameters);
+        prefetcher.stop();
+        EXPECT_FALSE(prefetcher.is_warming_up());
+        size_t touched_bytes = prefetcher.get_touched_bytes();
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        EXPECT_EQ(prefetcher.get_touched_bytes(), touched_bytes);
+    }
+    {
+        ParameterPrefetcher prefetcher;
+        prefetcher.warm_up(parameters);
+    }
+    // The worker holds the parameters until it exits, so the destructor has joined it if they are released.
+    for (auto& parameter : parameters) EXPECT_EQ(parameter.use_count(), 1);
+    mapping.reset();
+    reader.reset();
+}
+
+// Time to first access of every page of the parameters, which the first inference pays without warming up.
+TEST_F(ParameterPrefetcherTest, DISABLED_benchmark_first_access_after_warm_up) {
+    std::vector<Parameter::Ptr> parameters{create_parameter(0, kFileMB * 1024 * 1024)};
+    auto first_access = [&parameters]() {
+        auto start = std::chrono::steady_clock::now();
+        uint64_t sum = 0;
+        auto addr = static_cast<const volatile uint8_t*>(parameters[0]->get_buffer_addr());
+        for (size_t i = 0; i < parameters[0]->get_buffer_size(); i += 4096) sum += addr[i];
+        EXPECT_EQ(sum, 0x5a * (parameters[0]->get_buffer_size() / 4096));
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+    double cold = first_access();
+
+    // Map the file again to get pages not faulted in yet.
+    reader = std::make_unique<enn::util::MmapBufferReader>(filename);
+    mapping = reader->get_mapping();
+    parameters = {create_parameter(0, kFileMB * 1024 * 1024)};
+    ParameterPrefetcher prefetcher;
+    prefetcher.warm_up(parameters);
+    prefetcher.wait();
+    double warm = first_access();
+
+    std::cout << "[          ] first access of " << kFileMB << " MB parameters: " << cold << " ms without warm up, "
+              << warm << " ms after warm up" << std::endl;
+}
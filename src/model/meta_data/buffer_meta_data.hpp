@@ -5,6 +5,7 @@
 #include <string>
 #include "model/types.hpp"
 #include "model/memory/indexed_buffer.hpp"
+#include "common/enn_debug.h"
 
 
 namespace enn {
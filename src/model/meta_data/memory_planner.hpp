@@ -0,0 +1,271 @@
+#ifndef MODEL_METADATA_MEMORY_PLANNER_HPP_
+#define MODEL_METADATA_MEMORY_PLANNER_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "model/meta_data/buffer_meta_data.hpp"
+
+namespace enn {
+namespace model {
+namespace metadata {
+
+// MemoryPlanner packs intermediate buffers into a region, so that buffers which are never live at the same time
+//  share memory. It plans in steps, which are operators in topological order of the origin graph.
+//  - A buffer is live from the step defining it to the last step using it.
+//  - Steps are not always executed in the topological order(e.g. OperatorLists of independent branches),
+//    so two buffers share memory only if every step using one depends on the step defining the other.
+//  - Offsets are assigned greedily: a buffer is placed into the best fitting gap between the buffers of
+//    overlapping lifetime placed already, in order of size, size by lifetime or lifetime. The smallest wins.
+//  - A buffer may alias its source buffer, which is an input of the step defining it. Aliased buffers are
+//    placed as one, live from the definition of the first to the last use of any.
+class MemoryPlanner {
+ public:
+    static constexpr uint32_t ALIGNMENT = 64;  // bytes, cache line of CPU
+
+    enum class Alias {
+        VIEW,
+        IN_PLACE,
+    };
+
+    struct Report {
+        size_t buffer_num;
+        size_t aliased_num;        // buffers sharing the memory of their sources
+        uint64_t naive_bytes;      // a region per buffer
+        uint64_t planned_bytes;    // size of the shared region
+        uint64_t peak_live_bytes;  // the largest sum of buffers live at a step in the topological order
+
+        double saving() const {
+            return naive_bytes ? 1.0 - static_cast<double>(planned_bytes) / naive_bytes : 0.0;
+        }
+    };
+
+ public:
+    // Add the next step in topological order, with the steps it depends on directly. Return the step.
+    uint32_t add_step(const std::vector<uint32_t>& deps) {
+        deps_.push_back(deps);
+        return static_cast<uint32_t>(deps_.size() - 1);
+    }
+
+    // Add the buffer defined at the step and used at the steps. Its offset is set by plan().
+    void add_buffer(const BufferMetaData::Ptr& buffer, uint32_t def, const std::vector<uint32_t>& uses) {
+        LiveRange range{buffer, def, def, uses.empty() ? std::vector<uint32_t>{def} : uses, buffer->get_size()};
+        range.last = *std::max_element(range.uses.begin(), range.uses.end());
+        ranges_.push_back(std::move(range));
+    }
+
+    // Add the buffer as add_buffer(), which may share the memory of the source buffer added already.
+    //  - VIEW: the buffer is the data of the source as it is, e.g. reshape. The memory is always shared.
+    //  - IN_PLACE: the step overwrites the source with the buffer, e.g. element-wise operators. The memory is
+    //    shared only if every other use of the source is finished before the step, i.e. the source dies there.
+    void add_alias(const BufferMetaData::Ptr& buffer, uint32_t def, const std::vector<uint32_t>& uses,
+                   const BufferMetaData::Ptr& source, Alias alias) {
+        add_buffer(buffer, def, uses);
+        aliases_.push_back({ranges_.size() - 1, source, alias});
+    }
+
+    size_t get_buffer_num() const {
+        return ranges_.size();
+    }
+
+    Report plan() {
+        build_descendants();
+        size_t aliased_num = build_groups();
+
+        // Greedy by size is close to optimal for most of models, but not for all.
+        std::vector<std::vector<size_t>> orders(3, std::vector<size_t>(groups_.size()));
+        for (auto& order : orders) std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(orders[0].begin(), orders[0].end(), [this](size_t lhs, size_t rhs) {
+            return groups_[lhs].size > groups_[rhs].size;
+        });
+        std::stable_sort(orders[1].begin(), orders[1].end(), [this](size_t lhs, size_t rhs) {
+            return get_area(groups_[lhs]) > get_area(groups_[rhs]);
+        });
+        std::stable_sort(orders[2].begin(), orders[2].end(), [this](size_t lhs, size_t rhs) {
+            return groups_[lhs].last - groups_[lhs].def > groups_[rhs].last - groups_[rhs].def;
+        });
+
+        std::vector<uint64_t> best_offsets;
+        uint64_t best_bytes = std::numeric_limits<uint64_t>::max();
+        for (auto& order : orders) {
+            std::vector<uint64_t> offsets;
+            uint64_t bytes = assign(order, &offsets);
+            if (bytes < best_bytes) {
+                best_bytes = bytes;
+                best_offsets.swap(offsets);
+            }
+        }
+
+        Report report{ranges_.size(), aliased_num, 0, ranges_.empty() ? 0 : best_bytes, get_peak_live_bytes()};
+        for (size_t i = 0; i < ranges_.size(); ++i) {
+            ranges_[i].buffer->set_offset(static_cast<uint32_t>(best_offsets[group_of_[i]]));
+            report.naive_bytes += ranges_[i].buffer->get_size();
+        }
+        return report;
+    }
+
+ private:
+    struct LiveRange {
+        BufferMetaData::Ptr buffer;
+        uint32_t def;
+        uint32_t last;
+        std::vector<uint32_t> uses;
+        uint64_t size;
+    };
+
+    struct AliasRequest {
+        size_t index;
+        BufferMetaData::Ptr source;
+        Alias alias;
+    };
+
+    struct Block {
+        size_t index;
+        uint64_t begin;
+        uint64_t end;  // aligned
+    };
+
+    static uint64_t align(uint64_t size) {
+        return (size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    }
+
+    // descendants_[s] is a bitset of the steps depending on the step s, directly or not.
+    void build_descendants() {
+        const size_t words = (deps_.size() + 63) / 64;
+        descendants_.assign(deps_.size(), std::vector<uint64_t>(words, 0));
+        for (size_t step = deps_.size(); step-- > 0;) {
+            for (auto dep : deps_[step]) {
+                auto& bits = descendants_[dep];
+                for (size_t w = 0; w < words; ++w) bits[w] |= descendants_[step][w];
+                bits[step / 64] |= 1ULL << (step % 64);
+            }
+        }
+    }
+
+    bool depends(uint32_t step, uint32_t ancestor) const {
+        return (descendants_[ancestor][step / 64] >> (step % 64)) & 1ULL;
+    }
+
+    // All uses of the former are finished before the latter is defined.
+    bool ends_before(const LiveRange& former, const LiveRange& latter) const {
+        return std::all_of(former.uses.begin(), former.uses.end(),
+                           [&](uint32_t use) { return depends(latter.def, use); });
+    }
+
+    // Merge aliased buffers into groups_, placed as one range. Return the number of buffers merged.
+    //  Requests are resolved in order of definition, so an in-place step sees all uses of the memory before it.
+    size_t build_groups() {
+        groups_.clear();
+        group_of_.assign(ranges_.size(), SIZE_MAX);
+        std::vector<const AliasRequest*> requests(ranges_.size(), nullptr);
+        for (auto& request : aliases_) requests[request.index] = &request;
+
+        std::vector<size_t> order(ranges_.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(),
+                         [this](size_t lhs, size_t rhs) { return ranges_[lhs].def < ranges_[rhs].def; });
+
+        size_t aliased_num = 0;
+        for (auto index : order) {
+            auto& range = ranges_[index];
+            size_t source = requests[index] ? find_range(requests[index]->source) : SIZE_MAX;
+            if (source != SIZE_MAX && group_of_[source] != SIZE_MAX) {
+                auto& group = groups_[group_of_[source]];
+                bool is_dead = std::all_of(group.uses.begin(), group.uses.end(), [&](uint32_t use) {
+                    return use == range.def || depends(range.def, use);
+                });
+                if (requests[index]->alias == Alias::VIEW || is_dead) {
+                    group.uses.insert(group.uses.end(), range.uses.begin(), range.uses.end());
+                    group.last = std::max(group.last, range.last);
+                    group.size = std::max(group.size, range.size);
+                    group_of_[index] = group_of_[source];
+                    ++aliased_num;
+                    continue;
+                }
+            }
+            group_of_[index] = groups_.size();
+            groups_.push_back(range);
+        }
+        return aliased_num;
+    }
+
+    size_t find_range(const BufferMetaData::Ptr& buffer) const {
+        for (size_t i = 0; i < ranges_.size(); ++i) {
+            if (ranges_[i].buffer == buffer) return i;
+        }
+        return SIZE_MAX;
+    }
+
+    static uint64_t get_area(const LiveRange& range) {
+        return range.size * (range.last - range.def + 1);
+    }
+
+    // Place groups in the order, and return the size of the region.
+    uint64_t assign(const std::vector<size_t>& order, std::vector<uint64_t>* offsets) const {
+        offsets->assign(groups_.size(), 0);
+        std::vector<Block> placed;
+        uint64_t bytes = 0;
+        for (auto index : order) {
+            auto& range = groups_[index];
+            uint64_t offset = find_offset(range, placed);
+            (*offsets)[index] = offset;
+            placed.push_back({index, offset, offset + align(range.size)});
+            bytes = std::max<uint64_t>(bytes, offset + range.size);
+        }
+        return bytes;
+    }
+
+    uint64_t find_offset(const LiveRange& range, const std::vector<Block>& placed) const {
+        std::vector<const Block*> overlaps;
+        for (auto& block : placed) {
+            auto& other = groups_[block.index];
+            if (!ends_before(other, range) && !ends_before(range, other)) overlaps.push_back(&block);
+        }
+        std::sort(overlaps.begin(), overlaps.end(),
+                  [](const Block* lhs, const Block* rhs) { return lhs->begin < rhs->begin; });
+
+        const uint64_t size = align(range.size);
+        uint64_t best_offset = std::numeric_limits<uint64_t>::max();
+        uint64_t best_gap = std::numeric_limits<uint64_t>::max();
+        uint64_t prev_end = 0;
+        for (auto block : overlaps) {
+            if (block->begin >= prev_end + size && block->begin - prev_end < best_gap) {
+                best_gap = block->begin - prev_end;
+                best_offset = prev_end;
+            }
+            prev_end = std::max(prev_end, block->end);
+        }
+        return best_offset == std::numeric_limits<uint64_t>::max() ? prev_end : best_offset;
+    }
+
+    uint64_t get_peak_live_bytes() const {
+        std::vector<int64_t> delta(deps_.size() + 1, 0);
+        for (auto& range : groups_) {
+            delta[range.def] += range.size;
+            delta[range.last + 1] -= range.size;
+        }
+        int64_t live = 0, peak = 0;
+        for (auto bytes : delta) {
+            live += bytes;
+            peak = std::max(peak, live);
+        }
+        return static_cast<uint64_t>(peak);
+    }
+
+ private:
+    std::vector<std::vector<uint32_t>> deps_;
+    std::vector<LiveRange> ranges_;
+    std::vector<AliasRequest> aliases_;
+    std::vector<LiveRange> groups_;  // ranges_ merged by aliases_
+    std::vector<size_t> group_of_;   // index of groups_ for ranges_
+    std::vector<std::vector<uint64_t>> descendants_;
+};
+
+};  // namespace metadata
+};  // namespace model
+};  // namespace enn
+
+#endif  // MODEL_METADATA_MEMORY_PLANNER_HPP_
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "model/meta_data/memory_planner.hpp"
+
+using namespace enn::model::metadata;
+
+class MemoryPlannerTest : public testing::Test {
+ protected:
+    BufferMetaData::Ptr create_buffer(uint32_t size) {
+        auto buffer = std::make_shared<BufferMetaData>();
+        buffer->set_size(size)->set_offset(UINT32_MAX);
+        return buffer;
+    }
+
+    static bool is_overlapped(const BufferMetaData::Ptr& lhs, const BufferMetaData::Ptr& rhs) {
+        return lhs->get_offset() < rhs->get_offset() + rhs->get_size() &&
+               rhs->get_offset() < lhs->get_offset() + lhs->get_size();
+    }
+};
+
+TEST_F(MemoryPlannerTest, shares_memory_along_chain) {
+    // op0 -> t0 -> op1 -> t1 -> op2 -> t2 -> op3
+    MemoryPlanner planner;
+    for (uint32_t step = 0; step < 4; ++step) {
+        planner.add_step(step ? std::vector<uint32_t>{step - 1} : std::vector<uint32_t>{});
+    }
+    std::vector<BufferMetaData::Ptr> buffers{create_buffer(1000), create_buffer(1000), create_buffer(1000)};
+    for (uint32_t i = 0; i < buffers.size(); ++i) planner.add_buffer(buffers[i], i, {i + 1});
+
+    auto report = planner.plan();
+    // The operator reads t0 and writes t1 at the same time, while t0 is dead when t2 is written.
+    EXPECT_EQ(buffers[0]->get_offset(), buffers[2]->get_offset());
+    EXPECT_FALSE(is_overlapped(buffers[0], buffers[1]));
+    EXPECT_FALSE(is_overlapped(buffers[1], buffers[2]));
+    EXPECT_EQ(buffers[1]->get_offset() % MemoryPlanner::ALIGNMENT, 0);
+    EXPECT_EQ(report.buffer_num, 3);
+    EXPECT_EQ(report.naive_bytes, 3000);
+    EXPECT_EQ(report.planned_bytes, 1024 + 1000);
+    EXPECT_EQ(report.peak_live_bytes, 2000);
+    EXPECT_GT(report.saving(), 0.3);
+}
+
+TEST_F(MemoryPlannerTest, keeps_independent_branches_apart) {
+    // op1 and op2 both depend on op0 only, so they may run in any order.
+    MemoryPlanner planner;
+    planner.add_step({});
+    planner.add_step({0});
+    planner.add_step({0});
+    auto left = create_buffer(512);
+    auto right = create_buffer(512);
+    planner.add_buffer(left, 1, {});
+    planner.add_buffer(right, 2, {});
+
+    auto report = planner.plan();
+    EXPECT_FALSE(is_overlapped(left, right));
+    EXPECT_EQ(report.planned_bytes, 1024);
+}
+
+TEST_F(MemoryPlannerTest, fills_best_fitting_gap) {
+    // op0 -> op1 -> op2 -> op3 -> op4
+    MemoryPlanner planner;
+    for (uint32_t step = 0; step < 5; ++step) {
+        planner.add_step(step ? std::vector<uint32_t>{step - 1} : std::vector<uint32_t>{});
+    }
+    auto large = create_buffer(4096);  // live in [0, 1]
+    auto long_lived = create_buffer(1024);  // live in [0, 4]
+    auto small = create_buffer(256);  // live in [2, 3], fits in the space of the large one
+    planner.add_buffer(large, 0, {1});
+    planner.add_buffer(long_lived, 0, {4});
+    planner.add_buffer(small, 2, {3});
+
+    auto report = planner.plan();
+    EXPECT_EQ(large->get_offset(), 0);
+    EXPECT_EQ(long_lived->get_offset(), 4096);
+    EXPECT_EQ(small->get_offset(), 0);
+    EXPECT_EQ(report.planned_bytes, 4096 + 1024);
+    EXPECT_EQ(report.planned_bytes, report.peak_live_bytes);
+}
+
+TEST_F(MemoryPlannerTest, aliases_view_and_dead_input) {
+    // op0 -> t0 -> op1(flatten) -> t1 -> op2(dequantize) -> t2 -> op3, where op3 uses t0 as well.
+    MemoryPlanner planner;
+    for (uint32_t step = 0; step < 4; ++step) {
+        planner.add_step(step ? std::vector<uint32_t>{step - 1} : std::vector<uint32_t>{});
+    }
+    auto t0 = create_buffer(1000);
+    auto t1 = create_buffer(1000);
+    auto t2 = create_buffer(4000);  // wider than its source
+    planner.add_buffer(t0, 0, {1, 3});
+    planner.add_alias(t1, 1, {2}, t0, MemoryPlanner::Alias::VIEW);
+    planner.add_alias(t2, 2, {3}, t1, MemoryPlanner::Alias::IN_PLACE);
+
+    auto report = planner.plan();
+    // t0 is still used by op3, so op2 cannot overwrite it.
+    EXPECT_EQ(t1->get_offset(), t0->get_offset());
+    EXPECT_FALSE(is_overlapped(t0, t2));
+    EXPECT_EQ(report.aliased_num, 1);
+    EXPECT_EQ(report.planned_bytes, 1024 + 4000);
+
+    // Without the use of op3, t0 dies at op2.
+    MemoryPlanner dead;
+    for (uint32_t step = 0; step < 4; ++step) {
+        dead.add_step(step ? std::vector<uint32_t>{step - 1} : std::vector<uint32_t>{});
+    }
+    dead.add_buffer(t0, 0, {1});
+    dead.add_alias(t1, 1, {2}, t0, MemoryPlanner::Alias::VIEW);
+    dead.add_alias(t2, 2, {3}, t1, MemoryPlanner::Alias::IN_PLACE);
+
+    report = dead.plan();
+    EXPECT_EQ(t1->get_offset(), t0->get_offset());
+    EXPECT_EQ(t2->get_offset(), t0->get_offset());
+    EXPECT_EQ(report.aliased_num, 2);
+    EXPECT_EQ(report.planned_bytes, 4000);
+    EXPECT_EQ(report.naive_bytes, 6000);
+}
+
+TEST_F(MemoryPlannerTest, keeps_in_place_apart_from_independent_use) {
+    // op1 and op2 both use t0 of op0 and may run in any order, so op1 cannot overwrite t0.
+    MemoryPlanner planner;
+    planner.add_step({});
+    planner.add_step({0});
+    planner.add_step({0});
+    auto t0 = create_buffer(512);
+    auto t1 = create_buffer(512);
+    auto t2 = create_buffer(512);
+    planner.add_buffer(t0, 0, {1, 2});
+    planner.add_alias(t1, 1, {}, t0, MemoryPlanner::Alias::IN_PLACE);
+    planner.add_buffer(t2, 2, {});
+
+    auto report = planner.plan();
+    EXPECT_FALSE(is_overlapped(t0, t1));
+    EXPECT_FALSE(is_overlapped(t0, t2));
+    EXPECT_FALSE(is_overlapped(t1, t2));
+    EXPECT_EQ(report.aliased_num, 0);
+}
+
+TEST_F(MemoryPlannerTest, plans_close_to_peak_live_bytes) {
+    // Chain of operators with skip connections, like as residual blocks.
+    constexpr uint32_t kStepNum = 200;
+    std::mt19937 random(2021);
+    std::uniform_int_distribution<uint32_t> size_of(1, 64 * 1024);
+
+    MemoryPlanner planner;
+    std::vector<BufferMetaData::Ptr> buffers;
+    std::vector<std::pair<uint32_t, uint32_t>> live_ranges;
+    for (uint32_t step = 0; step < kStepNum; ++step) {
+        planner.add_step(step ? std::vector<uint32_t>{step - 1} : std::vector<uint32_t>{});
+    }
+    for (uint32_t step = 0; step + 1 < kStepNum; ++step) {
+        std::vector<uint32_t> uses{step + 1};
+        if (step % 4 == 0 && step + 4 < kStepNum) uses.push_back(step + 4);
+        buffers.push_back(create_buffer(size_of(random)));
+        live_ranges.push_back({step, uses.back()});
+        planner.add_buffer(buffers.back(), step, uses);
+    }
+
+    auto report = planner.plan();
+    for (size_t i = 0; i < buffers.size(); ++i) {
+        for (size_t j = i + 1; j < buffers.size(); ++j) {
+            bool is_live_together = live_ranges[i].first <= live_ranges[j].second &&
+                                    live_ranges[j].first <= live_ranges[i].second;
+            if (is_live_together) EXPECT_FALSE(is_overlapped(buffers[i], buffers[j])) << i << ", " << j;
+        }
+    }
+    EXPECT_LE(report.planned_bytes, report.naive_bytes);
+    EXPECT_GE(report.planned_bytes, report.peak_live_bytes);
+}
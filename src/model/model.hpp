@@ -12,10 +12,12 @@
 #include "model/graph/graph.hpp"
 #include "model/graph/iterator/methods/breadth_first_search.hpp"
 #include "model/meta_data/buffer_meta_data.hpp"
+#include "model/meta_data/memory_planner.hpp"
 #include "model/attribute.hpp"
 #include "model/component/operator/operator.hpp"
 #include "model/component/operator/operator_list.hpp"
 #include "model/component/tensor/feature_map.hpp"
+#include "model/memory/parameter_prefetcher.hpp"
 #include "model/graph_types.hpp"
 #include "runtime/dispatch/dispatcher_interface.hpp"
 // TODO(yc18.cho, hoon98.choi, TBD): remove all depedency on MemoryManager
@@ -29,6 +31,10 @@
 namespace enn {
 namespace model {
 
+namespace raw {
+class Model;
+};  // namespace raw
+
 using namespace component;
 using namespace enn::identifier;
 
@@ -61,6 +67,8 @@ class Model : public runtime::pool::Poolable<IdentifierBase<FullIDType>>,
 
     ~Model() {
         try {
+            // Stop to touch parameters before the memory of them is released.
+            if (parameter_prefetcher_ != nullptr) parameter_prefetcher_->stop();
             unload();  // release all resources including ones of userdriver.
             if (memory_manager_ == nullptr) {
                 ENN_WARN_COUT << "The MemoryManager in a Model(ID: 0x"
@@ -114,6 +122,7 @@ class Model : public runtime::pool::Poolable<IdentifierBase<FullIDType>>,
     bool is_ancestor_of(const ID& rid) const override { return id_->is_overlapped_by(rid); }
     bool is_descendant_of(const Poolable& rp) const override { return rp.is_ancestor_of(*id_); }
     bool is_descendant_of(const ID& rid) const override { return id_->is_overlapping(rid); }
+    const ID& get_key() const override { return *id_; }
     std::string to_string() const override {
         std::stringstream s;
         s << "Model(ID: 0x" << id_->to_string() << ")";
@@ -133,7 +142,11 @@ class Model : public runtime::pool::Poolable<IdentifierBase<FullIDType>>,
     void load() {
         using namespace enn::model::graph::iterator;
         ENN_DBG_COUT << "Load the Model(ID: 0x" << *id_ << ")." << std::endl;
+        std::vector<Parameter::Ptr> parameters;
         for (auto& opr_list : scheduled_graph_->order<BreadthFirstSearch>()) {
+            // Parameters are loaded on demand right before the userdriver prepares the OperatorList.
+            auto list_parameters = memory::ParameterPrefetcher::collect(*opr_list);
+            memory::ParameterPrefetcher::advise(list_parameters);
             try {
                 open_dispatcher_->dispatch(*opr_list);
             } catch (const std::runtime_error& re) {
@@ -141,7 +154,9 @@ class Model : public runtime::pool::Poolable<IdentifierBase<FullIDType>>,
                 ENN_ERR_COUT << "Failed to Dispatch Open User Driver : " << (int)(opr_list->get_accelerator()) << std::endl;
                 throw std::runtime_error("Open Dispatch Failed");
             }
+            parameters.insert(parameters.end(), list_parameters.begin(), list_parameters.end());
         }
+        if (parameter_prefetcher_ != nullptr) parameter_prefetcher_->warm_up(std::move(parameters));
     }
 
     Ptr set_origin_graph(OriginalGraph::Ptr origin_graph) {
@@ -174,6 +189,15 @@ class Model : public runtime::pool::Poolable<IdentifierBase<FullIDType>>,
         return buffer_meta_data_;
     }
 
+    void set_memory_plan_report(const metadata::MemoryPlanner::Report& report) {
+        memory_plan_report_ = report;
+    }
+
+    // Planned vs naive bytes of the intermediate buffers sharing a region.
+    const metadata::MemoryPlanner::Report& get_memory_plan_report() const {
+        return memory_plan_report_;
+    }
+
     const ID& get_id() const {
         return *id_;
     }
@@ -198,6 +222,19 @@ class Model : public runtime::pool::Poolable<IdentifierBase<FullIDType>>,
         return shared_from_this();
     }
 
+    // Parameters are warmed up in background after load() if the prefetcher is set.
+    Ptr set_parameter_prefetcher(memory::ParameterPrefetcher::UPtr parameter_prefetcher) {
+        parameter_prefetcher_ = std::move(parameter_prefetcher);
+        return shared_from_this();
+    }
+
+    // Keep the raw model shared with other models of the same content through ModelCache.
+    //  The memory it refers to is released after all of them are released.
+    Ptr set_raw_model(const std::shared_ptr<raw::Model>& raw_model) {
+        raw_model_ = raw_model;
+        return shared_from_this();
+    }
+
  private:
     void unload() {
         using namespace enn::model::graph::iterator;
@@ -221,8 +258,11 @@ class Model : public runtime::pool::Poolable<IdentifierBase<FullIDType>>,
     OriginalGraph::Ptr origin_graph_;  // graph composed of individual Operator and FeatureMap
     ScheduledGraph::Ptr scheduled_graph_;  // graph composed of OperatorList and FeatureMap
     std::vector<metadata::BufferMetaData::Ptr> buffer_meta_data_;  // memory info to be allocated
+    metadata::MemoryPlanner::Report memory_plan_report_{};
     IEnnMemoryManager* memory_manager_;
     std::vector<EnnBufferCore::Ptr> memory_object_pool;
+    std::shared_ptr<raw::Model> raw_model_;  // released after unload() in destructor
+    memory::ParameterPrefetcher::UPtr parameter_prefetcher_;
     Attribute::Ptr attribute_;  // attribute defined by GraphGen
     std::unique_ptr<runtime::dispatch::IDispatcher> open_dispatcher_;
     std::unique_ptr<runtime::dispatch::IDispatcher> close_dispatcher_;
@@ -0,0 +1,323 @@
+#ifndef SRC_MODEL_PARSER_MODEL_CACHE_HPP_
+#define SRC_MODEL_PARSER_MODEL_CACHE_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cinttypes>
+#include <cstring>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "model/raw/model.hpp"
+#include "common/enn_debug.h"
+
+namespace enn {
+namespace model {
+
+// ContentHash is 128 bits MurmurHash3(x64_128) over the whole content of a model.
+//  Buffers of a model(model and its parameters) are chained by seeding a buffer with the digest of the previous one.
+class ContentHash {
+ public:
+    struct Digest {
+        uint64_t high;
+        uint64_t low;
+
+        bool operator==(const Digest& rhs) const {
+            return high == rhs.high && low == rhs.low;
+        }
+    };
+
+    static Digest of(const void* data, size_t size, Digest seed = {0, 0}) {
+        constexpr uint64_t c1 = 0x87c37b91114253d5ULL;
+        constexpr uint64_t c2 = 0x4cf5ad432745937fULL;
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        const size_t block_num = size / 16;
+        uint64_t h1 = seed.high;
+        uint64_t h2 = seed.low;
+
+        for (size_t i = 0; i < block_num; ++i) {
+            uint64_t k1, k2;
+            // memcpy for the model which is not 8 bytes aligned.
+            std::memcpy(&k1, bytes + i * 16, sizeof(k1));
+            std::memcpy(&k2, bytes + i * 16 + 8, sizeof(k2));
+
+            k1 *= c1; k1 = rotl(k1, 31); k1 *= c2; h1 ^= k1;
+            h1 = rotl(h1, 27); h1 += h2; h1 = h1 * 5 + 0x52dce729;
+            k2 *= c2; k2 = rotl(k2, 33); k2 *= c1; h2 ^= k2;
+            h2 = rotl(h2, 31); h2 += h1; h2 = h2 * 5 + 0x38495ab5;
+        }
+
+        const uint8_t* tail = bytes + block_num * 16;
+        const size_t tail_size = size & 15;
+        uint64_t k1 = 0;
+        uint64_t k2 = 0;
+        for (size_t i = tail_size; i > 8; --i) k2 ^= static_cast<uint64_t>(tail[i - 1]) << ((i - 9) * 8);
+        if (tail_size > 8) {
+            k2 *= c2; k2 = rotl(k2, 33); k2 *= c1; h2 ^= k2;
+        }
+        for (size_t i = std::min<size_t>(tail_size, 8); i > 0; --i) {
+            k1 ^= static_cast<uint64_t>(tail[i - 1]) << ((i - 1) * 8);
+        }
+        if (tail_size > 0) {
+            k1 *= c1; k1 = rotl(k1, 31); k1 *= c2; h1 ^= k1;
+        }
+
+        h1 ^= size; h2 ^= size;
+        h1 += h2; h2 += h1;
+        h1 = fmix(h1); h2 = fmix(h2);
+        h1 += h2; h2 += h1;
+        return {h1, h2};
+    }
+
+ private:
+    static uint64_t rotl(uint64_t x, int r) {
+        return (x << r) | (x >> (64 - r));
+    }
+
+    static uint64_t fmix(uint64_t k) {
+        k ^= k >> 33;
+        k *= 0xff51afd7ed558ccdULL;
+        k ^= k >> 33;
+        k *= 0xc4ceb9fe1a85ec53ULL;
+        k ^= k >> 33;
+        return k;
+    }
+};
+
+// Content of a model to be opened: the model and its parameters(of CGO) in the memory they are loaded in.
+//  Lookup is keyed by the size, type and a hash of samples of the content, which costs the same regardless of
+//  the size of the model. The hash of the whole content is taken once only when it is compared with a cached one
+//  of the same key, so a model opened first(or of a new size) is not hashed as a whole.
+class ModelContent {
+ public:
+    using Ptr = std::shared_ptr<const ModelContent>;
+
+    // Head and tail of each buffer are sampled into the key.
+    static constexpr size_t SAMPLE_SIZE = 4 * 1024;  // bytes
+
+    struct Key {
+        ContentHash::Digest sample;
+        uint64_t size;
+        ModelType type;
+
+        bool operator==(const Key& rhs) const {
+            return sample == rhs.sample && size == rhs.size && type == rhs.type;
+        }
+
+        struct Hash {
+            size_t operator()(const Key& key) const {
+                // The digest is uniformly distributed already.
+                return static_cast<size_t>(key.sample.low ^ key.size);
+            }
+        };
+    };
+
+    ModelContent(ModelType type, const ModelMemInfo& model, const std::vector<std::shared_ptr<ModelMemInfo>>& params)
+        : key_{{0, 0}, 0, type}, digest_{0, 0} {
+        buffers_.push_back({model.va, static_cast<size_t>(model.size)});
+        for (auto& param : params) buffers_.push_back({param->va, static_cast<size_t>(param->size)});
+        for (auto& buffer : buffers_) {
+            const uint8_t* bytes = static_cast<const uint8_t*>(buffer.va);
+            size_t head = std::min<size_t>(buffer.size, SAMPLE_SIZE);
+            size_t tail = std::min<size_t>(buffer.size - head, SAMPLE_SIZE);
+            key_.sample = ContentHash::of(bytes, head, key_.sample);
+            key_.sample = ContentHash::of(bytes + buffer.size - tail, tail, key_.sample);
+            key_.size += buffer.size;
+        }
+    }
+
+    const Key& get_key() const {
+        return key_;
+    }
+
+    // Hash of the whole content, which is taken at the first call. Thread-safe.
+    const ContentHash::Digest& get_digest() const {
+        std::call_once(digest_once_, [this]() {
+            for (auto& buffer : buffers_) digest_ = ContentHash::of(buffer.va, buffer.size, digest_);
+            digested_ = true;
+            ENN_DBG_PRINT("Content hash of model: 0x%016" PRIx64 "%016" PRIx64 ", size: %" PRIu64 "\n",
+                          digest_.high, digest_.low, key_.size);
+        });
+        return digest_;
+    }
+
+    bool is_digested() const {
+        return digested_;
+    }
+
+ private:
+    struct Buffer {
+        const void* va;
+        size_t size;
+    };
+
+    std::vector<Buffer> buffers_;
+    Key key_;
+    mutable ContentHash::Digest digest_;
+    mutable std::once_flag digest_once_;
+    mutable std::atomic<bool> digested_{false};
+};
+
+// ModelCache keeps raw models parsed before, so that opening a model of the same content skips parsing.
+//  - An entry is looked up by ModelContent::Key, and then matched by the hash of the whole content.
+//  - Entries are evicted in LRU order when the total size of models exceeds the capacity.
+//    The capacity 0 disables the cache.
+//  - The raw model refers to the memory the model is loaded in, and so does the content of its entry.
+//    The owner of the memory should bind it to the lifetime of the raw model before insertion,
+//    because the raw model outlives the model opened first.
+//  - All methods are thread-safe. The content is hashed out of the lock.
+class ModelCache {
+ public:
+    using UPtr = std::unique_ptr<ModelCache>;
+    using RawModelPtr = std::shared_ptr<raw::Model>;
+    using Key = ModelContent::Key;
+
+    struct Stats {
+        uint64_t hits;
+        uint64_t misses;
+        uint64_t evictions;
+        size_t entry_num;
+        size_t total_size;
+
+        double hit_rate() const {
+            uint64_t lookups = hits + misses;
+            return lookups ? static_cast<double>(hits) / lookups : 0.0;
+        }
+    };
+
+ private:
+    struct Entry {
+        ModelContent::Ptr content;
+        RawModelPtr raw_model;
+    };
+    using EntryList = std::list<Entry>;
+
+ public:
+    explicit ModelCache(size_t capacity) : capacity_{capacity}, total_size_{0}, hits_{0}, misses_{0}, evictions_{0} {}
+
+    ModelCache(const ModelCache&) = delete;
+    ModelCache& operator=(const ModelCache&) = delete;
+
+    bool is_enabled() const {
+        return capacity_ > 0;
+    }
+
+    size_t get_capacity() const {
+        return capacity_;
+    }
+
+    // Return the raw model cached with the same content, or nullptr.
+    RawModelPtr find(const ModelContent::Ptr& content) {
+        for (auto& candidate : get_candidates(content->get_key())) {
+            // The candidate keeps its raw model, and so the memory of its content, alive while hashed.
+            if (candidate.content->get_digest() == content->get_digest()) {
+                std::lock_guard<std::mutex> guard(mutex_);
+                ++hits_;
+                show_hit_rate("hit");
+                // Move the entry to the front as the most recently used, unless evicted meanwhile.
+                auto it = find_entry(candidate.content);
+                if (it != index_.end()) entries_.splice(entries_.begin(), entries_, it->second);
+                return candidate.raw_model;
+            }
+        }
+        std::lock_guard<std::mutex> guard(mutex_);
+        ++misses_;
+        show_hit_rate("miss");
+        return nullptr;
+    }
+
+    // Insert the raw model of the content. The entry exceeding the capacity by itself is not cached.
+    void insert(const ModelContent::Ptr& content, const RawModelPtr& raw_model) {
+        if (raw_model == nullptr || content->get_key().size > capacity_) return;
+        // Opened concurrently and parsed twice, or the key is shared by different contents. It is rare.
+        for (auto& candidate : get_candidates(content->get_key())) {
+            if (candidate.content->get_digest() == content->get_digest()) {
+                erase(candidate.content);
+                break;
+            }
+        }
+        // Evicted raw models are released out of the lock, because releasing one may release its memory.
+        EntryList evicted;
+        std::lock_guard<std::mutex> guard(mutex_);
+        entries_.push_front({content, raw_model});
+        index_.emplace(content->get_key(), entries_.begin());
+        total_size_ += content->get_key().size;
+        while (total_size_ > capacity_) {
+            auto& lru = entries_.back();
+            total_size_ -= lru.content->get_key().size;
+            index_.erase(find_entry(lru.content));
+            evicted.splice(evicted.end(), entries_, std::prev(entries_.end()));
+            ++evictions_;
+        }
+    }
+
+    void clear() {
+        EntryList evicted;
+        std::lock_guard<std::mutex> guard(mutex_);
+        index_.clear();
+        evicted.swap(entries_);
+        total_size_ = 0;
+    }
+
+    Stats get_stats() const {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return {hits_, misses_, evictions_, entries_.size(), total_size_};
+    }
+
+ private:
+    using Index = std::unordered_multimap<Key, EntryList::iterator, Key::Hash>;
+
+    // Copy of entries with the key, to be compared out of the lock.
+    std::vector<Entry> get_candidates(const Key& key) const {
+        std::vector<Entry> candidates;
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto range = index_.equal_range(key);
+        for (auto it = range.first; it != range.second; ++it) candidates.push_back(*it->second);
+        return candidates;
+    }
+
+    // Should be called with the lock.
+    Index::iterator find_entry(const ModelContent::Ptr& content) {
+        auto range = index_.equal_range(content->get_key());
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second->content == content) return it;
+        }
+        return index_.end();
+    }
+
+    void erase(const ModelContent::Ptr& content) {
+        EntryList erased;
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto it = find_entry(content);
+        if (it == index_.end()) return;
+        total_size_ -= content->get_key().size;
+        erased.splice(erased.end(), entries_, it->second);
+        index_.erase(it);
+    }
+
+    void show_hit_rate(const char* result) const {
+        uint64_t lookups = hits_ + misses_;
+        ENN_INFO_PRINT("ModelCache %s: hit rate %.1f%% (%" PRIu64 "/%" PRIu64 "), %zu entries, %zu bytes\n", result,
+                       100.0 * hits_ / lookups, hits_, lookups, entries_.size(), total_size_);
+    }
+
+ private:
+    const size_t capacity_;
+    size_t total_size_;
+    uint64_t hits_;
+    uint64_t misses_;
+    uint64_t evictions_;
+    mutable std::mutex mutex_;
+    EntryList entries_;  // front is the most recently used
+    Index index_;
+};
+
+};  // namespace model
+};  // namespace enn
+
+#endif  // SRC_MODEL_PARSER_MODEL_CACHE_HPP_
@@ -0,0 +1,199 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstring>
+#include <list>
+#include <thread>
+#include <vector>
+
+#include "model/parser/model_cache.hpp"
+
+using namespace enn::model;
+
+class ModelCacheTest : public testing::Test {
+ protected:
+    // Content of a model filled with the byte, in a buffer kept until the end of the test.
+    ModelContent::Ptr make_content(uint8_t byte, size_t size, ModelType type = ModelType::NNC) {
+        buffers_.emplace_back(size, byte);
+        return make_content(buffers_.back(), type);
+    }
+
+    static ModelContent::Ptr make_content(std::vector<uint8_t>& buffer, ModelType type = ModelType::NNC) {
+        return std::make_shared<ModelContent>(type, ModelMemInfo(buffer.data(), -1, buffer.size()),
+                                              std::vector<std::shared_ptr<ModelMemInfo>>{});
+    }
+
+    // Raw model which sets the flag when released.
+    static ModelCache::RawModelPtr make_raw_model(std::atomic<bool>* released = nullptr) {
+        return ModelCache::RawModelPtr(new raw::Model(), [released](raw::Model* raw_model) {
+            if (released) *released = true;
+            delete raw_model;
+        });
+    }
+
+    std::list<std::vector<uint8_t>> buffers_;
+};
+
+TEST_F(ModelCacheTest, content_hash_matches_murmur3_x64_128) {
+    const char* text = "The quick brown fox jumps over the lazy dog";
+    auto digest = ContentHash::of(text, std::strlen(text));
+    EXPECT_EQ(digest.high, 0xe34bbc7bbc071b6cULL);
+    EXPECT_EQ(digest.low, 0x7a433ca9c49a9347ULL);
+}
+
+TEST_F(ModelCacheTest, content_hash_covers_whole_content) {
+    // Models which differ only at the end, far beyond the first 100KB.
+    std::vector<uint8_t> model(1024 * 1024, 0x5a);
+    std::vector<uint8_t> other = model;
+    other.back() ^= 1;
+    EXPECT_FALSE(ContentHash::of(model.data(), model.size()) == ContentHash::of(other.data(), other.size()));
+    EXPECT_TRUE(ContentHash::of(model.data(), model.size()) == ContentHash::of(model.data(), model.size()));
+}
+
+TEST_F(ModelCacheTest, key_includes_parameters_and_type) {
+    std::vector<uint8_t> model(1000, 1), param_a(300, 2), param_b(300, 3);
+    ModelMemInfo model_info(model.data(), -1, model.size());
+    auto a = std::make_shared<ModelMemInfo>(param_a.data(), -1, param_a.size());
+    auto b = std::make_shared<ModelMemInfo>(param_b.data(), -1, param_b.size());
+
+    ModelContent content(ModelType::CGO, model_info, {a, b});
+    EXPECT_EQ(content.get_key().size, 1600);
+    EXPECT_EQ(content.get_key(), ModelContent(ModelType::CGO, model_info, {a, b}).get_key());
+    EXPECT_FALSE(content.get_key() == ModelContent(ModelType::CGO, model_info, {b, a}).get_key());
+    EXPECT_FALSE(content.get_key() == ModelContent(ModelType::CGO, model_info, {a}).get_key());
+    EXPECT_FALSE(ModelContent(ModelType::NNC, model_info, {}).get_key() ==
+                 ModelContent(ModelType::CGO, model_info, {}).get_key());
+}
+
+TEST_F(ModelCacheTest, hashes_whole_content_only_for_the_same_key) {
+    ModelCache cache(16 * 1024 * 1024);
+    auto first = make_content(1, 1024 * 1024);
+    EXPECT_EQ(cache.find(first), nullptr);
+    cache.insert(first, make_raw_model());
+    EXPECT_FALSE(first->is_digested());
+
+    // A model of another size is missed by the key.
+    auto other_size = make_content(1, 1024 * 1024 + 1);
+    EXPECT_EQ(cache.find(other_size), nullptr);
+    EXPECT_FALSE(other_size->is_digested());
+    EXPECT_FALSE(first->is_digested());
+
+    // A model which differs only in the middle, out of the samples, has the same key but is not hit.
+    auto retrained = make_content(1, 1024 * 1024);
+    buffers_.back()[512 * 1024] ^= 1;
+    EXPECT_EQ(retrained->get_key(), first->get_key());
+    EXPECT_EQ(cache.find(retrained), nullptr);
+    EXPECT_TRUE(retrained->is_digested());
+    EXPECT_TRUE(first->is_digested());
+
+    // Both of them are kept and hit.
+    auto raw_model = make_raw_model();
+    cache.insert(retrained, raw_model);
+    EXPECT_EQ(cache.get_stats().entry_num, 2);
+    auto first_raw_model = cache.find(first);
+    EXPECT_NE(first_raw_model, nullptr);
+    EXPECT_EQ(cache.find(make_content(1, 1024 * 1024)), first_raw_model);
+    auto same_as_retrained = make_content(1, 1024 * 1024);
+    buffers_.back()[512 * 1024] ^= 1;
+    EXPECT_EQ(cache.find(same_as_retrained), raw_model);
+}
+
+TEST_F(ModelCacheTest, reports_hit_rate) {
+    ModelCache cache(1000);
+    auto raw_model = make_raw_model();
+    EXPECT_EQ(cache.find(make_content(1, 100)), nullptr);
+    cache.insert(make_content(1, 100), raw_model);
+    EXPECT_EQ(cache.find(make_content(1, 100)), raw_model);
+    EXPECT_EQ(cache.find(make_content(1, 100)), raw_model);
+    EXPECT_EQ(cache.find(make_content(1, 100, ModelType::CGO)), nullptr);
+
+    auto stats = cache.get_stats();
+    EXPECT_EQ(stats.hits, 2);
+    EXPECT_EQ(stats.misses, 2);
+    EXPECT_EQ(stats.entry_num, 1);
+    EXPECT_EQ(stats.total_size, 100);
+    EXPECT_DOUBLE_EQ(stats.hit_rate(), 0.5);
+}
+
+TEST_F(ModelCacheTest, evicts_least_recently_used_over_capacity) {
+    ModelCache cache(300);
+    std::atomic<bool> released{false};
+    cache.insert(make_content(1, 100), make_raw_model(&released));
+    cache.insert(make_content(2, 100), make_raw_model());
+    cache.insert(make_content(3, 100), make_raw_model());
+    // Touch the first one, so that the second one is the least recently used.
+    EXPECT_NE(cache.find(make_content(1, 100)), nullptr);
+    cache.insert(make_content(4, 100), make_raw_model());
+
+    EXPECT_NE(cache.find(make_content(1, 100)), nullptr);
+    EXPECT_EQ(cache.find(make_content(2, 100)), nullptr);
+    EXPECT_NE(cache.find(make_content(3, 100)), nullptr);
+    EXPECT_NE(cache.find(make_content(4, 100)), nullptr);
+    EXPECT_EQ(cache.get_stats().evictions, 1);
+    EXPECT_EQ(cache.get_stats().total_size, 300);
+
+    cache.insert(make_content(5, 250), make_raw_model());
+    EXPECT_TRUE(released.load());
+    EXPECT_EQ(cache.get_stats().entry_num, 1);
+}
+
+TEST_F(ModelCacheTest, keeps_raw_model_in_use_after_eviction) {
+    ModelCache cache(100);
+    std::atomic<bool> released{false};
+    auto in_use = make_raw_model(&released);
+    cache.insert(make_content(1, 100), in_use);
+    cache.insert(make_content(2, 100), make_raw_model());
+    EXPECT_EQ(cache.find(make_content(1, 100)), nullptr);
+    EXPECT_FALSE(released.load());
+    in_use.reset();
+    EXPECT_TRUE(released.load());
+}
+
+TEST_F(ModelCacheTest, skips_model_larger_than_capacity) {
+    ModelCache cache(100);
+    cache.insert(make_content(1, 101), make_raw_model());
+    EXPECT_EQ(cache.find(make_content(1, 101)), nullptr);
+
+    ModelCache disabled(0);
+    EXPECT_FALSE(disabled.is_enabled());
+    disabled.insert(make_content(1, 1), make_raw_model());
+    EXPECT_EQ(disabled.get_stats().entry_num, 0);
+}
+
+TEST_F(ModelCacheTest, replaces_model_parsed_twice_by_concurrent_open) {
+    ModelCache cache(1000);
+    auto first = make_content(1, 100);
+    auto second = make_content(1, 100);
+    EXPECT_EQ(cache.find(first), nullptr);
+    EXPECT_EQ(cache.find(second), nullptr);
+    cache.insert(first, make_raw_model());
+    auto raw_model = make_raw_model();
+    cache.insert(second, raw_model);
+    EXPECT_EQ(cache.get_stats().entry_num, 1);
+    EXPECT_EQ(cache.get_stats().total_size, 100);
+    EXPECT_EQ(cache.find(first), raw_model);
+}
+
+TEST_F(ModelCacheTest, is_safe_for_concurrent_open) {
+    constexpr int kThreadNum = 8;
+    constexpr int kOpenNum = 2000;
+    constexpr uint64_t kModelNum = 16;
+    ModelCache cache(kModelNum / 2 * 100);
+    std::vector<std::vector<uint8_t>> models;
+    for (uint64_t i = 0; i < kModelNum; ++i) models.emplace_back(100, static_cast<uint8_t>(i));
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreadNum; ++t) {
+        threads.emplace_back([&cache, &models, t]() {
+            for (int i = 0; i < kOpenNum; ++i) {
+                auto content = make_content(models[(t + i) % kModelNum]);
+                if (cache.find(content) == nullptr) cache.insert(content, make_raw_model());
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    auto stats = cache.get_stats();
+    EXPECT_EQ(stats.hits + stats.misses, kThreadNum * kOpenNum);
+    EXPECT_LE(stats.total_size, cache.get_capacity());
+    EXPECT_EQ(stats.total_size, stats.entry_num * 100);
+}
@@ -1,4 +1,3 @@
-#include <unordered_map>
 #include <future>
 #include <iostream>
 
@@ -36,10 +35,6 @@ public:
                 ENN_ERR_PRINT("Not Supported model type : %d\n", (int)model_type);
                 break;
         }
-
-        if (parse_strategy != nullptr && parse_strategy->is_verified()) {
-            hash_key = get_hashcode(model->va, model->size);
-        }
     }
 
     // This function is main part which parses data from input and, converts and generates memory,
@@ -56,12 +51,7 @@ public:
             return nullptr;
         }
 
-        // Check if it already has it with key generated by hash function
-        // Required, ToDo(empire.jung, 6/30): Enable it again if thread-safe is guaranteed.
-        // if (model_cache.find(hash_key) != model_cache.end()) {
-        //     return model_cache[hash_key];
-        // }
-
+        // Models parsed before are cached by the Engine with ModelCache(model_cache.hpp).
         parse_strategy->pre_execute();
 
         // Nice to have, ToDo(empire.jung, TBD): Check thread configuration and optimal count
@@ -95,44 +85,16 @@ public:
         parse_strategy->print();
 #endif
 
-        model_cache[hash_key] = parse_strategy->result();
-
-        return model_cache[hash_key];
-    }
-
-    void init_cache() {
-        model_cache.clear();
+        return parse_strategy->result();
     }
 
 private:
     std::unique_ptr<ParseStrategy> parse_strategy;
-
-    uint64_t hash_key = 0;
-    std::unordered_map<uint64_t, std::shared_ptr<raw::Model>> model_cache;
-
-    // Nice to have, ToDo(empire.jung, TBD): Change to use std::hash
-    uint64_t get_hashcode(void* model_va, const uint32_t model_size) {
-        uint64_t hash_code = 9973;
-
-        int loop_size = (model_size > 102400) ? 102400 : model_size;
-
-        for (int i = 0; i < loop_size; ++i) {
-            hash_code = 127 * hash_code + static_cast<unsigned char*>(model_va)[i];
-        }
-
-        ENN_DBG_PRINT("Hash code : 0x%" PRIx64 "\n", hash_code);
-
-        return hash_code;
-    }
 };
 
-Parser::Parser() : impl_(std::make_unique<Impl>()) {
-    impl_->init_cache();
-}
+Parser::Parser() : impl_(std::make_unique<Impl>()) {}
 
-Parser::~Parser() {
-    impl_->init_cache();
-}
+Parser::~Parser() = default;
 
 void Parser::Set(const ModelType& model_type, const std::shared_ptr<ModelMemInfo> model,
                  const std::shared_ptr<std::vector<std::shared_ptr<enn::model::ModelMemInfo>>> params) {
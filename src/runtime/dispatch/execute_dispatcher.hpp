@@ -2,6 +2,7 @@
 #define SRC_RUNTIME_DISPATCH_EXECUTE_DISPATCHER_HPP_
 
 #include <memory>
+#include <string>
 
 #include "runtime/dispatch/dispatcher_interface.hpp"
 
@@ -25,30 +26,31 @@ class ExecuteDispatcher : public IDispatcher {
         auto target_hw = operator_list_execute_request.get_accelerator();
         ENN_DBG_COUT << "Dispatch a OperatorListExecuteRequest from the ExecutableOperatorList(ID: "
             << operator_list_execute_request.get_executable_operator_list_id() << ") to execute." << std::endl;
+        auto user_driver = get_user_driver(target_hw);
+        if (user_driver == nullptr) {
+            ENN_ERR_PRINT("[Error] Unsuppoerted hardware : %d", (int)target_hw);
+            throw std::runtime_error("Not Supported Hardware to Execute");
+        }
+        if (user_driver->ExecuteSubGraph(operator_list_execute_request) != ENN_RET_SUCCESS) {
+            throw std::runtime_error("Failed Execute SubGraph on hardware " + std::to_string((int)target_hw));
+        }
+    }
+
+    // Return the userdriver that executes OperatorLists for the target hardware, or nullptr if not supported.
+    //  An ExecuteRequest resolves it once when its execution plan is frozen.
+    ud::UserDriver* get_user_driver(model::Accelerator target_hw) {
         if (available_accelerator(target_hw, model::Accelerator::NPU)) {
-            if (npu_user_driver_.ExecuteSubGraph(operator_list_execute_request) != ENN_RET_SUCCESS) {
-                throw std::runtime_error("Failed NPU Execute SubGraph");
-            }
+            return &npu_user_driver_;
         } else if (available_accelerator(target_hw, model::Accelerator::DSP)) {
-            if (dsp_user_driver_.ExecuteSubGraph(operator_list_execute_request) != ENN_RET_SUCCESS) {
-                throw std::runtime_error("Failed DSP Execute SubGraph");
-            }
+            return &dsp_user_driver_;
         } else if (available_accelerator(target_hw, model::Accelerator::CPU)) {
-            if (cpu_user_driver_.ExecuteSubGraph(operator_list_execute_request) != ENN_RET_SUCCESS) {
-                throw std::runtime_error("Failed CPU Execute SubGraph");
-            }
+            return &cpu_user_driver_;
         } else if (available_accelerator(target_hw, model::Accelerator::GPU)) {
-            if (gpu_user_driver_.ExecuteSubGraph(operator_list_execute_request) != ENN_RET_SUCCESS) {
-                throw std::runtime_error("Failed GPU Execute SubGraph");
-            }
+            return &gpu_user_driver_;
         } else if (available_accelerator(target_hw, model::Accelerator::UNIFIED)) {
-            if (unified_user_driver_.ExecuteSubGraph(operator_list_execute_request) != ENN_RET_SUCCESS) {
-                throw std::runtime_error("Fail Unified UD Execute SubGraph");
-            }
-        } else {
-            ENN_ERR_PRINT("[Error] Unsuppoerted hardware : %d", (int)target_hw);
-            throw std::runtime_error("Not Supported Hardware to Execute");
+            return &unified_user_driver_;
         }
+        return nullptr;
     }
 
 private:
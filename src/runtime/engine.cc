@@ -2,6 +2,7 @@
 #include "runtime/userdriver_manager.hpp"
 #include "model/model.hpp"
 #include "model/parser/parser.hpp"
+#include "model/parser/model_cache.hpp"
 #include "model/raw/model.hpp"
 #include "model/raw/data/operator.hpp"
 #include "common/enn_memory_manager.h"
@@ -10,36 +11,87 @@
 #include "runtime/scheduler/static_scheduler.hpp"
 #include "tool/profiler/include/ExynosNnProfilerApi.h"
 #include "runtime/execute_request/execute_request.hpp"
+#include "runtime/execute_request/async_executor.hpp"
+#include "runtime/execute_request/pipeline_executor.hpp"
+#include "runtime/metrics/model_statistics.hpp"
 #include "runtime/client_process/client_process.hpp"
 #include "common/enn_preference_generator.hpp"
 #include "tool/dumper/frequency_dumper.hpp"
 #include "tool/dumper/utilization_dumper.hpp"
 #include "common/identifier_chopper.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <cinttypes>
 #include <string>
+#include <mutex>
+#include <unordered_map>
 
 namespace enn {
 namespace runtime {
 
 using namespace dispatch;
 
+// Parameters referred in place of the mapped model file are warmed up in background after open.
+//  In Android, they are loaded in ION memory by client already, so it is enabled by the property only.
+const std::string PARAMETER_PREFETCH_PROPERTY{"vendor.enn.parameter.prefetch"};
+
+static bool is_parameter_prefetch_enabled() {
+    uint64_t enabled = 0;
+    if (enn::util::get_environment_property(PARAMETER_PREFETCH_PROPERTY, &enabled) == ENN_RET_SUCCESS) {
+        return enabled != 0;
+    }
+#ifdef ENN_ANDROID_BUILD
+    return false;
+#else
+    return true;
+#endif
+}
+
+// Total size of parsed models kept to be reused by opening a model of the same content, in bytes.
+const std::string MODEL_CACHE_CAPACITY_PROPERTY{"vendor.enn.model_cache.capacity"};
+
+static size_t get_model_cache_capacity() {
+    uint64_t capacity = 0;
+    if (enn::util::get_environment_property(MODEL_CACHE_CAPACITY_PROPERTY, &capacity) == ENN_RET_SUCCESS) {
+        return static_cast<size_t>(capacity);
+    }
+#ifdef ENN_MEDIUM_IF_HIDL
+    return 16 * 1024 * 1024;
+#else
+    // Without HIDL, the model memory is the buffer of client freed at EnnCloseModel, so the raw model cannot be
+    //  shared beyond the model opened first. Enable it by the property only if clients keep the buffers alive.
+    return 0;
+#endif
+}
+
 // Engine's implementation class
 class Engine::EngineImpl {
  public:
     EngineImpl()
         : memory_manager_(std::make_unique<enn::EnnMemoryManager>()),
           userdriver_manager_(std::make_unique<UserdriverManager>()),
-          model_pool_manager_(std::make_unique<pool::Manager>()) {
+          model_pool_manager_(std::make_unique<pool::Manager>()),
+          model_cache_(std::make_unique<model::ModelCache>(get_model_cache_capacity())),
+          statistics_(std::make_unique<metrics::StatisticsRegistry>()),
+          stage_executor_(std::make_unique<execute::AsyncExecutor>()),
+          async_executor_(std::make_unique<execute::AsyncExecutor>()) {
         memory_manager_->init();
     }
     ~EngineImpl() {
+        auto stats = model_cache_->get_stats();
+        ENN_INFO_PRINT("ModelCache: hit rate %.1f%% (hits %" PRIu64 ", misses %" PRIu64 ", evictions %" PRIu64 ")\n",
+                       100.0 * stats.hit_rate(), stats.hits, stats.misses, stats.evictions);
+        model_cache_->clear();
         memory_manager_->deinit();
     }
     EnnRet init();
     Engine::ModelID open_model(const LoadParameter& load_param, SessionBufInfo* session_info);
     Engine::ExecutableModelID commit_execution_data(const Engine::ModelID model_id, const InferenceData& exec_data);
     EnnRet execute_model(const std::vector<Engine::ExecutableModelID>& exec_id_list);
+    std::future<EnnRet> execute_model_async(const std::vector<Engine::ExecutableModelID>& exec_id_list);
+    EnnRet set_execution_pipeline(Engine::ModelID model_id, uint32_t queue_depth);
+    EnnRet get_model_statistics(Engine::ModelID model_id, EnnModelStatistics* statistics);
     EnnRet release_execution_data(Engine::ExecutableModelID exec_id);
     EnnRet close_model(Engine::ModelID model_id);
     EnnRet deinit();
@@ -53,6 +105,8 @@ private:
     std::vector<EnnBufferCore::Ptr> read_param_mem_infos_from(const std::vector<BufferCore> &params_in_model);
     void fill_session_info(SessionBufInfo* session_info, const model::Model::Ptr& enn_model);
     void create_execute_request();
+    execute::PipelineSlot::Ptr find_pipeline_slot(Engine::ModelID model_id);
+    execute::PipelineSlot::Ptr remove_pipeline_slot(Engine::ModelID model_id);
     // Private members of EngineImpl have to provide thread safety since Engine is Singleton.
     // However, the following actors locally constructed and distructed to avoid data race condition.
     //  @ Actor classes locally created and depended by EngineImpl, which do not guarantee MT-safe.
@@ -62,6 +116,20 @@ private:
     std::unique_ptr<enn::EnnMemoryManager> memory_manager_;
     UserdriverManager::UPtr userdriver_manager_;  // keeps userdriver instances
     pool::Manager::UPtr model_pool_manager_;
+    // Raw models parsed before, shared by models opened with the same content.
+    model::ModelCache::UPtr model_cache_;
+    // Latency histograms of models opened, which are always updated on the execution path with atomics.
+    metrics::StatisticsRegistry::UPtr statistics_;
+    // Pipeline slots of models opened, keyed by model id. ExecuteRequests keep the slot of their model,
+    //  so this map is only looked up on open, commit, pipeline setting and close.
+    std::mutex pipeline_mutex_;
+    std::unordered_map<Engine::ModelID, execute::PipelineSlot::Ptr> pipelines_;
+    // Worker pool running OperatorLists of an execution concurrently, which is released after async_executor_
+    //  as asynchronous executions submit to it.
+    execute::AsyncExecutor::UPtr stage_executor_;
+    // Worker pool for asynchronous execution. It should be declared last so that
+    //  it is released first and pending executions finish before others are destructed.
+    execute::AsyncExecutor::UPtr async_executor_;
 };
 
 EnnRet Engine::EngineImpl::init() {
@@ -92,7 +160,18 @@ EnnBufferCore::Ptr create_memory(std::unique_ptr<enn::EnnMemoryManager>& emm, co
 #endif
 }
 
+// Bind memory objects the raw model refers to into the lifetime of the raw model.
+//  They are released when the last owner(ModelCache or Model) releases the returned raw model.
+std::shared_ptr<model::raw::Model> bind_memory(IEnnMemoryManager* emm, const std::shared_ptr<model::raw::Model>& raw_model,
+                                               EnnBufferCore::Ptr model_memory, std::vector<EnnBufferCore::Ptr> params) {
+    params.push_back(std::move(model_memory));
+    return std::shared_ptr<model::raw::Model>(raw_model.get(), [emm, raw_model, params](model::raw::Model*) {
+        for (auto& mem_obj : params) emm->DeleteMemory(mem_obj);
+    });
+}
+
 Engine::ModelID Engine::EngineImpl::open_model(const LoadParameter& load_param, SessionBufInfo *session_info) {
+    auto start = std::chrono::steady_clock::now();
     // 1. check if client process coming called init().
     ClientProcess::Ptr access_client = nullptr;
     try {
@@ -120,10 +199,31 @@ Engine::ModelID Engine::EngineImpl::open_model(const LoadParameter& load_param,
             std::make_shared<enn::model::ModelMemInfo>(mem_obj->va, mem_obj->fd, mem_obj->size, mem_obj->offset));
     }
 
-    // 3. Parser to generate Raw Model From Memory.
-    model::Parser parser;
-    parser.Set(model_type, model_mem_info, param_mem_infos);
-    auto raw_model = parser.Parse();
+    // 3. Parser to generate Raw Model From Memory, unless the same content is parsed before.
+    std::shared_ptr<model::raw::Model> raw_model;
+    model::ModelContent::Ptr model_content;
+    if (model_cache_->is_enabled()) {
+        model_content = std::make_shared<model::ModelContent>(model_type, *model_mem_info, *param_mem_infos);
+        raw_model = model_cache_->find(model_content);
+    }
+    if (raw_model != nullptr) {
+        // The cached raw model refers to the memory of the model parsed first, which it keeps alive.
+        memory_manager_->DeleteMemory(memory_for_model);
+        for (auto& mem_obj : param_mem_objs) memory_manager_->DeleteMemory(mem_obj);
+        memory_for_model = nullptr;
+        param_mem_objs.clear();
+    } else {
+        model::Parser parser;
+        parser.Set(model_type, model_mem_info, param_mem_infos);
+        raw_model = parser.Parse();
+        if (model_cache_->is_enabled() && raw_model != nullptr) {
+            // Bind the memory to the raw model, which can outlive this model in the cache.
+            raw_model = bind_memory(memory_manager_.get(), raw_model, memory_for_model, std::move(param_mem_objs));
+            memory_for_model = nullptr;
+            param_mem_objs.clear();
+            model_cache_->insert(model_content, raw_model);
+        }
+    }
 
     // 4. Generator to generate Enn Model From Raw Model.
     model::Generator model_generator;
@@ -134,17 +234,21 @@ Engine::ModelID Engine::EngineImpl::open_model(const LoadParameter& load_param,
     CATCH(what) {
         ENN_ERR_COUT << "failed: " << what << std::endl;
         // Delete mem_loaded_model object created by memory_manager_->CreateMemory*(...)
-        memory_manager_->DeleteMemory(memory_for_model);
+        if (memory_for_model != nullptr) memory_manager_->DeleteMemory(memory_for_model);
         return 0;
     }
     END_TRY
 
     // Pass memory_object and memory_manager to release memory_object when model is released.
+    //  Memory bound to the raw model is released with the raw model instead.
     for (auto &mem_obj : param_mem_objs)
         enn_model->add_memory_object(mem_obj);
 
-    enn_model->add_memory_object(memory_for_model)
-             ->set_memory_manager(memory_manager_.get());
+    if (memory_for_model != nullptr)
+        enn_model->add_memory_object(memory_for_model);
+    if (model_cache_->is_enabled())
+        enn_model->set_raw_model(raw_model);
+    enn_model->set_memory_manager(memory_manager_.get());
 
     // 5. Static Schedule to Creat Op List for UD.
     enn::preference::EnnPreferenceGenerator pref_generator(load_param.preferences.u32_v);
@@ -161,6 +265,9 @@ Engine::ModelID Engine::EngineImpl::open_model(const LoadParameter& load_param,
                     .run();
 
     // 6. Dispatch Op List to UD.
+    if (is_parameter_prefetch_enabled()) {
+        enn_model->set_parameter_prefetcher(std::make_unique<model::memory::ParameterPrefetcher>());
+    }
     try {
         enn_model->set_open_dispatcher(userdriver_manager_->create_open_dispatcher())
                  ->set_close_dispatcher(userdriver_manager_->create_close_dispatcher())
@@ -195,6 +302,21 @@ Engine::ModelID Engine::EngineImpl::open_model(const LoadParameter& load_param,
         dump::FrequencyDumper::get_instance()->start_dump();
 #endif
 
+    // 9. Create latency histograms of the model, with OperatorLists in the order ExecuteRequest dispatches them.
+    //  Predicted latencies are reported along with them, to be compared with the actual ones.
+    std::vector<metrics::ModelStatistics::OperatorListInfo> operator_lists;
+    if (enn_model->get_scheduled_graph() && enn_model->get_scheduled_graph()->get_start_vertex()) {
+        for (auto& opr_list : enn_model->get_scheduled_graph()->order<model::graph::iterator::TopologicalSort>()) {
+            operator_lists.push_back({opr_list->get_id().get(), opr_list->get_accelerator(),
+                                      opr_list->get_predicted_latency() * 1000ull});
+        }
+    }
+    statistics_->add(enn_model->get_id().get(), operator_lists)->open().record_since(start);
+    {
+        std::lock_guard<std::mutex> guard(pipeline_mutex_);
+        pipelines_[enn_model->get_id().get()] = std::make_shared<execute::PipelineSlot>();
+    }
+
     // TODO(yc18.cho, TBD): Change the id to the ExecutableModelID after release_execution_data() is enabled.
     // Start to profile with model id
     START_PROFILER(enn_model->get_id().get());
@@ -207,6 +329,7 @@ Engine::ExecutableModelID Engine::EngineImpl::commit_execution_data(const Engine
     // NOTE(hoon98.choi): Please modify the below lines after implementation is done
     ENN_INFO_PRINT("called from pid %d\n", enn::util::get_caller_pid());
     ENN_INFO_PRINT("  - n_region: %d\n", exec_data.n_region);
+    auto start = std::chrono::steady_clock::now();
 
     // ExecutableModel object to be created and returned.
     ExecutableModel::Ptr executable_model = nullptr;
@@ -244,6 +367,11 @@ Engine::ExecutableModelID Engine::EngineImpl::commit_execution_data(const Engine
     try {
         // create ExecuteRequest by ExecutableModel and add it to pool.
         execute::ExecuteRequest::Ptr execute_request = execute::ExecuteRequest::create(executable_model);
+        // Resolve userdrivers of OperatorLists once, so that executions don't look them up again.
+        execute_request->freeze(userdriver_manager_->create_execute_dispatcher());
+        execute_request->set_statistics(statistics_->find(model_id));
+        execute_request->set_stage_executor(stage_executor_.get());
+        execute_request->set_pipeline_slot(find_pipeline_slot(model_id));
         model_pool_manager_->add(std::move(execute_request));
     } catch (const std::exception& ex) {
         // remove ExecutableModel object from Pool to release to one created in this function.
@@ -256,6 +384,8 @@ Engine::ExecutableModelID Engine::EngineImpl::commit_execution_data(const Engine
         ENN_ERR_COUT << "commit_execution_data() is failed" << std::endl;
         return 0;
     }
+    auto statistics = statistics_->find(model_id);
+    if (statistics) statistics->commit().record_since(start);
     // NOTE(hoon98.choi): zero means "Error". Please assign appropriate ID
     return executable_model->get_id();
 }
@@ -266,8 +396,13 @@ EnnRet Engine::EngineImpl::execute_model(const std::vector<Engine::ExecutableMod
 
     ENN_INFO_PRINT("Exec_id_list[0] = 0x%" PRIX64 "\n", exec_id_list[0]);
     try {
-        model_pool_manager_->get<execute::ExecuteRequest>(exec_id_list[0])
-                           ->execute(userdriver_manager_->create_execute_dispatcher());
+        auto execute_request = model_pool_manager_->get<execute::ExecuteRequest>(exec_id_list[0]);
+        auto pipeline = execute_request->get_pipeline();
+        if (pipeline) {
+            // Executions requested from different threads are overlapped by the pipeline.
+            return execute_request->execute_pipelined(*pipeline).get();
+        }
+        execute_request->execute();
     } catch (const std::exception& ex) {
         ENN_ERR_COUT << ex.what() << std::endl;
         ENN_ERR_COUT << "execute_model() is failed" << std::endl;
@@ -276,6 +411,78 @@ EnnRet Engine::EngineImpl::execute_model(const std::vector<Engine::ExecutableMod
     return ENN_RET_SUCCESS;
 }
 
+template <typename T>
+static std::future<T> make_ready_future(T value) {
+    std::promise<T> promise;
+    promise.set_value(value);
+    return promise.get_future();
+}
+
+std::future<EnnRet> Engine::EngineImpl::execute_model_async(const std::vector<Engine::ExecutableModelID>& exec_id_list) {
+    ENN_INFO_PRINT("Exec_id_list[0] = 0x%" PRIX64 "\n", exec_id_list[0]);
+    try {
+        auto execute_request = model_pool_manager_->get<execute::ExecuteRequest>(exec_id_list[0]);
+        auto pipeline = execute_request->get_pipeline();
+        if (pipeline) {
+            return execute_request->execute_pipelined(*pipeline);
+        }
+        return execute_request->execute_async(*async_executor_);
+    } catch (const std::exception& ex) {
+        ENN_ERR_COUT << ex.what() << std::endl;
+        ENN_ERR_COUT << "execute_model_async() is failed" << std::endl;
+        return make_ready_future(ENN_RET_FAILED);
+    }
+}
+
+execute::PipelineSlot::Ptr Engine::EngineImpl::find_pipeline_slot(Engine::ModelID model_id) {
+    std::lock_guard<std::mutex> guard(pipeline_mutex_);
+    auto it = pipelines_.find(model_id);
+    return it == pipelines_.end() ? nullptr : it->second;
+}
+
+execute::PipelineSlot::Ptr Engine::EngineImpl::remove_pipeline_slot(Engine::ModelID model_id) {
+    std::lock_guard<std::mutex> guard(pipeline_mutex_);
+    auto it = pipelines_.find(model_id);
+    if (it == pipelines_.end()) return nullptr;
+    auto slot = std::move(it->second);
+    pipelines_.erase(it);
+    return slot;
+}
+
+EnnRet Engine::EngineImpl::set_execution_pipeline(Engine::ModelID model_id, uint32_t queue_depth) {
+    ENN_INFO_PRINT("Model ID(0x%" PRIX64 "), queue depth: %u\n", model_id, queue_depth);
+    auto slot = find_pipeline_slot(model_id);
+    if (slot == nullptr) {
+        ENN_ERR_PRINT("Model ID(0x%" PRIX64 ") is not opened\n", model_id);
+        return ENN_RET_FAILED;
+    }
+    // The old pipeline is drained here, out of pipeline_mutex_.
+    slot->reset();
+    if (queue_depth == 0) {
+        return ENN_RET_SUCCESS;
+    }
+    try {
+        auto enn_model = model_pool_manager_->get<model::Model>(model_id);
+        slot->reset(std::make_shared<execute::PipelineExecutor>(
+            enn_model->get_scheduled_graph()->vertex_count(), queue_depth));
+    } catch (const std::exception& ex) {
+        ENN_ERR_COUT << ex.what() << std::endl;
+        ENN_ERR_COUT << "set_execution_pipeline() is failed" << std::endl;
+        return ENN_RET_FAILED;
+    }
+    return ENN_RET_SUCCESS;
+}
+
+EnnRet Engine::EngineImpl::get_model_statistics(Engine::ModelID model_id, EnnModelStatistics* statistics) {
+    auto model_statistics = statistics_->find(model_id);
+    if (model_statistics == nullptr || statistics == nullptr) {
+        ENN_ERR_PRINT("Statistics of Model ID(0x%" PRIX64 ") is not found\n", model_id);
+        return ENN_RET_INVAL;
+    }
+    model_statistics->fill(statistics);
+    return ENN_RET_SUCCESS;
+}
+
 EnnRet Engine::EngineImpl::release_execution_data(Engine::ExecutableModelID exec_id) {
     // TODO(hoon98.choi, TBD after exe_graph is done): implement: API -> mediuminterface -> IPC -> call this
     ENN_DBG_PRINT("Release Execution Data Start: ExecuteModelId[%ju]\n", exec_id);
@@ -299,6 +506,10 @@ EnnRet Engine::EngineImpl::close_model(Engine::ModelID model_id) {
     FINISH_PROFILER(model_id);
 
     ENN_INFO_PRINT(" received:  Model ID(0x%" PRIX64 ")\n", model_id);
+    // Frames in the pipeline are completed before the model is released.
+    auto pipeline_slot = remove_pipeline_slot(model_id);
+    if (pipeline_slot) pipeline_slot->reset();
+    statistics_->remove(model_id);
 
     try {
         model_pool_manager_->release<model::Model>(model_id);
@@ -338,7 +549,7 @@ EnnRet Engine::EngineImpl::shutdown_client_process(uint64_t client_pid) {
 }
 
 Buffer fill_user_buffer_info_by(const std::vector<model::metadata::BufferMetaData::Ptr>& meta_data_vector,
-                                size_t meta_data_index, int32_t& prev_region_index) {
+                                size_t meta_data_index) {
     Buffer user_buffer;
     auto& current_meta_data = meta_data_vector.at(meta_data_index);
 
@@ -351,16 +562,8 @@ Buffer fill_user_buffer_info_by(const std::vector<model::metadata::BufferMetaDat
     user_buffer.shape.c = current_meta_data->get_shape()[C_NCHW];
     user_buffer.shape.h = current_meta_data->get_shape()[H_NCHW];
     user_buffer.shape.w = current_meta_data->get_shape()[W_NCHW];
-
-    if ((prev_region_index != current_meta_data->get_region_index()) || (meta_data_index == 0)) {
-        user_buffer.offset = 0;
-    } else {
-        //  Same region index of Current & Prev data means Binding Buffer.
-        size_t prev_user_buffer_size = meta_data_vector.at(meta_data_index - 1)->get_size();
-        size_t prev_user_buffer_offset = meta_data_vector.at(meta_data_index - 1)->get_offset();
-        current_meta_data->set_offset(prev_user_buffer_size + prev_user_buffer_offset);
-        user_buffer.offset = current_meta_data->get_offset();
-    }
+    // Offset in the region is laid out by Generator, for bound buffers and intermediate buffers sharing a region.
+    user_buffer.offset = current_meta_data->get_offset();
 
     switch (current_meta_data->get_direction()) {
      case enn::model::Direction::Input :
@@ -382,26 +585,17 @@ Buffer fill_user_buffer_info_by(const std::vector<model::metadata::BufferMetaDat
     return user_buffer;
 }
 
-void fill_region_info_by(Buffer& current_user_buffer, SessionBufInfo* session_info,
-                         size_t& region_count, int32_t& prev_region_index) {
-    // Fill region when Current & Prev Region index is different.
-    // If same, increase the size of Prev Region.
-    if (current_user_buffer.region_idx != prev_region_index) {
-        // TODO(yc18.cho&hoon98.choi, TBD): implement factory/setter functions for HIDL struct.
-        Region region;
-        region.req_size = current_user_buffer.size;
-        region.attr = 0;  // initalized value
-
-        session_info->regions[current_user_buffer.region_idx] = region;
-        prev_region_index = current_user_buffer.region_idx;
-        region_count++;
-        ENN_DBG_COUT << "Region Created - id[" << current_user_buffer.region_idx << "] : size["
-                        << region.req_size << "]" << std::endl;
-    } else {
-        session_info->regions[prev_region_index].req_size += current_user_buffer.size;
-        ENN_DBG_COUT << "Region Request Size is increased - id[" << current_user_buffer.region_idx
-                        << "] : size[" << session_info->regions[prev_region_index].req_size << "]" << std::endl;
+void fill_region_info_by(Buffer& current_user_buffer, SessionBufInfo* session_info, size_t& region_count) {
+    // A region is large enough for the buffer at the furthest end of it.
+    //  Regions are initialized with zero size, as buffers of a region may not be in a row.
+    auto& region = session_info->regions[current_user_buffer.region_idx];
+    size_t end_of_buffer = current_user_buffer.offset + current_user_buffer.size;
+    if (region.req_size < end_of_buffer) {
+        region.req_size = end_of_buffer;
+        ENN_DBG_COUT << "Region Request Size is set - id[" << current_user_buffer.region_idx
+                        << "] : size[" << region.req_size << "]" << std::endl;
     }
+    region_count = std::max<size_t>(region_count, current_user_buffer.region_idx + 1);
 }
 
 void Engine::EngineImpl::fill_session_info(SessionBufInfo* session_info, const model::Model::Ptr& enn_model) {
@@ -410,17 +604,20 @@ void Engine::EngineImpl::fill_session_info(SessionBufInfo* session_info, const m
 
     size_t buffer_meta_data_num = enn_model->get_buffer_meta_data().size();
     session_info->buffers.resize(buffer_meta_data_num);
-    session_info->regions.resize(buffer_meta_data_num);
+    // TODO(yc18.cho&hoon98.choi, TBD): implement factory/setter functions for HIDL struct.
+    Region empty_region;
+    empty_region.req_size = 0;
+    empty_region.attr = 0;  // initalized value
+    session_info->regions.assign(buffer_meta_data_num, empty_region);
     size_t region_count = 0;
-    int32_t prev_region_idx = model::UNDEFINED;
     for (size_t i = 0; i < buffer_meta_data_num; i++) {
 
         // Fill Buffers
-        Buffer user_buffer = fill_user_buffer_info_by(enn_model->get_buffer_meta_data(), i, prev_region_idx);
+        Buffer user_buffer = fill_user_buffer_info_by(enn_model->get_buffer_meta_data(), i);
         session_info->buffers[i] = user_buffer;
 
         // Fill Regions
-        fill_region_info_by(user_buffer, session_info, region_count, prev_region_idx);
+        fill_region_info_by(user_buffer, session_info, region_count);
     }
 
     if (buffer_meta_data_num != region_count) {
@@ -522,6 +719,18 @@ Engine::EnnRet Engine::execute_model(const std::vector<Engine::ExecutableModelID
     return impl_->execute_model(exec_id_list);
 }
 
+std::future<Engine::EnnRet> Engine::execute_model_async(const std::vector<Engine::ExecutableModelID>& exec_id_list) {
+    return impl_->execute_model_async(exec_id_list);
+}
+
+Engine::EnnRet Engine::set_execution_pipeline(Engine::ModelID model_id, uint32_t queue_depth) {
+    return impl_->set_execution_pipeline(model_id, queue_depth);
+}
+
+Engine::EnnRet Engine::get_model_statistics(Engine::ModelID model_id, EnnModelStatistics* statistics) {
+    return impl_->get_model_statistics(model_id, statistics);
+}
+
 Engine::EnnRet Engine::release_execution_data(Engine::ExecutableModelID exec_id) {
     return impl_->release_execution_data(exec_id);
 }
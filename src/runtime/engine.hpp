@@ -1,6 +1,7 @@
 #ifndef SRC_RUNTIME_ENGINE_HPP_
 #define SRC_RUNTIME_ENGINE_HPP_
 
+#include <future>
 #include <mutex>
 #include <vector>
 
@@ -62,6 +63,22 @@ public:
     //  Second parameter should be end output buffer's array so that Engine can set the result of execution.
     EnnRet execute_model(const std::vector<ExecutableModelID>& exec_id_list);
 
+    // It executes model asynchronously on the worker pool of Engine and returns immediately.
+    //  The result of execution is delivered through the returned future.
+    //  Executions from the same model are run in the order they are requested.
+    std::future<EnnRet> execute_model_async(const std::vector<ExecutableModelID>& exec_id_list);
+
+    // It enables pipelined execution of a model for asynchronous executions.
+    //  Each OperatorList of the model becomes a stage of the pipeline, so that executions from
+    //  different executable models(sessions) of the model overlap on different accelerators.
+    //  Up to queue_depth executions are in the pipeline, and more executions wait for a free slot.
+    //  Zero queue_depth disables it.
+    EnnRet set_execution_pipeline(ModelID model_id, uint32_t queue_depth);
+
+    // It fills latency distributions of a model opened: open, commit, execute, queue wait and device time of
+    //  each OperatorList and userdriver. They are kept from open to close of the model without profiler.
+    EnnRet get_model_statistics(ModelID model_id, EnnModelStatistics* statistics);
+
     // It release executable model loaded by load_executable_model API function.
     //  Except for the static data of the model, all dynamically changing objects such as memory buffers are released.
     EnnRet release_execution_data(ExecutableModelID exec_id);
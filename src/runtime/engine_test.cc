@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <iostream>
 #include <fstream>
+#include <cstdlib>
 #include <string>
 
 #include "engine.hpp"
@@ -45,6 +46,8 @@ protected:
         load_param.model_type = (uint32_t)model_type;
         enn::EnnBufferCore::Ptr mem = std::make_shared<enn::EnnBufferCore>();
         mem->va = (buffer.get());
+        // Kept until the end of the test, as the client keeps the model loaded until it is closed.
+        model_buffers.push_back(std::move(buffer));
 #else
         auto mem = emm->CreateMemory(file_size, enn::EnnMmType::kEnnMmTypeIon);
         enn::util::import_file_to_mem(model_file.c_str(), reinterpret_cast<char**>(&(mem->va)), nullptr, size, offset);
@@ -102,6 +105,7 @@ protected:
     }
 
     std::unique_ptr<enn::EnnMemoryManager> emm;
+    std::vector<std::unique_ptr<char[]>> model_buffers;
 };
 
 TEST_F(ENN_ENGINE_TEST, test_open_model) {
@@ -144,6 +148,38 @@ TEST_F(ENN_ENGINE_TEST, test_open_model) {
     engine->deinit();
 }
 
+TEST_F(ENN_ENGINE_TEST, opens_model_of_same_content_with_model_cache) {
+    // The engine reads the capacity when it is created, and buffers of the models are kept until the test ends.
+    enn::runtime::Engine::destory_instance();
+    setenv("vendor.enn.model_cache.capacity", "67108864", 1);
+    auto engine = enn::runtime::Engine::get_instance();
+    engine->init();
+
+#ifdef SCHEMA_NNC_V1
+    std::string model_file = OLYMPUS::NPU::IV3::NNC;
+#else
+    std::string model_file = PAMIR::NPU::IV3::NNC;
+#endif
+
+    // The second and third are opened from the raw model cached at the first, which is closed before the third.
+    SessionBufInfo session_info[3];
+    for (int i = 0; i < 3; ++i) {
+        LoadParameter load_param;
+        load_param_setting(load_param, model_file);
+        EXPECT_NE(engine->open_model(load_param, &session_info[i]), 0);
+        if (i == 1) EXPECT_EQ(engine->close_model(session_info[0].model_id), ENN_RET_SUCCESS);
+    }
+    EXPECT_NE(session_info[1].model_id, session_info[2].model_id);
+    check_session_info_buffers(session_info[1].buffers, session_info[0].buffers);
+    check_session_info_buffers(session_info[2].buffers, session_info[0].buffers);
+    EXPECT_EQ(engine->close_model(session_info[1].model_id), ENN_RET_SUCCESS);
+    EXPECT_EQ(engine->close_model(session_info[2].model_id), ENN_RET_SUCCESS);
+
+    engine->deinit();
+    enn::runtime::Engine::destory_instance();
+    unsetenv("vendor.enn.model_cache.capacity");
+}
+
 #ifndef SCHEMA_NNC_V1
 TEST_F(ENN_ENGINE_TEST, test_open_model_SSD_nnc_v2) {
     auto engine = enn::runtime::Engine::get_instance();
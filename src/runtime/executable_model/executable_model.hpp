@@ -97,6 +97,7 @@ class ExecutableModel : public pool::Poolable<IdentifierBase<FullIDType>>,
     bool is_ancestor_of(const ID& rid) const override { return id_->is_overlapped_by(rid); }
     bool is_descendant_of(const Poolable& rp) const override { return rp.is_ancestor_of(*id_); }
     bool is_descendant_of(const ID& rid) const override { return id_->is_overlapping(rid); }
+    const ID& get_key() const override { return *id_; }
     std::string to_string() const override {
         std::stringstream s;
         s << "ExecutableModel(ID: 0x" << id_->to_string() << ")";
@@ -0,0 +1,166 @@
+#ifndef SRC_RUNTIME_EXECUTE_REQUEST_ASYNC_EXECUTOR_HPP_
+#define SRC_RUNTIME_EXECUTE_REQUEST_ASYNC_EXECUTOR_HPP_
+
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <thread>
+#include <deque>
+#include <vector>
+#include <unordered_map>
+#include <stdexcept>
+#include <type_traits>
+
+#include "common/enn_debug.h"
+
+namespace enn {
+namespace runtime {
+namespace execute {
+
+// AsyncExecutor is a bounded pool of worker threads which runs asynchronous executions.
+//  - The number of workers is fixed at construction, so that a burst of requests never creates threads.
+//  - The number of tasks waiting in the executor is bounded by the queue depth.
+//    submit() blocks the caller until a slot becomes free (backpressure).
+//  - Tasks submitted with the same key are run one by one in submission(FIFO) order,
+//    while tasks with different keys are run concurrently by different workers.
+//    The Engine uses the model id as a key, which keeps the order of executions per model.
+class AsyncExecutor {
+ public:
+    using UPtr = std::unique_ptr<AsyncExecutor>;
+    using Key = uint64_t;
+
+    static constexpr size_t DEFAULT_WORKER_NUM = 4;
+    static constexpr size_t DEFAULT_QUEUE_DEPTH = 64;
+
+ private:
+    using Task = std::function<void()>;
+
+    // Tasks of a key waiting to run. "scheduled" is true while the key is in the ready queue
+    //  or one of its tasks is running, so that only a worker handles a key at a time.
+    struct Strand {
+        std::deque<Task> tasks;
+        bool scheduled = false;
+    };
+
+ public:
+    explicit AsyncExecutor(size_t worker_num = DEFAULT_WORKER_NUM, size_t queue_depth = DEFAULT_QUEUE_DEPTH)
+        : queue_depth_{queue_depth ? queue_depth : 1}, pending_{0}, stop_{false} {
+        if (worker_num == 0) worker_num = 1;
+        workers_.reserve(worker_num);
+        for (size_t i = 0; i < worker_num; ++i) {
+            workers_.emplace_back(&AsyncExecutor::work, this);
+        }
+        ENN_DBG_COUT << "AsyncExecutor is created with " << worker_num << " workers, depth "
+                     << queue_depth_ << std::endl;
+    }
+
+    AsyncExecutor(const AsyncExecutor&) = delete;
+    AsyncExecutor& operator=(const AsyncExecutor&) = delete;
+
+    // Tasks already submitted are completed before workers are joined.
+    ~AsyncExecutor() {
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            stop_ = true;
+        }
+        task_cv_.notify_all();
+        slot_cv_.notify_all();
+        for (auto& worker : workers_) {
+            if (worker.joinable()) worker.join();
+        }
+        ENN_DBG_COUT << "AsyncExecutor is released" << std::endl;
+    }
+
+    // Submit a callable to run on the worker pool and return the future for its result.
+    //  An exception thrown from the callable is delivered to the future.
+    //  throw exception of std::runtime_error if the executor is being released.
+    template <typename F>
+    std::future<std::invoke_result_t<F>> submit(Key key, F&& f) {
+        using Result = std::invoke_result_t<F>;
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(f));
+        auto future = packaged->get_future();
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            slot_cv_.wait(lock, [this] { return stop_ || pending_ < queue_depth_; });
+            if (stop_) {
+                throw std::runtime_error("AsyncExecutor is stopped, cannot submit a task");
+            }
+            ++pending_;
+            auto& strand = strands_[key];
+            strand.tasks.emplace_back([packaged]() { (*packaged)(); });
+            if (!strand.scheduled) {
+                strand.scheduled = true;
+                ready_.push_back(key);
+                lock.unlock();
+                task_cv_.notify_one();
+            }
+        }
+        return future;
+    }
+
+    size_t get_worker_num() const {
+        return workers_.size();
+    }
+
+    size_t get_queue_depth() const {
+        return queue_depth_;
+    }
+
+    // Number of tasks submitted but not completed yet.
+    size_t get_pending_count() const {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return pending_;
+    }
+
+ private:
+    void work() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            task_cv_.wait(lock, [this] { return stop_ || !ready_.empty(); });
+            if (ready_.empty()) {
+                // stop_ is set and nothing is left to run.
+                return;
+            }
+            Key key = ready_.front();
+            ready_.pop_front();
+            auto& strand = strands_[key];
+            Task task = std::move(strand.tasks.front());
+            strand.tasks.pop_front();
+
+            lock.unlock();
+            task();
+            lock.lock();
+
+            --pending_;
+            slot_cv_.notify_one();
+            // strands_ can be rehashed while unlocked, so look up the key again.
+            auto it = strands_.find(key);
+            if (it->second.tasks.empty()) {
+                strands_.erase(it);
+            } else {
+                // Put the key back at the tail to give other keys a fair chance.
+                ready_.push_back(key);
+                task_cv_.notify_one();
+            }
+        }
+    }
+
+ private:
+    const size_t queue_depth_;
+    size_t pending_;
+    bool stop_;
+    mutable std::mutex mutex_;
+    std::condition_variable task_cv_;  // notified when a key becomes ready or executor stops
+    std::condition_variable slot_cv_;  // notified when a pending task is completed
+    std::unordered_map<Key, Strand> strands_;
+    std::deque<Key> ready_;
+    std::vector<std::thread> workers_;
+};
+
+};  // namespace execute
+};  // namespace runtime
+};  // namespace enn
+
+#endif  // SRC_RUNTIME_EXECUTE_REQUEST_ASYNC_EXECUTOR_HPP_
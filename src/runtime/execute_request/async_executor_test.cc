@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include "runtime/execute_request/async_executor.hpp"
+
+using namespace enn::runtime::execute;
+using Clock = std::chrono::steady_clock;
+
+class AsyncExecutorTest : public testing::Test {
+ protected:
+    // Return the p-th percentile of latencies in microseconds.
+    static double percentile(std::vector<double> latencies, double p) {
+        std::sort(latencies.begin(), latencies.end());
+        size_t index = static_cast<size_t>(p / 100.0 * (latencies.size() - 1));
+        return latencies[index];
+    }
+
+    static void show_latency(const char* title, const std::vector<double>& latencies) {
+        std::cout << "[          ] " << title << ": p50 " << percentile(latencies, 50)
+                  << " us, p99 " << percentile(latencies, 99) << " us" << std::endl;
+    }
+
+    static double elapsed_us(Clock::time_point from) {
+        return std::chrono::duration<double, std::micro>(Clock::now() - from).count();
+    }
+};
+
+TEST_F(AsyncExecutorTest, returns_result_through_future) {
+    AsyncExecutor executor(2, 4);
+    auto future = executor.submit(1, []() { return 42; });
+    EXPECT_EQ(future.get(), 42);
+    EXPECT_EQ(executor.get_worker_num(), 2);
+    EXPECT_EQ(executor.get_queue_depth(), 4);
+}
+
+TEST_F(AsyncExecutorTest, delivers_exception_through_future) {
+    AsyncExecutor executor(1, 4);
+    auto future = executor.submit(1, []() -> int { throw std::runtime_error("failed"); });
+    EXPECT_THROW(future.get(), std::runtime_error);
+}
+
+TEST_F(AsyncExecutorTest, keeps_fifo_order_per_key) {
+    constexpr int kKeyNum = 4;
+    constexpr int kTaskNum = 200;
+    AsyncExecutor executor(4, 16);
+    std::vector<std::vector<int>> orders(kKeyNum);
+    std::vector<std::future<void>> futures;
+    for (int i = 0; i < kTaskNum; ++i) {
+        int key = i % kKeyNum;
+        // Tasks of a key are never run concurrently, so each vector is touched by one worker at a time.
+        futures.push_back(executor.submit(key, [&orders, key, i]() { orders[key].push_back(i); }));
+    }
+    for (auto& future : futures) future.get();
+    for (int key = 0; key < kKeyNum; ++key) {
+        EXPECT_EQ(orders[key].size(), kTaskNum / kKeyNum);
+        EXPECT_TRUE(std::is_sorted(orders[key].begin(), orders[key].end()));
+    }
+}
+
+TEST_F(AsyncExecutorTest, runs_different_keys_concurrently) {
+    AsyncExecutor executor(2, 4);
+    std::promise<void> first_started;
+    std::promise<void> release_first;
+    auto release_future = release_first.get_future().share();
+    auto first = executor.submit(1, [&first_started, release_future]() {
+        first_started.set_value();
+        release_future.wait();
+    });
+    first_started.get_future().wait();
+    // The second key should not wait for the first one blocked.
+    auto second = executor.submit(2, []() { return 7; });
+    EXPECT_EQ(second.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    release_first.set_value();
+    first.get();
+    EXPECT_EQ(second.get(), 7);
+}
+
+TEST_F(AsyncExecutorTest, bounds_number_of_pending_tasks) {
+    constexpr size_t kDepth = 3;
+    AsyncExecutor executor(1, kDepth);
+    std::promise<void> release;
+    auto release_future = release.get_future().share();
+    std::vector<std::future<void>> futures;
+    for (size_t i = 0; i < kDepth; ++i) {
+        futures.push_back(executor.submit(1, [release_future]() { release_future.wait(); }));
+    }
+    EXPECT_EQ(executor.get_pending_count(), kDepth);
+
+    std::atomic<bool> submitted{false};
+    std::thread producer([&]() {
+        futures.push_back(executor.submit(1, []() {}));
+        submitted = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    // The producer is blocked until a slot becomes free.
+    EXPECT_FALSE(submitted.load());
+    release.set_value();
+    producer.join();
+    EXPECT_TRUE(submitted.load());
+    for (auto& future : futures) future.get();
+}
+
+TEST_F(AsyncExecutorTest, completes_pending_tasks_on_release) {
+    std::atomic<int> done{0};
+    {
+        AsyncExecutor executor(2, 32);
+        for (int i = 0; i < 32; ++i) {
+            executor.submit(i % 3, [&done]() {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+                done++;
+            });
+        }
+    }
+    EXPECT_EQ(done.load(), 32);
+}
+
+// Compare submit-to-complete latency of the executor with detached thread per request,
+//  which is the way EnnExecuteModelAsync worked before.
+TEST_F(AsyncExecutorTest, DISABLED_benchmark_submit_to_complete_latency) {
+    constexpr int kIteration = 2000;
+    constexpr int kModelNum = 4;
+    std::vector<double> thread_latencies;
+    std::vector<double> pool_latencies;
+    thread_latencies.reserve(kIteration);
+    pool_latencies.reserve(kIteration);
+
+    for (int i = 0; i < kIteration; ++i) {
+        auto start = Clock::now();
+        std::promise<double> promise;
+        auto future = promise.get_future();
+        std::thread thread([start](std::promise<double>&& promise) {
+            promise.set_value(elapsed_us(start));
+        }, std::move(promise));
+        thread.detach();
+        thread_latencies.push_back(future.get());
+    }
+
+    AsyncExecutor executor;
+    for (int i = 0; i < kIteration; ++i) {
+        auto start = Clock::now();
+        auto future = executor.submit(i % kModelNum, [start]() { return elapsed_us(start); });
+        pool_latencies.push_back(future.get());
+    }
+
+    show_latency("detached thread", thread_latencies);
+    show_latency("async executor ", pool_latencies);
+    EXPECT_EQ(pool_latencies.size(), thread_latencies.size());
+}
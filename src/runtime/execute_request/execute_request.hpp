@@ -5,25 +5,51 @@
 #include <string>
 #include <unordered_map>
 #include <functional>
+#include <future>
 #include <map>
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <sstream>
+#include <algorithm>
+#include <cinttypes>
 
 #include "runtime/dispatch/dispatcher_interface.hpp"
+#include "runtime/dispatch/execute_dispatcher.hpp"
 #include "runtime/executable_model/executable_model.hpp"
-#include "model/graph/iterator/methods/linear_search.hpp"
+#include "model/graph/iterator/methods/topological_sort.hpp"
 #include "runtime/execute_request/operator_list_execute_request.hpp"
+#include "runtime/execute_request/async_executor.hpp"
+#include "runtime/execute_request/pipeline_executor.hpp"
+#include "runtime/metrics/model_statistics.hpp"
 #include "runtime/pool/poolable.hpp"
 #include "common/ref_hash_map.hpp"
+#include "common/identifier_chopper.hpp"
 #include "tool/profiler/include/ExynosNnProfilerApi.h"
 
 namespace enn {
 namespace runtime {
 namespace execute {
 
-class ExecuteRequest : public pool::Poolable<IdentifierBase<FullIDType>> {
+class ExecuteRequest : public pool::Poolable<IdentifierBase<FullIDType>>,
+                       public std::enable_shared_from_this<ExecuteRequest> {
  private:
     using TableKey = OperatorList::ID;
     using ToDispatch = OperatorListExecuteRequest::Ptr;
 
+    // A vertex of the scheduled graph indexed for the dependency-driven execution.
+    struct Stage {
+        OperatorList::Ptr op_list;
+        ToDispatch request;
+        size_t in_degree = 0;
+        std::vector<size_t> successors;  // index of the stages depending on this
+        ud::UserDriver::BoundExecution execution;  // bound by the userdriver when the execution plan is frozen
+        metrics::LatencyHistogram* device_latency = nullptr;  // resolved when the statistics are set
+        metrics::LatencyHistogram* userdriver_latency = nullptr;
+    };
+
  public:
     using Ptr = std::shared_ptr<ExecuteRequest>;
     using ID = ExecutableModel::ID;
@@ -54,35 +80,105 @@ class ExecuteRequest : public pool::Poolable<IdentifierBase<FullIDType>> {
     bool is_ancestor_of(const ID& rid) const override { return executable_model_->id_->is_overlapped_by(rid); }
     bool is_descendant_of(const Poolable& rp) const override { return rp.is_ancestor_of(*executable_model_->id_); }
     bool is_descendant_of(const ID& rid) const override { return executable_model_->id_->is_overlapping(rid); }
+    const ID& get_key() const override { return *executable_model_->id_; }
     std::string to_string() const override {
         std::stringstream s;
         s << "ExecuteRequest from ExecutableModel(ID: 0x" << executable_model_->get_id().to_string() << ")";
         return s.str();
     }
 
-    void execute(std::unique_ptr<dispatch::IDispatcher> dispatcher) {
-        using namespace enn::model::graph::iterator;
-        ENN_DBG_COUT << "Start to execute with a ExecutableModel(ID: " <<
-                        executable_model_->get_id() << ")" << std::endl;
-        auto& scheduled_graph = executable_model_->model_->get_scheduled_graph();
-        // TODO(yc18.cho): Make LinearSearch be used only on the linear graph!!
-        for (auto& opr_list : scheduled_graph->order<LinearSearch>()) {
-            // create OperatorListExecuteRequest and pass it as rvalue to the Dispatcher on the fly.
-            //  Dispatch can prolong this temporary object's lifetime as taking by constant reference.
-            try {
-                dispatcher->dispatch(*dispatch_table_[opr_list->get_id()]);
-            } catch (const std::runtime_error& ia) {
-                ENN_ERR_COUT << "Failed to dispatch Execute user driver : "
-                             << (int)(opr_list->get_accelerator()) << std::endl;
-                throw std::runtime_error("Execute Dispatch Failed");
+    // Freeze the execution plan: resolve the userdriver of each OperatorList once with the dispatcher,
+    //  and let it bind the state prepared for the OperatorList, so that an execution without a dispatcher
+    //  runs them in the precomputed order with no lookup, allocation or lock in the runtime or the userdriver.
+    //  throw exception of std::runtime_error if an OperatorList can't be executed by any userdriver.
+    void freeze(std::unique_ptr<dispatch::ExecuteDispatcher> dispatcher) {
+        for (auto& stage : stages_) {
+            auto user_driver = dispatcher->get_user_driver(stage.op_list->get_accelerator());
+            if (user_driver == nullptr || stage.request == nullptr) {
+                throw std::runtime_error("OperatorList(ID: 0x" + stage.op_list->get_id().to_string() +
+                                         ") is not supported to execute");
+            }
+            stage.execution = user_driver->BindSubGraph(*stage.request);
+            if (!stage.execution) {
+                throw std::runtime_error("OperatorList(ID: 0x" + stage.op_list->get_id().to_string() +
+                                         ") is not prepared to execute");
             }
         }
-        ENN_DBG_COUT << "Finish to execute with a ExecutableModel(ID: " <<
-                        executable_model_->get_id() << ")" << std::endl;
+        // The dispatcher is kept as it refers to userdrivers resolved.
+        plan_dispatcher_ = std::move(dispatcher);
+    }
+
+    bool is_frozen() const {
+        return plan_dispatcher_ != nullptr;
+    }
+
+    // Record latencies of executions to the statistics of the model from now on, which are shared by
+    //  every ExecuteRequest of the model. Histograms of OperatorLists are resolved here once.
+    void set_statistics(metrics::ModelStatistics::Ptr statistics) {
+        for (auto& stage : stages_) {
+            stage.device_latency = statistics ? statistics->find_operator_list(stage.op_list->get_id().get()) : nullptr;
+            stage.userdriver_latency =
+                statistics ? statistics->find_userdriver(stage.op_list->get_accelerator()) : nullptr;
+        }
+        statistics_ = std::move(statistics);
     }
 
-    // TODO : implement asynchronous execution by using ThreadPool.
-    void execute_async(std::unique_ptr<dispatch::IDispatcher> dispatcher) {ENN_UNUSED(dispatcher);}
+    // Run OperatorLists that become ready together on the workers of the executor, which is owned by
+    //  the Engine and outlives this request. Without it, they are run by the caller one after another.
+    void set_stage_executor(AsyncExecutor* stage_executor) {
+        stage_executor_ = stage_executor;
+    }
+
+    // Keep the pipeline slot of the model, so that an execution finds whether it is pipelined by itself.
+    void set_pipeline_slot(PipelineSlot::Ptr pipeline_slot) {
+        pipeline_slot_ = std::move(pipeline_slot);
+    }
+
+    // Pipeline of the model to submit this request to, or nullptr if pipelined execution is not enabled.
+    std::shared_ptr<PipelineExecutor> get_pipeline() const {
+        return pipeline_slot_ ? pipeline_slot_->get() : nullptr;
+    }
+
+    void execute(std::unique_ptr<dispatch::IDispatcher> dispatcher) {
+        execute_impl(dispatcher.get());
+    }
+
+    // Execute with the frozen plan.
+    void execute() {
+        check_frozen();
+        execute_impl(nullptr);
+    }
+
+    // Submit this request to the AsyncExecutor and return the future for the result of execution.
+    //  Requests from the same Model are executed in submission order.
+    //  This ExecuteRequest and the dispatcher are kept alive until the execution is completed.
+    std::future<EnnReturn> execute_async(std::unique_ptr<dispatch::IDispatcher> dispatcher, AsyncExecutor& executor) {
+        return submit_async(std::move(dispatcher), executor);
+    }
+
+    std::future<EnnReturn> execute_async(AsyncExecutor& executor) {
+        check_frozen();
+        return submit_async(nullptr, executor);
+    }
+
+    // Submit this request as a frame to the PipelineExecutor of the Model and return the future for the result.
+    //  Each OperatorList is run as a stage in topological order, so that an OperatorList of this request
+    //  can be overlapped with another OperatorList of the request from another ExecutableModel(session).
+    //  The returned future is deferred, which only converts the result when it is waited.
+    std::future<EnnReturn> execute_pipelined(std::unique_ptr<dispatch::IDispatcher> dispatcher,
+                                             PipelineExecutor& pipeline) {
+        return submit_pipelined(std::move(dispatcher), pipeline);
+    }
+
+    std::future<EnnReturn> execute_pipelined(PipelineExecutor& pipeline) {
+        check_frozen();
+        return submit_pipelined(nullptr, pipeline);
+    }
+
+    // Number of OperatorLists to be dispatched for an execution.
+    size_t get_stage_count() const {
+        return stages_.size();
+    }
 
     const ExecutableModel::Ptr& get_executable_model() {
         return executable_model_;
@@ -101,13 +197,235 @@ class ExecuteRequest : public pool::Poolable<IdentifierBase<FullIDType>> {
         executable_model_->lock_ = true;
         for (const auto& [op_list_id, exec_op_list] : executable_model_->dispatch_table_)
             dispatch_table_.insert({op_list_id, std::make_shared<OperatorListExecuteRequest>(exec_op_list)});
+        build_stages();
         ENN_DBG_COUT << "An ExecuteRequest from an ExecutableModel(ID: 0x"
                 << executable_model_->get_id() << ") is created." << std::endl;
     }
 
+ private:
+    // Index the OperatorLists of the scheduled graph in topological order and their dependencies once,
+    //  so that each execution only counts down the in-degrees of them.
+    // An edge without FeatureMap(ID -1) only keeps an OperatorList reachable from the start vertex,
+    //  so it is not a dependency and the OperatorList is run as another root.
+    void build_stages() {
+        using namespace enn::model::graph::iterator;
+        auto& scheduled_graph = executable_model_->model_->get_scheduled_graph();
+        if (scheduled_graph == nullptr || scheduled_graph->get_start_vertex() == nullptr) return;
+
+        std::map<OperatorList::Ptr, size_t> index_of;
+        for (auto& opr_list : scheduled_graph->order<TopologicalSort>()) {
+            auto entry = dispatch_table_.find(opr_list->get_id());
+            index_of[opr_list] = stages_.size();
+            stages_.push_back({opr_list, entry == dispatch_table_.end() ? nullptr : entry->second});
+        }
+        is_linear_ = true;
+        for (auto& stage : stages_) {
+            for (const auto& neighbor : (*scheduled_graph)[stage.op_list]) {
+                if (neighbor.second->get_id() == -1) continue;
+                auto& successor = stages_[index_of.at(neighbor.first)];
+                stage.successors.push_back(index_of.at(neighbor.first));
+                successor.in_degree++;
+                if (successor.in_degree > 1) is_linear_ = false;
+            }
+            if (stage.successors.size() > 1) is_linear_ = false;
+        }
+        for (size_t i = 1; i < stages_.size(); ++i) {
+            if (stages_[i].in_degree == 0) is_linear_ = false;
+        }
+    }
+
+    void check_frozen() const {
+        if (!is_frozen()) {
+            throw std::runtime_error(to_string() + " has no execution plan frozen");
+        }
+    }
+
+    // A null dispatcher means the frozen plan.
+    std::future<EnnReturn> submit_async(std::shared_ptr<dispatch::IDispatcher> shared_dispatcher,
+                                        AsyncExecutor& executor) {
+        auto self = shared_from_this();
+        auto submitted = std::chrono::steady_clock::now();
+        return executor.submit(util::chop_into_model_id(executable_model_->get_id().get()),
+                               [self, shared_dispatcher, submitted]() -> EnnReturn {
+            if (self->statistics_) self->statistics_->queue_wait().record_since(submitted);
+            // As execute_model() of the Engine profiles a synchronous execution, from the worker running it.
+            PROFILE_SCOPE("ExynosNN_Execution", util::chop_into_model_id(self->executable_model_->get_id().get()));
+            try {
+                self->execute_impl(shared_dispatcher.get());
+            } catch (const std::exception& ex) {
+                ENN_ERR_COUT << ex.what() << std::endl;
+                ENN_ERR_COUT << "execute_async() is failed" << std::endl;
+                return ENN_RET_FAILED;
+            }
+            return ENN_RET_SUCCESS;
+        });
+    }
+
+    std::future<EnnReturn> submit_pipelined(std::shared_ptr<dispatch::IDispatcher> shared_dispatcher,
+                                            PipelineExecutor& pipeline) {
+        if (pipeline.get_stage_num() != stages_.size()) {
+            throw std::invalid_argument("The number of stages of the pipeline doesn't match to the OperatorLists");
+        }
+        auto self = shared_from_this();
+        auto submitted = std::chrono::steady_clock::now();
+        // Stages of a frame are run one after another, so the start time is not shared concurrently.
+        auto started = std::make_shared<std::chrono::steady_clock::time_point>();
+        auto frame = pipeline.submit(executable_model_->get_id().get(),
+                                     [self, shared_dispatcher, submitted, started](size_t stage) {
+            if (stage == 0) {
+                *started = std::chrono::steady_clock::now();
+                if (self->statistics_) self->statistics_->queue_wait().record(*started - submitted);
+            }
+            self->dispatch_stage(shared_dispatcher.get(), stage);
+            if (stage + 1 == self->stages_.size() && self->statistics_) {
+                self->statistics_->execute().record_since(*started);
+            }
+        });
+        return std::async(std::launch::deferred, [frame = std::move(frame)]() mutable -> EnnReturn {
+            try {
+                frame.get();
+            } catch (const std::exception& ex) {
+                ENN_ERR_COUT << ex.what() << std::endl;
+                ENN_ERR_COUT << "execute_pipelined() is failed" << std::endl;
+                return ENN_RET_FAILED;
+            }
+            return ENN_RET_SUCCESS;
+        });
+    }
+
+
+    // Dispatch through the dispatcher, or call the userdriver directly by the frozen plan if it is null.
+    void dispatch_stage(dispatch::IDispatcher* dispatcher, size_t index) {
+        auto& stage = stages_[index];
+        if (stage.request == nullptr) {
+            throw std::runtime_error("OperatorList(ID: 0x" + stage.op_list->get_id().to_string() +
+                                     ") is not prepared to execute");
+        }
+        auto start = std::chrono::steady_clock::now();
+        try {
+            if (dispatcher) {
+                dispatcher->dispatch(*stage.request);
+            } else if (stage.execution() != ENN_RET_SUCCESS) {
+                throw std::runtime_error("Failed Execute SubGraph");
+            }
+        } catch (const std::runtime_error& ia) {
+            ENN_ERR_COUT << "Failed to dispatch Execute user driver : "
+                         << (int)(stage.op_list->get_accelerator()) << std::endl;
+            throw std::runtime_error("Execute Dispatch Failed");
+        }
+        uint64_t elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                  std::chrono::steady_clock::now() - start).count();
+
+        if (stage.device_latency) stage.device_latency->record(elapsed_ns);
+        if (stage.userdriver_latency) stage.userdriver_latency->record(elapsed_ns);
+    }
+
+    void execute_impl(dispatch::IDispatcher* dispatcher) {
+        // printf-style log is used here, which doesn't build a message unless the debug log is enabled.
+        ENN_DBG_PRINT("Start to execute with a ExecutableModel(ID: 0x%" PRIX64 ")\n", executable_model_->get_id().get());
+        auto start = std::chrono::steady_clock::now();
+        if (is_linear_) {
+            // stages_ are already in the order of the chain, so no synchronization is needed.
+            for (size_t index = 0; index < stages_.size(); ++index) {
+                dispatch_stage(dispatcher, index);
+            }
+        } else {
+            execute_in_parallel(dispatcher);
+        }
+        if (statistics_) statistics_->execute().record_since(start);
+        ENN_DBG_PRINT("Finish to execute with a ExecutableModel(ID: 0x%" PRIX64 ")\n", executable_model_->get_id().get());
+    }
+
+    // Dispatch every OperatorList whose predecessors are all completed at once, and then
+    //  wait for them. The caller thread runs one of ready OperatorLists by itself and the others
+    //  are submitted to the stage executor, so wall-clock time follows the critical path of the scheduled graph.
+    //  Stages are keyed by their own address, so stages of a request never wait for each other in the executor.
+    // When an OperatorList fails, no more OperatorLists are dispatched and it throws
+    //  after the running ones are completed.
+    void execute_in_parallel(dispatch::IDispatcher* dispatcher) {
+        std::mutex mutex;
+        std::condition_variable completed_cv;
+        std::vector<size_t> remaining(stages_.size());
+        std::deque<size_t> ready;
+        std::vector<std::future<void>> futures;
+        size_t running = 0, done = 0;
+        bool failed = false;
+
+        for (size_t i = 0; i < stages_.size(); ++i) {
+            remaining[i] = stages_[i].in_degree;
+            if (remaining[i] == 0) ready.push_back(i);
+        }
+
+        auto run = [&](size_t index) {
+            bool success = true;
+            try {
+                dispatch_stage(dispatcher, index);
+            } catch (const std::exception&) {
+                success = false;
+            }
+            std::lock_guard<std::mutex> guard(mutex);
+            --running;
+            if (success) {
+                ++done;
+                for (auto successor : stages_[index].successors) {
+                    if (--remaining[successor] == 0) ready.push_back(successor);
+                }
+            } else {
+                failed = true;
+            }
+            completed_cv.notify_one();
+        };
+
+        std::vector<size_t> to_submit;
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            if (!failed && !ready.empty()) {
+                size_t index = ready.front();
+                ready.pop_front();
+                ++running;
+                if (stage_executor_) {
+                    to_submit.assign(ready.begin(), ready.end());
+                    running += ready.size();
+                    ready.clear();
+                }
+                // submit() can block for a free slot, so it is called out of the lock taken by run().
+                lock.unlock();
+                for (auto submitted : to_submit) {
+                    auto key = reinterpret_cast<AsyncExecutor::Key>(&stages_[submitted]);
+                    try {
+                        futures.push_back(stage_executor_->submit(key, [&run, submitted] { run(submitted); }));
+                    } catch (const std::runtime_error&) {
+                        run(submitted);  // the executor is being released
+                    }
+                }
+                to_submit.clear();
+                run(index);
+                lock.lock();
+                continue;
+            }
+            if (running == 0) break;
+            completed_cv.wait(lock, [&] { return running == 0 || (!failed && !ready.empty()); });
+        }
+        lock.unlock();
+        for (auto& future : futures) future.wait();
+
+        if (failed) {
+            throw std::runtime_error("Execute Dispatch Failed");
+        }
+        if (done != stages_.size()) {
+            throw std::runtime_error("Scheduled graph has a cycle, some OperatorLists are not executed");
+        }
+    }
+
  private:
     ExecutableModel::Ptr executable_model_;
     adt::RefHashMap<TableKey, ToDispatch, TableKey::Hash> dispatch_table_;
+    std::vector<Stage> stages_;
+    bool is_linear_ = true;  // every OperatorList has a predecessor and a successor at most
+    std::unique_ptr<dispatch::ExecuteDispatcher> plan_dispatcher_;
+    metrics::ModelStatistics::Ptr statistics_;  // nullptr unless set
+    AsyncExecutor* stage_executor_ = nullptr;  // not owned
+    PipelineSlot::Ptr pipeline_slot_;  // nullptr unless set
 };
 
 };  // namespace execute
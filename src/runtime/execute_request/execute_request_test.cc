@@ -1,10 +1,20 @@
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <set>
+#include <condition_variable>
+#include <thread>
+
 #include "runtime/execute_request/execute_request.hpp"
 
 #include "model/model.hpp"
 #include "runtime/executable_model/executable_model.hpp"
 #include "runtime/client_process/client_process.hpp"
+#include "model/component/operator/operator_list_builder.hpp"
+#include "model/component/tensor/feature_map_builder.hpp"
 
 using namespace enn::model;
 using namespace enn::runtime;
@@ -37,3 +47,483 @@ TEST_F(ExecuteRequestTest, check_sanity) {
     ExecuteRequest::Ptr execute_request = ExecuteRequest::create(executable_model);
     EXPECT_EQ(execute_request->get_executable_model()->get_id(), executable_model->get_id());
 }
+
+namespace {
+
+using OperatorList = enn::model::component::OperatorList;
+using OperatorListBuilder = enn::model::component::OperatorListBuilder;
+using FeatureMapBuilder = enn::model::component::FeatureMapBuilder;
+using Clock = std::chrono::steady_clock;
+
+class NullDispatcher : public dispatch::IDispatcher {
+ public:
+    void dispatch(const dispatch::Dispatchable&) override {}
+};
+
+// Records start and finish time of each OperatorList with sleeping while executing it.
+//  OperatorLists set to the rendezvous wait for each other to start, which proves that they run concurrently
+//  without depending on the wall-clock time. They give up after a timeout, which is reported by met().
+class RecordingDispatcher : public dispatch::IDispatcher {
+ public:
+    struct Record {
+        Clock::time_point start;
+        Clock::time_point finish;
+    };
+
+    explicit RecordingDispatcher(std::chrono::milliseconds duration, uint64_t fail_id = 0)
+        : duration_{duration}, fail_id_{fail_id} {}
+
+    void dispatch(const dispatch::Dispatchable& dispatchable) override {
+        auto& request = static_cast<const OperatorListExecuteRequest&>(dispatchable);
+        uint64_t id = request.get_operator_list_id().get();
+        auto start = Clock::now();
+        if (rendezvous_.count(id)) {
+            std::unique_lock<std::mutex> lock(mutex_);
+            ++arrived_;
+            arrived_cv_.notify_all();
+            if (arrived_cv_.wait_for(lock, std::chrono::seconds(10),
+                                     [this] { return arrived_ == rendezvous_.size(); })) {
+                ++met_;
+            }
+        }
+        std::this_thread::sleep_for(duration_);
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            records_[id] = {start, Clock::now()};
+        }
+        if (id == fail_id_) throw std::runtime_error("Failed to execute");
+    }
+
+    void set_rendezvous(std::set<uint64_t> ids) {
+        rendezvous_ = std::move(ids);
+    }
+
+    bool met() {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return met_ == rendezvous_.size();
+    }
+
+    Record get(const OperatorList::Ptr& op_list) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return records_.at(op_list->get_id().get());
+    }
+
+    size_t count() {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return records_.size();
+    }
+
+ private:
+    std::chrono::milliseconds duration_;
+    uint64_t fail_id_;
+    std::mutex mutex_;
+    std::map<uint64_t, Record> records_;
+    std::set<uint64_t> rendezvous_;
+    std::condition_variable arrived_cv_;
+    size_t arrived_ = 0;
+    size_t met_ = 0;
+};
+
+// Forwards to a dispatcher owned by the test, which outlives the request holding this.
+class ForwardingDispatcher : public dispatch::IDispatcher {
+ public:
+    explicit ForwardingDispatcher(dispatch::IDispatcher& target) : target_{target} {}
+    void dispatch(const dispatch::Dispatchable& dispatchable) override { target_.dispatch(dispatchable); }
+
+ private:
+    dispatch::IDispatcher& target_;
+};
+
+};  // namespace
+
+class ParallelExecuteRequestTest : public ExecuteRequestTest {
+ protected:
+    OperatorList::Ptr create_op_list(const Model::Ptr& model, Accelerator accelerator) {
+        return OperatorListBuilder().build(model->get_id()).set_accelerator(accelerator).create();
+    }
+
+    void connect(const OperatorList::Ptr& from, const OperatorList::Ptr& to) {
+        scheduled_graph->add_neighbor(from, FeatureMapBuilder().set_id(feature_map_id++).create(), to);
+    }
+
+    // Edge of the static scheduler to an OperatorList depending on no other one.
+    void connect_dummy(const OperatorList::Ptr& from, const OperatorList::Ptr& to) {
+        scheduled_graph->add_neighbor(from, FeatureMapBuilder().set_id(-1).create(), to);
+    }
+
+    // Create a diamond shaped graph: head -> (npu_branch, cpu_branch) -> tail
+    ExecutableModel::Ptr create_diamond() {
+        model = create_model();
+        scheduled_graph = std::make_shared<ScheduledGraph>();
+        head = create_op_list(model, Accelerator::NPU);
+        npu_branch = create_op_list(model, Accelerator::NPU);
+        cpu_branch = create_op_list(model, Accelerator::CPU);
+        tail = create_op_list(model, Accelerator::CPU);
+        connect(head, npu_branch);
+        connect(head, cpu_branch);
+        connect(npu_branch, tail);
+        connect(cpu_branch, tail);
+        scheduled_graph->add_vertex(tail).set_start_vertex(head).set_end_vertex(tail);
+        model->set_scheduled_graph(scheduled_graph);
+        auto executable_model = create_executable_model(model);
+        executable_model->load(std::make_unique<NullDispatcher>());
+        return executable_model;
+    }
+
+    Model::Ptr model;
+    ScheduledGraph::Ptr scheduled_graph;
+    OperatorList::Ptr head, npu_branch, cpu_branch, tail;
+    int32_t feature_map_id = 0;
+    AsyncExecutor stage_executor{2, 8};
+};
+
+TEST_F(ParallelExecuteRequestTest, runs_independent_operator_lists_concurrently) {
+    ExecuteRequest::Ptr execute_request = ExecuteRequest::create(create_diamond());
+    execute_request->set_stage_executor(&stage_executor);
+    RecordingDispatcher recorder(std::chrono::milliseconds(1));
+    recorder.set_rendezvous({npu_branch->get_id().get(), cpu_branch->get_id().get()});
+
+    execute_request->execute(std::make_unique<ForwardingDispatcher>(recorder));
+
+    ASSERT_EQ(recorder.count(), 4);
+    // Both branches start after the head and the tail starts after both branches.
+    EXPECT_LE(recorder.get(head).finish, recorder.get(npu_branch).start);
+    EXPECT_LE(recorder.get(head).finish, recorder.get(cpu_branch).start);
+    EXPECT_LE(recorder.get(npu_branch).finish, recorder.get(tail).start);
+    EXPECT_LE(recorder.get(cpu_branch).finish, recorder.get(tail).start);
+    // Each branch started while the other one was running.
+    EXPECT_TRUE(recorder.met());
+}
+
+TEST_F(ParallelExecuteRequestTest, runs_ready_operator_lists_by_caller_without_stage_executor) {
+    ExecuteRequest::Ptr execute_request = ExecuteRequest::create(create_diamond());
+    RecordingDispatcher recorder(std::chrono::milliseconds(1));
+    execute_request->execute(std::make_unique<ForwardingDispatcher>(recorder));
+
+    ASSERT_EQ(recorder.count(), 4);
+    EXPECT_LE(recorder.get(head).finish, recorder.get(npu_branch).start);
+    EXPECT_LE(recorder.get(head).finish, recorder.get(cpu_branch).start);
+    EXPECT_LE(recorder.get(npu_branch).finish, recorder.get(tail).start);
+    EXPECT_LE(recorder.get(cpu_branch).finish, recorder.get(tail).start);
+}
+
+// Roots connected from the start vertex only by a dummy edge don't wait for the start vertex.
+TEST_F(ParallelExecuteRequestTest, runs_independent_roots_concurrently) {
+    model = create_model();
+    scheduled_graph = std::make_shared<ScheduledGraph>();
+    head = create_op_list(model, Accelerator::NPU);
+    auto other_root = create_op_list(model, Accelerator::CPU);
+    tail = create_op_list(model, Accelerator::CPU);
+    connect_dummy(head, other_root);
+    connect(head, tail);
+    connect(other_root, tail);
+    scheduled_graph->add_vertex(tail).set_start_vertex(head).set_end_vertex(tail);
+    model->set_scheduled_graph(scheduled_graph);
+    auto executable_model = create_executable_model(model);
+    executable_model->load(std::make_unique<NullDispatcher>());
+
+    ExecuteRequest::Ptr execute_request = ExecuteRequest::create(executable_model);
+    execute_request->set_stage_executor(&stage_executor);
+    RecordingDispatcher recorder(std::chrono::milliseconds(1));
+    recorder.set_rendezvous({head->get_id().get(), other_root->get_id().get()});
+    execute_request->execute(std::make_unique<ForwardingDispatcher>(recorder));
+
+    ASSERT_EQ(recorder.count(), 3);
+    EXPECT_TRUE(recorder.met());
+    EXPECT_LE(recorder.get(head).finish, recorder.get(tail).start);
+    EXPECT_LE(recorder.get(other_root).finish, recorder.get(tail).start);
+}
+
+TEST_F(ParallelExecuteRequestTest, stops_dispatching_after_failure) {
+    ExecuteRequest::Ptr execute_request = ExecuteRequest::create(create_diamond());
+    execute_request->set_stage_executor(&stage_executor);
+    RecordingDispatcher recorder(std::chrono::milliseconds(10), cpu_branch->get_id().get());
+    EXPECT_THROW(execute_request->execute(std::make_unique<ForwardingDispatcher>(recorder)), std::runtime_error);
+    // The head and both branches are dispatched, but the tail is not.
+    EXPECT_EQ(recorder.count(), 3);
+}
+
+TEST_F(ParallelExecuteRequestTest, runs_linear_graph_in_order) {
+    model = create_model();
+    scheduled_graph = std::make_shared<ScheduledGraph>();
+    std::vector<OperatorList::Ptr> op_lists;
+    for (int i = 0; i < 4; ++i) {
+        op_lists.push_back(create_op_list(model, i % 2 ? Accelerator::CPU : Accelerator::NPU));
+        if (i > 0) connect(op_lists[i - 1], op_lists[i]);
+    }
+    scheduled_graph->add_vertex(op_lists.back()).set_start_vertex(op_lists.front()).set_end_vertex(op_lists.back());
+    model->set_scheduled_graph(scheduled_graph);
+    auto executable_model = create_executable_model(model);
+    executable_model->load(std::make_unique<NullDispatcher>());
+
+    ExecuteRequest::Ptr execute_request = ExecuteRequest::create(executable_model);
+    RecordingDispatcher recorder(std::chrono::milliseconds(1));
+    execute_request->execute(std::make_unique<ForwardingDispatcher>(recorder));
+    ASSERT_EQ(recorder.count(), op_lists.size());
+    for (size_t i = 1; i < op_lists.size(); ++i) {
+        EXPECT_LE(recorder.get(op_lists[i - 1]).finish, recorder.get(op_lists[i]).start);
+    }
+}
+
+TEST_F(ParallelExecuteRequestTest, overlaps_sessions_in_pipeline) {
+    constexpr std::chrono::milliseconds kDuration{50};
+    model = create_model();
+    scheduled_graph = std::make_shared<ScheduledGraph>();
+    head = create_op_list(model, Accelerator::NPU);
+    tail = create_op_list(model, Accelerator::CPU);
+    connect(head, tail);
+    scheduled_graph->add_vertex(tail).set_start_vertex(head).set_end_vertex(tail);
+    model->set_scheduled_graph(scheduled_graph);
+
+    // Two sessions of a model, which have their own buffers.
+    std::vector<ExecuteRequest::Ptr> sessions;
+    for (int i = 0; i < 2; ++i) {
+        auto executable_model = create_executable_model(model);
+        executable_model->load(std::make_unique<NullDispatcher>());
+        sessions.push_back(ExecuteRequest::create(executable_model));
+        EXPECT_EQ(sessions.back()->get_stage_count(), 2);
+    }
+
+    PipelineExecutor pipeline(2, 2);
+    std::vector<std::unique_ptr<RecordingDispatcher>> records;
+    std::vector<std::future<EnnReturn>> futures;
+    for (auto& session : sessions) {
+        records.push_back(std::make_unique<RecordingDispatcher>(kDuration));
+        futures.push_back(session->execute_pipelined(std::make_unique<ForwardingDispatcher>(*records.back()),
+                                                     pipeline));
+    }
+    for (auto& future : futures) EXPECT_EQ(future.get(), ENN_RET_SUCCESS);
+
+    // The head of the second session runs while the tail of the first session is running.
+    EXPECT_LE(records[0]->get(head).finish, records[1]->get(head).start);
+    EXPECT_LT(records[1]->get(head).start, records[0]->get(tail).finish);
+    EXPECT_LE(records[1]->get(head).finish, records[1]->get(tail).start);
+}
+
+TEST_F(ParallelExecuteRequestTest, reports_predicted_and_actual_latency) {
+    model = create_model();
+    scheduled_graph = std::make_shared<ScheduledGraph>();
+    head = create_op_list(model, Accelerator::NPU);
+    tail = create_op_list(model, Accelerator::CPU);
+    OperatorListBuilder(head).set_predicted_latency(1000);
+    connect(head, tail);
+    scheduled_graph->add_vertex(tail).set_start_vertex(head).set_end_vertex(tail);
+    model->set_scheduled_graph(scheduled_graph);
+    auto executable_model = create_executable_model(model);
+    executable_model->load(std::make_unique<NullDispatcher>());
+
+    auto statistics = std::make_shared<metrics::ModelStatistics>(
+        std::vector<metrics::ModelStatistics::OperatorListInfo>{
+            {head->get_id().get(), Accelerator::NPU, head->get_predicted_latency() * 1000ull},
+            {tail->get_id().get(), Accelerator::CPU, tail->get_predicted_latency() * 1000ull}},
+        std::make_shared<metrics::UserdriverStatistics>());
+    ExecuteRequest::Ptr execute_request = ExecuteRequest::create(executable_model);
+    execute_request->set_statistics(statistics);
+    RecordingDispatcher recorder(std::chrono::milliseconds(2));
+    for (int i = 0; i < 2; ++i) {
+        execute_request->execute(std::make_unique<ForwardingDispatcher>(recorder));
+    }
+
+    EnnModelStatistics report;
+    statistics->fill(&report);
+    ASSERT_EQ(report.n_operator_list, 2);
+    EXPECT_EQ(report.operator_list_predicted_ns[0], 1000 * 1000);
+    EXPECT_EQ(report.operator_list_predicted_ns[1], 0);
+    for (uint32_t i = 0; i < report.n_operator_list; ++i) {
+        EXPECT_EQ(report.operator_list[i].count, 2);
+        EXPECT_GE(report.operator_list[i].max_ns, 1000 * 1000);  // by the 2 ms delay of the dispatcher
+    }
+}
+
+namespace {
+
+// Userdriver that does nothing but counts executions, to measure the overhead of the runtime.
+class NoOpUserDriver : public enn::ud::UserDriver {
+ public:
+    NoOpUserDriver() : UserDriver("NoOp") {}
+    EnnReturn Initialize(void) override { return ENN_RET_SUCCESS; }
+    EnnReturn OpenSubGraph(const OperatorList&) override { return ENN_RET_SUCCESS; }
+    EnnReturn ExecuteSubGraph(const OperatorListExecuteRequest&) override {
+        executed++;
+        return ENN_RET_SUCCESS;
+    }
+    BoundExecution BindSubGraph(const OperatorListExecuteRequest&) override {
+        bound++;
+        return [this]() {
+            executed++;
+            executed_by_binding++;
+            return ENN_RET_SUCCESS;
+        };
+    }
+    EnnReturn CloseSubGraph(const OperatorList&) override { return ENN_RET_SUCCESS; }
+    EnnReturn Deinitialize(void) override { return ENN_RET_SUCCESS; }
+
+    std::atomic<int> executed{0};
+    std::atomic<int> bound{0};
+    std::atomic<int> executed_by_binding{0};
+};
+
+}  // namespace
+
+class FrozenPlanExecuteRequestTest : public ParallelExecuteRequestTest {
+ protected:
+    std::unique_ptr<dispatch::ExecuteDispatcher> create_execute_dispatcher() {
+        return std::make_unique<dispatch::ExecuteDispatcher>(cpu_ud, gpu_ud, npu_ud, dsp_ud, unified_ud);
+    }
+
+    // A chain of OperatorLists alternating NPU and CPU.
+    ExecuteRequest::Ptr create_chain(int op_list_count) {
+        model = create_model();
+        scheduled_graph = std::make_shared<ScheduledGraph>();
+        std::vector<OperatorList::Ptr> op_lists;
+        for (int i = 0; i < op_list_count; ++i) {
+            op_lists.push_back(create_op_list(model, i % 2 ? Accelerator::CPU : Accelerator::NPU));
+            if (i > 0) connect(op_lists[i - 1], op_lists[i]);
+        }
+        scheduled_graph->add_vertex(op_lists.back()).set_start_vertex(op_lists.front()).set_end_vertex(op_lists.back());
+        model->set_scheduled_graph(scheduled_graph);
+        auto executable_model = create_executable_model(model);
+        executable_model->load(std::make_unique<NullDispatcher>());
+        return ExecuteRequest::create(executable_model);
+    }
+
+    NoOpUserDriver cpu_ud, gpu_ud, npu_ud, dsp_ud, unified_ud;
+};
+
+TEST_F(FrozenPlanExecuteRequestTest, executes_by_frozen_plan) {
+    ExecuteRequest::Ptr execute_request = create_chain(3);
+    EXPECT_FALSE(execute_request->is_frozen());
+    EXPECT_THROW(execute_request->execute(), std::runtime_error);
+
+    execute_request->freeze(create_execute_dispatcher());
+    EXPECT_TRUE(execute_request->is_frozen());
+    execute_request->execute();
+    execute_request->execute();
+    EXPECT_EQ(npu_ud.executed.load(), 4);
+    EXPECT_EQ(cpu_ud.executed.load(), 2);
+
+    AsyncExecutor executor(1, 4);
+    EXPECT_EQ(execute_request->execute_async(executor).get(), ENN_RET_SUCCESS);
+    PipelineExecutor pipeline(3, 2);
+    EXPECT_EQ(execute_request->execute_pipelined(pipeline).get(), ENN_RET_SUCCESS);
+    EXPECT_EQ(npu_ud.executed.load(), 8);
+    EXPECT_EQ(cpu_ud.executed.load(), 4);
+}
+
+TEST_F(FrozenPlanExecuteRequestTest, executes_by_userdriver_bound_at_freeze) {
+    ExecuteRequest::Ptr execute_request = create_chain(3);
+    execute_request->freeze(create_execute_dispatcher());
+    EXPECT_EQ(npu_ud.bound.load(), 2);
+    EXPECT_EQ(cpu_ud.bound.load(), 1);
+
+    execute_request->execute();
+    execute_request->execute();
+    EXPECT_EQ(npu_ud.executed_by_binding.load(), 4);
+    EXPECT_EQ(cpu_ud.executed_by_binding.load(), 2);
+
+    // A dispatcher given per execution looks up the userdriver and calls ExecuteSubGraph.
+    execute_request->execute(create_execute_dispatcher());
+    EXPECT_EQ(npu_ud.executed.load(), 6);
+    EXPECT_EQ(npu_ud.executed_by_binding.load(), 4);
+    EXPECT_EQ(npu_ud.bound.load(), 2);
+}
+
+TEST_F(FrozenPlanExecuteRequestTest, finds_pipeline_through_slot_of_model) {
+    ExecuteRequest::Ptr execute_request = create_chain(3);
+    execute_request->freeze(create_execute_dispatcher());
+    EXPECT_EQ(execute_request->get_pipeline(), nullptr);
+
+    auto pipeline_slot = std::make_shared<PipelineSlot>();
+    execute_request->set_pipeline_slot(pipeline_slot);
+    EXPECT_EQ(execute_request->get_pipeline(), nullptr);
+
+    // A pipeline set after commit is found by the ExecuteRequest already committed.
+    auto pipeline = std::make_shared<PipelineExecutor>(3, 2);
+    pipeline_slot->reset(pipeline);
+    EXPECT_EQ(execute_request->get_pipeline(), pipeline);
+    EXPECT_EQ(execute_request->execute_pipelined(*execute_request->get_pipeline()).get(), ENN_RET_SUCCESS);
+
+    pipeline_slot->reset();
+    EXPECT_EQ(execute_request->get_pipeline(), nullptr);
+}
+
+TEST_F(FrozenPlanExecuteRequestTest, throws_on_freeze_with_unsupported_accelerator) {
+    model = create_model();
+    scheduled_graph = std::make_shared<ScheduledGraph>();
+    head = create_op_list(model, Accelerator::NONE);
+    scheduled_graph->add_vertex(head).set_start_vertex(head).set_end_vertex(head);
+    model->set_scheduled_graph(scheduled_graph);
+    auto executable_model = create_executable_model(model);
+    executable_model->load(std::make_unique<NullDispatcher>());
+    ExecuteRequest::Ptr execute_request = ExecuteRequest::create(executable_model);
+    EXPECT_THROW(execute_request->freeze(create_execute_dispatcher()), std::runtime_error);
+    EXPECT_FALSE(execute_request->is_frozen());
+}
+
+// Runtime overhead per execution with no-op userdrivers: creating a dispatcher and resolving
+//  the userdriver of each OperatorList per execution, compared with the frozen plan.
+TEST_F(FrozenPlanExecuteRequestTest, DISABLED_benchmark_runtime_overhead_with_noop_userdrivers) {
+    constexpr int kIteration = 100000;
+    constexpr int kOpListCount = 4;
+    ExecuteRequest::Ptr execute_request = create_chain(kOpListCount);
+
+    auto start = Clock::now();
+    for (int i = 0; i < kIteration; ++i) {
+        execute_request->execute(create_execute_dispatcher());
+    }
+    double per_dispatcher = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / kIteration;
+
+    execute_request->freeze(create_execute_dispatcher());
+    start = Clock::now();
+    for (int i = 0; i < kIteration; ++i) {
+        execute_request->execute();
+    }
+    double per_plan = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / kIteration;
+
+    std::cout << "[          ] " << kOpListCount << " OperatorLists, dispatcher per execution: " << per_dispatcher
+              << " ns, frozen plan: " << per_plan << " ns" << std::endl;
+    EXPECT_EQ(npu_ud.executed.load() + cpu_ud.executed.load(), 2 * kIteration * kOpListCount);
+}
+
+TEST_F(FrozenPlanExecuteRequestTest, records_latency_statistics_of_model) {
+    constexpr int kOpListCount = 3;
+    ExecuteRequest::Ptr execute_request = create_chain(kOpListCount);
+    execute_request->freeze(create_execute_dispatcher());
+
+    OperatorListBuilder(scheduled_graph->get_start_vertex()).set_predicted_latency(1000);
+
+    // OperatorLists of the model in topological order, as Engine creates the statistics at open.
+    std::vector<metrics::ModelStatistics::OperatorListInfo> op_lists;
+    for (auto& op_list : scheduled_graph->order<enn::model::graph::iterator::TopologicalSort>()) {
+        op_lists.push_back({op_list->get_id().get(), op_list->get_accelerator(),
+                            op_list->get_predicted_latency() * 1000ull});
+    }
+    auto userdriver = std::make_shared<metrics::UserdriverStatistics>();
+    auto statistics = std::make_shared<metrics::ModelStatistics>(op_lists, userdriver);
+    execute_request->set_statistics(statistics);
+
+    execute_request->execute();
+    AsyncExecutor executor(1, 4);
+    EXPECT_EQ(execute_request->execute_async(executor).get(), ENN_RET_SUCCESS);
+    PipelineExecutor pipeline(kOpListCount, 2);
+    EXPECT_EQ(execute_request->execute_pipelined(pipeline).get(), ENN_RET_SUCCESS);
+
+    EnnModelStatistics report;
+    statistics->fill(&report);
+    EXPECT_EQ(report.execute.count, 3);
+    EXPECT_EQ(report.queue_wait.count, 2);  // of asynchronous and pipelined executions
+    EXPECT_EQ(report.open.count, 0);
+    ASSERT_EQ(report.n_operator_list, kOpListCount);
+    for (uint32_t i = 0; i < report.n_operator_list; ++i) {
+        EXPECT_EQ(report.operator_list[i].count, 3);
+        EXPECT_LE(report.operator_list[i].p50_ns, report.operator_list[i].p99_ns);
+        EXPECT_LE(report.operator_list[i].p99_ns, report.operator_list[i].max_ns);
+    }
+    EXPECT_EQ(report.operator_list_userdriver[0], ENN_USERDRIVER_NPU);
+    EXPECT_EQ(report.operator_list_userdriver[1], ENN_USERDRIVER_CPU);
+    EXPECT_EQ(report.operator_list_predicted_ns[0], 1000 * 1000);
+    EXPECT_EQ(report.operator_list_predicted_ns[1], 0);
+    EXPECT_EQ(report.userdriver[ENN_USERDRIVER_NPU].count, 6);
+    EXPECT_EQ(report.userdriver[ENN_USERDRIVER_CPU].count, 3);
+    EXPECT_EQ(report.userdriver[ENN_USERDRIVER_GPU].count, 0);
+}
@@ -0,0 +1,204 @@
+#ifndef SRC_RUNTIME_EXECUTE_REQUEST_PIPELINE_EXECUTOR_HPP_
+#define SRC_RUNTIME_EXECUTE_REQUEST_PIPELINE_EXECUTOR_HPP_
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <future>
+#include <thread>
+#include <deque>
+#include <vector>
+#include <unordered_set>
+#include <stdexcept>
+
+#include "common/enn_debug.h"
+
+namespace enn {
+namespace runtime {
+namespace execute {
+
+// PipelineExecutor runs frames through a fixed number of stages so that
+//  stage k of a frame is overlapped with stage k-1 of the next frame.
+//  - Each stage has its own worker thread and FIFO queue, so a stage runs a frame at a time
+//    and frames pass each stage in submission order.
+//  - The number of frames in the pipeline is bounded by the queue depth.
+//    submit() blocks the caller until a frame leaves the pipeline (backpressure).
+//  - A key identifies the buffers a frame works on(session). Only a frame per key can be in the pipeline,
+//    because stages of two frames sharing buffers would overwrite intermediate data of each other.
+//  - When a stage of a frame fails, the remaining stages of the frame are skipped and
+//    the exception is delivered to its future.
+class PipelineExecutor {
+ public:
+    using UPtr = std::unique_ptr<PipelineExecutor>;
+    using Key = uint64_t;
+    using StageTask = std::function<void(size_t stage)>;
+
+    static constexpr size_t DEFAULT_QUEUE_DEPTH = 4;
+
+ private:
+    struct Frame {
+        Key key;
+        StageTask run_stage;
+        std::promise<void> promise;
+        std::exception_ptr error;
+    };
+    using FramePtr = std::shared_ptr<Frame>;
+
+ public:
+    explicit PipelineExecutor(size_t stage_num, size_t queue_depth = DEFAULT_QUEUE_DEPTH)
+        : queue_depth_{queue_depth ? queue_depth : 1}, in_flight_{0}, stop_{false},
+          stage_queues_(stage_num ? stage_num : 1) {
+        workers_.reserve(stage_queues_.size());
+        for (size_t stage = 0; stage < stage_queues_.size(); ++stage) {
+            workers_.emplace_back(&PipelineExecutor::work, this, stage);
+        }
+        ENN_DBG_COUT << "PipelineExecutor is created with " << stage_queues_.size() << " stages, depth "
+                     << queue_depth_ << std::endl;
+    }
+
+    PipelineExecutor(const PipelineExecutor&) = delete;
+    PipelineExecutor& operator=(const PipelineExecutor&) = delete;
+
+    // Frames already submitted go through all stages before workers are joined.
+    ~PipelineExecutor() {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            stop_ = true;
+            slot_cv_.notify_all();
+            slot_cv_.wait(lock, [this] { return in_flight_ == 0; });
+        }
+        stage_cv_.notify_all();
+        for (auto& worker : workers_) {
+            if (worker.joinable()) worker.join();
+        }
+        ENN_DBG_COUT << "PipelineExecutor is released" << std::endl;
+    }
+
+    // Submit a frame which calls run_stage(0) to run_stage(stage_num - 1) in order.
+    //  throw exception of std::runtime_error if the executor is being released.
+    std::future<void> submit(Key key, StageTask run_stage) {
+        auto frame = std::make_shared<Frame>();
+        frame->key = key;
+        frame->run_stage = std::move(run_stage);
+        auto future = frame->promise.get_future();
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            slot_cv_.wait(lock, [this, key] {
+                return stop_ || (in_flight_ < queue_depth_ && keys_in_flight_.count(key) == 0);
+            });
+            if (stop_) {
+                throw std::runtime_error("PipelineExecutor is stopped, cannot submit a frame");
+            }
+            ++in_flight_;
+            keys_in_flight_.insert(key);
+            stage_queues_.front().push_back(std::move(frame));
+        }
+        stage_cv_.notify_all();
+        return future;
+    }
+
+    size_t get_stage_num() const {
+        return stage_queues_.size();
+    }
+
+    size_t get_queue_depth() const {
+        return queue_depth_;
+    }
+
+    // Number of frames submitted but not completed yet.
+    size_t get_in_flight_count() const {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return in_flight_;
+    }
+
+ private:
+    void work(size_t stage) {
+        auto& queue = stage_queues_[stage];
+        bool is_last = (stage + 1 == stage_queues_.size());
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            stage_cv_.wait(lock, [this, &queue] { return !queue.empty() || (stop_ && in_flight_ == 0); });
+            if (queue.empty()) {
+                // stop_ is set and no frame is left in the pipeline.
+                return;
+            }
+            FramePtr frame = std::move(queue.front());
+            queue.pop_front();
+
+            lock.unlock();
+            if (!frame->error) {
+                try {
+                    frame->run_stage(stage);
+                } catch (...) {
+                    frame->error = std::current_exception();
+                }
+            }
+            lock.lock();
+
+            if (!is_last && !frame->error) {
+                stage_queues_[stage + 1].push_back(std::move(frame));
+                stage_cv_.notify_all();
+                continue;
+            }
+            keys_in_flight_.erase(frame->key);
+            --in_flight_;
+            // Complete the frame after the slot is released, so that a client waiting for this frame
+            //  can submit the next frame of the same key without blocking.
+            if (frame->error) {
+                frame->promise.set_exception(frame->error);
+            } else {
+                frame->promise.set_value();
+            }
+            slot_cv_.notify_all();
+            if (in_flight_ == 0) stage_cv_.notify_all();
+        }
+    }
+
+ private:
+    const size_t queue_depth_;
+    size_t in_flight_;
+    bool stop_;
+    mutable std::mutex mutex_;
+    std::condition_variable stage_cv_;  // notified when a frame is queued to a stage or pipeline is drained
+    std::condition_variable slot_cv_;   // notified when a frame leaves the pipeline
+    std::unordered_set<Key> keys_in_flight_;
+    std::vector<std::deque<FramePtr>> stage_queues_;
+    std::vector<std::thread> workers_;
+};
+
+// PipelineSlot holds the PipelineExecutor of a model, if enabled. It is shared by the Engine and every
+//  ExecuteRequest of the model, so that an execution finds the pipeline without a lookup in the Engine,
+//  and without a lock unless the pipeline is enabled.
+class PipelineSlot {
+ public:
+    using Ptr = std::shared_ptr<PipelineSlot>;
+
+    // Replace the pipeline, nullptr disables it. The old one is drained out of the lock when it is released.
+    void reset(std::shared_ptr<PipelineExecutor> pipeline = nullptr) {
+        std::shared_ptr<PipelineExecutor> old;
+        std::lock_guard<std::mutex> guard(mutex_);
+        old = std::move(pipeline_);
+        pipeline_ = std::move(pipeline);
+        enabled_.store(pipeline_ != nullptr, std::memory_order_release);
+    }
+
+    std::shared_ptr<PipelineExecutor> get() const {
+        if (!enabled_.load(std::memory_order_acquire)) return nullptr;
+        std::lock_guard<std::mutex> guard(mutex_);
+        return pipeline_;
+    }
+
+ private:
+    std::atomic<bool> enabled_{false};
+    mutable std::mutex mutex_;
+    std::shared_ptr<PipelineExecutor> pipeline_;
+};
+
+};  // namespace execute
+};  // namespace runtime
+};  // namespace enn
+
+#endif  // SRC_RUNTIME_EXECUTE_REQUEST_PIPELINE_EXECUTOR_HPP_
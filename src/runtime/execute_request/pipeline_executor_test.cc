@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "runtime/execute_request/pipeline_executor.hpp"
+
+using namespace enn::runtime::execute;
+
+class PipelineExecutorTest : public testing::Test {};
+
+TEST_F(PipelineExecutorTest, runs_stages_of_frame_in_order) {
+    constexpr size_t kStageNum = 3;
+    PipelineExecutor pipeline(kStageNum, 2);
+    EXPECT_EQ(pipeline.get_stage_num(), kStageNum);
+    EXPECT_EQ(pipeline.get_queue_depth(), 2);
+
+    std::vector<size_t> stages;
+    pipeline.submit(0, [&stages](size_t stage) { stages.push_back(stage); }).get();
+    EXPECT_EQ(stages, std::vector<size_t>({0, 1, 2}));
+}
+
+TEST_F(PipelineExecutorTest, keeps_frame_order_in_each_stage) {
+    constexpr size_t kStageNum = 3;
+    constexpr int kFrameNum = 50;
+    PipelineExecutor pipeline(kStageNum, 4);
+    std::vector<std::vector<int>> orders(kStageNum);
+    std::vector<std::future<void>> futures;
+    for (int frame = 0; frame < kFrameNum; ++frame) {
+        // Each stage is run by a worker, so a vector is touched by a thread at a time.
+        futures.push_back(pipeline.submit(frame % 4, [&orders, frame](size_t stage) {
+            orders[stage].push_back(frame);
+        }));
+    }
+    for (auto& future : futures) future.get();
+    for (auto& order : orders) {
+        ASSERT_EQ(order.size(), kFrameNum);
+        EXPECT_TRUE(std::is_sorted(order.begin(), order.end()));
+    }
+}
+
+TEST_F(PipelineExecutorTest, overlaps_stages_of_different_frames) {
+    PipelineExecutor pipeline(2, 2);
+    std::promise<void> second_started;
+    auto second_started_future = second_started.get_future();
+    std::atomic<bool> overlapped{false};
+
+    // The last stage of the first frame waits for the first stage of the second frame to start,
+    //  which happens only if the stages of two frames overlap. It gives up after a timeout.
+    auto first = pipeline.submit(0, [&](size_t stage) {
+        if (stage == 1) {
+            overlapped = second_started_future.wait_for(std::chrono::seconds(10)) == std::future_status::ready;
+        }
+    });
+    auto second = pipeline.submit(1, [&](size_t stage) {
+        if (stage == 0) second_started.set_value();
+    });
+    first.get();
+    second.get();
+    EXPECT_TRUE(overlapped.load());
+}
+
+TEST_F(PipelineExecutorTest, bounds_frames_in_flight) {
+    constexpr size_t kDepth = 2;
+    PipelineExecutor pipeline(2, kDepth);
+    std::promise<void> release;
+    auto release_future = release.get_future().share();
+    std::vector<std::future<void>> futures;
+    for (size_t i = 0; i < kDepth; ++i) {
+        futures.push_back(pipeline.submit(i, [release_future](size_t) { release_future.wait(); }));
+    }
+    EXPECT_EQ(pipeline.get_in_flight_count(), kDepth);
+
+    std::atomic<bool> submitted{false};
+    std::thread producer([&]() {
+        futures.push_back(pipeline.submit(kDepth, [](size_t) {}));
+        submitted = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(submitted.load());
+    release.set_value();
+    producer.join();
+    EXPECT_TRUE(submitted.load());
+    for (auto& future : futures) future.get();
+}
+
+TEST_F(PipelineExecutorTest, admits_a_frame_per_key) {
+    PipelineExecutor pipeline(2, 4);
+    std::promise<void> release;
+    auto release_future = release.get_future().share();
+    auto first = pipeline.submit(7, [release_future](size_t) { release_future.wait(); });
+
+    std::atomic<bool> submitted{false};
+    std::future<void> second;
+    std::thread producer([&]() {
+        second = pipeline.submit(7, [](size_t) {});
+        submitted = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    // The second frame shares buffers with the first one, so it waits even though the pipeline has room.
+    EXPECT_FALSE(submitted.load());
+    release.set_value();
+    producer.join();
+    first.get();
+    second.get();
+}
+
+TEST_F(PipelineExecutorTest, skips_remaining_stages_after_failure) {
+    PipelineExecutor pipeline(3, 2);
+    std::vector<size_t> stages;
+    auto future = pipeline.submit(0, [&stages](size_t stage) {
+        stages.push_back(stage);
+        if (stage == 1) throw std::runtime_error("failed");
+    });
+    EXPECT_THROW(future.get(), std::runtime_error);
+    EXPECT_EQ(stages, std::vector<size_t>({0, 1}));
+
+    // The key is released for the next frame.
+    pipeline.submit(0, [](size_t) {}).get();
+}
+
+TEST_F(PipelineExecutorTest, completes_frames_on_release) {
+    std::atomic<int> done{0};
+    {
+        PipelineExecutor pipeline(3, 4);
+        for (int i = 0; i < 12; ++i) {
+            pipeline.submit(i % 4, [&done](size_t stage) {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+                if (stage == 2) done++;
+            });
+        }
+    }
+    EXPECT_EQ(done.load(), 12);
+}
@@ -0,0 +1,125 @@
+#ifndef SRC_RUNTIME_METRICS_LATENCY_HISTOGRAM_HPP_
+#define SRC_RUNTIME_METRICS_LATENCY_HISTOGRAM_HPP_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include "client/enn_api-type.h"
+
+namespace enn {
+namespace runtime {
+namespace metrics {
+
+// LatencyHistogram counts latencies in nanoseconds into log-linear buckets like HDR histogram.
+//  - Values below 2^SUB_BUCKET_BITS have a bucket each, and each power of 2 above is split into
+//    2^SUB_BUCKET_BITS buckets, so that a percentile is within 1/16(6.25%) of the actual value over the whole range.
+//  - record() only adds to atomic counters without a lock or allocation, so that it can be called on the
+//    execution path by threads concurrently. Readers see a consistent enough view without stopping writers.
+class LatencyHistogram {
+ public:
+    static constexpr uint32_t SUB_BUCKET_BITS = 4;
+    static constexpr uint64_t SUB_BUCKET_NUM = 1ull << SUB_BUCKET_BITS;
+    static constexpr size_t BUCKET_NUM = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_NUM;
+
+    LatencyHistogram() {
+        reset();
+    }
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+    void record(uint64_t value_ns) {
+        buckets_[index_of(value_ns)].fetch_add(1, std::memory_order_relaxed);
+        count_.fetch_add(1, std::memory_order_relaxed);
+        sum_ns_.fetch_add(value_ns, std::memory_order_relaxed);
+        uint64_t max_ns = max_ns_.load(std::memory_order_relaxed);
+        while (value_ns > max_ns &&
+               !max_ns_.compare_exchange_weak(max_ns, value_ns, std::memory_order_relaxed)) {}
+    }
+
+    void record(std::chrono::steady_clock::duration elapsed) {
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+        record(static_cast<uint64_t>(ns > 0 ? ns : 0));
+    }
+
+    void record_since(std::chrono::steady_clock::time_point start) {
+        record(std::chrono::steady_clock::now() - start);
+    }
+
+    void reset() {
+        for (auto& bucket : buckets_) bucket.store(0, std::memory_order_relaxed);
+        count_.store(0, std::memory_order_relaxed);
+        sum_ns_.store(0, std::memory_order_relaxed);
+        max_ns_.store(0, std::memory_order_relaxed);
+    }
+
+    uint64_t get_count() const {
+        return count_.load(std::memory_order_relaxed);
+    }
+
+    uint64_t get_max() const {
+        return max_ns_.load(std::memory_order_relaxed);
+    }
+
+    uint64_t get_mean() const {
+        uint64_t count = get_count();
+        return count ? sum_ns_.load(std::memory_order_relaxed) / count : 0;
+    }
+
+    // The smallest value that "quantile"(0 ~ 1) of recorded values are equal to or less than,
+    //  which is the highest value of its bucket and is capped by the max recorded.
+    uint64_t get_percentile(double quantile) const {
+        uint64_t count = get_count();
+        if (count == 0) return 0;
+        uint64_t rank = static_cast<uint64_t>(quantile * count + 0.5);
+        if (rank < 1) rank = 1;
+        if (rank > count) rank = count;
+        uint64_t accumulated = 0;
+        for (size_t index = 0; index < BUCKET_NUM; ++index) {
+            accumulated += buckets_[index].load(std::memory_order_relaxed);
+            if (accumulated >= rank) {
+                uint64_t highest = highest_of(index);
+                uint64_t max_ns = get_max();
+                return highest < max_ns ? highest : max_ns;
+            }
+        }
+        return get_max();
+    }
+
+    void fill(EnnLatencyStatistics* statistics) const {
+        statistics->count = get_count();
+        statistics->mean_ns = get_mean();
+        statistics->max_ns = get_max();
+        statistics->p50_ns = get_percentile(0.5);
+        statistics->p90_ns = get_percentile(0.9);
+        statistics->p99_ns = get_percentile(0.99);
+        statistics->p999_ns = get_percentile(0.999);
+    }
+
+    static size_t index_of(uint64_t value) {
+        if (value < SUB_BUCKET_NUM) return static_cast<size_t>(value);
+        uint32_t shift = 63 - __builtin_clzll(value) - SUB_BUCKET_BITS;
+        return static_cast<size_t>((shift + 1) * SUB_BUCKET_NUM + ((value >> shift) - SUB_BUCKET_NUM));
+    }
+
+    // The highest value counted into the bucket of index.
+    static uint64_t highest_of(size_t index) {
+        if (index < SUB_BUCKET_NUM) return index;
+        uint32_t shift = static_cast<uint32_t>(index / SUB_BUCKET_NUM - 1);
+        uint64_t lowest = (SUB_BUCKET_NUM + index % SUB_BUCKET_NUM) << shift;
+        return lowest + ((1ull << shift) - 1);
+    }
+
+ private:
+    std::array<std::atomic<uint64_t>, BUCKET_NUM> buckets_;
+    std::atomic<uint64_t> count_;
+    std::atomic<uint64_t> sum_ns_;
+    std::atomic<uint64_t> max_ns_;
+};
+
+};  // namespace metrics
+};  // namespace runtime
+};  // namespace enn
+
+#endif  // SRC_RUNTIME_METRICS_LATENCY_HISTOGRAM_HPP_
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "runtime/metrics/latency_histogram.hpp"
+
+using namespace enn::runtime::metrics;
+using Clock = std::chrono::steady_clock;
+
+TEST(LatencyHistogramTest, buckets_cover_values_in_order) {
+    size_t last_index = 0;
+    for (uint64_t value : {0ull, 1ull, 15ull, 16ull, 17ull, 31ull, 32ull, 1000ull, 123456789ull, ~0ull}) {
+        size_t index = LatencyHistogram::index_of(value);
+        EXPECT_LT(index, LatencyHistogram::BUCKET_NUM);
+        EXPECT_LE(last_index, index);
+        EXPECT_LE(value, LatencyHistogram::highest_of(index));
+        if (index > 0) EXPECT_GT(value, LatencyHistogram::highest_of(index - 1));
+        last_index = index;
+    }
+    // Values below 16 are exact, and a bucket above is narrower than 1/16 of its values.
+    EXPECT_EQ(LatencyHistogram::highest_of(LatencyHistogram::index_of(15)), 15);
+    uint64_t value = 1000000;
+    EXPECT_LE(LatencyHistogram::highest_of(LatencyHistogram::index_of(value)) - value, value / 16);
+}
+
+TEST(LatencyHistogramTest, percentiles_are_within_precision) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.get_percentile(0.5), 0);
+    for (uint64_t value = 1; value <= 100000; ++value) {
+        histogram.record(value * 1000);
+    }
+    EXPECT_EQ(histogram.get_count(), 100000);
+    EXPECT_EQ(histogram.get_max(), 100000000);
+    EXPECT_EQ(histogram.get_mean(), 50000500);
+    auto expect_near = [&](double quantile, double expected) {
+        double actual = static_cast<double>(histogram.get_percentile(quantile));
+        EXPECT_GE(actual, expected) << quantile;
+        EXPECT_LE(actual, expected * (1 + 1.0 / 16)) << quantile;
+    };
+    expect_near(0.5, 50000000);
+    expect_near(0.9, 90000000);
+    expect_near(0.99, 99000000);
+    expect_near(0.999, 99900000);
+    EXPECT_EQ(histogram.get_percentile(1.0), histogram.get_max());
+
+    EnnLatencyStatistics statistics;
+    histogram.fill(&statistics);
+    EXPECT_EQ(statistics.count, 100000);
+    EXPECT_EQ(statistics.p50_ns, histogram.get_percentile(0.5));
+    EXPECT_EQ(statistics.p999_ns, histogram.get_percentile(0.999));
+
+    histogram.reset();
+    EXPECT_EQ(histogram.get_count(), 0);
+    EXPECT_EQ(histogram.get_max(), 0);
+}
+
+TEST(LatencyHistogramTest, records_from_threads_without_loss) {
+    constexpr int kThreadNum = 4;
+    constexpr int kRecordNum = 100000;
+    LatencyHistogram histogram;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreadNum; ++t) {
+        threads.emplace_back([&histogram, t]() {
+            for (int i = 0; i < kRecordNum; ++i) histogram.record(static_cast<uint64_t>(t * kRecordNum + i));
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    EXPECT_EQ(histogram.get_count(), kThreadNum * kRecordNum);
+    EXPECT_EQ(histogram.get_max(), kThreadNum * kRecordNum - 1);
+}
+
+TEST(LatencyHistogramTest, DISABLED_benchmark_record) {
+    constexpr int kIteration = 1000000;
+    LatencyHistogram histogram;
+    auto start = Clock::now();
+    for (int i = 0; i < kIteration; ++i) {
+        histogram.record(static_cast<uint64_t>(i) * 37);
+    }
+    double per_record = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / kIteration;
+    std::cout << "[          ] record: " << per_record << " ns" << std::endl;
+    EXPECT_EQ(histogram.get_count(), kIteration);
+}
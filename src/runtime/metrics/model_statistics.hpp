@@ -0,0 +1,178 @@
+#ifndef SRC_RUNTIME_METRICS_MODEL_STATISTICS_HPP_
+#define SRC_RUNTIME_METRICS_MODEL_STATISTICS_HPP_
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "model/types.hpp"
+#include "runtime/metrics/latency_histogram.hpp"
+
+namespace enn {
+namespace runtime {
+namespace metrics {
+
+// Index of enn_userdriver_e of the userdriver an OperatorList of the accelerator is dispatched to,
+//  in the same order as ExecuteDispatcher looks it up.
+inline uint32_t userdriver_of(model::Accelerator accelerator) {
+    static const model::Accelerator userdrivers[ENN_USERDRIVER_SIZE] = {
+        model::Accelerator::NPU, model::Accelerator::DSP, model::Accelerator::CPU,
+        model::Accelerator::GPU, model::Accelerator::UNIFIED};
+    for (uint32_t index = 0; index < ENN_USERDRIVER_SIZE; ++index) {
+        if (model::available_accelerator(accelerator, userdrivers[index])) return index;
+    }
+    return ENN_USERDRIVER_SIZE;
+}
+
+// Device time of OperatorLists of all models, per userdriver. Shared by ModelStatistics.
+class UserdriverStatistics {
+ public:
+    using Ptr = std::shared_ptr<UserdriverStatistics>;
+
+    // nullptr for the accelerator that no userdriver executes.
+    LatencyHistogram* find(model::Accelerator accelerator) {
+        uint32_t index = userdriver_of(accelerator);
+        return index < ENN_USERDRIVER_SIZE ? &histograms_[index] : nullptr;
+    }
+
+    void fill(EnnModelStatistics* statistics) const {
+        for (uint32_t index = 0; index < ENN_USERDRIVER_SIZE; ++index) {
+            histograms_[index].fill(&statistics->userdriver[index]);
+        }
+    }
+
+ private:
+    LatencyHistogram histograms_[ENN_USERDRIVER_SIZE];
+};
+
+// Latency histograms of a model, which are kept from open to close of the model and updated
+//  by every session of it. OperatorLists are fixed at construction, so that finding and updating
+//  a histogram on the execution path never takes a lock.
+class ModelStatistics {
+ public:
+    using Ptr = std::shared_ptr<ModelStatistics>;
+    using OperatorListKey = uint64_t;
+
+    struct OperatorListInfo {
+        OperatorListKey key;
+        model::Accelerator accelerator;
+        uint64_t predicted_ns;  // by the static scheduler, 0 if not predicted
+    };
+
+    struct OperatorListStatistics {
+        OperatorListInfo info;
+        LatencyHistogram device;
+    };
+
+    // operator_lists: OperatorLists in topological order.
+    ModelStatistics(const std::vector<OperatorListInfo>& operator_lists, UserdriverStatistics::Ptr userdriver)
+        : operator_lists_(operator_lists.size()), userdriver_{std::move(userdriver)} {
+        for (size_t i = 0; i < operator_lists.size(); ++i) {
+            operator_lists_[i].info = operator_lists[i];
+            index_of_[operator_lists[i].key] = i;
+        }
+    }
+
+    LatencyHistogram& open() { return open_; }
+    LatencyHistogram& commit() { return commit_; }
+    LatencyHistogram& execute() { return execute_; }
+    LatencyHistogram& queue_wait() { return queue_wait_; }
+
+    // nullptr if the OperatorList is not of the model.
+    LatencyHistogram* find_operator_list(OperatorListKey key) {
+        auto it = index_of_.find(key);
+        return it == index_of_.end() ? nullptr : &operator_lists_[it->second].device;
+    }
+
+    LatencyHistogram* find_userdriver(model::Accelerator accelerator) {
+        return userdriver_ ? userdriver_->find(accelerator) : nullptr;
+    }
+
+    size_t get_operator_list_count() const {
+        return operator_lists_.size();
+    }
+
+    // OperatorLists over ENN_STATISTICS_OPERATOR_LIST_MAX are not reported, though they are recorded.
+    void fill(EnnModelStatistics* statistics) const {
+        std::memset(statistics, 0, sizeof(*statistics));
+        open_.fill(&statistics->open);
+        commit_.fill(&statistics->commit);
+        execute_.fill(&statistics->execute);
+        queue_wait_.fill(&statistics->queue_wait);
+        size_t n_operator_list = std::min<size_t>(operator_lists_.size(), ENN_STATISTICS_OPERATOR_LIST_MAX);
+        statistics->n_operator_list = static_cast<uint32_t>(n_operator_list);
+        for (size_t i = 0; i < n_operator_list; ++i) {
+            operator_lists_[i].device.fill(&statistics->operator_list[i]);
+            statistics->operator_list_userdriver[i] = userdriver_of(operator_lists_[i].info.accelerator);
+            statistics->operator_list_predicted_ns[i] = operator_lists_[i].info.predicted_ns;
+        }
+        if (userdriver_) userdriver_->fill(statistics);
+    }
+
+ private:
+    LatencyHistogram open_;
+    LatencyHistogram commit_;
+    LatencyHistogram execute_;
+    LatencyHistogram queue_wait_;
+    std::vector<OperatorListStatistics> operator_lists_;
+    std::unordered_map<OperatorListKey, size_t> index_of_;
+    UserdriverStatistics::Ptr userdriver_;
+};
+
+// ModelStatistics of models opened, keyed by model id. It is looked up at open, commit and close,
+//  not on the execution path, as an ExecuteRequest keeps the ModelStatistics of its model.
+class StatisticsRegistry {
+ public:
+    using UPtr = std::unique_ptr<StatisticsRegistry>;
+    using ModelID = uint64_t;
+
+    StatisticsRegistry() : userdriver_{std::make_shared<UserdriverStatistics>()} {}
+
+    ModelStatistics::Ptr add(ModelID model_id, const std::vector<ModelStatistics::OperatorListInfo>& operator_lists) {
+        auto statistics = std::make_shared<ModelStatistics>(operator_lists, userdriver_);
+        std::lock_guard<std::mutex> guard(mutex_);
+        models_[model_id] = statistics;
+        return statistics;
+    }
+
+    // nullptr if the model is not opened.
+    ModelStatistics::Ptr find(ModelID model_id) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto it = models_.find(model_id);
+        return it == models_.end() ? nullptr : it->second;
+    }
+
+    void remove(ModelID model_id) {
+        std::lock_guard<std::mutex> guard(mutex_);
+        models_.erase(model_id);
+    }
+
+ private:
+    UserdriverStatistics::Ptr userdriver_;
+    std::mutex mutex_;
+    std::unordered_map<ModelID, ModelStatistics::Ptr> models_;
+};
+
+// EnnModelStatistics is passed over HIDL in the vector of int32 for custom_interface.
+//  Both ends are built from the same header, so that it is copied as it is.
+inline std::vector<int32_t> serialize(const EnnModelStatistics& statistics) {
+    std::vector<int32_t> serialized((sizeof(statistics) + sizeof(int32_t) - 1) / sizeof(int32_t), 0);
+    std::memcpy(serialized.data(), &statistics, sizeof(statistics));
+    return serialized;
+}
+
+inline bool deserialize(const int32_t* serialized, size_t size, EnnModelStatistics* statistics) {
+    if (size * sizeof(int32_t) < sizeof(*statistics)) return false;
+    std::memcpy(statistics, serialized, sizeof(*statistics));
+    return true;
+}
+
+};  // namespace metrics
+};  // namespace runtime
+};  // namespace enn
+
+#endif  // SRC_RUNTIME_METRICS_MODEL_STATISTICS_HPP_
@@ -2,6 +2,9 @@
 
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
 #include <functional>
 #include <list>
 #include <algorithm>
@@ -25,8 +28,10 @@ namespace pool {
 // - It is a one-way tree that composes with the inner class "Node" which points to children nodes.
 // - It is a tree in which a dependency between nodes must always be maintained.
 //    a) When a node is added, the node it depends on must be in the tree.
-//    b) When trying to find a node, it traverses through the dependency path from the root of the tree.
+//    b) When trying to find a node, it is looked up in the index of its level by the Key in O(1).
 //    c) When a node is removed, all child nodes of that node are also deleted.
+// - Finding objects is done in parallel under a shared lock, since it is called at every execution
+//    while adding and removing are rare. Adding and removing take the exclusive lock.
 // - It creates and finds dependency paths by calling virtual functions in the Poolable interface.
 // - It follows the general terminology of a Tree ADT.
 template <typename SP,
@@ -51,13 +56,15 @@ class DependencyTreePool {
 
      public:
         Node() : object_{nullptr}, level_{0} { width_list_[level_]++; }
-        Node(const SP& object, size_t level) : object_{object}, level_{level} { width_list_[level_]++; }
+        Node(const SP& object, const Ptr& parent)
+            : object_{object}, level_{parent->get_level() + 1}, parent_{parent} { width_list_[level_]++; }
         ~Node() { width_list_[level_]--; }
 
         bool operator==(const Node& rhs) { return object_ == *rhs; }
         const SP& get() const { return object_; }
         const std::list<Ptr>& get_children() { return children_; }
         size_t get_level() { return level_; }
+        Ptr get_parent() { return parent_.lock(); }
         template <typename C> void add_child(C&& child) { children_.push_back(std::forward<C>(child)); }
         void remove_child(const Ptr& node) { children_.remove_if([&](const Ptr& child) { return child == node; }); }
         std::string to_string() const {
@@ -70,36 +77,35 @@ class DependencyTreePool {
      private:
         SP object_;
         size_t level_;
+        WPtr parent_;
         std::list<Ptr> children_;
     };
 
+    // Nodes on a level indexed by the value of the Key.
+    using IndexKey = std::decay_t<decltype(std::declval<const typename E::Key&>().get())>;
+    using Index = std::unordered_map<IndexKey, typename Node::Ptr>;
+
  private:
     typename Node::Ptr root_;
-    mutable std::mutex mutex_;
+    std::array<Index, Height + 1> index_;
+    mutable std::shared_mutex mutex_;
 
  private:
-    inline typename Node::Ptr find_impl(const typename Node::Ptr& parent,
-                                        const typename E::Key& key,
-                                        size_t target_level,
-                                        size_t current_level) const {
-        for (auto& child : parent->get_children()) {
-            if (target_level == current_level && *child->get() == key) {
-                ENN_DBG_COUT << "An Object(Ox" << key << ") is found in children of "
-                << parent->to_string() << std::endl;
-                return child;
-            } else if (child->get()->is_ancestor_of(key)) {
-                return find_impl(child, key, target_level, current_level + 1);
-            }
+    inline typename Node::Ptr find_impl(const typename E::Key& key, size_t target_level) const {
+        auto& index = index_[target_level];
+        auto it = index.find(key.get());
+        if (it == index.end()) {
+            ENN_ERR_COUT << "An Object with the ID(0x" << key
+                         << ") is not found on the level " << target_level << std::endl;
+            return nullptr;
         }
-        ENN_ERR_COUT << "An Object with the ID(0x" << key
-                     << ") is not found in the children of "<< parent->to_string() << std::endl;
-        return nullptr;
+        return it->second;
     }
 
     inline bool add_impl(const typename Node::Ptr& parent,
                                const SP& object,
                                size_t target_level,
-                               size_t current_level) const {
+                               size_t current_level) {
         if (target_level == current_level) return append_node(parent, object);
         for (auto& child : parent->get_children()) {
             if (child->get()->is_ancestor_of(*object))
@@ -110,39 +116,41 @@ class DependencyTreePool {
         return false;
     }
 
-    inline bool append_node(const typename Node::Ptr& parent, const SP& object) const {
-        auto& children = parent->get_children();
-        auto it = std::find_if(children.begin(), children.end(),
-                               [&](const typename Node::Ptr& child) { return child->get() == object; });
+    inline bool append_node(const typename Node::Ptr& parent, const SP& object) {
+        auto& index = index_[parent->get_level() + 1];
         // Return false if the object to add already exists.
-        if (it != children.end()) {
+        if (index.count(object->get_key().get())) {
             ENN_ERR_COUT << object->to_string() << " already exists as a child of "
                          << parent->to_string() << std::endl;
             return false;
         }
-        parent->add_child(std::make_shared<Node>(object, parent->get_level() + 1));
+        auto node = std::make_shared<Node>(object, parent);
+        parent->add_child(node);
+        index.emplace(object->get_key().get(), std::move(node));
         ENN_DBG_COUT << object->to_string() <<" is added to " << parent->to_string() << std::endl;
         return true;
     }
 
-    inline bool remove_impl(const typename Node::Ptr& parent,
-                            const typename E::Key& key,
-                            size_t target_level,
-                            size_t current_level) const {
-        for (auto& child : parent->get_children()) {
-            ENN_INFO_COUT << "child is " << child->to_string() << std::endl;
-            if (target_level == current_level && *child->get() == key) {
-                parent->remove_child(child);
-                ENN_DBG_COUT << "An Object(Ox" << key << ") is removed from children of "
-                << parent->to_string() << std::endl;
-                return true;
-            } else if (child->get()->is_ancestor_of(key)) {
-                return remove_impl(child, key, target_level, current_level + 1);
-            }
+    inline bool remove_impl(const typename E::Key& key, size_t target_level) {
+        auto node = find_impl(key, target_level);
+        if (!node) {
+            ENN_ERR_COUT << "An Object(ID:0x" << key << ") to be removed is not found" << std::endl;
+            return false;
         }
-        ENN_ERR_COUT << "An Object on which an Object(ID:0x" << key
-                     << ") to be removed depends is not found in children of " << parent->to_string() << std::endl;
-        return false;
+        auto parent = node->get_parent();
+        unindex(node);
+        if (parent) parent->remove_child(node);
+        ENN_DBG_COUT << "An Object(Ox" << key << ") is removed from children of "
+                     << (parent ? parent->to_string() : "unknown") << std::endl;
+        return true;
+    }
+
+    // Remove the node and its descendants from the index, which are deleted together from the tree.
+    inline void unindex(const typename Node::Ptr& node) {
+        for (auto& child : node->get_children()) {
+            unindex(child);
+        }
+        index_[node->get_level()].erase(node->get()->get_key().get());
     }
 
  public:
@@ -150,7 +158,7 @@ class DependencyTreePool {
 
     template <size_t level>
     bool add(const SP& object) {
-        std::lock_guard<std::mutex> guard(mutex_);
+        std::unique_lock<std::shared_mutex> lock(mutex_);
         if (!add_impl(root_, object, level, 1)) {
             return false;
         }
@@ -159,22 +167,22 @@ class DependencyTreePool {
 
     template <size_t level>
     SP find(const typename E::Key& key) const {
-        std::lock_guard<std::mutex> guard(mutex_);
-        auto found = find_impl(root_, key, level, 1);
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto found = find_impl(key, level);
         if (!found) return nullptr;
         return found->get();
     }
 
     template <size_t level>
     bool remove(const typename E::Key& key) {
-        std::lock_guard<std::mutex> guard(mutex_);
-        if (!remove_impl(root_, key, level, 1)) return false;
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        if (!remove_impl(key, level)) return false;
         return true;
     }
 
     template <size_t level>
     size_t width() const {
-        std::lock_guard<std::mutex> guard(mutex_);
+        std::shared_lock<std::shared_mutex> lock(mutex_);
         return Node::get_width_list()[level];
     }
 };
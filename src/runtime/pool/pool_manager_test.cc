@@ -4,6 +4,8 @@
 #include <numeric>
 #include <map>
 #include <algorithm>
+#include <chrono>
+#include <future>
 
 #include "runtime/pool/manager.hpp"
 #include "common/helper_templates.hpp"
@@ -325,3 +327,69 @@ TEST_F(ModelPoolManagerTest, test_cascade_release_by_client_process_id) {
     EXPECT_EQ(pool_manager.count<ExecutableModel>(), 0);
 }
 
+
+TEST_F(ModelPoolManagerTest, test_get_execute_request_after_release_of_sibling) {
+    pool_manager.add<ClientProcess>(client_process);
+    auto model = std::make_shared<Model>(client_process);
+    pool_manager.add<Model>(model);
+    std::vector<ExecuteRequest::Ptr> requests;
+    for (int i = 0; i < 3; i++) {
+        ExecutableModel::Ptr exec_model = ExecutableModel::create(model);
+        pool_manager.add<ExecutableModel>(exec_model);
+        requests.push_back(ExecuteRequest::create(exec_model));
+        pool_manager.add<ExecuteRequest>(requests.back());
+    }
+    // The same object can't be added twice.
+    EXPECT_THROW(pool_manager.add<ExecuteRequest>(requests[0]), std::runtime_error);
+
+    auto id_of = [](const ExecuteRequest::Ptr& request) {
+        return static_cast<uint64_t>(request->get_executable_model()->get_id());
+    };
+    pool_manager.release<ExecutableModel>(id_of(requests[1]));
+    EXPECT_THROW(pool_manager.get<ExecuteRequest>(id_of(requests[1])), std::runtime_error);
+    EXPECT_EQ(pool_manager.get<ExecuteRequest>(id_of(requests[0])), requests[0]);
+    EXPECT_EQ(pool_manager.get<ExecuteRequest>(id_of(requests[2])), requests[2]);
+    EXPECT_EQ(pool_manager.count<ExecuteRequest>(), 2);
+
+    pool_manager.release<Model>(static_cast<uint64_t>(model->get_id()));
+    EXPECT_EQ(pool_manager.count<ExecutableModel>(), 0);
+    EXPECT_EQ(pool_manager.count<ExecuteRequest>(), 0);
+    EXPECT_THROW(pool_manager.get<ExecuteRequest>(id_of(requests[0])), std::runtime_error);
+}
+
+// Threads get ExecuteRequests of different models from the pool like execute_model() does,
+//  while many models are open. Lookups should scale with threads as they don't exclude each other.
+TEST_F(ModelPoolManagerTest, DISABLED_benchmark_get_execute_request_with_multi_threads) {
+    constexpr int kModelCount = 128;
+    constexpr int kGetPerThread = 50000;
+    pool_manager.add<ClientProcess>(client_process);
+    std::vector<uint64_t> request_ids;
+    std::vector<ExecuteRequest::Ptr> requests;
+    for (int i = 0; i < kModelCount; i++) {
+        auto model = std::make_shared<Model>(client_process);
+        pool_manager.add<Model>(model);
+        ExecutableModel::Ptr exec_model = ExecutableModel::create(model);
+        pool_manager.add<ExecutableModel>(exec_model);
+        requests.push_back(ExecuteRequest::create(exec_model));
+        pool_manager.add<ExecuteRequest>(requests.back());
+        request_ids.push_back(static_cast<uint64_t>(exec_model->get_id()));
+    }
+
+    for (int thread_count : {1, 2, 4, 8}) {
+        std::vector<std::future<void>> future_list;
+        auto start = std::chrono::steady_clock::now();
+        for (int t = 0; t < thread_count; t++) {
+            future_list.push_back(std::async(std::launch::async, [&, t]() {
+                for (int i = 0; i < kGetPerThread; i++) {
+                    auto id = request_ids[(t + i * thread_count) % kModelCount];
+                    if (!pool_manager.get<ExecuteRequest>(id)) break;
+                }
+            }));
+        }
+        for (auto& future : future_list) future.get();
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "[          ] " << thread_count << " threads: "
+                  << thread_count * kGetPerThread / elapsed / 1e6 << " M get/s" << std::endl;
+    }
+    EXPECT_EQ(pool_manager.count<ExecuteRequest>(), kModelCount);
+}
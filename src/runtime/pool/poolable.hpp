@@ -36,6 +36,8 @@ class Poolable {
     virtual bool is_descendant_of(const Poolable& rp) const = 0;
     // return true if itself depends on the Poolable with rk(Key), otherwise false.
     virtual bool is_descendant_of(const Key& rk) const = 0;
+    // return Key of an object, which identifies it among objects on the same level of the pool.
+    virtual const Key& get_key() const = 0;
     // return string containg information of an object.
     virtual std::string to_string() const = 0;
 };
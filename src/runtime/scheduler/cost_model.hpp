@@ -0,0 +1,149 @@
+#ifndef RUNTIME_SCHEDULER_COST_MODEL_HPP_
+#define RUNTIME_SCHEDULER_COST_MODEL_HPP_
+
+#include <map>
+#include <vector>
+#include <memory>
+#include <utility>
+#include <algorithm>
+
+#include "model/types.hpp"
+#include "model/component/operator/operator.hpp"
+#include "model/component/tensor/tensor.hpp"
+
+namespace enn {
+namespace runtime {
+namespace schedule {
+
+// CostModel predicts latency(us) of an operator on an accelerator and of crossing
+//  a boundary between OperatorLists, which the cost model based schedule minimizes.
+//  - An operator is estimated as roofline of its FLOPs and bytes moved with the throughput of the device,
+//    unless a measured latency of the operator on the device is given.
+//  - Crossing a boundary costs dispatch overhead of the next OperatorList and
+//    synchronization(cache maintenance) of feature maps passed to it.
+class CostModel {
+ public:
+    using Ptr = std::shared_ptr<CostModel>;
+    using Accelerator = model::Accelerator;
+    using Operator = model::component::Operator;
+
+    struct DeviceCost {
+        double ops_per_us;    // arithmetic throughput
+        double bytes_per_us;  // memory bandwidth
+        double dispatch_us;   // overhead to dispatch an OperatorList to the userdriver
+    };
+
+    static constexpr double DEFAULT_SYNC_BYTES_PER_US = 4000.0;  // 4 GB/s to flush and invalidate caches
+
+ public:
+    CostModel() : sync_bytes_per_us_{DEFAULT_SYNC_BYTES_PER_US} {
+        // Rough figures of mobile SoC, which are enough to order the choices.
+        //  Give measured ones by set_device_cost() or set_measured_latency() for better prediction.
+        device_costs_[Accelerator::CPU]     = {20000.0, 10000.0, 20.0};
+        device_costs_[Accelerator::GPU]     = {200000.0, 20000.0, 200.0};
+        device_costs_[Accelerator::NPU]     = {2000000.0, 20000.0, 100.0};
+        device_costs_[Accelerator::DSP]     = {300000.0, 10000.0, 150.0};
+        device_costs_[Accelerator::UNIFIED] = {2000000.0, 20000.0, 100.0};
+    }
+
+    CostModel& set_device_cost(Accelerator device, const DeviceCost& cost) {
+        device_costs_[device] = cost;
+        return *this;
+    }
+
+    CostModel& set_sync_bandwidth(double bytes_per_us) {
+        sync_bytes_per_us_ = bytes_per_us;
+        return *this;
+    }
+
+    // Measured latency overrides the estimation of the operator on the device.
+    CostModel& set_measured_latency(uint64_t operator_id, Accelerator device, double latency_us) {
+        measured_[{operator_id, device}] = latency_us;
+        return *this;
+    }
+
+    const DeviceCost& get_device_cost(Accelerator device) const {
+        auto it = device_costs_.find(device);
+        // Operators without a known device run on CPU in the end.
+        return it == device_costs_.end() ? device_costs_.at(Accelerator::CPU) : it->second;
+    }
+
+    double predict(const Operator::Ptr& op, Accelerator device) const {
+        auto it = measured_.find({op->get_id(), device});
+        if (it != measured_.end()) return it->second;
+        auto& cost = get_device_cost(device);
+        return std::max(get_flops(op) / cost.ops_per_us, get_bytes(op) / cost.bytes_per_us);
+    }
+
+    // Cost of starting a new OperatorList on the device which takes the input feature maps of the operator.
+    //  Feature maps of each tile are synchronized, while the OperatorList is dispatched once.
+    double predict_boundary(const Operator::Ptr& op, Accelerator device, uint32_t tile_num = 1) const {
+        return get_device_cost(device).dispatch_us + tile_num * get_in_feature_map_bytes(op) / sync_bytes_per_us_;
+    }
+
+    // The operator with a constant input(weight) is estimated as multiply-accumulate of
+    //  the weight per output channel for each output element, like as convolution and fully connected.
+    //  Others are estimated as an operation per output element.
+    // Output channels are taken from the weight, as feature maps can be either NCHW or NHWC.
+    static double get_flops(const Operator::Ptr& op) {
+        double out_elements = 0;
+        for (auto& tensor : op->out_tensors) out_elements += get_element_count(*tensor);
+        double weight_elements = 0;
+        size_t out_channels = 1;
+        for (auto& tensor : op->in_tensors) {
+            if (tensor->is_const() && get_element_count(*tensor) > weight_elements) {
+                weight_elements = get_element_count(*tensor);
+                out_channels = get_out_channels(tensor->get_shape());
+            }
+        }
+        if (weight_elements == 0) return out_elements;
+        return 2.0 * out_elements * std::max(weight_elements / out_channels, 1.0);
+    }
+
+    static double get_bytes(const Operator::Ptr& op) {
+        double bytes = 0;
+        for (auto& tensor : op->in_tensors) bytes += get_byte_size(*tensor);
+        for (auto& tensor : op->out_tensors) bytes += get_byte_size(*tensor);
+        return bytes;
+    }
+
+    static double get_in_feature_map_bytes(const Operator::Ptr& op) {
+        double bytes = 0;
+        for (auto& tensor : op->in_tensors) {
+            if (!tensor->is_const()) bytes += get_byte_size(*tensor);
+        }
+        return bytes;
+    }
+
+ private:
+    // Weights of convolution(OIHW, OHWI) and fully connected(OI) lead with output channels, while
+    //  a weight of depthwise convolution(1HWO) puts them last.
+    static size_t get_out_channels(const std::vector<uint32_t>& weight_shape) {
+        if (weight_shape.empty()) return 1;
+        size_t out_channels = weight_shape.front();
+        if (out_channels == 1 && weight_shape.size() > 1) out_channels = weight_shape.back();
+        return std::max<size_t>(out_channels, 1);
+    }
+
+    static double get_element_count(const model::component::Tensor& tensor) {
+        double count = 1;
+        for (auto dim : tensor.get_shape()) count *= dim;
+        return tensor.get_shape().empty() ? 0 : count;
+    }
+
+    static double get_byte_size(const model::component::Tensor& tensor) {
+        auto it = model::pixel_bit_format_size.find(static_cast<TFlite::TensorType>(tensor.get_data_type()));
+        return get_element_count(tensor) * (it == model::pixel_bit_format_size.end() ? 1 : it->second);
+    }
+
+ private:
+    std::map<Accelerator, DeviceCost> device_costs_;
+    std::map<std::pair<uint64_t, Accelerator>, double> measured_;
+    double sync_bytes_per_us_;
+};
+
+};  // namespace schedule
+};  // namespace runtime
+};  // namespace enn
+
+#endif  // RUNTIME_SCHEDULER_COST_MODEL_HPP_
@@ -2,9 +2,14 @@
 #define RUNTIME_SCHEDULER_STATIC_SCHEDULER_HPP_
 
 #include <map>
+#include <set>
+#include <algorithm>
+#include <utility>
 #include <vector>
 #include <string>
 #include <memory>
+#include <cmath>
+#include <limits>
 
 #include "model/model.hpp"
 
@@ -13,13 +18,16 @@
 #include "model/component/operator/operator_list_builder.hpp"
 #include "model/component/tensor/feature_map_builder.hpp"
 #include "model/graph/iterator/methods/topological_sort.hpp"
+#include "model/graph/iterator/methods/breadth_first_search.hpp"
+#include "runtime/scheduler/cost_model.hpp"
 
 namespace enn {
 namespace runtime {
 namespace schedule {
 
 enum class ModelTrait {
-    Default
+    Default,
+    CostModel,  // some operators can run on more than one accelerator
 };
 
 using namespace enn::model::component;
@@ -29,31 +37,43 @@ class IStaticSchedule {
     virtual ~IStaticSchedule() = default;
     // Group Operators into OperatorList
     virtual void arrange(model::Model::Ptr target_model) = 0;
+    // Preferences from client which are given before arrange()
+    virtual void set_preference(uint32_t /* target_latency */, uint32_t /* tile_num */) {}
 };
 
 class DefaultStaticSchedule : public IStaticSchedule {
+ public:
     void arrange(model::Model::Ptr target_model) override {
         ENN_DBG_COUT << "Schedule origin graph to op_list graph" << std::endl;
         model::ScheduledGraph::Ptr scheduled_graph = std::make_shared<model::ScheduledGraph>();
 
-        model::Accelerator target_device = model::Accelerator::SIZE;
-        std::vector<OperatorList::Ptr> operator_list_vector;
-
-        OperatorListBuilder operator_list_builder;
-        // loop origin graph to collect same taget device operator.
-        for (auto& opr_ptr : target_model->get_origin_graph()->order<enn::model::graph::iterator::TopologicalSort>()) {
+        auto& origin_graph = target_model->get_origin_graph();
+        std::vector<Operator::Ptr> operators;
+        for (auto& opr_ptr : origin_graph->order<enn::model::graph::iterator::TopologicalSort>()) {
             if (static_cast<int>(opr_ptr->get_id()) < 0) {
                 // Skip the Virtual Input & Virtual Output.
                 continue;
             }
+            operators.push_back(opr_ptr);
+        }
+        auto devices = assign(operators);
+
+        model::Accelerator target_device = model::Accelerator::SIZE;
+        std::vector<OperatorList::Ptr> operator_list_vector;
+        // OperatorList that each Operator is grouped into.
+        std::map<Operator::Ptr, OperatorList::Ptr> owner_of;
 
+        OperatorListBuilder operator_list_builder;
+        // loop operators in topological order to collect same taget device operator.
+        for (size_t i = 0; i < operators.size(); ++i) {
+            auto& opr_ptr = operators[i];
             if (target_device == model::Accelerator::SIZE) {
                 // for first operator, add operator to list and update target device
                 operator_list_builder.build(target_model->get_id())
                                      .set_attribute(target_model->get_attribute());
                 operator_list_builder.add_operator(opr_ptr);
-                target_device = opr_ptr->get_accelerator();
-            } else if (target_device == opr_ptr->get_accelerator()) {
+                target_device = devices[i];
+            } else if (target_device == devices[i]) {
                 // for same target device operator, add operator to operator list.
                 operator_list_builder.add_operator(opr_ptr);
             } else {
@@ -62,24 +82,19 @@ class DefaultStaticSchedule : public IStaticSchedule {
                 auto op_list = operator_list_builder.set_accelerator(target_device)
                                                     .create();
 
-                OperatorList::Ptr prev_op_list_vertex;
                 if (op_list->get_size() != 0) {
-                    operator_list_vector.push_back(op_list);
-                    prev_op_list_vertex = std::move(op_list);
+                    operator_list_vector.push_back(std::move(op_list));
                     op_list = operator_list_builder
                                 .build(target_model->get_id())
                                 .set_attribute(target_model->get_attribute())
                                 .create();
-
-                    FeatureMapBuilder feature_map_builder;
-                    FeatureMap::Ptr fm = feature_map_builder.set_id(-1).create();
-                    scheduled_graph->add_neighbor(prev_op_list_vertex, fm, op_list);
                 }
 
-                target_device = opr_ptr->get_accelerator();
+                target_device = devices[i];
                 operator_list_builder = OperatorListBuilder(op_list);
                 operator_list_builder.add_operator(opr_ptr);
             }
+            owner_of[opr_ptr] = operator_list_builder.get();
         }
 
         // create last operator_list.
@@ -94,10 +109,223 @@ class DefaultStaticSchedule : public IStaticSchedule {
         for (auto& v : operator_list_vector) {
             scheduled_graph->add_vertex(v);
         }
+        connect_operator_lists(origin_graph, owner_of, operator_list_vector, scheduled_graph);
 
         target_model->set_scheduled_graph(scheduled_graph);
         ENN_DBG_COUT << "Schedule origin graph to op_list graph Completed" << std::endl;
     }
+
+ protected:
+    // Decide the accelerator for each of operators given in topological order.
+    //  Consecutive operators on the same accelerator are grouped into an OperatorList.
+    //  Default follows the accelerator written in the model.
+    virtual std::vector<model::Accelerator> assign(const std::vector<Operator::Ptr>& operators) {
+        std::vector<model::Accelerator> devices;
+        devices.reserve(operators.size());
+        for (auto& opr_ptr : operators) {
+            devices.push_back(opr_ptr->get_accelerator());
+        }
+        return devices;
+    }
+
+ private:
+    // Connect OperatorLists only where a FeatureMap flows from one to another, so that
+    //  OperatorLists that don't depend on each other have no path between them and can be run concurrently.
+    // The graph is acyclic as each OperatorList is a contiguous range of the topological order.
+    // An OperatorList that depends on no other one is connected from the start vertex with a dummy edge
+    //  (FeatureMap ID -1) to keep all vertices reachable from the start vertex for traversals of clients.
+    //  ExecuteRequest doesn't take the dummy edge as a dependency, so such OperatorLists run as roots.
+    void connect_operator_lists(const model::OriginalGraph::Ptr& origin_graph,
+                                const std::map<Operator::Ptr, OperatorList::Ptr>& owner_of,
+                                const std::vector<OperatorList::Ptr>& operator_list_vector,
+                                model::ScheduledGraph::Ptr& scheduled_graph) {
+        std::set<std::pair<OperatorList::Ptr, OperatorList::Ptr>> connected;
+        std::set<OperatorList::Ptr> has_predecessor;
+        for (auto& from_list : operator_list_vector) {
+            for (auto& opr : *from_list) {
+                auto opr_ptr = std::static_pointer_cast<Operator>(opr);
+                for (const auto& [next_opr_ptr, feature_map] : (*origin_graph)[opr_ptr]) {
+                    auto to = owner_of.find(next_opr_ptr);
+                    if (to == owner_of.end() || to->second == from_list) continue;
+                    if (connected.insert({from_list, to->second}).second) {
+                        scheduled_graph->add_neighbor(from_list, feature_map, to->second);
+                        has_predecessor.insert(to->second);
+                    }
+                }
+            }
+        }
+
+        auto& start_list = operator_list_vector.front();
+        for (auto& op_list : operator_list_vector) {
+            if (op_list == start_list || has_predecessor.count(op_list)) continue;
+            FeatureMapBuilder feature_map_builder;
+            FeatureMap::Ptr fm = feature_map_builder.set_id(-1).create();
+            scheduled_graph->add_neighbor(start_list, fm, op_list);
+        }
+    }
+};
+
+// CostModelStaticSchedule places an operator that can run on some accelerators(mask of them in the model)
+//  to minimize the latency predicted by the CostModel, rather than cutting wherever the accelerator changes.
+//  - Accelerators are chosen by dynamic programming over the topological order, where switching accelerator
+//    between consecutive operators pays a boundary(dispatch and sync). So a few operators are not split
+//    to another device for a small gain, which avoids ping-pong between CPU and other devices.
+//  - With target_latency(us), fragments are merged into a neighbor while the predicted latency meets the target,
+//    which spends the latency headroom to reduce OperatorLists to dispatch.
+//  - tile_num scales computation and sync of an execution, while dispatch overhead is paid once.
+//  - Predicted latency is set to each OperatorList to be compared with the actual one.
+class CostModelStaticSchedule : public DefaultStaticSchedule {
+ public:
+    explicit CostModelStaticSchedule(CostModel::Ptr cost_model = std::make_shared<CostModel>())
+        : cost_model_{std::move(cost_model)}, target_latency_{0}, tile_num_{1} {}
+
+    void set_preference(uint32_t target_latency, uint32_t tile_num) override {
+        target_latency_ = target_latency;
+        tile_num_ = tile_num ? tile_num : 1;
+    }
+
+    void arrange(model::Model::Ptr target_model) override {
+        DefaultStaticSchedule::arrange(target_model);
+        set_predicted_latency(target_model->get_scheduled_graph());
+    }
+
+    // Accelerators in the mask, or the accelerator itself if it is not a mask of them.
+    static std::vector<model::Accelerator> get_candidates(model::Accelerator accelerator) {
+        static const model::Accelerator devices[] = {model::Accelerator::CPU, model::Accelerator::GPU,
+                                                     model::Accelerator::NPU, model::Accelerator::DSP,
+                                                     model::Accelerator::UNIFIED};
+        std::vector<model::Accelerator> candidates;
+        if (accelerator == model::Accelerator::CUSTOM_CPU_KERNEL) return {accelerator};
+        for (auto device : devices) {
+            if (model::available_accelerator(accelerator, device)) candidates.push_back(device);
+        }
+        if (candidates.empty()) candidates.push_back(accelerator);
+        return candidates;
+    }
+
+    // Predicted latency(us) to run operators on the devices, cut into OperatorLists where the device changes.
+    double predict(const std::vector<Operator::Ptr>& operators, const std::vector<model::Accelerator>& devices) const {
+        double latency = 0;
+        for (size_t i = 0; i < operators.size(); ++i) {
+            latency += predict_operator(operators[i], devices[i]);
+            if (i == 0 || devices[i] != devices[i - 1]) latency += predict_boundary(operators[i], devices[i]);
+        }
+        return latency;
+    }
+
+ protected:
+    std::vector<model::Accelerator> assign(const std::vector<Operator::Ptr>& operators) override {
+        const size_t size = operators.size();
+        std::vector<std::vector<model::Accelerator>> candidates;
+        candidates.reserve(size);
+        for (auto& opr_ptr : operators) {
+            candidates.push_back(get_candidates(opr_ptr->get_accelerator()));
+        }
+        if (size == 0) return {};
+
+        // latency[i][k]: least latency of operators[0..i] with operators[i] on candidates[i][k].
+        // from[i][k]: candidate of operators[i - 1] which gives the least latency.
+        std::vector<std::vector<double>> latency(size);
+        std::vector<std::vector<size_t>> from(size);
+        for (size_t i = 0; i < size; ++i) {
+            latency[i].assign(candidates[i].size(), std::numeric_limits<double>::max());
+            from[i].assign(candidates[i].size(), 0);
+            for (size_t k = 0; k < candidates[i].size(); ++k) {
+                auto device = candidates[i][k];
+                double compute = predict_operator(operators[i], device);
+                if (i == 0) {
+                    latency[i][k] = compute + predict_boundary(operators[i], device);
+                    continue;
+                }
+                double boundary = predict_boundary(operators[i], device);
+                for (size_t j = 0; j < candidates[i - 1].size(); ++j) {
+                    double sum = latency[i - 1][j] + compute + (candidates[i - 1][j] == device ? 0 : boundary);
+                    if (sum < latency[i][k]) {
+                        latency[i][k] = sum;
+                        from[i][k] = j;
+                    }
+                }
+            }
+        }
+
+        std::vector<model::Accelerator> devices(size);
+        size_t k = std::min_element(latency.back().begin(), latency.back().end()) - latency.back().begin();
+        ENN_DBG_COUT << "Least predicted latency of the model: " << latency.back()[k] << " us" << std::endl;
+        for (size_t i = size; i-- > 0;) {
+            devices[i] = candidates[i][k];
+            k = from[i][k];
+        }
+
+        if (target_latency_ > 0) {
+            merge_fragments(operators, candidates, devices);
+        }
+        return devices;
+    }
+
+ private:
+    double predict_operator(const Operator::Ptr& opr_ptr, model::Accelerator device) const {
+        return tile_num_ * cost_model_->predict(opr_ptr, device);
+    }
+
+    double predict_boundary(const Operator::Ptr& opr_ptr, model::Accelerator device) const {
+        return cost_model_->predict_boundary(opr_ptr, device, tile_num_);
+    }
+
+    // Merge a fragment(run of operators on a device) into the device of a neighbor fragment
+    //  while the predicted latency doesn't exceed target latency. Among mergeable ones,
+    //  the merge with the least latency is taken first.
+    void merge_fragments(const std::vector<Operator::Ptr>& operators,
+                         const std::vector<std::vector<model::Accelerator>>& candidates,
+                         std::vector<model::Accelerator>& devices) const {
+        auto supports = [&candidates](size_t i, model::Accelerator device) {
+            return std::find(candidates[i].begin(), candidates[i].end(), device) != candidates[i].end();
+        };
+        while (true) {
+            double best = static_cast<double>(target_latency_);
+            std::vector<model::Accelerator> best_devices;
+            for (size_t begin = 0; begin < devices.size();) {
+                size_t end = begin;
+                while (end < devices.size() && devices[end] == devices[begin]) ++end;
+                for (auto neighbor : {begin > 0 ? begin - 1 : end, end}) {
+                    if (neighbor >= devices.size()) continue;
+                    auto device = devices[neighbor];
+                    bool mergeable = true;
+                    for (size_t i = begin; i < end && mergeable; ++i) mergeable = supports(i, device);
+                    if (!mergeable) continue;
+                    auto merged = devices;
+                    std::fill(merged.begin() + begin, merged.begin() + end, device);
+                    double latency = predict(operators, merged);
+                    if (latency <= best) {
+                        best = latency;
+                        best_devices = std::move(merged);
+                    }
+                }
+                begin = end;
+            }
+            if (best_devices.empty()) break;
+            devices = std::move(best_devices);
+        }
+    }
+
+    void set_predicted_latency(const model::ScheduledGraph::Ptr& scheduled_graph) {
+        using namespace enn::model::graph::iterator;
+        for (auto& op_list : scheduled_graph->order<BreadthFirstSearch>()) {
+            std::vector<Operator::Ptr> operators;
+            for (auto& opr : *op_list) {
+                operators.push_back(std::static_pointer_cast<Operator>(opr));
+            }
+            std::vector<model::Accelerator> devices(operators.size(), op_list->get_accelerator());
+            auto latency = static_cast<uint32_t>(std::lround(predict(operators, devices)));
+            OperatorListBuilder(op_list).set_predicted_latency(latency);
+            ENN_DBG_COUT << "OperatorList(ID: 0x" << op_list->get_id() << ") on " << (int)op_list->get_accelerator()
+                         << " is predicted to take " << latency << " us" << std::endl;
+        }
+    }
+
+ private:
+    CostModel::Ptr cost_model_;
+    uint32_t target_latency_;
+    uint32_t tile_num_;
 };
 
 // When a new scheduling method is required, create a class extending IStaticScheule.
@@ -112,10 +340,19 @@ class StaticScheduler {
             case ModelTrait::Default:
                 schedule_ = std::make_unique<DefaultStaticSchedule>();
                 break;
+            case ModelTrait::CostModel:
+                schedule_ = std::make_unique<CostModelStaticSchedule>();
+                break;
         }
         return *this;
     }
 
+    // Replace the schedule chosen by set_model(), e.g. a CostModelStaticSchedule with measured costs.
+    StaticScheduler& set_schedule(std::unique_ptr<IStaticSchedule> schedule) {
+        schedule_ = std::move(schedule);
+        return *this;
+    }
+
     StaticScheduler& set_preset_id(uint32_t preset_id_from_client) {
         preset_id = preset_id_from_client;
         return *this;
@@ -147,6 +384,7 @@ class StaticScheduler {
     }
 
     void run() {
+        schedule_->set_preference(target_latency, tile_num);
         schedule_->arrange(target_model_);
         set_preferences();
     }
@@ -154,6 +392,13 @@ class StaticScheduler {
  private:
     ModelTrait analyze_model() {
         // Analyze the target_model_ and then return ModelTrait
+        using namespace enn::model::graph::iterator;
+        for (auto& opr_ptr : target_model_->get_origin_graph()->order<TopologicalSort>()) {
+            if (static_cast<int>(opr_ptr->get_id()) >= 0 &&
+                CostModelStaticSchedule::get_candidates(opr_ptr->get_accelerator()).size() > 1) {
+                return ModelTrait::CostModel;
+            }
+        }
         return ModelTrait::Default;
     }
 
@@ -4,6 +4,8 @@
 #include <string>
 
 #include "runtime/scheduler/static_scheduler.hpp"
+#include "model/component/operator/operator_builder.hpp"
+#include "model/component/tensor/parameter_builder.hpp"
 
 #include "model/types.hpp"
 #include "model/model.hpp"
@@ -11,6 +13,7 @@
 #include "model/parser/parser.hpp"
 #include "model/generator/generator.hpp"
 #include "model/graph/iterator/methods/topological_sort.hpp"
+#include "model/graph/iterator/methods/breadth_first_search.hpp"
 
 #include "common/enn_debug.h"
 #include "common/enn_utils.h"
@@ -94,3 +97,207 @@ TEST_F(StaticSchedulerTest, static_shcedule_mobile_bert_nnc) {
     std::vector<enn::model::Accelerator> expected_result = {enn::model::Accelerator::GPU};
     check_operator_lists(enn_model, expected_result);
 }
+
+// Branches on different accelerators should not be connected to each other,
+//  so that they can be executed concurrently.
+TEST_F(StaticSchedulerTest, static_schedule_connects_only_dependent_operator_lists) {
+    using namespace enn::model::component;
+    using enn::model::Accelerator;
+    auto create_op = [](int64_t id, Accelerator accelerator) {
+        return OperatorBuilder().set_id(id).set_accelerator(accelerator).create();
+    };
+    auto create_fm = [](int32_t id) { return FeatureMapBuilder().set_id(id).create(); };
+
+    auto v_in = create_op(-1, Accelerator::NONE);
+    auto v_out = create_op(-1, Accelerator::NONE);
+    auto conv = create_op(0, Accelerator::NPU);
+    auto pool = create_op(1, Accelerator::NPU);
+    auto softmax = create_op(2, Accelerator::CPU);
+    auto fc = create_op(3, Accelerator::NPU);
+
+    auto origin_graph = std::make_shared<enn::model::OriginalGraph>();
+    origin_graph->add_vertex(v_in).set_start_vertex(v_in);
+    origin_graph->add_vertex(v_out).set_end_vertex(v_out);
+    origin_graph->add_neighbor(v_in, create_fm(0), conv);
+    origin_graph->add_neighbor(conv, create_fm(1), pool);
+    origin_graph->add_neighbor(pool, create_fm(2), softmax);
+    origin_graph->add_neighbor(pool, create_fm(3), fc);
+    origin_graph->add_neighbor(softmax, create_fm(4), v_out);
+    origin_graph->add_neighbor(fc, create_fm(5), v_out);
+
+    enn_model = std::make_shared<Model>(client_process);
+    enn_model->set_origin_graph(origin_graph);
+
+    enn::runtime::schedule::StaticScheduler static_scheduler;
+    static_scheduler.set_model(enn_model);
+    static_scheduler.run();
+
+    // [conv, pool](NPU) -> [softmax](CPU)
+    //                   -> [fc](NPU)
+    auto& scheduled_graph = enn_model->get_scheduled_graph();
+    EXPECT_EQ(scheduled_graph->vertex_count(), 3);
+    EXPECT_EQ(scheduled_graph->edge_count(), 2);
+    auto start = scheduled_graph->get_start_vertex();
+    EXPECT_EQ(start->get_size(), 2);
+    int visited = 0;
+    for (auto& op_list : scheduled_graph->order<enn::model::graph::iterator::BreadthFirstSearch>()) {
+        EXPECT_EQ(op_list == start, visited == 0);
+        ++visited;
+    }
+    EXPECT_EQ(visited, 3);
+    for (auto& [op_list, edge] : (*scheduled_graph)[start]) {
+        EXPECT_TRUE((*scheduled_graph)[op_list].empty());
+        EXPECT_GE(edge->get_id(), 0);
+    }
+}
+
+class CostModelStaticScheduleTest : public StaticSchedulerTest {
+ protected:
+    using Accelerator = enn::model::Accelerator;
+    using Operator = enn::model::component::Operator;
+    using CostModel = enn::runtime::schedule::CostModel;
+
+    // Build a chain of operators on the accelerators, which have no tensors so that
+    //  only measured latencies and dispatch overheads are counted.
+    void build_chain(const std::vector<Accelerator>& accelerators) {
+        using namespace enn::model::component;
+        auto create_fm = [](int32_t id) { return FeatureMapBuilder().set_id(id).create(); };
+        auto v_in = OperatorBuilder().set_id(-1).set_accelerator(Accelerator::NONE).create();
+        auto v_out = OperatorBuilder().set_id(-1).set_accelerator(Accelerator::NONE).create();
+        auto origin_graph = std::make_shared<enn::model::OriginalGraph>();
+        origin_graph->add_vertex(v_in).set_start_vertex(v_in);
+        origin_graph->add_vertex(v_out).set_end_vertex(v_out);
+        Operator::Ptr prev = v_in;
+        int32_t fm_id = 0;
+        for (size_t i = 0; i < accelerators.size(); ++i) {
+            Operator::Ptr op = OperatorBuilder().set_id(i).set_accelerator(accelerators[i]).create();
+            origin_graph->add_neighbor(prev, create_fm(fm_id++), op);
+            prev = op;
+        }
+        origin_graph->add_neighbor(prev, create_fm(fm_id), v_out);
+
+        enn_model = std::make_shared<Model>(client_process);
+        enn_model->set_origin_graph(origin_graph);
+    }
+
+    void schedule(CostModel::Ptr cost_model, uint32_t target_latency = 0) {
+        enn::runtime::schedule::StaticScheduler static_scheduler;
+        static_scheduler.set_model(enn_model)
+                        .set_target_latency(target_latency)
+                        .set_schedule(std::make_unique<enn::runtime::schedule::CostModelStaticSchedule>(cost_model))
+                        .run();
+    }
+
+    std::vector<std::pair<Accelerator, uint32_t>> get_operator_lists() {
+        std::vector<std::pair<Accelerator, uint32_t>> op_lists;
+        for (auto& op_list : enn_model->get_scheduled_graph()->order<enn::model::graph::iterator::TopologicalSort>()) {
+            op_lists.push_back({op_list->get_accelerator(), op_list->get_size()});
+        }
+        return op_lists;
+    }
+
+    // a(NPU) -> b(CPU or NPU) -> c(NPU)
+    CostModel::Ptr create_npu_cpu_npu(double b_on_cpu, double b_on_npu) {
+        build_chain({Accelerator::NPU, npu_or_cpu, Accelerator::NPU});
+        auto cost_model = std::make_shared<CostModel>();
+        cost_model->set_device_cost(Accelerator::CPU, {1.0, 1.0, 20.0})
+                   .set_device_cost(Accelerator::NPU, {1.0, 1.0, 100.0})
+                   .set_measured_latency(0, Accelerator::NPU, 50)
+                   .set_measured_latency(1, Accelerator::CPU, b_on_cpu)
+                   .set_measured_latency(1, Accelerator::NPU, b_on_npu)
+                   .set_measured_latency(2, Accelerator::NPU, 50);
+        return cost_model;
+    }
+
+    const Accelerator npu_or_cpu =
+        static_cast<Accelerator>(static_cast<int>(Accelerator::NPU) | static_cast<int>(Accelerator::CPU));
+};
+
+TEST_F(CostModelStaticScheduleTest, chooses_cost_model_schedule_for_operators_with_candidates) {
+    build_chain({Accelerator::NPU, npu_or_cpu, Accelerator::NPU});
+    enn::runtime::schedule::StaticScheduler static_scheduler;
+    static_scheduler.set_model(enn_model).run();
+    for (auto& [accelerator, size] : get_operator_lists()) {
+        EXPECT_EQ(enn::runtime::schedule::CostModelStaticSchedule::get_candidates(accelerator).size(), 1);
+    }
+}
+
+TEST_F(CostModelStaticScheduleTest, keeps_default_schedule_for_fixed_operators) {
+    build_chain({Accelerator::NPU, Accelerator::CPU, Accelerator::NPU});
+    schedule(std::make_shared<CostModel>());
+    std::vector<std::pair<Accelerator, uint32_t>> expected = {
+        {Accelerator::NPU, 1}, {Accelerator::CPU, 1}, {Accelerator::NPU, 1}};
+    EXPECT_EQ(get_operator_lists(), expected);
+}
+
+TEST_F(CostModelStaticScheduleTest, avoids_ping_pong_for_small_gain) {
+    // CPU saves 20 us for b, but the boundaries cost 120 us.
+    schedule(create_npu_cpu_npu(10, 30));
+    std::vector<std::pair<Accelerator, uint32_t>> expected = {{Accelerator::NPU, 3}};
+    EXPECT_EQ(get_operator_lists(), expected);
+    EXPECT_EQ(enn_model->get_scheduled_graph()->get_start_vertex()->get_predicted_latency(), 100 + 50 + 30 + 50);
+}
+
+TEST_F(CostModelStaticScheduleTest, splits_for_large_gain) {
+    schedule(create_npu_cpu_npu(10, 1000));
+    std::vector<std::pair<Accelerator, uint32_t>> expected = {
+        {Accelerator::NPU, 1}, {Accelerator::CPU, 1}, {Accelerator::NPU, 1}};
+    EXPECT_EQ(get_operator_lists(), expected);
+    std::vector<uint32_t> predicted;
+    for (auto& op_list : enn_model->get_scheduled_graph()->order<enn::model::graph::iterator::TopologicalSort>()) {
+        predicted.push_back(op_list->get_predicted_latency());
+    }
+    EXPECT_EQ(predicted, std::vector<uint32_t>({150, 30, 150}));
+}
+
+TEST_F(CostModelStaticScheduleTest, merges_fragments_within_target_latency) {
+    // split: 150 + 30 + 150 = 330 us, merged into NPU: 100 + 50 + 200 + 50 = 400 us
+    schedule(create_npu_cpu_npu(10, 200), 350);
+    EXPECT_EQ(get_operator_lists().size(), 3);
+
+    schedule(create_npu_cpu_npu(10, 200), 500);
+    std::vector<std::pair<Accelerator, uint32_t>> expected = {{Accelerator::NPU, 3}};
+    EXPECT_EQ(get_operator_lists(), expected);
+}
+
+TEST_F(CostModelStaticScheduleTest, estimates_operator_with_weight_by_flops) {
+    using namespace enn::model::component;
+    auto op = OperatorBuilder().set_id(0).set_accelerator(Accelerator::CPU).create();
+    auto input = FeatureMapBuilder().set_id(0).set_shape(std::vector<uint32_t>{1, 8, 8, 16}).create();
+    auto weight = ParameterBuilder().set_name("weight").set_shape(std::vector<uint32_t>{32, 3, 3, 16}).create();
+    auto output = FeatureMapBuilder().set_id(1).set_shape(std::vector<uint32_t>{1, 8, 8, 32}).create();
+    OperatorBuilder(op).add_in_tensor(input).add_in_tensor(weight).add_out_tensor(output);
+
+    // 2 * (8 * 8 * 32) outputs * (3 * 3 * 16) MACs
+    EXPECT_DOUBLE_EQ(CostModel::get_flops(op), 2.0 * 8 * 8 * 32 * 3 * 3 * 16);
+    CostModel cost_model;
+    cost_model.set_device_cost(Accelerator::CPU, {1000.0, 1e9, 20.0})
+              .set_device_cost(Accelerator::GPU, {10000.0, 1e9, 200.0});
+    EXPECT_GT(cost_model.predict(op, Accelerator::CPU), cost_model.predict(op, Accelerator::GPU));
+    cost_model.set_measured_latency(0, Accelerator::CPU, 5);
+    EXPECT_DOUBLE_EQ(cost_model.predict(op, Accelerator::CPU), 5);
+    EXPECT_GT(cost_model.predict_boundary(op, Accelerator::CPU, 2), cost_model.predict_boundary(op, Accelerator::CPU));
+}
+
+TEST_F(CostModelStaticScheduleTest, estimates_flops_by_output_channels_of_weight) {
+    using namespace enn::model::component;
+    auto create_conv = [](std::vector<uint32_t> in_shape, std::vector<uint32_t> weight_shape,
+                          std::vector<uint32_t> out_shape) {
+        auto op = OperatorBuilder().set_id(0).set_accelerator(Accelerator::CPU).create();
+        auto input = FeatureMapBuilder().set_id(0).set_shape(in_shape).create();
+        auto weight = ParameterBuilder().set_name("weight").set_shape(weight_shape).create();
+        auto bias = ParameterBuilder().set_name("bias").set_shape(std::vector<uint32_t>{weight_shape[0]}).create();
+        auto output = FeatureMapBuilder().set_id(1).set_shape(out_shape).create();
+        OperatorBuilder(op).add_in_tensor(input).add_in_tensor(weight).add_in_tensor(bias).add_out_tensor(output);
+        return op;
+    };
+    // NCHW feature maps with OIHW weight: 2 * (32 * 8 * 8) outputs * (16 * 3 * 3) MACs
+    auto nchw = create_conv({1, 16, 8, 8}, {32, 16, 3, 3}, {1, 32, 8, 8});
+    EXPECT_DOUBLE_EQ(CostModel::get_flops(nchw), 2.0 * 32 * 8 * 8 * 16 * 3 * 3);
+    // Depthwise weight(1HWO): 2 * (8 * 8 * 32) outputs * (3 * 3) MACs
+    auto depthwise = create_conv({1, 8, 8, 32}, {1, 3, 3, 32}, {1, 8, 8, 32});
+    EXPECT_DOUBLE_EQ(CostModel::get_flops(depthwise), 2.0 * 8 * 8 * 32 * 3 * 3);
+    // Fully connected(OI): 2 * 10 outputs * 64 MACs
+    auto fully_connected = create_conv({1, 64}, {10, 64}, {1, 10});
+    EXPECT_DOUBLE_EQ(CostModel::get_flops(fully_connected), 2.0 * 10 * 64);
+}
@@ -19,6 +19,7 @@
 
 #include "tool/profiler/include/ExynosNnProfiler.h"
 #include "tool/profiler/include/ExynosNnProfilerConfig.h"
+#include "tool/profiler/include/ProfileRecorder.hpp"
 #include "tool/profiler/include/ProfileWatcher.hpp"
 #include "tool/profiler/include/ProfilerLog.h"
 
@@ -47,7 +48,10 @@ ExynosNnProfiler* ExynosNnProfiler::get_instance() {
     call_once(ExynosNnProfiler::_once_flag, []() {
         _instance.reset(new ExynosNnProfiler);
     });
-    profile_watchers.insert(std::make_pair(0, new ProfileWatcher(0)));
+    std::lock_guard<std::mutex> lock_guard(_mutex);
+    if (profile_watchers.find(0) == profile_watchers.end()) {
+        profile_watchers.insert(std::make_pair(0, new ProfileWatcher(0)));
+    }
     return _instance.get();
 }
 
@@ -56,7 +60,10 @@ ExynosNnProfiler* ExynosNnProfiler::get_instance(uint64_t id) {
         _instance.reset(new ExynosNnProfiler);
     });
     std::lock_guard<std::mutex> lock_guard(_mutex);
-    profile_watchers.insert(std::make_pair(id, new ProfileWatcher(id)));
+    // A watcher of the id already started keeps recording, instead of being replaced.
+    if (profile_watchers.find(id) == profile_watchers.end()) {
+        profile_watchers.insert(std::make_pair(id, new ProfileWatcher(id)));
+    }
     return _instance.get();
 }
 
@@ -108,66 +115,89 @@ FinishProfiler::~FinishProfiler() {
 }
 
 
-ScopedProfiling::ScopedProfiling(std::string custom_label, uint64_t id)
-: custom_label(custom_label), id(id), op_num(-1) {
-    ExynosNnProfiler::only_get_instance()->get_profile_watcher(id)->push_profile_data(
-        new EntryProfileData(custom_label));
+// Events are pushed to the ring of the calling thread without lock, and drained to the watcher of the id later.
+static inline void record(ProfileEventType type, const char* custom_label, uint64_t id, int32_t op_num = -1,
+                          bool is_excluded = false) {
+    ProfileRecorder& recorder = ProfileRecorder::get_instance();
+    if (recorder.is_recording()) {
+        recorder.record(type, id, recorder.intern(custom_label), op_num, is_excluded);
+    }
+}
+
+ScopedProfiling::ScopedProfiling(const std::string& file, int line, const std::string& func, uint64_t id)
+: id(id), label(0), op_num(-1), is_recorded(false) {
+    std::size_t name_found = file.find_last_of("/");
+    record_entry(func + "(" + file.substr(name_found + 1) + ":" + std::to_string(line) + ")");
+}
+
+ScopedProfiling::ScopedProfiling(const std::string& custom_label, uint64_t id)
+: id(id), label(0), op_num(-1), is_recorded(false) {
+    record_entry(custom_label);
+}
+
+ScopedProfiling::ScopedProfiling(const std::string& custom_label, uint64_t id, int32_t op_num)
+: id(id), label(0), op_num(op_num), is_recorded(false) {
+    record_entry(custom_label);
+}
+
+ScopedProfiling::ScopedProfiling(const char* custom_label, uint64_t id)
+: id(id), label(0), op_num(-1), is_recorded(false) {
+    record_entry(custom_label);
 }
 
-ScopedProfiling::ScopedProfiling(std::string custom_label, uint64_t id, int32_t op_num)
-: custom_label(custom_label), id(id), op_num(op_num) {
-    ExynosNnProfiler::only_get_instance()->get_profile_watcher(id)->push_profile_data(
-        new EntryProfileData(custom_label, op_num));
+ScopedProfiling::ScopedProfiling(const char* custom_label, uint64_t id, int32_t op_num)
+: id(id), label(0), op_num(op_num), is_recorded(false) {
+    record_entry(custom_label);
 }
 
 ScopedProfiling::~ScopedProfiling() {
-    if(custom_label.empty())
-        ExynosNnProfiler::only_get_instance()->get_profile_watcher(id)->push_profile_data(
-            new ExitProfileData(file, std::to_string(line), func));
-    else
-        ExynosNnProfiler::only_get_instance()->get_profile_watcher(id)->push_profile_data(
-            new ExitProfileData(custom_label, op_num));
+    if (is_recorded) {
+        ProfileRecorder::get_instance().record(ProfileEventType::EXIT, id, label, op_num);
+    }
+}
+
+template <typename Label>
+void ScopedProfiling::record_entry(const Label& custom_label) {
+    ProfileRecorder& recorder = ProfileRecorder::get_instance();
+    if (recorder.is_recording()) {
+        label = recorder.intern(custom_label);
+        recorder.record(ProfileEventType::ENTRY, id, label, op_num);
+        is_recorded = true;
+    }
 }
 
 
 void profile_from(const char* custom_label, uint64_t id) {
-    ExynosNnProfiler::only_get_instance()->get_profile_watcher(id)->push_profile_data(
-        new EntryProfileData(custom_label));
+    record(ProfileEventType::ENTRY, custom_label, id);
     return;
 }
 
 void profile_from_with_op_num(const char* custom_label, uint64_t id, int32_t op_num) {
-    ExynosNnProfiler::only_get_instance()->get_profile_watcher(id)->push_profile_data(
-        new EntryProfileData(custom_label, op_num));
+    record(ProfileEventType::ENTRY, custom_label, id, op_num);
     return;
 }
 
 void profile_until(const char* custom_label, uint64_t id) {
-    ExynosNnProfiler::only_get_instance()->get_profile_watcher(id)->push_profile_data(
-        new ExitProfileData(custom_label));
+    record(ProfileEventType::EXIT, custom_label, id);
     return;
 }
 
 void profile_until_with_op_num(const char* custom_label, uint64_t id, int32_t op_num) {
-    ExynosNnProfiler::only_get_instance()->get_profile_watcher(id)->push_profile_data(
-        new ExitProfileData(custom_label, op_num));
+    record(ProfileEventType::EXIT, custom_label, id, op_num);
     return;
 }
 
 void profile_append(struct CalculatedProfileNode* calculated_profile_node, uint64_t id) {
-    ExynosNnProfiler::only_get_instance()->get_profile_watcher(id)->push_profile_data(
-        new CalculatedProfileData(calculated_profile_node));
+    ProfileRecorder::get_instance().record(ProfileEventType::CALCULATED, id, 0, -1, false, calculated_profile_node);
     return;
 }
 
 void profile_exclude_from(const char* custom_label, uint64_t id) {
-    ExynosNnProfiler::only_get_instance()->get_profile_watcher(id)->push_profile_data(
-        new EntryProfileData(custom_label, true));
+    record(ProfileEventType::ENTRY, custom_label, id, -1, true);
     return;
 }
 
 void profile_exclude_until(const char* custom_label, uint64_t id) {
-    ExynosNnProfiler::only_get_instance()->get_profile_watcher(id)->push_profile_data(
-        new ExitProfileData(custom_label, true));
+    record(ProfileEventType::EXIT, custom_label, id, -1, true);
     return;
 }
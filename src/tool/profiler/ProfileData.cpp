@@ -11,7 +11,7 @@
 /**
  * @file    ProfileData.cpp
  * @brief   It defines class of ProfileData.
- * @details ProfileData instantiated would be enqueued in ProfileDataQueue.
+ * @details ProfileData is made of an event drained from the ring of a thread, to build the profile tree.
  * @version 1
  */
 
@@ -21,24 +21,9 @@ ProfileData::ProfileData()
 : thread_id(std::this_thread::get_id()), is_excluded(false), op_num(-1) {
 }
 
-ProfileData::ProfileData(const std::string& file, const std::string& line, const std::string& func)
-: file(file), line(line), func(func), thread_id(std::this_thread::get_id()),
-is_excluded(false), time(std::chrono::system_clock::now()), op_num(-1) {
-}
-
-ProfileData::ProfileData(const std::string& custom_label)
-: custom_label(custom_label), thread_id(std::this_thread::get_id()),
-is_excluded(false), time(std::chrono::system_clock::now()), op_num(-1) {
-}
-
-ProfileData::ProfileData(const std::string& custom_label, const bool& is_excluded)
-: custom_label(custom_label), thread_id(std::this_thread::get_id()),
-is_excluded(is_excluded), time(std::chrono::system_clock::now()), op_num(-1) {
-}
-
-ProfileData::ProfileData(const std::string& custom_label, const int32_t& op_num)
-: custom_label(custom_label), thread_id(std::this_thread::get_id()),
-is_excluded(false), time(std::chrono::system_clock::now()), op_num(op_num) {
+ProfileData::ProfileData(const std::string& custom_label, const int32_t& op_num, const bool& is_excluded,
+                         const std::chrono::steady_clock::time_point& time, const std::thread::id& thread_id)
+: custom_label(custom_label), thread_id(thread_id), is_excluded(is_excluded), time(time), op_num(op_num) {
 }
 
 void ProfileData::set_custom_label(const std::string& custom_label) {
@@ -47,22 +32,10 @@ void ProfileData::set_custom_label(const std::string& custom_label) {
 }
 
 
-const std::chrono::system_clock::time_point& ProfileData::get_time() {
+const std::chrono::steady_clock::time_point& ProfileData::get_time() {
     return time;
 }
 
-const std::string& ProfileData::get_file() {
-    return file;
-}
-
-const std::string& ProfileData::get_line() {
-    return line;
-}
-
-const std::string& ProfileData::get_func() {
-    return func;
-}
-
 const std::thread::id& ProfileData::get_thread_id() {
     return thread_id;
 }
@@ -76,36 +49,14 @@ const std::int32_t& ProfileData::get_op_num() {
 }
 
 
-EntryProfileData::EntryProfileData(const std::string& file, const std::string& line, const std::string& func)
-: ProfileData(file, line, func) {
-}
-
-EntryProfileData::EntryProfileData(const std::string& custom_label)
-: ProfileData(custom_label) {
-}
-
-EntryProfileData::EntryProfileData(const std::string& custom_label, const bool& is_excluded)
-: ProfileData(custom_label, is_excluded) {
-}
-
-EntryProfileData::EntryProfileData(const std::string& custom_label, const int32_t& op_num)
-: ProfileData(custom_label, op_num) {
-}
-
-ExitProfileData::ExitProfileData(const std::string& file, const std::string& line, const std::string& func)
-: ProfileData(file, line, func) {
-}
-
-ExitProfileData::ExitProfileData(const std::string& custom_label)
-: ProfileData(custom_label) {
-}
-
-ExitProfileData::ExitProfileData(const std::string& custom_label, const bool& is_excluded)
-: ProfileData(custom_label, is_excluded) {
+EntryProfileData::EntryProfileData(const std::string& custom_label, const int32_t& op_num, const bool& is_excluded,
+                                   const std::chrono::steady_clock::time_point& time, const std::thread::id& thread_id)
+: ProfileData(custom_label, op_num, is_excluded, time, thread_id) {
 }
 
-ExitProfileData::ExitProfileData(const std::string& custom_label, const int32_t& op_num)
-: ProfileData(custom_label, op_num) {
+ExitProfileData::ExitProfileData(const std::string& custom_label, const int32_t& op_num, const bool& is_excluded,
+                                 const std::chrono::steady_clock::time_point& time, const std::thread::id& thread_id)
+: ProfileData(custom_label, op_num, is_excluded, time, thread_id) {
 }
 
 CalculatedProfileData::CalculatedProfileData(struct CalculatedProfileNode* calculated_profile_node)
@@ -0,0 +1,196 @@
+/*
+ * Copyright (C) 2021 Samsung Electronics Co. LTD
+ *
+ * This software is proprietary of Samsung Electronics.
+ * No part of this software, either material or conceptual may be copied or distributed, transmitted,
+ * transcribed, stored in a retrieval system or translated into any human or computer language in any form by any means,
+ * electronic, mechanical, manual or otherwise, or disclosed
+ * to third parties without the express written permission of Samsung Electronics.
+ */
+
+/**
+ * @file    ProfileRecorder.cpp
+ * @brief   It defines class of ProfileRecorder.
+ * @details Threads profiled record events to their own rings, and a drainer thread hands them over to sinks.
+ * @version 1
+ */
+
+#include "tool/profiler/include/ProfileRecorder.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace {
+
+std::atomic<uint64_t> recorder_serial{0};
+
+// Label ids of the addresses of literals, mapped directly by the address.
+constexpr size_t LABEL_CACHE_SIZE = 64;
+
+}  // namespace
+
+struct ProfileRecorder::LabelCacheEntry {
+    const char* address = nullptr;
+    std::string text;
+    uint32_t label = 0;
+};
+
+// The ring and the label ids of a thread, which are of the recorder of owner_serial.
+struct ProfileRecorder::ThreadState {
+    uint64_t owner_serial = 0;
+    std::shared_ptr<ProfileRing> ring;
+    std::unordered_map<std::string, uint32_t> label_ids;
+    std::array<LabelCacheEntry, LABEL_CACHE_SIZE> label_cache;
+
+    ~ThreadState() {
+        if (ring) ring->retire();
+    }
+};
+
+thread_local ProfileRecorder::ThreadState ProfileRecorder::thread_state;
+
+ProfileRecorder& ProfileRecorder::get_instance() {
+    static ProfileRecorder instance;
+    return instance;
+}
+
+ProfileRecorder::ProfileRecorder()
+: serial(++recorder_serial), is_active(false), dropped_num(0), thread_num(0), drainer_should_finish(false) {
+}
+
+ProfileRecorder::~ProfileRecorder() {
+    std::lock_guard<std::mutex> control_lock(control_mutex);
+    stop_drainer();
+}
+
+// The thread state is taken once for a call, since an access to thread_local of a shared library is a call.
+ProfileRing* ProfileRecorder::get_ring() {
+    return get_thread_state().ring.get();
+}
+
+ProfileRecorder::ThreadState& ProfileRecorder::get_thread_state() {
+    ThreadState& state = thread_state;
+    if (state.owner_serial != serial) {
+        if (state.ring) state.ring->retire();
+        state.label_ids.clear();
+        state.label_cache.fill(LabelCacheEntry());
+        std::lock_guard<std::mutex> lock(rings_mutex);
+        state.ring = std::make_shared<ProfileRing>(thread_num++);
+        state.owner_serial = serial;
+        rings.push_back(state.ring);
+    }
+    return state;
+}
+
+uint32_t ProfileRecorder::intern(const std::string& label) {
+    return intern(get_thread_state(), label);
+}
+
+uint32_t ProfileRecorder::intern(ThreadState& state, const std::string& label) {
+    auto cached = state.label_ids.find(label);
+    if (cached != state.label_ids.end()) return cached->second;
+
+    std::lock_guard<std::mutex> lock(labels_mutex);
+    auto found = label_ids.find(label);
+    if (found == label_ids.end()) {
+        found = label_ids.emplace(label, static_cast<uint32_t>(labels.size())).first;
+        labels.push_back(label);
+    }
+    state.label_ids.emplace(label, found->second);
+    return found->second;
+}
+
+uint32_t ProfileRecorder::intern(const char* label) {
+    ThreadState& state = get_thread_state();
+    LabelCacheEntry& entry = state.label_cache[(reinterpret_cast<uintptr_t>(label) >> 3) % LABEL_CACHE_SIZE];
+    if (entry.address != label || std::strcmp(entry.text.c_str(), label) != 0) {
+        entry.address = label;
+        entry.text = label;
+        entry.label = intern(state, entry.text);
+    }
+    return entry.label;
+}
+
+std::string ProfileRecorder::get_label(uint32_t label) {
+    std::lock_guard<std::mutex> lock(labels_mutex);
+    return label < labels.size() ? labels[label] : std::string();
+}
+
+void ProfileRecorder::attach(uint64_t id, ProfileEventSink* sink) {
+    std::lock_guard<std::mutex> control_lock(control_mutex);
+    {
+        std::lock_guard<std::mutex> lock(drain_mutex);
+        // No event is in rings without any sink, since detach() of the last sink drained them.
+        if (sinks.empty()) clock.calibrate();
+        sinks[id] = sink;
+    }
+    is_active.store(true, std::memory_order_relaxed);
+    if (!drainer_thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(drainer_mutex);
+            drainer_should_finish = false;
+        }
+        drainer_thread = std::thread(&ProfileRecorder::thread_func, this);
+    }
+}
+
+void ProfileRecorder::detach(uint64_t id) {
+    std::lock_guard<std::mutex> control_lock(control_mutex);
+    bool is_last = false;
+    {
+        std::lock_guard<std::mutex> lock(drain_mutex);
+        drain();
+        sinks.erase(id);
+        is_last = sinks.empty();
+    }
+    if (is_last) {
+        is_active.store(false, std::memory_order_relaxed);
+        stop_drainer();
+    }
+}
+
+void ProfileRecorder::flush() {
+    std::lock_guard<std::mutex> lock(drain_mutex);
+    drain();
+}
+
+void ProfileRecorder::drain() {
+    std::lock_guard<std::mutex> lock(rings_mutex);
+    for (auto& ring : rings) {
+        ring->drain([&](const ProfileEvent& event) {
+            auto sink = sinks.find(event.id);
+            // Events of an id without sink, e.g. profiled before START_PROFILER, are dropped.
+            if (sink == sinks.end()) return;
+            ProfileEvent converted = event;
+            converted.time_ns = clock.to_ns(event.time_ns);
+            sink->second->consume(converted, *ring);
+        });
+    }
+    // Rings of threads exited are released, after their last events are drained above.
+    rings.erase(std::remove_if(rings.begin(), rings.end(),
+                               [](const std::shared_ptr<ProfileRing>& ring) {
+                                   return ring->is_retired() && ring->is_empty();
+                               }),
+                rings.end());
+}
+
+void ProfileRecorder::stop_drainer() {
+    if (!drainer_thread.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(drainer_mutex);
+        drainer_should_finish = true;
+    }
+    drainer_cv.notify_all();
+    drainer_thread.join();
+}
+
+void ProfileRecorder::thread_func() {
+    std::unique_lock<std::mutex> lk(drainer_mutex);
+    while (!drainer_should_finish) {
+        drainer_cv.wait_for(lk, std::chrono::microseconds(DRAINER_THREAD_WAIT_TIME));
+        lk.unlock();
+        flush();
+        lk.lock();
+    }
+}
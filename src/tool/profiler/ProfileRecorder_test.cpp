@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2021 Samsung Electronics Co. LTD
+ *
+ * This software is proprietary of Samsung Electronics.
+ * No part of this software, either material or conceptual may be copied or distributed, transmitted,
+ * transcribed, stored in a retrieval system or translated into any human or computer language in any form by any means,
+ * electronic, mechanical, manual or otherwise, or disclosed
+ * to third parties without the express written permission of Samsung Electronics.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "tool/profiler/include/ExynosNnProfilerApi.h"
+#include "tool/profiler/include/ProfileRecorder.hpp"
+#include "tool/profiler/include/ProfileTrace.hpp"
+
+namespace {
+
+class CollectingSink : public ProfileEventSink {
+ public:
+    void consume(const ProfileEvent& event, const ProfileRing& ring) override {
+        events.push_back(event);
+        thread_indices.push_back(ring.get_thread_index());
+    }
+
+    std::vector<ProfileEvent> events;
+    std::vector<uint32_t> thread_indices;
+};
+
+ProfileEvent make_event(ProfileEventType type, uint32_t label, int64_t time_ns) {
+    return ProfileEvent{1, time_ns, nullptr, label, -1, type, false};
+}
+
+}  // namespace
+
+TEST(ENN_PROFILER_TEST, ring_keeps_order_and_drops_when_full) {
+    ProfileRing ring(0);
+    for (size_t i = 0; i < ProfileRing::CAPACITY; ++i) {
+        ASSERT_TRUE(ring.push(make_event(ProfileEventType::ENTRY, static_cast<uint32_t>(i), 0)));
+    }
+    EXPECT_FALSE(ring.push(make_event(ProfileEventType::ENTRY, 0, 0)));
+
+    uint32_t expected = 0;
+    EXPECT_EQ(ring.drain([&](const ProfileEvent& event) { EXPECT_EQ(event.label, expected++); }),
+              ProfileRing::CAPACITY);
+    EXPECT_TRUE(ring.is_empty());
+
+    // Wraps around after drained.
+    EXPECT_TRUE(ring.push(make_event(ProfileEventType::EXIT, 7, 0)));
+    EXPECT_EQ(ring.drain([](const ProfileEvent& event) { EXPECT_EQ(event.label, 7u); }), 1u);
+}
+
+TEST(ENN_PROFILER_TEST, recorder_hands_events_of_threads_to_sink_of_id) {
+    ProfileRecorder recorder;
+    CollectingSink sink;
+    const uint32_t label = recorder.intern("scope");
+    EXPECT_EQ(recorder.intern("scope"), label);
+    EXPECT_EQ(recorder.get_label(label), "scope");
+
+    recorder.record(ProfileEventType::ENTRY, 1, label);  // not recorded before attached
+    recorder.attach(1, &sink);
+    EXPECT_TRUE(recorder.is_recording());
+
+    constexpr int kScopes = 100;
+    auto run = [&]() {
+        for (int i = 0; i < kScopes; ++i) {
+            recorder.record(ProfileEventType::ENTRY, 1, label, i);
+            recorder.record(ProfileEventType::ENTRY, 2, label, i);  // no sink
+            recorder.record(ProfileEventType::EXIT, 1, label, i);
+        }
+    };
+    std::thread thread1(run), thread2(run);
+    thread1.join();
+    thread2.join();
+    recorder.detach(1);
+    EXPECT_FALSE(recorder.is_recording());
+    EXPECT_EQ(recorder.get_dropped_num(), 0u);
+
+    ASSERT_EQ(sink.events.size(), 4u * kScopes);
+    // Events of a thread are in the order recorded, on the monotonic clock.
+    std::map<uint32_t, std::vector<ProfileEvent>> events_of_threads;
+    for (size_t i = 0; i < sink.events.size(); ++i) {
+        EXPECT_EQ(sink.events[i].id, 1u);
+        events_of_threads[sink.thread_indices[i]].push_back(sink.events[i]);
+    }
+    ASSERT_EQ(events_of_threads.size(), 2u);
+    for (auto& thread_events : events_of_threads) {
+        auto& events = thread_events.second;
+        for (size_t i = 0; i < events.size(); ++i) {
+            EXPECT_EQ(events[i].type, i % 2 == 0 ? ProfileEventType::ENTRY : ProfileEventType::EXIT);
+            EXPECT_EQ(events[i].op_num, static_cast<int32_t>(i / 2));
+            if (i > 0) EXPECT_LE(events[i - 1].time_ns, events[i].time_ns);
+        }
+    }
+}
+
+TEST(ENN_PROFILER_TEST, trace_nests_scopes_in_lanes_of_threads) {
+    ProfileTrace trace;
+    // Drained ring by ring, so that the second thread comes after in spite of its earlier times.
+    trace.add(make_event(ProfileEventType::ENTRY, 0, 2000), "Outer", 0);
+    trace.add(make_event(ProfileEventType::ENTRY, 0, 2500), "Inner \"1\"", 0);
+    trace.add(make_event(ProfileEventType::EXIT, 0, 3000), "Inner \"1\"", 0);
+    trace.add(make_event(ProfileEventType::EXIT, 0, 4000), "Outer", 0);
+    trace.add(make_event(ProfileEventType::ENTRY, 0, 1000), "Other", 3);
+    trace.add(make_event(ProfileEventType::EXIT, 0, 1500), "Other", 3);
+    EXPECT_EQ(trace.get_event_num(), 6u);
+
+    std::ostringstream out;
+    trace.write(out, 0x1234);
+    const std::string json = out.str();
+    EXPECT_NE(json.find("\"args\":{\"name\":\"Model 0X1234\"}"), std::string::npos);
+    EXPECT_NE(json.find("\"tid\":3,\"args\":{\"name\":\"Thread 3\"}"), std::string::npos);
+    EXPECT_NE(json.find("Inner \\\"1\\\""), std::string::npos);
+
+    auto position = [&](const std::string& event) {
+        auto found = json.find(event);
+        EXPECT_NE(found, std::string::npos) << event;
+        return found;
+    };
+    auto other = position("{\"name\":\"Other\",\"cat\":\"enn\",\"ph\":\"B\",\"ts\":0.000,\"pid\":0,\"tid\":3}");
+    auto outer = position("{\"name\":\"Outer\",\"cat\":\"enn\",\"ph\":\"B\",\"ts\":1.000,\"pid\":0,\"tid\":0}");
+    auto inner = position("\"ph\":\"B\",\"ts\":1.500,");
+    auto inner_exit = position("\"ph\":\"E\",\"ts\":2.000,");
+    auto outer_exit = position("{\"name\":\"Outer\",\"cat\":\"enn\",\"ph\":\"E\",\"ts\":3.000,\"pid\":0,\"tid\":0}");
+    EXPECT_LT(other, outer);
+    EXPECT_LT(outer, inner);
+    EXPECT_LT(inner, inner_exit);
+    EXPECT_LT(inner_exit, outer_exit);
+}
+
+TEST(ENN_PROFILER_TEST, profile_scope_is_recorded_until_finished) {
+    constexpr uint64_t kModelId = 0x100000000;
+    {
+        START_PROFILER(kModelId);
+        FINISH_PROFILER(kModelId);
+        for (int i = 0; i < 3; ++i) {
+            PROFILE_SCOPE("Outer", kModelId);
+            PROFILE_FROM("Inner", kModelId, i + 1);
+            PROFILE_UNTIL("Inner", kModelId, i + 1);
+        }
+        EXPECT_TRUE(ProfileRecorder::get_instance().is_recording());
+    }
+    EXPECT_FALSE(ProfileRecorder::get_instance().is_recording());
+
+    // Scopes out of START_PROFILER and FINISH_PROFILER cost a check only.
+    PROFILE_SCOPE("Stopped", kModelId);
+}
+
+TEST(ENN_PROFILER_TEST, DISABLED_profile_scope_cost) {
+    constexpr uint64_t kModelId = 0x200000000;
+    constexpr int kScopes = 1000;  // 2 events of each, in a ring
+    constexpr int kRepeat = 100;
+    START_PROFILER(kModelId);
+    FINISH_PROFILER(kModelId);
+    std::chrono::nanoseconds elapsed(0);
+    for (int r = 0; r < kRepeat; ++r) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < kScopes; ++i) {
+            PROFILE_SCOPE("Benchmark_Scope", kModelId);
+        }
+        elapsed += std::chrono::steady_clock::now() - start;
+        // Drained out of the measure, as the drainer thread does on other cores.
+        ProfileRecorder::get_instance().flush();
+    }
+    const double ns = static_cast<double>(elapsed.count()) / (kScopes * kRepeat);
+    std::cout << "[          ] PROFILE_SCOPE: " << ns << " ns per scope" << std::endl;
+    EXPECT_EQ(ProfileRecorder::get_instance().get_dropped_num(), 0u);
+#ifdef __OPTIMIZE__
+    // Builds of the unit test are not optimized and instrumented for coverage, where the cost is only shown.
+    EXPECT_LT(ns, 100.0);
+#endif
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2021 Samsung Electronics Co. LTD
+ *
+ * This software is proprietary of Samsung Electronics.
+ * No part of this software, either material or conceptual may be copied or distributed, transmitted,
+ * transcribed, stored in a retrieval system or translated into any human or computer language in any form by any means,
+ * electronic, mechanical, manual or otherwise, or disclosed
+ * to third parties without the express written permission of Samsung Electronics.
+ */
+
+/**
+ * @file    ProfileTrace.cpp
+ * @brief   It defines class of ProfileTrace.
+ * @details Events are written as Trace Event Format of JSON, with timestamps in microseconds.
+ * @version 1
+ */
+
+#include "tool/profiler/include/ProfileTrace.hpp"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <fstream>
+
+#include "tool/profiler/include/ProfilerLog.h"
+
+namespace {
+
+std::string escape(const std::string& text) {
+    std::string escaped;
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+            escaped += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char code[8];
+            std::snprintf(code, sizeof(code), "\\u%04x", c);
+            escaped += code;
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+// Microseconds with the fraction of nanoseconds, as the "ts" and "dur" of the format.
+std::string to_us(int64_t ns) {
+    char us[32];
+    std::snprintf(us, sizeof(us), "%" PRId64 ".%03d", ns / 1000, static_cast<int>(ns % 1000));
+    return us;
+}
+
+}  // namespace
+
+void ProfileTrace::add(const ProfileEvent& event, const std::string& label, uint32_t thread_index) {
+    thread_indices.insert(thread_index);
+    if (event.type == ProfileEventType::CALCULATED) {
+        add_calculated(event.calculated_profile_node, event.time_ns, thread_index);
+        return;
+    }
+    if (is_full()) return;
+    events.push_back({label, event.time_ns, 0, thread_index, event.type == ProfileEventType::ENTRY ? 'B' : 'E',
+                      event.is_excluded});
+}
+
+void ProfileTrace::add_calculated(const struct CalculatedProfileNode* node, int64_t time_ns, uint32_t thread_index) {
+    if (node == nullptr || is_full()) return;
+    const int64_t duration_ns = static_cast<int64_t>(node->duration) * 1000;
+    events.push_back({node->label ? node->label : "", time_ns, duration_ns, thread_index, 'X', false});
+    if (node->child == nullptr) return;
+    for (int64_t i = 0, child_time_ns = time_ns; node->child[i] != nullptr; ++i) {
+        add_calculated(node->child[i], child_time_ns, thread_index);
+        child_time_ns += static_cast<int64_t>(node->child[i]->duration) * 1000;
+    }
+}
+
+bool ProfileTrace::is_full() {
+    if (events.size() < MAX_EVENT_NUM) return false;
+    ++dropped_num;
+    return true;
+}
+
+void ProfileTrace::write(std::ostream& out, uint64_t id) const {
+    // Events of threads are drained ring by ring, so that they are sorted by time here. The sort is stable to keep
+    // the order of ENTRY and EXIT at the same time.
+    std::vector<const TraceEvent*> sorted;
+    sorted.reserve(events.size());
+    for (auto& event : events) sorted.push_back(&event);
+    std::stable_sort(sorted.begin(), sorted.end(),
+                     [](const TraceEvent* a, const TraceEvent* b) { return a->time_ns < b->time_ns; });
+    const int64_t base_ns = sorted.empty() ? 0 : sorted.front()->time_ns;
+
+    char model_name[64];
+    std::snprintf(model_name, sizeof(model_name), "Model %#" PRIX64, id);
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+    out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"tid\":0,\"args\":{\"name\":\"" << model_name << "\"}}";
+    for (uint32_t thread_index : thread_indices) {
+        out << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << thread_index
+            << ",\"args\":{\"name\":\"Thread " << thread_index << "\"}}";
+    }
+    for (auto event : sorted) {
+        out << ",\n{\"name\":\"" << escape(event->name) << "\",\"cat\":\"" << (event->is_excluded ? "excluded" : "enn")
+            << "\",\"ph\":\"" << event->phase << "\",\"ts\":" << to_us(event->time_ns - base_ns);
+        if (event->phase == 'X') out << ",\"dur\":" << to_us(event->duration_ns);
+        out << ",\"pid\":0,\"tid\":" << event->thread_index << "}";
+    }
+    out << "\n]}\n";
+    if (dropped_num > 0) {
+        profile::log::error("%zu events are not traced over %zu events.\n", dropped_num, MAX_EVENT_NUM);
+    }
+}
+
+bool ProfileTrace::write(const std::string& path, uint64_t id) const {
+    std::ofstream out(path, std::ofstream::trunc);
+    if (!out.is_open()) {
+        profile::log::error("Can not open %s for the trace.\n", path.c_str());
+        return false;
+    }
+    write(out, id);
+    return out.good();
+}
@@ -17,12 +17,14 @@
 
 #include "tool/profiler/include/ProfileTreeNode.hpp"
 
+#include <algorithm>
+
 class ProfileTreeNode;
 
 ProfileTreeNode::ProfileTreeNode(const std::string& label)
 : iteration(1), proportion_of_total(0), proportion_of_caller(0), parent(nullptr),
 thread_id(std::this_thread::get_id()), is_established(false),
-is_excluded(false), label(label), entry_time(std::chrono::system_clock::now()),
+is_excluded(false), label(label), entry_time(std::chrono::steady_clock::now()),
 ninetieth_latency(std::chrono::microseconds::zero()),
 cur_duration(std::chrono::microseconds::zero()), self_duration(std::chrono::microseconds::zero()),
 sum_duration(std::chrono::microseconds::zero()), min_duration(std::chrono::microseconds::max()),
@@ -31,7 +33,7 @@ exclude_duration(std::chrono::microseconds::zero()) {
 }
 
 ProfileTreeNode::ProfileTreeNode(const std::string& label,
-                                    const std::chrono::system_clock::time_point& entry_time)
+                                    const std::chrono::steady_clock::time_point& entry_time)
 : iteration(0), proportion_of_total(0), proportion_of_caller(0), parent(nullptr),
 is_established(false), is_excluded(false), label(label), entry_time(entry_time),
 ninetieth_latency(std::chrono::microseconds::zero()),
@@ -43,7 +45,7 @@ add_entry_time(entry_time);
 }
 
 ProfileTreeNode::ProfileTreeNode(const std::string& label,
-                                    const std::chrono::system_clock::time_point& entry_time,
+                                    const std::chrono::steady_clock::time_point& entry_time,
                                     const std::thread::id& thread_id)
 : iteration(0), proportion_of_total(0), proportion_of_caller(0), parent(nullptr),
 is_established(false), is_excluded(false), thread_id(thread_id), label(label),
@@ -56,7 +58,7 @@ exclude_duration(std::chrono::microseconds::zero()) {
 }
 
 ProfileTreeNode::ProfileTreeNode(const std::string& label,
-                                    const std::chrono::system_clock::time_point& entry_time,
+                                    const std::chrono::steady_clock::time_point& entry_time,
                                     const std::thread::id& thread_id, const bool& is_excluded)
 : iteration(0), proportion_of_total(0), proportion_of_caller(0), parent(nullptr),
 is_established(false), is_excluded(is_excluded), thread_id(thread_id), label(label),
@@ -79,7 +81,7 @@ exclude_duration(std::chrono::microseconds::zero()) {
     *this = std::chrono::microseconds(duration);
 }
 
-ProfileTreeNode* ProfileTreeNode::operator=(const std::chrono::system_clock::time_point& entry_time) {
+ProfileTreeNode* ProfileTreeNode::operator=(const std::chrono::steady_clock::time_point& entry_time) {
     this->entry_time = entry_time;
     return this;
 }
@@ -109,7 +111,7 @@ bool ProfileTreeNode::operator!=(const std::string& label_) const {
     return false;
 }
 
-ProfileTreeNode* ProfileTreeNode::set_duration(std::chrono::system_clock::time_point exit_time) {
+ProfileTreeNode* ProfileTreeNode::set_duration(std::chrono::steady_clock::time_point exit_time) {
     std::chrono::microseconds duration =
             std::chrono::duration_cast<std::chrono::microseconds>(exit_time - entry_times.front());
     entry_times.pop();
@@ -126,7 +128,7 @@ void ProfileTreeNode::set_self_duration(const std::chrono::microseconds& duratio
     return;
 }
 
-void ProfileTreeNode::add_entry_time(const std::chrono::system_clock::time_point& entry_time) {
+void ProfileTreeNode::add_entry_time(const std::chrono::steady_clock::time_point& entry_time) {
     entry_times.push(entry_time);
     return;
 }
@@ -212,11 +214,11 @@ int ProfileTreeNode::get_iteration() {
     return iteration;
 }
 
-std::chrono::system_clock::time_point& ProfileTreeNode::get_entry_time() {
+std::chrono::steady_clock::time_point& ProfileTreeNode::get_entry_time() {
     return entry_time;
 }
 
-std::queue<std::chrono::system_clock::time_point>& ProfileTreeNode::get_entry_times() {
+std::queue<std::chrono::steady_clock::time_point>& ProfileTreeNode::get_entry_times() {
     return entry_times;
 }
 
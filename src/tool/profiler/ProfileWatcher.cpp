@@ -11,10 +11,11 @@
 /**
  * @file    ProfileWatcher.cpp
  * @brief   It defines class of ProfileWatcher.
- * @details A thread created creates profile-tree and prints the result in the way of DFS.
+ * @details Events drained are built into profile-tree, which is printed in the way of DFS, and traced.
  * @version 1
  */
 
+#include <cinttypes>
 #include <fstream>
 
 #include "tool/profiler/include/ProfileWatcher.hpp"
@@ -22,18 +23,19 @@
 class ProfileWatcher;
 
 ProfileWatcher::ProfileWatcher(uint64_t id)
-: id(id) {
-    profile_thread_should_finish() = false;
-    profile_data_is_normal() = true;
+: is_normal(true), id(id) {
     create_profile_tree();
-    create_profile_data_q();
-    watcher_thread = std::thread(&ProfileWatcher::thread_func, this);
+    ProfileRecorder::get_instance().attach(id, this);
 }
 
 ProfileWatcher::~ProfileWatcher() {
-    profile_thread_should_finish() = true;
-    cv_.notify_all();
-    watcher_thread.join();
+    // All of the events recorded so far are consumed in detach().
+    ProfileRecorder::get_instance().detach(id);
+    if (ProfileRecorder::get_instance().get_dropped_num() > 0) {
+        profile::log::error("%" PRIu64 " events are dropped by full rings.\n",
+                            ProfileRecorder::get_instance().get_dropped_num());
+    }
+    dump_profile_trace();
     if (profile_data_is_normal()) {
         try {
             dump_profile_tree();
@@ -46,26 +48,31 @@ ProfileWatcher::~ProfileWatcher() {
     else {
         print_profile_data_error();
     }
-    delete profile_data_q;
     delete profile_tree_root;
 }
 
-std::condition_variable& ProfileWatcher::get_condition_variable() {
-    return cv_;
-}
-
-void ProfileWatcher::push_profile_data(ProfileData* profile_data) {
-    if (!profile_data_q) {
-        profile::log::error("Queue for profiled data is null.\n");
-        profile::log::error("Make sure that you did not call the PROFILE_* macro before calling START_PROFILER.\n");
-        return;
+void ProfileWatcher::consume(const ProfileEvent& event, const ProfileRing& ring) {
+    const std::chrono::steady_clock::time_point time(
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::nanoseconds(event.time_ns)));
+    ProfileData* profile_data = nullptr;
+    std::string label;
+    if (event.type == ProfileEventType::CALCULATED) {
+        profile_data = new CalculatedProfileData(event.calculated_profile_node);
+    } else {
+        label = ProfileRecorder::get_instance().get_label(event.label);
+        if (event.type == ProfileEventType::ENTRY) {
+            profile_data = new EntryProfileData(label, event.op_num, event.is_excluded, time, ring.get_thread_id());
+        } else {
+            profile_data = new ExitProfileData(label, event.op_num, event.is_excluded, time, ring.get_thread_id());
+        }
+        label = parse_label(profile_data);
     }
-    try {
-        profile_data_q->push(profile_data);
-    } catch (const std::exception& e) {
-        profile::log::error("Profile data push failed : %s \n", e.what());
+    // Traced before the tree, which releases the calculated sub-tree. The trace keeps events after an error also.
+    profile_trace.add(event, label, ring.get_thread_index());
+    if (profile_data_is_normal() && !supervise_profile_tree(profile_data)) {
+        profile_data_is_normal() = false;
     }
-    return;
+    delete profile_data;
 }
 
 void ProfileWatcher::print_profile_tree() {
@@ -137,28 +144,7 @@ void ProfileWatcher::trim_profile_tree() {
     return;
 }
 
-void ProfileWatcher::thread_func() {
-    while (!profile_thread_should_finish()|| !profile_data_q->is_empty()) {
-        std::unique_lock<std::mutex> lk(m_);
-        // The latency for calling notify is included in execution time
-        // That's why wait_for is used for time out.
-        // Notify is callsed only when destructing the profile_watcher.
-        cv_.wait_for(lk, std::chrono::microseconds(WATCHER_THREAD_WAIT_TIME));
-        if (!supervise_profile_tree()) {
-            profile_data_is_normal() = false;
-            return;
-        }
-    }
-    return;
-}
-
-bool& ProfileWatcher::profile_thread_should_finish() {
-    static bool finish;
-    return finish;
-}
-
 bool& ProfileWatcher::profile_data_is_normal() {
-    static bool is_normal;
     return is_normal;
 }
 
@@ -168,19 +154,9 @@ void ProfileWatcher::create_profile_tree() {
     return;
 }
 
-void ProfileWatcher::create_profile_data_q() {
-    profile_data_q = new ProfileDataQueue<ProfileData>();
-    return;
-}
-
 std::string ProfileWatcher::parse_label(ProfileData* profile_data) {
     std::string label;
-    if (profile_data->get_custom_label().empty()) {
-        std::size_t name_found = profile_data->get_file().find_last_of("/");
-        std::string pure_file_name = profile_data->get_file().substr(name_found + 1);
-        label = profile_data->get_func() + "(" + pure_file_name + ":" + profile_data->get_line() + ")";
-    }
-    else if (profile_data->get_op_num() > 0) {
+    if (profile_data->get_op_num() > 0) {
         label = profile_data->get_custom_label() + "_" + std::to_string(profile_data->get_op_num());
     } else {
         label = profile_data->get_custom_label();
@@ -348,29 +324,24 @@ void ProfileWatcher::update_calculated_profile_node(CalculatedProfileNode* calcu
     return;
 }
 
-bool ProfileWatcher::supervise_profile_tree() {
-    while (!profile_data_q->is_empty()) {
-        ProfileData* profile_data = profile_data_q->pop();
-        if (profile_data == nullptr) {
-            return true;
-        }
-        bool ret = true;
-        if (typeid(*profile_data) == typeid(EntryProfileData)) {
-            ret = process_entry_profile_data(profile_data);
-        } else if (typeid(*profile_data) == typeid(ExitProfileData)) {
-            ret = process_exit_profile_data(profile_data);
-        } else if (typeid(*profile_data) == typeid(CalculatedProfileData)) {
-            ret = process_calculated_profile_data(profile_data);
-        }
-        delete profile_data;
-        if (!ret) return false;  // abnormal return
+bool ProfileWatcher::supervise_profile_tree(ProfileData* profile_data) {
+    if (profile_data == nullptr) {
+        return true;
     }
-    return true;
+    bool ret = true;
+    if (typeid(*profile_data) == typeid(EntryProfileData)) {
+        ret = process_entry_profile_data(profile_data);
+    } else if (typeid(*profile_data) == typeid(ExitProfileData)) {
+        ret = process_exit_profile_data(profile_data);
+    } else if (typeid(*profile_data) == typeid(CalculatedProfileData)) {
+        ret = process_calculated_profile_data(profile_data);
+    }
+    return ret;  // false for abnormal return
 }
 
 void ProfileWatcher :: dump_node(ProfileTreeNode* node, std::string label) {
     std::ofstream out_dump;
-    out_dump.open(DUMP_PATH, std::ofstream::app || std::ofstream::out);
+    out_dump.open(DUMP_PATH, std::ofstream::app | std::ofstream::out);
     std::vector<std::chrono::microseconds> durations = node->get_durations();
     out_dump<<(label + node->get_label());
     for(int32_t idx = 0; idx < durations.size(); idx++) {
@@ -387,7 +358,7 @@ void ProfileWatcher :: dump_profile_tree() {
     char model_info[256];
     std::sprintf(model_info, MSG_TABLE_BORDER_TOP, id);
     std::ofstream out_dump;
-    out_dump.open(DUMP_PATH, std::ofstream::app || std::ofstream::out);
+    out_dump.open(DUMP_PATH, std::ofstream::app | std::ofstream::out);
     out_dump<<model_info<<"\n";
     out_dump.close();
     // Use DFS to recursively dump the profile subtrees
@@ -395,3 +366,9 @@ void ProfileWatcher :: dump_profile_tree() {
         dump_node(sub_tree, "_");
     }
 }
+
+void ProfileWatcher :: dump_profile_trace() {
+    char model_id[32];
+    std::snprintf(model_id, sizeof(model_id), "%" PRIX64, id);
+    profile_trace.write(std::string(TRACE_PATH_PREFIX) + model_id + ".json", id);
+}
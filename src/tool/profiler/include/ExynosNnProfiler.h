@@ -32,9 +32,9 @@ struct CalculatedProfileNode {
 
 uint8_t*    profile_level_is(void);
 void        profile_from(const char* custom_label, uint64_t id);
-void        profile_from2(const char* custom_label, uint64_t id, int32_t op_num);
+void        profile_from_with_op_num(const char* custom_label, uint64_t id, int32_t op_num);
 void        profile_until(const char* custom_label, uint64_t id);
-void        profile_until2(const char* custom_label, uint64_t id, int32_t op_num);
+void        profile_until_with_op_num(const char* custom_label, uint64_t id, int32_t op_num);
 void        profile_append(struct CalculatedProfileNode* calculated_profile_node, uint64_t id);
 void        profile_exclude_from(const char* custom_label, uint64_t id);
 void        profile_exclude_until(const char* custom_label, uint64_t id);
@@ -22,6 +22,7 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <string>
 
 class ProfileWatcher;
 
@@ -75,20 +76,25 @@ class FinishProfiler
 };
 
 
+// It records the entry and the exit of the scope, only if the profiler is started.
 class ScopedProfiling {
  public:
-    ScopedProfiling(std::string file, int line, std::string func, uint64_t id);
-    ScopedProfiling(std::string custom_label, uint64_t id);
-    ScopedProfiling(std::string custom_label, uint64_t id, int32_t op_num);
+    ScopedProfiling(const std::string& file, int line, const std::string& func, uint64_t id);
+    ScopedProfiling(const std::string& custom_label, uint64_t id);
+    ScopedProfiling(const std::string& custom_label, uint64_t id, int32_t op_num);
+    // Labels of literals, which are interned by their addresses without building a string.
+    ScopedProfiling(const char* custom_label, uint64_t id);
+    ScopedProfiling(const char* custom_label, uint64_t id, int32_t op_num);
     ~ScopedProfiling();
 
  private:
-    std::string file;
-    std::string custom_label;
-    int line = 0;
-    std::string func;
+    template <typename Label>
+    void record_entry(const Label& custom_label);
+
     uint64_t id;
+    uint32_t label;
     int32_t op_num;
+    bool is_recorded;
 };
 
 #endif  // __cplusplus
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2021 Samsung Electronics Co. LTD
+ *
+ * This software is proprietary of Samsung Electronics.
+ * No part of this software, either material or conceptual may be copied or distributed, transmitted,
+ * transcribed, stored in a retrieval system or translated into any human or computer language in any form by any means,
+ * electronic, mechanical, manual or otherwise, or disclosed
+ * to third parties without the express written permission of Samsung Electronics.
+ */
+
+/**
+ * @file    ProfileClock.hpp
+ * @brief   It declares the clock of the events profiled, which reads the counter of the CPU.
+ * @details Ticks are read on recording and converted to steady_clock on draining, so that recording needs no
+ *          system call. The counter is cntvct_el0 on aarch64 and TSC on x86, and steady_clock on the others.
+ * @version 1
+ */
+
+#ifndef TOOLS_PROFILER_INCLUDE_PROFILECLOCK_HPP_
+#define TOOLS_PROFILER_INCLUDE_PROFILECLOCK_HPP_
+
+#ifdef __cplusplus
+
+#include <chrono>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// Duration to measure the frequency of TSC (us), which is not known to the user space.
+constexpr int PROFILE_CLOCK_CALIBRATION_TIME = 2000;
+
+class ProfileClock {
+ public:
+    static int64_t now_ticks() {
+#if defined(__aarch64__)
+        uint64_t ticks;
+        asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+        return static_cast<int64_t>(ticks);
+#elif defined(__x86_64__) || defined(__i386__)
+        return static_cast<int64_t>(__rdtsc());
+#else
+        return steady_now_ns();
+#endif
+    }
+
+    static int64_t steady_now_ns() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Anchor the ticks to steady_clock of now. It is called when recording starts, not on the path recording.
+    void calibrate() {
+#if defined(__aarch64__)
+        uint64_t frequency;
+        asm volatile("mrs %0, cntfrq_el0" : "=r"(frequency));
+        ns_per_tick = 1e9 / static_cast<double>(frequency);
+        base_ticks = now_ticks();
+        base_ns = steady_now_ns();
+#elif defined(__x86_64__) || defined(__i386__)
+        const int64_t start_ns = steady_now_ns();
+        const int64_t start_ticks = now_ticks();
+        int64_t end_ns = start_ns;
+        while (end_ns - start_ns < PROFILE_CLOCK_CALIBRATION_TIME * 1000) {
+            end_ns = steady_now_ns();
+        }
+        const int64_t end_ticks = now_ticks();
+        ns_per_tick = static_cast<double>(end_ns - start_ns) / static_cast<double>(end_ticks - start_ticks);
+        base_ticks = end_ticks;
+        base_ns = end_ns;
+#else
+        ns_per_tick = 1.0;
+        base_ticks = 0;
+        base_ns = 0;
+#endif
+    }
+
+    int64_t to_ns(int64_t ticks) const {
+        return base_ns + static_cast<int64_t>(static_cast<double>(ticks - base_ticks) * ns_per_tick);
+    }
+
+ private:
+    double ns_per_tick = 1.0;
+    int64_t base_ticks = 0;
+    int64_t base_ns = 0;
+};
+
+#endif // __cplusplus
+
+#endif // TOOLS_PROFILER_INCLUDE_PROFILECLOCK_HPP_
@@ -24,21 +24,17 @@
 #include <chrono>
 #include <thread>
 
+// A time point of a scope, which is made of a ProfileEvent drained from the ring of the thread.
 class ProfileData {
  public:
     ProfileData();
-    ProfileData(const std::string& file, const std::string& line, const std::string& func);
-    ProfileData(const std::string& custom_label);
-    ProfileData(const std::string& custom_label, const bool& is_excluded);
-    ProfileData(const std::string& custom_label, const int32_t& op_num);
+    ProfileData(const std::string& custom_label, const int32_t& op_num, const bool& is_excluded,
+                const std::chrono::steady_clock::time_point& time, const std::thread::id& thread_id);
     virtual ~ProfileData() = default;
 
     void set_custom_label(const std::string& custom_label);
 
-    const std::chrono::system_clock::time_point& get_time();
-    const std::string& get_file();
-    const std::string& get_line();
-    const std::string& get_func();
+    const std::chrono::steady_clock::time_point& get_time();
     const std::thread::id& get_thread_id();
     const std::string& get_custom_label();
     const int32_t& get_op_num();
@@ -46,12 +42,9 @@ class ProfileData {
     bool is_excluded;
 
  protected:
-    std::chrono::system_clock::time_point time;
+    std::chrono::steady_clock::time_point time;
 
  private:
-    std::string file;
-    std::string line;
-    std::string func;
     std::string custom_label;
     std::thread::id thread_id;
     int32_t op_num;
@@ -60,20 +53,16 @@ class ProfileData {
 
 class EntryProfileData : public ProfileData {
  public:
-    EntryProfileData(const std::string& file, const std::string& line, const std::string& func);
-    EntryProfileData(const std::string& custom_label);
-    EntryProfileData(const std::string& custom_label, const bool& is_excluded);
-    EntryProfileData(const std::string& custom_label, const int32_t& op_num);
+    EntryProfileData(const std::string& custom_label, const int32_t& op_num, const bool& is_excluded,
+                     const std::chrono::steady_clock::time_point& time, const std::thread::id& thread_id);
     virtual ~EntryProfileData() = default;
 };
 
 
 class ExitProfileData : public ProfileData {
  public:
-    ExitProfileData(const std::string& file, const std::string& line, const std::string& func);
-    ExitProfileData(const std::string& custom_label);
-    ExitProfileData(const std::string& custom_label, const bool& is_excluded);
-    ExitProfileData(const std::string& custom_label, const int32_t& op_num);
+    ExitProfileData(const std::string& custom_label, const int32_t& op_num, const bool& is_excluded,
+                    const std::chrono::steady_clock::time_point& time, const std::thread::id& thread_id);
     virtual ~ExitProfileData() = default;
 };
 
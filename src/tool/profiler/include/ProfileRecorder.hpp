@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2021 Samsung Electronics Co. LTD
+ *
+ * This software is proprietary of Samsung Electronics.
+ * No part of this software, either material or conceptual may be copied or distributed, transmitted,
+ * transcribed, stored in a retrieval system or translated into any human or computer language in any form by any means,
+ * electronic, mechanical, manual or otherwise, or disclosed
+ * to third parties without the express written permission of Samsung Electronics.
+ */
+
+/**
+ * @file    ProfileRecorder.hpp
+ * @brief   It declares the class to record events of time points to rings of threads and to drain them.
+ * @details ProfileRecorder is a singleton. A drainer thread hands the events over to the sink of the model id.
+ * @version 1
+ */
+
+#ifndef TOOLS_PROFILER_INCLUDE_PROFILERECORDER_HPP_
+#define TOOLS_PROFILER_INCLUDE_PROFILERECORDER_HPP_
+
+#ifdef __cplusplus
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "tool/profiler/include/ProfileClock.hpp"
+#include "tool/profiler/include/ProfileRing.hpp"
+
+// Duration that the drainer thread waits between drains (us). A ring holds events of this duration at least.
+constexpr int DRAINER_THREAD_WAIT_TIME = 1000;
+
+// Consumer of the events of a model id, which is called on the drainer thread.
+class ProfileEventSink {
+ public:
+    virtual ~ProfileEventSink() = default;
+    virtual void consume(const ProfileEvent& event, const ProfileRing& ring) = 0;
+};
+
+class ProfileRecorder {
+ public:
+    static ProfileRecorder& get_instance();
+
+    ProfileRecorder();
+    ~ProfileRecorder();
+    ProfileRecorder(const ProfileRecorder&) = delete;
+    ProfileRecorder& operator=(const ProfileRecorder&) = delete;
+
+    // Push an event of now to the ring of the calling thread, without lock. It does nothing if no sink is attached,
+    // and drops the event if the ring is full.
+    void record(ProfileEventType type, uint64_t id, uint32_t label, int32_t op_num = -1, bool is_excluded = false,
+                struct CalculatedProfileNode* calculated_profile_node = nullptr) {
+        if (!is_active.load(std::memory_order_relaxed)) return;
+        ProfileEvent event{id, ProfileClock::now_ticks(), calculated_profile_node, label, op_num, type, is_excluded};
+        if (!get_ring()->push(event)) {
+            dropped_num.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    bool is_recording() const {
+        return is_active.load(std::memory_order_relaxed);
+    }
+
+    // Id of the label, which is looked up in the cache of the calling thread before the table shared.
+    uint32_t intern(const std::string& label);
+    // Looked up by the address first, which is verified by the text as the buffer may be reused for another label.
+    uint32_t intern(const char* label);
+    std::string get_label(uint32_t label);
+
+    // Events of the id are handed over to the sink from now on, until detached. detach() drains all of the events
+    // recorded before, so that the sink has all of them after it.
+    void attach(uint64_t id, ProfileEventSink* sink);
+    void detach(uint64_t id);
+    void flush();
+
+    uint64_t get_dropped_num() const {
+        return dropped_num.load(std::memory_order_relaxed);
+    }
+
+ private:
+    struct LabelCacheEntry;
+    struct ThreadState;
+
+    ProfileRing* get_ring();
+    ThreadState& get_thread_state();
+    uint32_t intern(ThreadState& state, const std::string& label);
+    void drain();
+    void stop_drainer();
+    void thread_func();
+
+    static thread_local ThreadState thread_state;
+
+    // Calibrated when the first sink is attached, and used by the drainer only after.
+    ProfileClock clock;
+    // Unique among recorders, so that a thread knows whether its ring is of this recorder.
+    const uint64_t serial;
+    std::atomic<bool> is_active;
+    std::atomic<uint64_t> dropped_num;
+
+    std::mutex rings_mutex;
+    std::vector<std::shared_ptr<ProfileRing>> rings;
+    uint32_t thread_num;
+
+    std::mutex labels_mutex;
+    std::vector<std::string> labels;
+    std::unordered_map<std::string, uint32_t> label_ids;
+
+    // Held while draining, so that a sink is not detached during consume().
+    std::mutex drain_mutex;
+    std::map<uint64_t, ProfileEventSink*> sinks;
+
+    // Held while attaching or detaching, which starts or stops the drainer.
+    std::mutex control_mutex;
+    std::mutex drainer_mutex;
+    std::condition_variable drainer_cv;
+    std::thread drainer_thread;
+    bool drainer_should_finish;
+};
+
+#endif // __cplusplus
+
+#endif // TOOLS_PROFILER_INCLUDE_PROFILERECORDER_HPP_
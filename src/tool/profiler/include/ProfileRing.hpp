@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2021 Samsung Electronics Co. LTD
+ *
+ * This software is proprietary of Samsung Electronics.
+ * No part of this software, either material or conceptual may be copied or distributed, transmitted,
+ * transcribed, stored in a retrieval system or translated into any human or computer language in any form by any means,
+ * electronic, mechanical, manual or otherwise, or disclosed
+ * to third parties without the express written permission of Samsung Electronics.
+ */
+
+/**
+ * @file    ProfileRing.hpp
+ * @brief   It declares the event of a time point and the ring buffer of events of a thread.
+ * @details A thread profiled writes its events to its own ring, which the drainer of ProfileRecorder reads.
+ * @version 1
+ */
+
+#ifndef TOOLS_PROFILER_INCLUDE_PROFILERING_HPP_
+#define TOOLS_PROFILER_INCLUDE_PROFILERING_HPP_
+
+#ifdef __cplusplus
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "tool/profiler/include/ExynosNnProfiler.h"
+
+enum class ProfileEventType : uint8_t {
+    ENTRY,
+    EXIT,
+    CALCULATED,
+};
+
+// A time point profiled, of plain data so that recording it costs a copy only. The label is an id interned by
+// ProfileRecorder. The time is of ticks of ProfileClock in a ring, and of steady_clock in nanoseconds to sinks.
+struct ProfileEvent {
+    uint64_t id;
+    int64_t time_ns;
+    struct CalculatedProfileNode* calculated_profile_node;
+    uint32_t label;
+    int32_t op_num;
+    ProfileEventType type;
+    bool is_excluded;
+};
+
+// Ring of events of a producer thread and a consumer, the drainer. The producer only writes tail_ and the consumer
+// only writes head_, so that neither of them waits for the other. push() fails if the ring is full.
+class ProfileRing {
+ public:
+    static constexpr size_t CAPACITY = 4096;  // power of 2
+
+    explicit ProfileRing(uint32_t thread_index)
+    : events(CAPACITY), head(0), tail(0), retired(false),
+      thread_index(thread_index), thread_id(std::this_thread::get_id()) {}
+    ProfileRing(const ProfileRing&) = delete;
+    ProfileRing& operator=(const ProfileRing&) = delete;
+
+    bool push(const ProfileEvent& event) {
+        const size_t cur_tail = tail.load(std::memory_order_relaxed);
+        if (cur_tail - head.load(std::memory_order_acquire) == CAPACITY) return false;
+        events[cur_tail & (CAPACITY - 1)] = event;
+        tail.store(cur_tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Call func for the events pushed so far, in order, and return the number of them.
+    template <typename Func>
+    size_t drain(Func&& func) {
+        const size_t cur_head = head.load(std::memory_order_relaxed);
+        const size_t cur_tail = tail.load(std::memory_order_acquire);
+        for (size_t i = cur_head; i != cur_tail; ++i) {
+            func(events[i & (CAPACITY - 1)]);
+        }
+        head.store(cur_tail, std::memory_order_release);
+        return cur_tail - cur_head;
+    }
+
+    bool is_empty() const {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+
+    // The thread of the ring exited, so that the ring is released after drained.
+    void retire() {
+        retired.store(true, std::memory_order_release);
+    }
+
+    bool is_retired() const {
+        return retired.load(std::memory_order_acquire);
+    }
+
+    uint32_t get_thread_index() const {
+        return thread_index;
+    }
+
+    const std::thread::id& get_thread_id() const {
+        return thread_id;
+    }
+
+ private:
+    std::vector<ProfileEvent> events;
+    alignas(64) std::atomic<size_t> head;
+    alignas(64) std::atomic<size_t> tail;
+    std::atomic<bool> retired;
+    uint32_t thread_index;
+    std::thread::id thread_id;
+};
+
+#endif // __cplusplus
+
+#endif // TOOLS_PROFILER_INCLUDE_PROFILERING_HPP_
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2021 Samsung Electronics Co. LTD
+ *
+ * This software is proprietary of Samsung Electronics.
+ * No part of this software, either material or conceptual may be copied or distributed, transmitted,
+ * transcribed, stored in a retrieval system or translated into any human or computer language in any form by any means,
+ * electronic, mechanical, manual or otherwise, or disclosed
+ * to third parties without the express written permission of Samsung Electronics.
+ */
+
+/**
+ * @file    ProfileTrace.hpp
+ * @brief   It declares the class to write the events profiled in the format of Chrome trace.
+ * @details The JSON written can be opened by chrome://tracing or Perfetto UI, with a lane for each thread.
+ * @version 1
+ */
+
+#ifndef TOOLS_PROFILER_INCLUDE_PROFILETRACE_HPP_
+#define TOOLS_PROFILER_INCLUDE_PROFILETRACE_HPP_
+
+#ifdef __cplusplus
+
+#include <ostream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "tool/profiler/include/ProfileRing.hpp"
+
+class ProfileTrace {
+ public:
+    // Events kept at most, about 64MB, so that a long run does not exhaust the memory.
+    static constexpr size_t MAX_EVENT_NUM = 1 << 20;
+
+    // Scopes nest by the order of ENTRY and EXIT events of a thread. A calculated sub-tree becomes complete events,
+    // children of which are placed one after another from the start of the parent.
+    void add(const ProfileEvent& event, const std::string& label, uint32_t thread_index);
+    void write(std::ostream& out, uint64_t id) const;
+    bool write(const std::string& path, uint64_t id) const;
+
+    size_t get_event_num() const {
+        return events.size();
+    }
+
+ private:
+    struct TraceEvent {
+        std::string name;
+        int64_t time_ns;
+        int64_t duration_ns;
+        uint32_t thread_index;
+        char phase;
+        bool is_excluded;
+    };
+
+    void add_calculated(const struct CalculatedProfileNode* node, int64_t time_ns, uint32_t thread_index);
+    bool is_full();
+
+    std::vector<TraceEvent> events;
+    std::set<uint32_t> thread_indices;
+    size_t dropped_num = 0;
+};
+
+#endif // __cplusplus
+
+#endif // TOOLS_PROFILER_INCLUDE_PROFILETRACE_HPP_
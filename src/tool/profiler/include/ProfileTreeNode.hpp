@@ -29,14 +29,14 @@
 class ProfileTreeNode {
  public:
     ProfileTreeNode(const std::string& label);
-    ProfileTreeNode(const std::string& label, const std::chrono::system_clock::time_point& entry_time);
-    ProfileTreeNode(const std::string& label, const std::chrono::system_clock::time_point& entry_time,
+    ProfileTreeNode(const std::string& label, const std::chrono::steady_clock::time_point& entry_time);
+    ProfileTreeNode(const std::string& label, const std::chrono::steady_clock::time_point& entry_time,
                         const std::thread::id& thread_id);
-    ProfileTreeNode(const std::string& label, const std::chrono::system_clock::time_point& entry_time,
+    ProfileTreeNode(const std::string& label, const std::chrono::steady_clock::time_point& entry_time,
                         const std::thread::id& thread_id, const bool& is_excluded);
     ProfileTreeNode(const std::string label, const uint32_t& duration);
 
-    ProfileTreeNode* operator=(const std::chrono::system_clock::time_point& entry_time);
+    ProfileTreeNode* operator=(const std::chrono::steady_clock::time_point& entry_time);
     ProfileTreeNode* operator=(const std::chrono::microseconds& duration);
     bool operator!=(const std::string& label_) const;
 
@@ -46,10 +46,10 @@ class ProfileTreeNode {
     ProfileTreeNode* push_child_node(ProfileTreeNode* child);
     ProfileTreeNode* pop_child();
     void calc_proportion(ProfileTreeNode* root);
-    void add_entry_time(const std::chrono::system_clock::time_point& entry_time);
+    void add_entry_time(const std::chrono::steady_clock::time_point& entry_time);
 
     void set_parent(ProfileTreeNode* parent);
-    ProfileTreeNode* set_duration(std::chrono::system_clock::time_point exit_time);
+    ProfileTreeNode* set_duration(std::chrono::steady_clock::time_point exit_time);
     void update_exclude_duration(const std::chrono::microseconds& duration);
     void set_self_duration(const std::chrono::microseconds& duration);
 
@@ -62,8 +62,8 @@ class ProfileTreeNode {
     double get_proportion_of_total();
     double get_proportion_of_caller();
     int get_iteration();
-    std::chrono::system_clock::time_point& get_entry_time();
-    std::queue<std::chrono::system_clock::time_point>& get_entry_times();
+    std::chrono::steady_clock::time_point& get_entry_time();
+    std::queue<std::chrono::steady_clock::time_point>& get_entry_times();
     std::vector<ProfileTreeNode*>& get_children();
     std::thread::id get_thread_id();
     std::chrono::microseconds& get_ninetieth_latency();
@@ -74,8 +74,8 @@ class ProfileTreeNode {
 
  private:
     std::string label;
-    std::queue<std::chrono::system_clock::time_point> entry_times;
-    std::chrono::system_clock::time_point entry_time;
+    std::queue<std::chrono::steady_clock::time_point> entry_times;
+    std::chrono::steady_clock::time_point entry_time;
     std::vector<std::chrono::microseconds> durations;
     std::chrono::microseconds ninetieth_latency;
     std::chrono::microseconds cur_duration;
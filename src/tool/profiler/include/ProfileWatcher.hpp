@@ -10,8 +10,8 @@
 
 /**
  * @file    ProfileWatcher.hpp
- * @brief   It declares the class to generate the profile tree after dequeuing .
- * @details A thread created by method in this class works to create profile tree from ProfileDataQueue.
+ * @brief   It declares the class to generate the profile tree and the trace of a model.
+ * @details The drainer thread of ProfileRecorder hands the events of the model over to the ProfileWatcher.
  * @version 1
  */
 
@@ -21,17 +21,14 @@
 #ifdef __cplusplus
 
 #include <map>
-#include <condition_variable>
 #include <inttypes.h>
 
 #include "tool/profiler/include/ExynosNnProfiler.h"
 #include "tool/profiler/include/ExynosNnProfilerConfig.h"
 #include "tool/profiler/include/ProfileTreeNode.hpp"
 #include "tool/profiler/include/ProfileData.hpp"
-#include "tool/profiler/include/ProfileDataQueue.hpp"
-
-// Duration that Watcher thread should wait (us).
-constexpr int WATCHER_THREAD_WAIT_TIME = 100;
+#include "tool/profiler/include/ProfileRecorder.hpp"
+#include "tool/profiler/include/ProfileTrace.hpp"
 
 // Messages to print out the result of profile.
 constexpr char MSG_START[] =
@@ -48,27 +45,25 @@ constexpr char MSG_FINISH[] =
     "Finish printing the profiled data result...\n";
 
 constexpr char DUMP_PATH[] = "/data/vendor/enn/dump/latency/exynos_nn_profiler_dump.csv";
+// Chrome trace of a model, followed by the model id and ".json".
+constexpr char TRACE_PATH_PREFIX[] = "/data/vendor/enn/dump/latency/exynos_nn_profiler_trace_";
 
 class ProfileTreeNode;
-class ProfileWatcher {
+class ProfileWatcher : public ProfileEventSink {
  public:
     ProfileWatcher(const ProfileWatcher&) = delete;
     ProfileWatcher(uint64_t id);
     ~ProfileWatcher();
     ProfileWatcher& operator=(const ProfileWatcher&) = delete;
 
-    std::condition_variable& get_condition_variable();
-    void push_profile_data(ProfileData* profile_data);
+    void consume(const ProfileEvent& event, const ProfileRing& ring) override;
     void print_profile_tree();
     void print_node(ProfileTreeNode* sub_tree_root, ProfileTreeNode* node, int level);
     void print_profile_data_error();
     void calculate_self_duration(ProfileTreeNode* node);
     void trim_profile_tree();
-    void thread_func();
-    bool& profile_thread_should_finish();
     bool& profile_data_is_normal();
     void create_profile_tree();
-    void create_profile_data_q();
     std::string parse_label(ProfileData* profile_data);
     void update_tree_foundation(const std::string& label, ProfileTreeNode* node);
     ProfileTreeNode* search_tree_foundation(const std::string& label);
@@ -78,19 +73,18 @@ class ProfileWatcher {
     bool process_calculated_profile_data(ProfileData* profile_data);
     ProfileTreeNode* append_calculated_profile_node(CalculatedProfileNode* calculated_profile_node, ProfileTreeNode* head);
     void update_calculated_profile_node(CalculatedProfileNode* calculated_profile_node, ProfileTreeNode* head);
-    bool supervise_profile_tree();
+    bool supervise_profile_tree(ProfileData* profile_data);
     void dump_node(ProfileTreeNode* node, std::string label);
     void dump_profile_tree();
+    void dump_profile_trace();
 
  private:
-    ProfileDataQueue<ProfileData>* profile_data_q;
     ProfileTreeNode* profile_tree_root;
     ProfileTreeNode* profile_tree_head;
     std::map<std::string, ProfileTreeNode*> map_info_oftree_foundation;
     std::map<std::thread::id, ProfileTreeNode*> tree_heads_of_threads;
-    std::thread watcher_thread;
-    std::condition_variable cv_;
-    std::mutex m_;
+    ProfileTrace profile_trace;
+    bool is_normal;
     uint64_t id;
 };
 
@@ -20,7 +20,11 @@
 
 #include <utility>
 #include <string>
+#ifdef __ANDROID__
 #include <android/log.h>
+#else
+#include <cstdio>
+#endif
 
 namespace profile {
 namespace log {
@@ -29,12 +33,20 @@ static const char* TAG = "EXYNOS_NN_PROFILER";
 
 template <typename... Args>
 inline void result(std::string format, Args&&... args) noexcept {
+#ifdef __ANDROID__
     __android_log_print(ANDROID_LOG_INFO, TAG, format.c_str(), std::forward<Args>(args)...);
+#else
+    std::printf(format.c_str(), std::forward<Args>(args)...);
+#endif
 }
 
 template <typename... Args>
 inline void error(std::string format, Args&&... args) noexcept {
+#ifdef __ANDROID__
     __android_log_print(ANDROID_LOG_ERROR, TAG, format.c_str(), std::forward<Args>(args)...);
+#else
+    std::fprintf(stderr, format.c_str(), std::forward<Args>(args)...);
+#endif
 }
 
 
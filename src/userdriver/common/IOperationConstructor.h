@@ -38,6 +38,12 @@ public:
 
     virtual EnnReturn create_ud_operator(const model::component::Operator::Ptr &operator_) = 0;
 
+    // Called after operators of operator_list are created, to replace some of them with a fused one.
+    virtual EnnReturn fuse_ud_operators(const model::component::OperatorList &operator_list) {
+        ENN_UNUSED(operator_list);
+        return ENN_RET_SUCCESS;
+    }
+
     bool is_builtin_operator(const TFlite::BuiltinOperator &code) {
         return (TFlite::BuiltinOperator_MIN <= (int)code && (int)code <= TFlite::BuiltinOperator_MAX);
     }
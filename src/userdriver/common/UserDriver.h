@@ -19,6 +19,7 @@
 #define USERDRIVER_COMMON_USERDRIVER_H_
 
 #include <atomic>
+#include <functional>
 #include <map>
 #include <string>
 #include <vector>
@@ -51,6 +52,8 @@ public:
 
 class UserDriver {
 public:
+    using BoundExecution = std::function<EnnReturn(void)>;
+
     /**
      * @brief UserDriver constructor
      * @details Initialize internal variables and resources
@@ -103,6 +106,17 @@ public:
      */
     virtual EnnReturn ExecuteSubGraph(const enn::runtime::OperatorListExecuteRequest& operator_list_execute_reqeust) = 0;
 
+    /**
+     * @brief Bind execution of a subgraph (optional): Implement real one in the target UD
+     *        to look up its state of the subgraph once, instead of every ExecuteSubGraph.
+     *
+     * @param operator_list_execute_reqeust Request to execute, which outlives the returned one
+     * @return BoundExecution Executes the request when called, or empty if failed
+     */
+    virtual BoundExecution BindSubGraph(const enn::runtime::OperatorListExecuteRequest& operator_list_execute_reqeust) {
+        return [this, &operator_list_execute_reqeust]() { return ExecuteSubGraph(operator_list_execute_reqeust); };
+    }
+
     /**
      * @brief close a subgraph
      *
@@ -10,6 +10,7 @@
 #include "userdriver/common/operator_interfaces/interfaces/operators/IDequantization.hpp"
 #include "userdriver/common/operator_interfaces/interfaces/operators/IDetection.hpp"
 #include "userdriver/common/operator_interfaces/interfaces/operators/IFlatten.hpp"
+#include "userdriver/common/operator_interfaces/interfaces/operators/IFusedPipeline.hpp"
 #include "userdriver/common/operator_interfaces/interfaces/operators/INormalization.hpp"
 #include "userdriver/common/operator_interfaces/interfaces/operators/INormalQuantization.hpp"
 #include "userdriver/common/operator_interfaces/interfaces/operators/IPad.hpp"
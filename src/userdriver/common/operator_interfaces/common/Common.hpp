@@ -134,6 +134,9 @@ enum class StorageType {
 
 enum class Reducer { SUM, MIN, MAX, PROD, ALL, ANY, SIZE };
 
+// Padding by values, by the mirror of the input without the edge, and by the edge repeated.
+enum class PadMode { CONSTANT = 0, REFLECT = 1, EDGE = 2 };
+
 enum { N_NCHW = 0, C_NCHW = 1, H_NCHW = 2, W_NCHW = 3 };
 
 enum { N_NHWC = 0, H_NHWC = 1, W_NHWC = 2, C_NHWC = 3 };
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "userdriver/common/operator_interfaces/common/Common.hpp"
+#include "userdriver/common/operator_interfaces/interfaces/ITensor.hpp"
+
+namespace enn {
+namespace ud {
+
+// Chain of element-wise operators fused into one. It is initialized with the operators of a userdriver.
+class IFusedPipeline {
+public:
+    virtual Status execute(const std::shared_ptr<ITensor> input, std::shared_ptr<ITensor> output) = 0;
+    virtual Status release() = 0;
+    virtual ~IFusedPipeline() = default;
+};  // class IFusedPipeline
+
+}  // namespace ud
+}  // namespace enn
@@ -24,6 +24,7 @@ namespace enn {
 namespace ud {
 
 #define BUF_IN(_idx_) buffer->in[_idx_]
+#define BUF_IN_ALL() buffer->in
 #define BUF_OUT(_idx_) buffer->out[_idx_]
 #define BUF_DATA(_idx_) buffer->data[_idx_]
 #define ARG_DATA(_idx_) data_[_idx_]
@@ -98,9 +98,31 @@ std::shared_ptr<ITensor> NEONComputeLibrary::create_and_copy_tensor(const TFlite
     }
 }
 
+// Clones are given buffers of the buffer table in prepare(), so they are views allocating nothing.
 std::shared_ptr<ITensor> NEONComputeLibrary::clone_tensor(const std::shared_ptr<ITensor> base) {
-    return create_tensor((TFlite::TensorType)base->get_buffer_type(), base->getPrecisionType(), base->getDims(),
-                         base->get_buffer_index());
+    const uint32_t type = base->get_buffer_type();
+    const PrecisionType precision = base->getPrecisionType();
+    const NDims &ndim = base->getDims();
+    const int32_t buffer_index = base->get_buffer_index();
+    switch ((TFlite::TensorType)type) {
+        case TFlite::TensorType::TensorType_FLOAT32:
+            return std::make_shared<NEONTensorView<float>>(ndim, precision, type, buffer_index);
+        case TFlite::TensorType::TensorType_FLOAT16:
+            return std::make_shared<NEONTensorView<_Float16_t>>(ndim, precision, type, buffer_index);
+        case TFlite::TensorType::TensorType_INT32:
+            return std::make_shared<NEONTensorView<int32_t>>(ndim, precision, type, buffer_index);
+        case TFlite::TensorType::TensorType_UINT8:
+            return std::make_shared<NEONTensorView<uint8_t>>(ndim, precision, type, buffer_index);
+        case TFlite::TensorType::TensorType_BOOL:
+            return std::make_shared<NEONTensorView<bool>>(ndim, precision, type, buffer_index);
+        case TFlite::TensorType::TensorType_INT16:
+            return std::make_shared<NEONTensorView<int16_t>>(ndim, precision, type, buffer_index);
+        case TFlite::TensorType::TensorType_INT8:
+            return std::make_shared<NEONTensorView<int8_t>>(ndim, precision, type, buffer_index);
+        default:
+            ENN_ERR_PRINT("Unsupported data type\n");
+            return nullptr;
+    }
 }
 
 }  // namespace cpu
@@ -62,6 +62,8 @@ public:
 
     std::shared_ptr<ITensor> clone_tensor(const std::shared_ptr<ITensor> tensor);
 
+    CPU_OP_CREATOR(IArgMax, ArgMax, ArgMax);
+    CPU_OP_CREATOR(IArgMin, ArgMin, ArgMin);
     CPU_OP_CREATOR(IAsymmDequantization, AsymmDequantization, AsymmDequantization);
     CPU_OP_CREATOR(IAsymmQuantization, AsymmQuantization, AsymmQuantization);
     CPU_OP_CREATOR_SOC(ICFUConverter, NEONCFUConverter, CFUConverter);
@@ -71,6 +73,7 @@ public:
     CPU_OP_CREATOR(IDetection, Detection, Detection);
     CPU_OP_CREATOR(IDetection, DetectionBatchSingle, DetectionBatchSingle);
     CPU_OP_CREATOR(IFlatten, Flatten, Flatten);
+    CPU_OP_CREATOR(IFusedPipeline, NEONFusedPipeline, FusedPipeline);
     CPU_OP_CREATOR(INormalization, Normalization, Normalization);
     CPU_OP_CREATOR(INormalQuantization, NEONNormalQuantization, NormalQuantization);
     CPU_OP_CREATOR(IPad, Pad, Pad);
@@ -9,3 +9,8 @@
 #include <limits>
 #include <cassert>
 #include <typeinfo>
+
+#include "userdriver/cpu/common/NEONVector.hpp"
+#include "userdriver/cpu/common/NEONKernels.hpp"
+#include "userdriver/cpu/common/NEONPipelineStage.hpp"
+#include "userdriver/cpu/common/NEONThreadPool.hpp"
@@ -0,0 +1,289 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "userdriver/cpu/common/NEONVector.hpp"
+
+namespace enn {
+namespace ud {
+namespace cpu {
+namespace kernel {
+
+// Vectorized kernels shared by operators, on the back end V of simd. Remainders of 8 lanes are done in scalar.
+
+// output[i] = input[i] * scale. The input may be placed in the front of the output, because it is done backward.
+template <typename V = simd::Native, typename T>
+void dequantize(const T* input, float* output, size_t size, float scale) {
+    const typename V::F32 scales = V::dup(scale);
+    size_t idx = size;
+    for (; idx >= V::LANES; idx -= V::LANES) {
+        V::store(output + idx - V::LANES, V::mul(V::load(input + idx - V::LANES), scales));
+    }
+    while (idx-- > 0) output[idx] = static_cast<float>(input[idx]) * scale;
+}
+
+// data[i] = (data[i] - mean) * scale, in place.
+template <typename V = simd::Native>
+void normalize(float* data, size_t size, float mean, float scale) {
+    const typename V::F32 means = V::dup(mean);
+    const typename V::F32 scales = V::dup(scale);
+    size_t idx = 0;
+    for (; idx + V::LANES <= size; idx += V::LANES) {
+        V::store(data + idx, V::mul(V::sub(V::load(data + idx), means), scales));
+    }
+    for (; idx < size; ++idx) data[idx] = (data[idx] - mean) * scale;
+}
+
+// Clip to the positive limit of T, or keep the lower bits with the sign bit for the negative.
+template <typename T>
+T clip_to_sign_bit(int32_t value) {
+    constexpr int32_t MAX_LIMIT = std::numeric_limits<T>::max();
+    if (value < 0) return static_cast<T>(value | ~MAX_LIMIT);
+    return static_cast<T>(value > MAX_LIMIT ? MAX_LIMIT : value);
+}
+
+// output[i] = clip_to_sign_bit(round((input[i] - mean) * scale)). T2 is int8_t or int16_t.
+template <typename V = simd::Native, typename T1, typename T2>
+void normalize_quantize(const T1* input, T2* output, size_t size, double mean, float scale) {
+    constexpr int32_t MAX_LIMIT = std::numeric_limits<T2>::max();
+    const typename V::F32 means = V::dup(static_cast<float>(mean));
+    const typename V::F32 scales = V::dup(scale);
+    const typename V::I32 max_limits = V::dup_i32(MAX_LIMIT);
+    const typename V::I32 sign_bits = V::dup_i32(~MAX_LIMIT);
+    size_t idx = 0;
+    for (; idx + V::LANES <= size; idx += V::LANES) {
+        auto value = V::round(V::mul(V::sub(V::load(input + idx), means), scales));
+        // min(value, MAX) for the positive, value | ~MAX for the negative.
+        value = V::bit_or(V::min(value, max_limits), V::bit_and(V::sign(value), sign_bits));
+        V::store(output + idx, value);
+    }
+    for (; idx < size; ++idx) {
+        auto value = static_cast<int32_t>(std::round((static_cast<float>(input[idx]) - mean) * scale));
+        output[idx] = clip_to_sign_bit<T2>(value);
+    }
+}
+
+// Split 16 pairs of bytes at src into the even ones at even and the odd ones at odd.
+template <typename V = simd::Native>
+void deinterleave16(const int8_t* src, int8_t* even, int8_t* odd) {
+    V::deinterleave16(src, even, odd);
+}
+
+// class_in_use[c] becomes non-zero if conf of the class c of any prior is the threshold or more.
+template <typename V = simd::Native>
+void mark_class_in_use(const float* conf, uint32_t num_classes, uint32_t num_priors, float threshold,
+                       uint32_t* class_in_use) {
+    const typename V::F32 thresholds = V::dup(threshold);
+    for (uint32_t p = 0; p < num_priors; ++p) {
+        const float* scores = conf + static_cast<size_t>(p) * num_classes;
+        uint32_t c = 0;
+        for (; c + V::LANES <= num_classes; c += V::LANES) {
+            V::store(class_in_use + c, V::bit_or(V::load_i32(class_in_use + c), V::ge(V::load(scores + c), thresholds)));
+        }
+        for (; c < num_classes; ++c) class_in_use[c] |= (scores[c] >= threshold ? 1 : 0);
+    }
+}
+
+// exp(x) for x of 0 or less, as in softmax. x is reduced to r = x - n * ln2 with n = round(x / ln2), and exp(r) is
+// a polynomial of Cephes expf, about 2e-7 of relative error. Values below -87.3 give 2^-126 order of results.
+template <typename V = simd::Native>
+typename V::F32 exp(typename V::F32 x) {
+    x = V::max(x, V::dup(-87.3f));
+    const typename V::I32 n = V::round(V::mul(x, V::dup(1.44269504f)));
+    const typename V::F32 f = V::to_f32(n);
+    const typename V::F32 r = V::sub(V::sub(x, V::mul(f, V::dup(0.693359375f))), V::mul(f, V::dup(-2.12194440e-4f)));
+    typename V::F32 p = V::dup(1.9875691500e-4f);
+    p = V::add(V::mul(p, r), V::dup(1.3981999507e-3f));
+    p = V::add(V::mul(p, r), V::dup(8.3334519073e-3f));
+    p = V::add(V::mul(p, r), V::dup(4.1665795894e-2f));
+    p = V::add(V::mul(p, r), V::dup(1.6666665459e-1f));
+    p = V::add(V::mul(p, r), V::dup(5.0000001201e-1f));
+    p = V::add(V::add(V::mul(V::mul(p, r), r), r), V::dup(1.0f));
+    return V::mul(p, V::pow2(n));
+}
+
+// exp() of a value, for remainders of lanes.
+inline float exp(float x) {
+    simd::Scalar::F32 lanes = simd::Scalar::dup(x);
+    return exp<simd::Scalar>(lanes).v[0];
+}
+
+// Softmax of size elements in a row. output[i] is exp(z[i]) / sum of exp(z), or z[i] - log(sum) for log softmax, where
+// z[i] = input[i] * coef - max of them. coef is beta times the scale of a quantized input, so that dequantization is
+// done on the fly. The input may be the output itself.
+template <typename V = simd::Native, typename T>
+void softmax_row(const T* input, float* output, size_t size, float coef, bool log_softmax) {
+    const typename V::F32 coefs = V::dup(coef);
+    float max = -std::numeric_limits<float>::infinity();
+    size_t idx = 0;
+    if (size >= V::LANES) {
+        typename V::F32 maxima = V::mul(V::load(input), coefs);
+        for (idx = V::LANES; idx + V::LANES <= size; idx += V::LANES) {
+            maxima = V::max(maxima, V::mul(V::load(input + idx), coefs));
+        }
+        max = V::reduce_max(maxima);
+    }
+    for (; idx < size; ++idx) max = std::max(max, static_cast<float>(input[idx]) * coef);
+
+    const typename V::F32 maxima = V::dup(max);
+    typename V::F32 sums = V::dup(0.0f);
+    float sum = 0.0f;
+    for (idx = 0; idx + V::LANES <= size; idx += V::LANES) {
+        auto z = V::sub(V::mul(V::load(input + idx), coefs), maxima);
+        auto e = exp<V>(z);
+        V::store(output + idx, log_softmax ? z : e);
+        sums = V::add(sums, e);
+    }
+    for (; idx < size; ++idx) {
+        float z = static_cast<float>(input[idx]) * coef - max;
+        float e = exp(z);
+        output[idx] = log_softmax ? z : e;
+        sum += e;
+    }
+    sum += V::reduce_add(sums);
+
+    const float factor = log_softmax ? -std::log(sum) : 1.0f / sum;
+    const typename V::F32 factors = V::dup(factor);
+    for (idx = 0; idx + V::LANES <= size; idx += V::LANES) {
+        auto value = V::load(output + idx);
+        V::store(output + idx, log_softmax ? V::add(value, factors) : V::mul(value, factors));
+    }
+    for (; idx < size; ++idx) output[idx] = log_softmax ? output[idx] + factor : output[idx] * factor;
+}
+
+// Softmax over channels of size positions in a row, as softmax_row(): element (c, i) is at input[c * stride + i].
+// The positions are done together, channel by channel, with max and sum of size floats.
+template <typename V = simd::Native, typename T>
+void softmax_channels(const T* input, float* output, size_t channels, size_t stride, size_t size, float coef,
+                      bool log_softmax, float* max, float* sum) {
+    const typename V::F32 coefs = V::dup(coef);
+    size_t i = 0;
+    for (; i + V::LANES <= size; i += V::LANES) {
+        typename V::F32 maxima = V::mul(V::load(input + i), coefs);
+        for (size_t c = 1; c < channels; ++c) maxima = V::max(maxima, V::mul(V::load(input + c * stride + i), coefs));
+        V::store(max + i, maxima);
+    }
+    for (; i < size; ++i) {
+        max[i] = static_cast<float>(input[i]) * coef;
+        for (size_t c = 1; c < channels; ++c) max[i] = std::max(max[i], static_cast<float>(input[c * stride + i]) * coef);
+    }
+
+    std::fill(sum, sum + size, 0.0f);
+    for (size_t c = 0; c < channels; ++c) {
+        const T* in = input + c * stride;
+        float* out = output + c * stride;
+        for (i = 0; i + V::LANES <= size; i += V::LANES) {
+            auto z = V::sub(V::mul(V::load(in + i), coefs), V::load(max + i));
+            auto e = exp<V>(z);
+            V::store(out + i, log_softmax ? z : e);
+            V::store(sum + i, V::add(V::load(sum + i), e));
+        }
+        for (; i < size; ++i) {
+            float z = static_cast<float>(in[i]) * coef - max[i];
+            float e = exp(z);
+            out[i] = log_softmax ? z : e;
+            sum[i] += e;
+        }
+    }
+
+    for (i = 0; i < size; ++i) sum[i] = log_softmax ? -std::log(sum[i]) : 1.0f / sum[i];
+    for (size_t c = 0; c < channels; ++c) {
+        float* out = output + c * stride;
+        for (i = 0; i + V::LANES <= size; i += V::LANES) {
+            auto value = V::load(out + i);
+            auto factors = V::load(sum + i);
+            V::store(out + i, log_softmax ? V::add(value, factors) : V::mul(value, factors));
+        }
+        for (; i < size; ++i) out[i] = log_softmax ? out[i] + sum[i] : out[i] * sum[i];
+    }
+}
+
+// Index of the max, the last of ties, or the min, the first of ties, over channels of size positions in a row, as
+// softmax_channels(): element (c, i) is at input[c * stride + i]. The positions are done together, channel by channel.
+template <typename V = simd::Native, typename T>
+void arg_extreme_channels(const T* input, int32_t* output, size_t channels, size_t stride, size_t size, bool is_max) {
+    size_t i = 0;
+    for (; i + V::LANES <= size; i += V::LANES) {
+        typename V::F32 extremes = V::load(input + i);
+        typename V::I32 indices = V::dup_i32(0);
+        for (size_t c = 1; c < channels; ++c) {
+            auto values = V::load(input + c * stride + i);
+            auto channel = V::dup_i32(static_cast<int32_t>(c));
+            if (is_max) {
+                indices = V::select(V::ge(values, extremes), channel, indices);
+                extremes = V::max(values, extremes);
+            } else {
+                indices = V::select(V::ge(values, extremes), indices, channel);
+                extremes = V::min(values, extremes);
+            }
+        }
+        V::store(reinterpret_cast<uint32_t*>(output + i), indices);
+    }
+    for (; i < size; ++i) {
+        T extreme = input[i];
+        int32_t index = 0;
+        for (size_t c = 1; c < channels; ++c) {
+            T value = input[c * stride + i];
+            if (is_max ? value >= extreme : value < extreme) {
+                extreme = value;
+                index = static_cast<int32_t>(c);
+            }
+        }
+        output[i] = index;
+    }
+}
+
+// Index of the max, the last of ties, or the min, the first of ties, of size elements in a row. Each lane keeps its
+// extreme over blocks of lanes, and the lanes are merged by the same order at the end.
+template <typename V = simd::Native, typename T>
+int32_t arg_extreme_row(const T* input, size_t size, bool is_max) {
+    float extreme = static_cast<float>(input[0]);
+    int32_t index = 0;
+    size_t idx = 0;
+    if (size >= V::LANES) {
+        typename V::F32 extremes = V::load(input);
+        typename V::I32 blocks = V::dup_i32(0);
+        for (idx = V::LANES; idx + V::LANES <= size; idx += V::LANES) {
+            auto values = V::load(input + idx);
+            auto block = V::dup_i32(static_cast<int32_t>(idx / V::LANES));
+            if (is_max) {
+                blocks = V::select(V::ge(values, extremes), block, blocks);
+                extremes = V::max(values, extremes);
+            } else {
+                blocks = V::select(V::ge(values, extremes), blocks, block);
+                extremes = V::min(values, extremes);
+            }
+        }
+        float lane_extremes[V::LANES];
+        uint32_t lane_blocks[V::LANES];
+        V::store(lane_extremes, extremes);
+        V::store(lane_blocks, blocks);
+        for (int l = 0; l < V::LANES; ++l) {
+            float value = lane_extremes[l];
+            int32_t lane_index = static_cast<int32_t>(lane_blocks[l]) * V::LANES + l;
+            bool is_better = is_max ? (value > extreme || (value == extreme && lane_index > index))
+                                    : (value < extreme || (value == extreme && lane_index < index));
+            if (l == 0 || is_better) {
+                extreme = value;
+                index = lane_index;
+            }
+        }
+    }
+    for (; idx < size; ++idx) {
+        float value = static_cast<float>(input[idx]);
+        if (is_max ? value >= extreme : value < extreme) {
+            extreme = value;
+            index = static_cast<int32_t>(idx);
+        }
+    }
+    return index;
+}
+
+}  // namespace kernel
+}  // namespace cpu
+}  // namespace ud
+}  // namespace enn
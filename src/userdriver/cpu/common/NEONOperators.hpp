@@ -11,6 +11,7 @@
 #include "userdriver/cpu/operators/Flatten.hpp"
 #include "userdriver/cpu/operators/NEONCFUConverter.hpp"
 #include "userdriver/cpu/operators/NEONDequantization.hpp"
+#include "userdriver/cpu/operators/NEONFusedPipeline.hpp"
 #include "userdriver/cpu/operators/NEONNormalQuantization.hpp"
 #include "userdriver/cpu/operators/NEONSigDet.hpp"
 #include "userdriver/cpu/operators/Normalization.hpp"
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "userdriver/common/operator_interfaces/common/Common.hpp"
+
+namespace enn {
+namespace ud {
+namespace cpu {
+
+// An element-wise operator as a step of NEONFusedPipeline. Parameters are per channel, where the channel of the
+// element at index is index / plane_size % channel.
+struct PipelineStage {
+    enum class Type {
+        AFFINE,          // (x - means[c]) * scales[c], normalization and dequantization
+        QUANTIZE,        // round(x * scales[c]) keeping the sign bit and the lower bits, as Quantization
+        ASYMM_QUANTIZE,  // round(x / scales[c] + means[c]), as AsymmQuantization
+    };
+
+    Type type = Type::AFFINE;
+    // Data type the operator reads its input as, when it is the first step.
+    DataType input_type = DataType::FLOAT;
+    uint32_t plane_size = 1;
+    uint32_t channel = 1;
+    std::vector<float> means;
+    std::vector<float> scales;
+};
+
+}  // namespace cpu
+}  // namespace ud
+}  // namespace enn
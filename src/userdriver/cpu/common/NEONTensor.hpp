@@ -16,7 +16,7 @@ public:
         vdims_ = {dims.n, dims.c, dims.h, dims.w};
         buf_.reset(new T[getDimensionsSize(vdims_)]());
         order_ = DataOrder::NCHW;
-        data_type_ = data_type_map_[typeid(T).name()];
+        data_type_ = data_type_of();
         buffer_type_ = buffer_type;
         buffer_index_ = buffer_index;
     }
@@ -27,7 +27,7 @@ public:
         dims_ = extendToDim4(vdims_);
         buf_.reset(new T[getDimensionsSize(vdims_)]());
         order_ = DataOrder::NCHW;
-        data_type_ = data_type_map_[typeid(T).name()];
+        data_type_ = data_type_of();
         buffer_type_ = buffer_type;
         buffer_index_ = buffer_index;
     }
@@ -39,7 +39,7 @@ public:
         buf_.reset(new T[getDimensionsSize(vdims_)]());
         std::copy(data, data + getDimensionsSize(vdims_), buf_.get());
         order_ = DataOrder::NCHW;
-        data_type_ = data_type_map_[typeid(T).name()];
+        data_type_ = data_type_of();
         buffer_type_ = buffer_type;
         buffer_index_ = buffer_index;
     }
@@ -51,7 +51,7 @@ public:
         buf_.reset(new T[getDimensionsSize(vdims_)]());
         std::copy(data, data + getDimensionsSize(vdims_), buf_.get());
         order_ = DataOrder::NCHW;
-        data_type_ = data_type_map_[typeid(T).name()];
+        data_type_ = data_type_of();
         buffer_type_ = buffer_type;
         buffer_index_ = buffer_index;
     }
@@ -98,13 +98,13 @@ public:
                     void* = nullptr) override {
         UNUSED(type);
         auto total_bytes = sizeof(T) * getTotalSizeFromDims();
-        memcpy(data, buf_.get(), total_bytes);
+        memcpy(data, getBufferPtr(), total_bytes);
         return Status::SUCCESS;
     }
     Status writeData(DataPtr data, bool = true, DataOrderChangeType type = DataOrderChangeType::OTHER) override {
         UNUSED(type);
         auto total_bytes = sizeof(T) * getTotalSizeFromDims();
-        memcpy(buf_.get(), data, total_bytes);
+        memcpy(getBufferPtr(), data, total_bytes);
         return Status::SUCCESS;
     }
 
@@ -146,7 +146,7 @@ public:
         std::cout << "(n: " << dims_.n << ") (c: " << dims_.c << ") (h: " << dims_.h << ") (w: " << dims_.w << ")" << std::endl;
         std::cout << "Offset: " << offset_ << std::endl;
         std::cout << "Scale: " << scale_ << std::endl;
-        std::cout << "Buffer: " << buf_ << std::endl;
+        std::cout << "Buffer: " << static_cast<void*>(getBufferPtr()) << std::endl;
         std::cout << "----------------------------" << std::endl;
     }
 
@@ -154,7 +154,7 @@ public:
         std::ofstream out_file;
         out_file.open(file_name);
         for (uint32_t i = 0; i < getTotalSizeFromDims(); i++) {
-            out_file << std::setprecision(std::numeric_limits<long double>::digits10 + 1) << buf_.get()[i] << std::endl;
+            out_file << std::setprecision(std::numeric_limits<long double>::digits10 + 1) << getBufferPtr()[i] << std::endl;
         }
     }
 
@@ -192,7 +192,11 @@ public:
         return Status::SUCCESS;
     }
 
+    // A view shares no ownership of the buffer, so the pointer is valid while the buffer table is.
     std::shared_ptr<T> getDataPtr() {
+        if (buf_ == nullptr) {
+            return std::shared_ptr<T>(std::shared_ptr<T>(), getBufferPtr());
+        }
         return buf_;
     }
 
@@ -205,7 +209,7 @@ public:
     }
 
     Status zeroInit() {
-        std::fill(buf_.get(), buf_.get() + getTotalSizeFromDims(), 0);
+        std::fill(getBufferPtr(), getBufferPtr() + getTotalSizeFromDims(), 0);
         return Status::SUCCESS;
     }
 
@@ -243,6 +247,10 @@ public:
 
     void set_buffer_ptr(void* addr) override {
         raw_buffer = addr;
+        // A view of a tensor out of the buffer table, e.g. buffer_index < 0, has its own buffer as others.
+        if (raw_buffer == nullptr && buf_ == nullptr) {
+            buf_.reset(new T[getTotalSizeFromDims()]());
+        }
     }
 
     T* getBufferPtr() {
@@ -261,7 +269,37 @@ public:
         vdims_.clear();
     }
 
+protected:
+    struct View {};
+
+    // Tensor without its own buffer, see NEONTensorView.
+    NEONTensor(View, const NDims& ndim, const PrecisionType& precision, const uint32_t& buffer_type,
+               const int32_t& buffer_index, const float& scale = 1.0, const int32_t& offset = 0)
+        : vdims_(ndim), precision_(precision), scale_(scale), offset_(offset) {
+        dims_ = extendToDim4(vdims_);
+        order_ = DataOrder::NCHW;
+        data_type_ = data_type_of();
+        buffer_type_ = buffer_type;
+        buffer_index_ = buffer_index;
+    }
+
 private:
+    static DataType data_type_of() {
+        static const std::map<std::string, DataType> data_type_map = {
+            {typeid(float).name(),      DataType::FLOAT},
+            {typeid(_Float16_t).name(), DataType::FLOAT16},
+            {typeid(int32_t).name(),    DataType::INT32},
+            {typeid(int8_t).name(),     DataType::INT8},
+            {typeid(uint8_t).name(),    DataType::UINT8},
+            {typeid(bool).name(),       DataType::BOOL},
+            {typeid(int16_t).name(),    DataType::INT16},
+            {typeid(uint16_t).name(),   DataType::UINT16}
+        };
+        auto found = data_type_map.find(typeid(T).name());
+        return found != data_type_map.end() ? found->second : DataType::FLOAT;  // default is DataType::FLOAT(0)
+    }
+
+
     Dim4 dims_;
     NDims vdims_;
     PrecisionType precision_;
@@ -274,19 +312,18 @@ private:
     uint32_t buffer_type_ = 0;
 
     std::shared_ptr<T> buf_;
-
-    std::map<std::string, DataType> data_type_map_ = {
-        {typeid(float).name(),      DataType::FLOAT},
-        {typeid(_Float16_t).name(), DataType::FLOAT16},
-        {typeid(int32_t).name(),    DataType::INT32},
-        {typeid(int8_t).name(),     DataType::INT8},
-        {typeid(uint8_t).name(),    DataType::UINT8},
-        {typeid(bool).name(),       DataType::BOOL},
-        {typeid(int16_t).name(),    DataType::INT16},
-        {typeid(uint16_t).name(),   DataType::UINT16}
-    }; // default is DataType::FLOAT(0)
 };  // class NEONTensor
 
+// NEONTensorView refers to a buffer of the buffer table set by set_buffer_ptr(), instead of allocating one.
+// Executors of a subgraph are prepared with views, so preparing costs no memory for data of tensors.
+template <typename T>
+class NEONTensorView : public NEONTensor<T> {
+public:
+    NEONTensorView(const NDims& ndim, const PrecisionType& precision, const uint32_t& buffer_type = 0,
+                   const int32_t& buffer_index = UNDEFINED)
+        : NEONTensor<T>(typename NEONTensor<T>::View(), ndim, precision, buffer_type, buffer_index) {}
+};  // class NEONTensorView
+
 }  // namespace cpu
 }  // namespace ud
 }  // namespace enn
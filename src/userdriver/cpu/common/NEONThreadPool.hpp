@@ -0,0 +1,243 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace enn {
+namespace ud {
+namespace cpu {
+
+// Items of a loop are split into tasks of this number of elements at least, because smaller ones cost
+// more to dispatch than to compute. Operators pass it divided by elements per item as the grain.
+constexpr size_t PARALLEL_GRAIN = 16 * 1024;
+
+// ThreadPool runs loops of operators on worker threads and the calling thread together(intra-op parallelism).
+//  - parallel_for() splits [0, size) into tasks of `grain` items at least, and returns after all are done.
+//  - Loops of requests executed at the same time share the workers. The calling thread always works on
+//    its own loop, so a loop is finished even if all workers are busy with others.
+//  - Workers move to the cores of core_affinity of the loop they join, a bit per core. 0 is any core.
+//    It is given per loop, so that loops of operator lists on different cores share the pool.
+class ThreadPool {
+public:
+    static constexpr uint32_t MAX_THREADS = 8;
+
+    // thread_num counts the calling thread in, so thread_num - 1 workers are created.
+    explicit ThreadPool(uint32_t thread_num) : stop_(false) {
+        thread_num = std::min(std::max(thread_num, 1u), MAX_THREADS);
+        for (uint32_t i = 1; i < thread_num; ++i) {
+            workers_.emplace_back([this]() { work(); });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        job_cv_.notify_all();
+        for (auto& worker : workers_) worker.join();
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    static uint32_t get_default_thread_num() {
+        return std::min(std::max(std::thread::hardware_concurrency(), 1u), MAX_THREADS);
+    }
+
+    uint32_t get_thread_num() const {
+        return static_cast<uint32_t>(workers_.size() + 1);
+    }
+
+    // func(begin, end) is called for disjoint ranges covering [0, size), on thread_num threads at most.
+    //  Workers run it on the cores of core_affinity, while the calling thread stays where it is.
+    void parallel_for(size_t size, size_t grain, uint32_t thread_num, uint32_t core_affinity,
+                      const std::function<void(size_t, size_t)>& func) {
+        if (size == 0) return;
+        thread_num = std::min(thread_num, get_thread_num());
+        const size_t max_tasks = size / std::max<size_t>(grain, 1);
+        if (thread_num <= 1 || max_tasks <= 1) {
+            func(0, size);
+            return;
+        }
+
+        // More tasks than threads balance loops of uneven items, e.g. NMS of classes.
+        Job job(func, size, std::min<size_t>(max_tasks, thread_num * 4), core_affinity);
+        job.helpers = std::min<size_t>(thread_num - 1, job.task_num - 1);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            jobs_.push_back(&job);
+        }
+        for (size_t i = 0; i < job.helpers; ++i) job_cv_.notify_one();
+
+        run(&job);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto queued = std::find(jobs_.begin(), jobs_.end(), &job);
+        if (queued != jobs_.end()) jobs_.erase(queued);
+        done_cv_.wait(lock, [&job]() { return job.running == 0; });
+    }
+
+private:
+    struct Job {
+        Job(const std::function<void(size_t, size_t)>& func, size_t size, size_t task_num, uint32_t core_affinity)
+            : func(func), size(size), task_num(task_num), core_affinity(core_affinity), next_task(0), helpers(0),
+              joined(0), running(0) {}
+
+        const std::function<void(size_t, size_t)>& func;
+        const size_t size;
+        const size_t task_num;
+        const uint32_t core_affinity;
+        std::atomic<size_t> next_task;
+        size_t helpers;  // workers to join
+        size_t joined;   // guarded by mutex_
+        size_t running;  // guarded by mutex_
+    };
+
+    static void run(Job* job) {
+        for (size_t task = job->next_task++; task < job->task_num; task = job->next_task++) {
+            job->func(job->size * task / job->task_num, job->size * (task + 1) / job->task_num);
+        }
+    }
+
+    void work() {
+        uint32_t applied_affinity = 0;  // any core, as created
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            job_cv_.wait(lock, [this]() { return stop_ || !jobs_.empty(); });
+            if (stop_) return;
+
+            Job* job = jobs_.front();
+            ++job->running;
+            if (++job->joined >= job->helpers) jobs_.pop_front();
+            lock.unlock();
+
+            if (applied_affinity != job->core_affinity) {
+                apply_core_affinity(job->core_affinity);
+                applied_affinity = job->core_affinity;
+            }
+            run(job);
+
+            lock.lock();
+            if (--job->running == 0) done_cv_.notify_all();
+        }
+    }
+
+    static void apply_core_affinity(uint32_t core_affinity) {
+#if defined(__linux__)
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        const uint32_t core_num = std::max(std::thread::hardware_concurrency(), 1u);
+        for (uint32_t core = 0; core < core_num && core < 32; ++core) {
+            if (core_affinity == 0 || (core_affinity >> core) & 1u) CPU_SET(core, &cpu_set);
+        }
+        sched_setaffinity(0, sizeof(cpu_set), &cpu_set);  // best effort, the cores may be offline
+#else
+        (void)core_affinity;
+#endif
+    }
+
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable job_cv_;
+    std::condition_variable done_cv_;
+    std::deque<Job*> jobs_;
+    bool stop_;
+};
+
+// Operators executed by the thread in the lifetime of a ParallelScope run their loops on the pool, with
+// thread_num threads at most on the cores of core_affinity and grains of grain_scale times. Without a scope,
+// e.g. in workers or op tests, loops run on the calling thread.
+class ParallelScope {
+public:
+    ParallelScope(ThreadPool* pool, uint32_t thread_num, uint32_t grain_scale = 1, uint32_t core_affinity = 0)
+        : previous_(current()) {
+        current() = {pool, thread_num, std::max(grain_scale, 1u), core_affinity};
+    }
+
+    ~ParallelScope() {
+        current() = previous_;
+    }
+
+    ParallelScope(const ParallelScope&) = delete;
+    ParallelScope& operator=(const ParallelScope&) = delete;
+
+    struct Context {
+        ThreadPool* pool;
+        uint32_t thread_num;
+        uint32_t grain_scale;
+        uint32_t core_affinity;
+    };
+
+    static Context& current() {
+        static thread_local Context context{nullptr, 1, 1, 0};
+        return context;
+    }
+
+private:
+    Context previous_;
+};
+
+// Run func(begin, end) over [0, size) on the pool of the current ParallelScope.
+template <typename Func>
+void parallel_for(size_t size, size_t grain, Func&& func) {
+    const auto& context = ParallelScope::current();
+    if (context.pool == nullptr || context.thread_num <= 1) {
+        if (size > 0) func(static_cast<size_t>(0), size);
+        return;
+    }
+    context.pool->parallel_for(size, grain * context.grain_scale, context.thread_num, context.core_affinity,
+                               std::function<void(size_t, size_t)>(func));
+}
+
+// Run func(begin, end) over [0, size) of an element-wise loop reading in_bytes and writing out_bytes per element.
+// The output may start at the address of the input(in place), then the loop runs in passes so that no output
+// overwrites the input of an element not read yet: a wider output from the end, a narrower one from the front.
+template <typename Func>
+void parallel_for_in_place(const void* input, size_t in_bytes, const void* output, size_t out_bytes, size_t size,
+                           size_t grain, Func&& func) {
+    if (input != output || in_bytes == out_bytes) {
+        parallel_for(size, grain, func);
+        return;
+    }
+    auto pass = [&](size_t lo, size_t hi) {
+        parallel_for(hi - lo, grain, [&](size_t begin, size_t end) { func(lo + begin, lo + end); });
+    };
+    if (out_bytes > in_bytes) {
+        // Outputs of [lo, hi) are on the inputs of [hi, size), done already.
+        for (size_t hi = size; hi > 0;) {
+            size_t lo = std::min((hi * in_bytes + out_bytes - 1) / out_bytes, hi - 1);
+            pass(lo, hi);
+            hi = lo;
+        }
+    } else {
+        // Outputs of [lo, hi) are on the inputs of [0, lo), done already.
+        for (size_t lo = 0; lo < size;) {
+            size_t hi = std::min(std::max(lo * in_bytes / out_bytes, lo + 1), size);
+            pass(lo, hi);
+            lo = hi;
+        }
+    }
+}
+
+// Grain of items of elements_per_item elements each.
+inline size_t parallel_grain(size_t elements_per_item) {
+    return std::max<size_t>(PARALLEL_GRAIN / std::max<size_t>(elements_per_item, 1), 1);
+}
+
+}  // namespace cpu
+}  // namespace ud
+}  // namespace enn
@@ -0,0 +1,422 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#if defined(NEON_OPT)
+#include <arm_neon.h>
+#endif
+#if defined(__SSE4_1__)
+#include <immintrin.h>
+#endif
+
+namespace enn {
+namespace ud {
+namespace cpu {
+namespace simd {
+
+// Thin vector layer the kernels of the CPU userdriver are written on, so that they are vectorized on x86 hosts as well.
+//  A back end has 8 lanes of float(F32) and int32_t(I32) and the same static functions:
+//  - Neon   : NEON_OPT is defined(Android build).
+//  - Avx2   : compiled with -mavx2 -mfma(CPU_SIMD=AVX2 of x86 build).
+//  - Sse4   : compiled with -msse4.1(CPU_SIMD=SSE4 of x86 build, default).
+//  - Scalar : always, as a reference of the others.
+//  Native is the best one compiled. Masks of comparison are all bits set(-1) for true and 0 for false.
+//  round() rounds half away from zero, like as std::round().
+//  max(a, b) is a > b ? a : b and min(a, b) is a < b ? a : b, so max(b, a) is std::max(a, b) but for NaN on Neon.
+
+struct Scalar {
+    static constexpr const char* name = "Scalar";
+    static constexpr int LANES = 8;
+    struct F32 { float v[LANES]; };
+    struct I32 { int32_t v[LANES]; };
+
+    static F32 dup(float value) {
+        F32 r;
+        for (int i = 0; i < LANES; ++i) r.v[i] = value;
+        return r;
+    }
+    static I32 dup_i32(int32_t value) {
+        I32 r;
+        for (int i = 0; i < LANES; ++i) r.v[i] = value;
+        return r;
+    }
+    template <typename T>
+    static F32 load(const T* src) {
+        F32 r;
+        for (int i = 0; i < LANES; ++i) r.v[i] = static_cast<float>(src[i]);
+        return r;
+    }
+    static I32 load_i32(const uint32_t* src) {
+        I32 r;
+        std::memcpy(r.v, src, sizeof(r.v));
+        return r;
+    }
+    static void store(float* dst, const F32& a) {
+        std::memcpy(dst, a.v, sizeof(a.v));
+    }
+    static void store(uint32_t* dst, const I32& a) {
+        std::memcpy(dst, a.v, sizeof(a.v));
+    }
+    // Narrowing with saturation.
+    static void store(int16_t* dst, const I32& a) {
+        for (int i = 0; i < LANES; ++i) dst[i] = static_cast<int16_t>(clamp(a.v[i], INT16_MIN, INT16_MAX));
+    }
+    static void store(int8_t* dst, const I32& a) {
+        for (int i = 0; i < LANES; ++i) dst[i] = static_cast<int8_t>(clamp(a.v[i], INT8_MIN, INT8_MAX));
+    }
+    static F32 add(const F32& a, const F32& b) { return map(a, b, [](float x, float y) { return x + y; }); }
+    static F32 sub(const F32& a, const F32& b) { return map(a, b, [](float x, float y) { return x - y; }); }
+    static F32 mul(const F32& a, const F32& b) { return map(a, b, [](float x, float y) { return x * y; }); }
+    static F32 div(const F32& a, const F32& b) { return map(a, b, [](float x, float y) { return x / y; }); }
+    static F32 max(const F32& a, const F32& b) { return map(a, b, [](float x, float y) { return x > y ? x : y; }); }
+    static F32 min(const F32& a, const F32& b) { return map(a, b, [](float x, float y) { return x < y ? x : y; }); }
+    static I32 round(const F32& a) {
+        I32 r;
+        for (int i = 0; i < LANES; ++i) r.v[i] = static_cast<int32_t>(std::round(a.v[i]));
+        return r;
+    }
+    static F32 to_f32(const I32& a) {
+        F32 r;
+        for (int i = 0; i < LANES; ++i) r.v[i] = static_cast<float>(a.v[i]);
+        return r;
+    }
+    // 2^n for n in [-126, 127], made of the exponent bits.
+    static F32 pow2(const I32& n) {
+        F32 r;
+        for (int i = 0; i < LANES; ++i) {
+            uint32_t bits = static_cast<uint32_t>(n.v[i] + 127) << 23;
+            std::memcpy(&r.v[i], &bits, sizeof(bits));
+        }
+        return r;
+    }
+    static float reduce_max(const F32& a) {
+        float r = a.v[0];
+        for (int i = 1; i < LANES; ++i) r = a.v[i] > r ? a.v[i] : r;
+        return r;
+    }
+    static float reduce_add(const F32& a) {
+        float r = a.v[0];
+        for (int i = 1; i < LANES; ++i) r += a.v[i];
+        return r;
+    }
+    static I32 ge(const F32& a, const F32& b) {
+        I32 r;
+        for (int i = 0; i < LANES; ++i) r.v[i] = a.v[i] >= b.v[i] ? -1 : 0;
+        return r;
+    }
+    static I32 min(const I32& a, const I32& b) { return map(a, b, [](int32_t x, int32_t y) { return x < y ? x : y; }); }
+    static I32 bit_or(const I32& a, const I32& b) { return map(a, b, [](int32_t x, int32_t y) { return x | y; }); }
+    static I32 bit_and(const I32& a, const I32& b) { return map(a, b, [](int32_t x, int32_t y) { return x & y; }); }
+    // a for the lanes of the mask set, b for the others.
+    static I32 select(const I32& mask, const I32& a, const I32& b) {
+        I32 r;
+        for (int i = 0; i < LANES; ++i) r.v[i] = mask.v[i] ? a.v[i] : b.v[i];
+        return r;
+    }
+    // -1 for negative lanes, 0 for others.
+    static I32 sign(const I32& a) {
+        I32 r;
+        for (int i = 0; i < LANES; ++i) r.v[i] = a.v[i] < 0 ? -1 : 0;
+        return r;
+    }
+    // Split 16 pairs of bytes into even and odd ones.
+    static void deinterleave16(const int8_t* src, int8_t* even, int8_t* odd) {
+        for (int i = 0; i < 16; ++i) {
+            even[i] = src[2 * i];
+            odd[i] = src[2 * i + 1];
+        }
+    }
+
+ private:
+    static int32_t clamp(int32_t x, int32_t lo, int32_t hi) { return x < lo ? lo : (x > hi ? hi : x); }
+    template <typename V, typename Op>
+    static V map(const V& a, const V& b, Op op) {
+        V r;
+        for (int i = 0; i < LANES; ++i) r.v[i] = op(a.v[i], b.v[i]);
+        return r;
+    }
+};
+
+#if defined(__SSE4_1__)
+struct Sse4 {
+    static constexpr const char* name = "SSE4";
+    static constexpr int LANES = 8;
+    struct F32 { __m128 lo, hi; };
+    struct I32 { __m128i lo, hi; };
+
+    static F32 dup(float value) { return {_mm_set1_ps(value), _mm_set1_ps(value)}; }
+    static I32 dup_i32(int32_t value) { return {_mm_set1_epi32(value), _mm_set1_epi32(value)}; }
+    static F32 load(const float* src) { return {_mm_loadu_ps(src), _mm_loadu_ps(src + 4)}; }
+    static F32 load(const int16_t* src) {
+        __m128i s16 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        return {_mm_cvtepi32_ps(_mm_cvtepi16_epi32(s16)), _mm_cvtepi32_ps(_mm_cvtepi16_epi32(_mm_srli_si128(s16, 8)))};
+    }
+    static F32 load(const int8_t* src) {
+        __m128i s8 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src));
+        return {_mm_cvtepi32_ps(_mm_cvtepi8_epi32(s8)), _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(s8, 4)))};
+    }
+    static F32 load(const uint8_t* src) {
+        __m128i u8 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src));
+        return {_mm_cvtepi32_ps(_mm_cvtepu8_epi32(u8)), _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_srli_si128(u8, 4)))};
+    }
+    static I32 load_i32(const uint32_t* src) {
+        return {_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 4))};
+    }
+    static void store(float* dst, const F32& a) {
+        _mm_storeu_ps(dst, a.lo);
+        _mm_storeu_ps(dst + 4, a.hi);
+    }
+    static void store(uint32_t* dst, const I32& a) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), a.lo);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 4), a.hi);
+    }
+    static void store(int16_t* dst, const I32& a) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packs_epi32(a.lo, a.hi));
+    }
+    static void store(int8_t* dst, const I32& a) {
+        __m128i s16 = _mm_packs_epi32(a.lo, a.hi);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packs_epi16(s16, s16));
+    }
+    static F32 add(const F32& a, const F32& b) { return {_mm_add_ps(a.lo, b.lo), _mm_add_ps(a.hi, b.hi)}; }
+    static F32 sub(const F32& a, const F32& b) { return {_mm_sub_ps(a.lo, b.lo), _mm_sub_ps(a.hi, b.hi)}; }
+    static F32 mul(const F32& a, const F32& b) { return {_mm_mul_ps(a.lo, b.lo), _mm_mul_ps(a.hi, b.hi)}; }
+    static F32 div(const F32& a, const F32& b) { return {_mm_div_ps(a.lo, b.lo), _mm_div_ps(a.hi, b.hi)}; }
+    static F32 max(const F32& a, const F32& b) { return {_mm_max_ps(a.lo, b.lo), _mm_max_ps(a.hi, b.hi)}; }
+    static F32 min(const F32& a, const F32& b) { return {_mm_min_ps(a.lo, b.lo), _mm_min_ps(a.hi, b.hi)}; }
+    static I32 round(const F32& a) { return {round(a.lo), round(a.hi)}; }
+    static F32 to_f32(const I32& a) { return {_mm_cvtepi32_ps(a.lo), _mm_cvtepi32_ps(a.hi)}; }
+    static F32 pow2(const I32& n) { return {pow2(n.lo), pow2(n.hi)}; }
+    static float reduce_max(const F32& a) {
+        __m128 r = _mm_max_ps(a.lo, a.hi);
+        r = _mm_max_ps(r, _mm_movehl_ps(r, r));
+        return _mm_cvtss_f32(_mm_max_ss(r, _mm_shuffle_ps(r, r, 1)));
+    }
+    static float reduce_add(const F32& a) {
+        __m128 r = _mm_add_ps(a.lo, a.hi);
+        r = _mm_add_ps(r, _mm_movehl_ps(r, r));
+        return _mm_cvtss_f32(_mm_add_ss(r, _mm_shuffle_ps(r, r, 1)));
+    }
+    static I32 ge(const F32& a, const F32& b) {
+        return {_mm_castps_si128(_mm_cmpge_ps(a.lo, b.lo)), _mm_castps_si128(_mm_cmpge_ps(a.hi, b.hi))};
+    }
+    static I32 min(const I32& a, const I32& b) { return {_mm_min_epi32(a.lo, b.lo), _mm_min_epi32(a.hi, b.hi)}; }
+    static I32 bit_or(const I32& a, const I32& b) { return {_mm_or_si128(a.lo, b.lo), _mm_or_si128(a.hi, b.hi)}; }
+    static I32 bit_and(const I32& a, const I32& b) { return {_mm_and_si128(a.lo, b.lo), _mm_and_si128(a.hi, b.hi)}; }
+    static I32 select(const I32& mask, const I32& a, const I32& b) {
+        return {_mm_blendv_epi8(b.lo, a.lo, mask.lo), _mm_blendv_epi8(b.hi, a.hi, mask.hi)};
+    }
+    static I32 sign(const I32& a) { return {_mm_srai_epi32(a.lo, 31), _mm_srai_epi32(a.hi, 31)}; }
+    static void deinterleave16(const int8_t* src, int8_t* even, int8_t* odd) {
+        const __m128i split = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+        __m128i first = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)), split);
+        __m128i second = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 16)), split);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(even), _mm_unpacklo_epi64(first, second));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(odd), _mm_unpackhi_epi64(first, second));
+    }
+
+ private:
+    // Truncate, then step away from zero if the fraction is half or more. The fraction is exact below 2^24.
+    static __m128i round(__m128 a) {
+        __m128i truncated = _mm_cvttps_epi32(a);
+        __m128 fraction = _mm_sub_ps(a, _mm_cvtepi32_ps(truncated));
+        __m128i up = _mm_castps_si128(_mm_cmpge_ps(fraction, _mm_set1_ps(0.5f)));
+        __m128i down = _mm_castps_si128(_mm_cmple_ps(fraction, _mm_set1_ps(-0.5f)));
+        return _mm_add_epi32(_mm_sub_epi32(truncated, up), down);
+    }
+    static __m128 pow2(__m128i n) { return _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n, _mm_set1_epi32(127)), 23)); }
+};
+#endif
+
+#if defined(__AVX2__)
+struct Avx2 {
+    static constexpr const char* name = "AVX2";
+    static constexpr int LANES = 8;
+    struct F32 { __m256 v; };
+    struct I32 { __m256i v; };
+
+    static F32 dup(float value) { return {_mm256_set1_ps(value)}; }
+    static I32 dup_i32(int32_t value) { return {_mm256_set1_epi32(value)}; }
+    static F32 load(const float* src) { return {_mm256_loadu_ps(src)}; }
+    static F32 load(const int16_t* src) {
+        return {_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src))))};
+    }
+    static F32 load(const int8_t* src) {
+        return {_mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src))))};
+    }
+    static F32 load(const uint8_t* src) {
+        return {_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src))))};
+    }
+    static I32 load_i32(const uint32_t* src) { return {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src))}; }
+    static void store(float* dst, const F32& a) { _mm256_storeu_ps(dst, a.v); }
+    static void store(uint32_t* dst, const I32& a) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), a.v); }
+    static void store(int16_t* dst, const I32& a) {
+        __m128i s16 = _mm_packs_epi32(_mm256_castsi256_si128(a.v), _mm256_extracti128_si256(a.v, 1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), s16);
+    }
+    static void store(int8_t* dst, const I32& a) {
+        __m128i s16 = _mm_packs_epi32(_mm256_castsi256_si128(a.v), _mm256_extracti128_si256(a.v, 1));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packs_epi16(s16, s16));
+    }
+    static F32 add(const F32& a, const F32& b) { return {_mm256_add_ps(a.v, b.v)}; }
+    static F32 sub(const F32& a, const F32& b) { return {_mm256_sub_ps(a.v, b.v)}; }
+    static F32 mul(const F32& a, const F32& b) { return {_mm256_mul_ps(a.v, b.v)}; }
+    static F32 div(const F32& a, const F32& b) { return {_mm256_div_ps(a.v, b.v)}; }
+    static F32 max(const F32& a, const F32& b) { return {_mm256_max_ps(a.v, b.v)}; }
+    static F32 min(const F32& a, const F32& b) { return {_mm256_min_ps(a.v, b.v)}; }
+    static I32 round(const F32& a) {
+        __m256i truncated = _mm256_cvttps_epi32(a.v);
+        __m256 fraction = _mm256_sub_ps(a.v, _mm256_cvtepi32_ps(truncated));
+        __m256i up = _mm256_castps_si256(_mm256_cmp_ps(fraction, _mm256_set1_ps(0.5f), _CMP_GE_OQ));
+        __m256i down = _mm256_castps_si256(_mm256_cmp_ps(fraction, _mm256_set1_ps(-0.5f), _CMP_LE_OQ));
+        return {_mm256_add_epi32(_mm256_sub_epi32(truncated, up), down)};
+    }
+    static F32 to_f32(const I32& a) { return {_mm256_cvtepi32_ps(a.v)}; }
+    static F32 pow2(const I32& n) {
+        return {_mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(n.v, _mm256_set1_epi32(127)), 23))};
+    }
+    static float reduce_max(const F32& a) {
+        __m128 r = _mm_max_ps(_mm256_castps256_ps128(a.v), _mm256_extractf128_ps(a.v, 1));
+        r = _mm_max_ps(r, _mm_movehl_ps(r, r));
+        return _mm_cvtss_f32(_mm_max_ss(r, _mm_shuffle_ps(r, r, 1)));
+    }
+    static float reduce_add(const F32& a) {
+        __m128 r = _mm_add_ps(_mm256_castps256_ps128(a.v), _mm256_extractf128_ps(a.v, 1));
+        r = _mm_add_ps(r, _mm_movehl_ps(r, r));
+        return _mm_cvtss_f32(_mm_add_ss(r, _mm_shuffle_ps(r, r, 1)));
+    }
+    static I32 ge(const F32& a, const F32& b) { return {_mm256_castps_si256(_mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ))}; }
+    static I32 min(const I32& a, const I32& b) { return {_mm256_min_epi32(a.v, b.v)}; }
+    static I32 bit_or(const I32& a, const I32& b) { return {_mm256_or_si256(a.v, b.v)}; }
+    static I32 bit_and(const I32& a, const I32& b) { return {_mm256_and_si256(a.v, b.v)}; }
+    static I32 select(const I32& mask, const I32& a, const I32& b) { return {_mm256_blendv_epi8(b.v, a.v, mask.v)}; }
+    static I32 sign(const I32& a) { return {_mm256_srai_epi32(a.v, 31)}; }
+    static void deinterleave16(const int8_t* src, int8_t* even, int8_t* odd) {
+        // Split in each 128 bits lane, then gather the even and odd halves of both lanes.
+        const __m256i split = _mm256_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15,
+                                               0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+        __m256i bytes = _mm256_shuffle_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)), split);
+        bytes = _mm256_permute4x64_epi64(bytes, 0xD8);  // 0, 2, 1, 3
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(even), _mm256_castsi256_si128(bytes));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(odd), _mm256_extracti128_si256(bytes, 1));
+    }
+};
+#endif
+
+#if defined(NEON_OPT)
+struct Neon {
+    static constexpr const char* name = "NEON";
+    static constexpr int LANES = 8;
+    struct F32 { float32x4_t lo, hi; };
+    struct I32 { int32x4_t lo, hi; };
+
+    static F32 dup(float value) { return {vdupq_n_f32(value), vdupq_n_f32(value)}; }
+    static I32 dup_i32(int32_t value) { return {vdupq_n_s32(value), vdupq_n_s32(value)}; }
+    static F32 load(const float* src) { return {vld1q_f32(src), vld1q_f32(src + 4)}; }
+    static F32 load(const int16_t* src) {
+        int16x8_t s16 = vld1q_s16(src);
+        return {vcvtq_f32_s32(vmovl_s16(vget_low_s16(s16))), vcvtq_f32_s32(vmovl_s16(vget_high_s16(s16)))};
+    }
+    static F32 load(const int8_t* src) {
+        int16x8_t s16 = vmovl_s8(vld1_s8(src));
+        return {vcvtq_f32_s32(vmovl_s16(vget_low_s16(s16))), vcvtq_f32_s32(vmovl_s16(vget_high_s16(s16)))};
+    }
+    static F32 load(const uint8_t* src) {
+        uint16x8_t u16 = vmovl_u8(vld1_u8(src));
+        return {vcvtq_f32_u32(vmovl_u16(vget_low_u16(u16))), vcvtq_f32_u32(vmovl_u16(vget_high_u16(u16)))};
+    }
+    static I32 load_i32(const uint32_t* src) {
+        return {vreinterpretq_s32_u32(vld1q_u32(src)), vreinterpretq_s32_u32(vld1q_u32(src + 4))};
+    }
+    static void store(float* dst, const F32& a) {
+        vst1q_f32(dst, a.lo);
+        vst1q_f32(dst + 4, a.hi);
+    }
+    static void store(uint32_t* dst, const I32& a) {
+        vst1q_u32(dst, vreinterpretq_u32_s32(a.lo));
+        vst1q_u32(dst + 4, vreinterpretq_u32_s32(a.hi));
+    }
+    static void store(int16_t* dst, const I32& a) { vst1q_s16(dst, vcombine_s16(vqmovn_s32(a.lo), vqmovn_s32(a.hi))); }
+    static void store(int8_t* dst, const I32& a) {
+        vst1_s8(dst, vqmovn_s16(vcombine_s16(vqmovn_s32(a.lo), vqmovn_s32(a.hi))));
+    }
+    static F32 add(const F32& a, const F32& b) { return {vaddq_f32(a.lo, b.lo), vaddq_f32(a.hi, b.hi)}; }
+    static F32 sub(const F32& a, const F32& b) { return {vsubq_f32(a.lo, b.lo), vsubq_f32(a.hi, b.hi)}; }
+    static F32 mul(const F32& a, const F32& b) { return {vmulq_f32(a.lo, b.lo), vmulq_f32(a.hi, b.hi)}; }
+    static F32 div(const F32& a, const F32& b) { return {div(a.lo, b.lo), div(a.hi, b.hi)}; }
+    static F32 max(const F32& a, const F32& b) { return {vmaxq_f32(a.lo, b.lo), vmaxq_f32(a.hi, b.hi)}; }
+    static F32 min(const F32& a, const F32& b) { return {vminq_f32(a.lo, b.lo), vminq_f32(a.hi, b.hi)}; }
+    static I32 round(const F32& a) { return {round(a.lo), round(a.hi)}; }
+    static F32 to_f32(const I32& a) { return {vcvtq_f32_s32(a.lo), vcvtq_f32_s32(a.hi)}; }
+    static F32 pow2(const I32& n) { return {pow2(n.lo), pow2(n.hi)}; }
+    static float reduce_max(const F32& a) {
+        float32x4_t r = vmaxq_f32(a.lo, a.hi);
+        float32x2_t half = vpmax_f32(vget_low_f32(r), vget_high_f32(r));
+        return vget_lane_f32(vpmax_f32(half, half), 0);
+    }
+    static float reduce_add(const F32& a) {
+        float32x4_t r = vaddq_f32(a.lo, a.hi);
+        float32x2_t half = vpadd_f32(vget_low_f32(r), vget_high_f32(r));
+        return vget_lane_f32(vpadd_f32(half, half), 0);
+    }
+    static I32 ge(const F32& a, const F32& b) {
+        return {vreinterpretq_s32_u32(vcgeq_f32(a.lo, b.lo)), vreinterpretq_s32_u32(vcgeq_f32(a.hi, b.hi))};
+    }
+    static I32 min(const I32& a, const I32& b) { return {vminq_s32(a.lo, b.lo), vminq_s32(a.hi, b.hi)}; }
+    static I32 bit_or(const I32& a, const I32& b) { return {vorrq_s32(a.lo, b.lo), vorrq_s32(a.hi, b.hi)}; }
+    static I32 bit_and(const I32& a, const I32& b) { return {vandq_s32(a.lo, b.lo), vandq_s32(a.hi, b.hi)}; }
+    static I32 select(const I32& mask, const I32& a, const I32& b) {
+        return {vbslq_s32(vreinterpretq_u32_s32(mask.lo), a.lo, b.lo),
+                vbslq_s32(vreinterpretq_u32_s32(mask.hi), a.hi, b.hi)};
+    }
+    static I32 sign(const I32& a) { return {vshrq_n_s32(a.lo, 31), vshrq_n_s32(a.hi, 31)}; }
+    static void deinterleave16(const int8_t* src, int8_t* even, int8_t* odd) {
+        int8x16x2_t pairs = vld2q_s8(src);
+        vst1q_s8(even, pairs.val[0]);
+        vst1q_s8(odd, pairs.val[1]);
+    }
+
+ private:
+    static int32x4_t round(float32x4_t a) {
+#if defined(__aarch64__)
+        return vcvtaq_s32_f32(a);  // to nearest, ties away from zero
+#else
+        int32x4_t truncated = vcvtq_s32_f32(a);
+        float32x4_t fraction = vsubq_f32(a, vcvtq_f32_s32(truncated));
+        int32x4_t up = vreinterpretq_s32_u32(vcgeq_f32(fraction, vdupq_n_f32(0.5f)));
+        int32x4_t down = vreinterpretq_s32_u32(vcleq_f32(fraction, vdupq_n_f32(-0.5f)));
+        return vaddq_s32(vsubq_s32(truncated, up), down);
+#endif
+    }
+    // Division of IEEE, not of the reciprocal estimate, which armv7 has only.
+    static float32x4_t div(float32x4_t a, float32x4_t b) {
+#if defined(__aarch64__)
+        return vdivq_f32(a, b);
+#else
+        float x[4], y[4];
+        vst1q_f32(x, a);
+        vst1q_f32(y, b);
+        for (int i = 0; i < 4; ++i) x[i] /= y[i];
+        return vld1q_f32(x);
+#endif
+    }
+    static float32x4_t pow2(int32x4_t n) { return vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(n, vdupq_n_s32(127)), 23)); }
+};
+#endif
+
+#if defined(NEON_OPT)
+using Native = Neon;
+#elif defined(__AVX2__)
+using Native = Avx2;
+#elif defined(__SSE4_1__)
+using Native = Sse4;
+#else
+using Native = Scalar;
+#endif
+
+}  // namespace simd
+}  // namespace cpu
+}  // namespace ud
+}  // namespace enn
@@ -21,6 +21,26 @@ namespace enn {
 namespace ud {
 namespace cpu {
 
+namespace {
+
+// Axis of ArgMax and ArgMin is the const input of INT32 or INT64, not an option.
+bool get_const_axis(const model::component::Operator::Ptr &operator_, int32_t *axis) {
+    for (auto &tensor : operator_->in_tensors) {
+        if (tensor->is_const()) {
+            auto param = std::static_pointer_cast<model::component::Parameter>(tensor);
+            if (param->get_data_type() == TFlite::TensorType_INT64) {
+                *axis = static_cast<int32_t>(*static_cast<const int64_t *>(param->get_buffer_addr()));
+            } else {
+                *axis = *static_cast<const int32_t *>(param->get_buffer_addr());
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
 /***************************************************************************************************************************
  * create_ud_operator() of Builtin Operators                                                                               *
  ***************************************************************************************************************************/
@@ -79,6 +99,142 @@ EnnReturn OperationConstructor::create_ud_operator<TFlite::BuiltinOperator::Buil
     return (ret_value == Status::SUCCESS) ? ENN_RET_SUCCESS : ENN_RET_FAILED;
 }
 
+template <>
+EnnReturn OperationConstructor::create_ud_operator<TFlite::BuiltinOperator::BuiltinOperator_LOG_SOFTMAX>(
+    const model::component::Operator::Ptr &operator_) {
+    ENN_DBG_PRINT("opr->code = %d\n", operator_->get_code());
+
+    std::string builtin_op_name = TFlite::EnumNameBuiltinOperator(operator_->get_code());
+    if (builtin_op_name.compare(operator_->get_name()) != 0) {
+        ENN_ERR_PRINT("Invalid BuiltinOperator : %s\n", builtin_op_name.c_str());
+        return ENN_RET_INVAL;
+    }
+
+    PrecisionType precision_type = PrecisionType::FP32;
+
+    std::vector<std::shared_ptr<ITensor>> in_tensors, out_tensors, data_tensors;
+
+    convert_to_tensors(operator_, precision_type, in_tensors, out_tensors, data_tensors);
+
+    // LogSoftmaxOptions has no option, it is over the last axis with beta 1.
+    float beta = 1.f;
+    int32_t axis = -1;
+
+    int32_t number = in_tensors[0]->getDim().n;
+    int32_t channel = in_tensors[0]->getDim().c;
+    int32_t height = in_tensors[0]->getDim().h;
+    int32_t width = in_tensors[0]->getDim().w;
+
+    const auto &softmax = compute_library->createSoftmax(precision_type);
+
+    Status ret_value = softmax->initialize(in_tensors[0], width, height, channel, number, beta, axis, true);
+
+    operators->push_back(std::make_shared<EnnUDOperator<ISoftmax>>(operator_->get_name(), operator_->get_id(), in_tensors,
+                                                                   out_tensors, data_tensors, softmax));
+
+    return (ret_value == Status::SUCCESS) ? ENN_RET_SUCCESS : ENN_RET_FAILED;
+}
+
+template <>
+EnnReturn OperationConstructor::create_ud_operator<TFlite::BuiltinOperator::BuiltinOperator_ARG_MAX>(
+    const model::component::Operator::Ptr &operator_) {
+    ENN_DBG_PRINT("opr->code = %d\n", operator_->get_code());
+
+    std::string builtin_op_name = TFlite::EnumNameBuiltinOperator(operator_->get_code());
+    if (builtin_op_name.compare(operator_->get_name()) != 0) {
+        ENN_ERR_PRINT("Invalid BuiltinOperator : %s\n", builtin_op_name.c_str());
+        return ENN_RET_INVAL;
+    }
+
+    if (operator_->get_option().get_enum() != TFlite::BuiltinOptions_ArgMaxOptions) {
+        ENN_ERR_PRINT("Invalid BuiltinOptions : %s\n", TFlite::EnumNameBuiltinOptions(operator_->get_option().get_enum()));
+        return ENN_RET_INVAL;
+    }
+
+    if (operator_->get_option().get_addr() == nullptr) {
+        ENN_ERR_PRINT("Invalid BuiltinOptions (null)\n");
+        return ENN_RET_INVAL;
+    }
+
+    // Indices are computed on the input of any data type, without dequantization.
+    auto options = reinterpret_cast<const TFlite::ArgMaxOptions *>(operator_->get_option().get_addr());
+    if (options->output_type() != TFlite::TensorType_INT32) {
+        ENN_ERR_PRINT("Unsupported output type : %s\n", TFlite::EnumNameTensorType(options->output_type()));
+        return ENN_RET_INVAL;
+    }
+
+    int32_t axis = 0;
+    if (!get_const_axis(operator_, &axis)) {
+        ENN_ERR_PRINT("Invalid axis (null)\n");
+        return ENN_RET_INVAL;
+    }
+
+    PrecisionType precision_type = PrecisionType::FP32;
+
+    std::vector<std::shared_ptr<ITensor>> in_tensors, out_tensors, data_tensors;
+
+    convert_to_tensors(operator_, precision_type, in_tensors, out_tensors, data_tensors);
+
+    const auto &arg_max = compute_library->createArgMax(precision_type);
+
+    Status ret_value = arg_max->initialize(in_tensors[0], axis, out_tensors[0]);
+
+    operators->push_back(std::make_shared<EnnUDOperator<IArgMax>>(operator_->get_name(), operator_->get_id(), in_tensors,
+                                                                  out_tensors, data_tensors, arg_max));
+
+    return (ret_value == Status::SUCCESS) ? ENN_RET_SUCCESS : ENN_RET_FAILED;
+}
+
+template <>
+EnnReturn OperationConstructor::create_ud_operator<TFlite::BuiltinOperator::BuiltinOperator_ARG_MIN>(
+    const model::component::Operator::Ptr &operator_) {
+    ENN_DBG_PRINT("opr->code = %d\n", operator_->get_code());
+
+    std::string builtin_op_name = TFlite::EnumNameBuiltinOperator(operator_->get_code());
+    if (builtin_op_name.compare(operator_->get_name()) != 0) {
+        ENN_ERR_PRINT("Invalid BuiltinOperator : %s\n", builtin_op_name.c_str());
+        return ENN_RET_INVAL;
+    }
+
+    if (operator_->get_option().get_enum() != TFlite::BuiltinOptions_ArgMinOptions) {
+        ENN_ERR_PRINT("Invalid BuiltinOptions : %s\n", TFlite::EnumNameBuiltinOptions(operator_->get_option().get_enum()));
+        return ENN_RET_INVAL;
+    }
+
+    if (operator_->get_option().get_addr() == nullptr) {
+        ENN_ERR_PRINT("Invalid BuiltinOptions (null)\n");
+        return ENN_RET_INVAL;
+    }
+
+    // Indices are computed on the input of any data type, without dequantization.
+    auto options = reinterpret_cast<const TFlite::ArgMinOptions *>(operator_->get_option().get_addr());
+    if (options->output_type() != TFlite::TensorType_INT32) {
+        ENN_ERR_PRINT("Unsupported output type : %s\n", TFlite::EnumNameTensorType(options->output_type()));
+        return ENN_RET_INVAL;
+    }
+
+    int32_t axis = 0;
+    if (!get_const_axis(operator_, &axis)) {
+        ENN_ERR_PRINT("Invalid axis (null)\n");
+        return ENN_RET_INVAL;
+    }
+
+    PrecisionType precision_type = PrecisionType::FP32;
+
+    std::vector<std::shared_ptr<ITensor>> in_tensors, out_tensors, data_tensors;
+
+    convert_to_tensors(operator_, precision_type, in_tensors, out_tensors, data_tensors);
+
+    const auto &arg_min = compute_library->createArgMin(precision_type);
+
+    Status ret_value = arg_min->initialize(in_tensors[0], axis, out_tensors[0]);
+
+    operators->push_back(std::make_shared<EnnUDOperator<IArgMin>>(operator_->get_name(), operator_->get_id(), in_tensors,
+                                                                  out_tensors, data_tensors, arg_min));
+
+    return (ret_value == Status::SUCCESS) ? ENN_RET_SUCCESS : ENN_RET_FAILED;
+}
+
 #ifndef SCHEMA_NNC_V1
 template <>
 EnnReturn OperationConstructor::create_ud_operator<TFlite::BuiltinOperator::BuiltinOperator_DEQUANTIZE>(
@@ -769,7 +925,8 @@ EnnReturn OperationConstructor::create_ud_operator<CustomOperator::CustomOperato
 
     const auto &concat = compute_library->createConcat(precision_type);
 
-    Status ret_value = concat->initialize({in_tensors[0], in_tensors[1]}, 2, number, channel, height, width, *axis);
+    Status ret_value = concat->initialize(in_tensors, static_cast<int32_t>(in_tensors.size()), number, channel, height,
+                                          width, *axis);
 
     operators->push_back(std::make_shared<EnnUDOperator<IConcat>>(operator_->get_name(), operator_->get_id(), in_tensors,
                                                                   out_tensors, data_tensors, concat));
@@ -881,6 +1038,7 @@ EnnReturn OperationConstructor::create_ud_operator<CustomOperator::CustomOperato
     std::vector<int32_t> pad_front;
     std::vector<int32_t> pad_end;
     std::vector<float> pad_val;
+    PadMode pad_mode = PadMode::CONSTANT;
 
     for (auto &tensor : operator_->in_tensors) {
         if (tensor->is_const()) {  // if tensor is const, the tensor is parameter.
@@ -906,13 +1064,20 @@ EnnReturn OperationConstructor::create_ud_operator<CustomOperator::CustomOperato
                      i++) {
                     pad_val.push_back(*(data + i));
                 }
+            } else if (param->get_name().compare("PAD_MODE") == 0) {
+                int32_t mode = *(int32_t *)(param->get_buffer_addr());
+                if (mode < static_cast<int32_t>(PadMode::CONSTANT) || mode > static_cast<int32_t>(PadMode::EDGE)) {
+                    ENN_ERR_PRINT("Invalid PAD_MODE : %d\n", mode);
+                    return ENN_RET_INVAL;
+                }
+                pad_mode = static_cast<PadMode>(mode);
             }
         }
     }
 
     const auto &pad = compute_library->createPad(precision_type);
 
-    Status ret_value = pad->initialize(in_tensors[0], width, height, channel, pad_front, pad_end, pad_val);
+    Status ret_value = pad->initialize(in_tensors[0], width, height, channel, pad_front, pad_end, pad_val, pad_mode);
 
     operators->push_back(std::make_shared<EnnUDOperator<IPad>>(operator_->get_name(), operator_->get_id(), in_tensors,
                                                                out_tensors, data_tensors, pad));
@@ -970,6 +1135,12 @@ OperationConstructor::OperationConstructor(std::shared_ptr<NEONComputeLibrary> c
     builtin_op_map = {
         {TFlite::BuiltinOperator::BuiltinOperator_SOFTMAX,
          &OperationConstructor::create_ud_operator<TFlite::BuiltinOperator::BuiltinOperator_SOFTMAX>},
+        {TFlite::BuiltinOperator::BuiltinOperator_LOG_SOFTMAX,
+         &OperationConstructor::create_ud_operator<TFlite::BuiltinOperator::BuiltinOperator_LOG_SOFTMAX>},
+        {TFlite::BuiltinOperator::BuiltinOperator_ARG_MAX,
+         &OperationConstructor::create_ud_operator<TFlite::BuiltinOperator::BuiltinOperator_ARG_MAX>},
+        {TFlite::BuiltinOperator::BuiltinOperator_ARG_MIN,
+         &OperationConstructor::create_ud_operator<TFlite::BuiltinOperator::BuiltinOperator_ARG_MIN>},
 #ifndef SCHEMA_NNC_V1
         {TFlite::BuiltinOperator::BuiltinOperator_DEQUANTIZE,
          &OperationConstructor::create_ud_operator<TFlite::BuiltinOperator::BuiltinOperator_DEQUANTIZE>},
@@ -1038,6 +1209,118 @@ EnnReturn OperationConstructor::create_ud_operator(const model::component::Opera
     return ENN_RET_FAILED;
 }
 
+namespace {
+
+template <typename I, typename T>
+bool get_pipeline_stage(const std::shared_ptr<UDOperator> &ud_operator, PipelineStage *stage) {
+    auto ud_op = std::dynamic_pointer_cast<EnnUDOperator<I>>(ud_operator);
+    if (!ud_op || ud_op->getInTensors().size() != 1) {
+        return false;
+    }
+    auto op = std::dynamic_pointer_cast<T>(ud_op->getOp());
+    return op && op->getPipelineStage(ud_op->getInTensors()[0], stage);
+}
+
+bool get_pipeline_stage(const std::shared_ptr<UDOperator> &ud_operator, PipelineStage *stage) {
+    return get_pipeline_stage<INormalization, Normalization>(ud_operator, stage) ||
+           get_pipeline_stage<IDequantization, NEONDequantization>(ud_operator, stage) ||
+           get_pipeline_stage<IAsymmDequantization, AsymmDequantization>(ud_operator, stage) ||
+           get_pipeline_stage<IQuantization, Quantization>(ud_operator, stage) ||
+           get_pipeline_stage<IAsymmQuantization, AsymmQuantization>(ud_operator, stage);
+}
+
+std::shared_ptr<Softmax> get_fusable_softmax(const std::shared_ptr<UDOperator> &ud_operator) {
+    auto ud_op = std::dynamic_pointer_cast<EnnUDOperator<ISoftmax>>(ud_operator);
+    if (!ud_op || ud_op->getOutTensors().size() != 1 || ud_op->getOutTensors()[0]->getDataType() != DataType::FLOAT) {
+        return nullptr;
+    }
+    return std::dynamic_pointer_cast<Softmax>(ud_op->getOp());
+}
+
+// The only output of prev is a float intermediate feature map, which is the only input of next and read by
+// nothing else, so it is not needed when both are fused.
+bool is_fusable(const model::component::Operator::Ptr &prev, const std::shared_ptr<UDOperator> &prev_ud,
+                const std::shared_ptr<UDOperator> &next_ud) {
+    auto outputs = prev_ud->getOutTensors();
+    auto inputs = next_ud->getInTensors();
+    if (outputs.size() != 1 || inputs.size() != 1 || outputs[0]->get_buffer_index() != inputs[0]->get_buffer_index() ||
+        outputs[0]->getDataType() != DataType::FLOAT ||
+        outputs[0]->getTotalSizeFromDims() != inputs[0]->getTotalSizeFromDims()) {
+        return false;
+    }
+    for (auto &out_tensor : prev->out_tensors) {
+        if (!out_tensor->is_const()) {
+            auto ofm = std::static_pointer_cast<model::component::FeatureMap>(out_tensor);
+            return ofm->get_type() == model::component::FeatureMap::Type::INTERMEDIATE && ofm->next().count() == 1;
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
+EnnReturn OperationConstructor::fuse_ud_operators(const model::component::OperatorList &operator_list) {
+    std::vector<model::component::Operator::Ptr> model_operators;
+    for (auto &&opr : operator_list) {
+        model_operators.push_back(std::static_pointer_cast<model::component::Operator>(opr));
+    }
+    if (!operators || operators->size() != model_operators.size()) {
+        ENN_DBG_PRINT("Operators are not one-to-one with the model, not fused\n");
+        return ENN_RET_SUCCESS;
+    }
+
+    auto fused_operators = std::make_shared<std::vector<std::shared_ptr<UDOperator>>>();
+    for (size_t begin = 0; begin < operators->size();) {
+        // Steps of element-wise operators, where only the last one may quantize, and a softmax after float steps.
+        std::vector<PipelineStage> stages;
+        std::shared_ptr<Softmax> softmax;
+        size_t end = begin;
+        for (PipelineStage stage; end < operators->size(); ++end, stage = PipelineStage()) {
+            if (end > begin && (stages.back().type != PipelineStage::Type::AFFINE ||
+                                !is_fusable(model_operators[end - 1], (*operators)[end - 1], (*operators)[end]))) {
+                break;
+            }
+            if (get_pipeline_stage((*operators)[end], &stage)) {
+                stages.push_back(stage);
+            } else {
+                softmax = (end > begin) ? get_fusable_softmax((*operators)[end]) : nullptr;
+                end += softmax ? 1 : 0;
+                break;
+            }
+        }
+
+        std::shared_ptr<NEONFusedPipeline> pipeline;
+        if (end - begin >= 2) {
+            pipeline =
+                std::static_pointer_cast<NEONFusedPipeline>(compute_library->createFusedPipeline(PrecisionType::FP32));
+            const auto &input = (*operators)[begin]->getInTensors()[0];
+            if (pipeline->initialize(input, stages, softmax) != Status::SUCCESS) {
+                pipeline = nullptr;
+            }
+        }
+        if (!pipeline) {
+            fused_operators->push_back((*operators)[begin++]);
+            continue;
+        }
+
+        std::string name;
+        std::vector<std::shared_ptr<ITensor>> data_tensors;
+        for (size_t i = begin; i < end; ++i) {
+            name += (i == begin ? "" : "+") + (*operators)[i]->getName();
+            auto op_data_tensors = (*operators)[i]->getDataTensors();
+            data_tensors.insert(data_tensors.end(), op_data_tensors.begin(), op_data_tensors.end());
+        }
+        ENN_DBG_PRINT("Fused %zu operators : %s\n", end - begin, name.c_str());
+        fused_operators->push_back(std::make_shared<EnnUDOperator<IFusedPipeline>>(
+            name, (*operators)[begin]->getId(), (*operators)[begin]->getInTensors(),
+            (*operators)[end - 1]->getOutTensors(), data_tensors, pipeline));
+        begin = end;
+    }
+    operators = fused_operators;
+
+    return ENN_RET_SUCCESS;
+}
+
 void OperationConstructor::convert_to_tensors(const model::component::Operator::Ptr &operator_,
                                               PrecisionType &precision_type,
                                               std::vector<std::shared_ptr<ITensor>> &in_tensors,
@@ -37,6 +37,10 @@ public:
 
     EnnReturn create_ud_operator(const model::component::Operator::Ptr &operator_) override;
 
+    // Chains of element-wise operators, e.g. Normalization and Quantization, or Dequantization and Softmax,
+    // are replaced with a FusedPipeline when their intermediate feature maps are read by nothing else.
+    EnnReturn fuse_ud_operators(const model::component::OperatorList &operator_list) override;
+
     template <TFlite::BuiltinOperator builtin_op>
     EnnReturn create_ud_operator(const model::component::Operator::Ptr &operator_);
 
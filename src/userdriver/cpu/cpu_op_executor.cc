@@ -15,11 +15,13 @@
 namespace enn {
 namespace ud {
 
+DEFINE_EXECUTOR(IArgMax, BUF_IN(0), BUF_OUT(0))
+DEFINE_EXECUTOR(IArgMin, BUF_IN(0), BUF_OUT(0))
 DEFINE_EXECUTOR(IAsymmDequantization, BUF_IN(0), BUF_OUT(0))
 DEFINE_EXECUTOR(IAsymmQuantization, BUF_IN(0), BUF_OUT(0))
 DEFINE_EXECUTOR(ICFUConverter, BUF_IN(0), BUF_OUT(0))
 DEFINE_EXECUTOR(ICFUInverter, BUF_IN(0), BUF_OUT(0))
-DEFINE_EXECUTOR(IConcat, {BUF_IN(0), BUF_IN(1)}, BUF_OUT(0))
+DEFINE_EXECUTOR(IConcat, BUF_IN_ALL(), BUF_OUT(0))
 DEFINE_EXECUTOR(IDequantization, BUF_IN(0), BUF_OUT(0))
 #if 0  // Required, ToDo(empire.jung, 8/31): Legacy SSD, remove after deciding to use priorbox
 DEFINE_EXECUTOR(IDetection, BUF_IN(1), BUF_IN(2), BUF_IN(0), BUF_OUT(0))
@@ -27,6 +29,7 @@ DEFINE_EXECUTOR(IDetection, BUF_IN(1), BUF_IN(2), BUF_IN(0), BUF_OUT(0))
 DEFINE_EXECUTOR(IDetection, BUF_IN(0), BUF_IN(1), ARG_DATA(0), BUF_OUT(0))
 #endif
 DEFINE_EXECUTOR(IFlatten, BUF_IN(0), BUF_OUT(0))
+DEFINE_EXECUTOR(IFusedPipeline, BUF_IN(0), BUF_OUT(0))
 DEFINE_EXECUTOR(INormalization, BUF_IN(0), BUF_OUT(0))
 DEFINE_EXECUTOR(INormalQuantization, BUF_IN(0), BUF_OUT(0))
 DEFINE_EXECUTOR(IPad, BUF_IN(0), BUF_OUT(0))
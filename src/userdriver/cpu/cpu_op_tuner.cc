@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2021 Samsung Electronics Co. LTD
+ *
+ * This software is proprietary of Samsung Electronics.
+ * No part of this software, either material or conceptual may be copied or
+ * distributed, transmitted, transcribed, stored in a retrieval system or
+ * translated into any human or computer language in any form by any means,
+ * electronic, mechanical, manual or otherwise, or disclosed to third parties
+ * without the express written permission of Samsung Electronics.
+ */
+
+#include "userdriver/cpu/cpu_op_tuner.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+#include "common/enn_debug.h"
+
+namespace enn {
+namespace ud {
+namespace cpu {
+
+namespace {
+
+void append_tensors(std::ostringstream& signature, const std::vector<std::shared_ptr<ITensor>>& tensors) {
+    signature << "(";
+    for (size_t i = 0; i < tensors.size(); ++i) {
+        if (i > 0) signature << ",";
+        signature << static_cast<int>(tensors[i]->getDataType()) << ":";
+        const auto& dims = tensors[i]->getDims();
+        for (size_t d = 0; d < dims.size(); ++d) signature << (d > 0 ? "x" : "") << dims[d];
+    }
+    signature << ")";
+}
+
+}  // namespace
+
+std::string OperationTuner::get_signature(const std::shared_ptr<UDOperator>& op, uint32_t thread_num) {
+    std::ostringstream signature;
+    for (char c : op->getName()) signature << (std::isspace(static_cast<unsigned char>(c)) ? '_' : c);
+    append_tensors(signature, op->getInTensors());
+    signature << "->";
+    append_tensors(signature, op->getOutTensors());
+    signature << "/" << thread_num;
+    return signature.str();
+}
+
+EnnReturn OperationTuner::tune(UDOperators& operators, ThreadPool* pool, uint32_t thread_num, uint32_t core_affinity) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    load();
+
+    // Loops on a thread have nothing to tune.
+    thread_num = std::min(thread_num, pool->get_thread_num());
+    if (thread_num <= 1) return ENN_RET_SUCCESS;
+
+    bool is_updated = false;
+    for (auto& op : *operators) {
+        const std::string signature = get_signature(op, thread_num);
+        auto cached = cache_.find(signature);
+        TuningConfig config;
+        if (cached != cache_.end()) {
+            config = cached->second;
+        } else if (measure(op, pool, thread_num, core_affinity, &config)) {
+            cache_.emplace(signature, config);
+            is_updated = true;
+            ++measured_num_;
+        } else {
+            ENN_WARN_PRINT("%s is not tuned\n", signature.c_str());
+            continue;
+        }
+        ENN_DBG_PRINT("%s: thread_num = %u, grain_scale = %u\n", signature.c_str(), config.thread_num,
+                      config.grain_scale);
+        op = std::make_shared<TunedUDOperator>(op, config);
+    }
+
+    return is_updated ? save() : ENN_RET_SUCCESS;
+}
+
+bool OperationTuner::measure(const std::shared_ptr<UDOperator>& op, ThreadPool* pool, uint32_t thread_num,
+                             uint32_t core_affinity, TuningConfig* config) {
+    // Tensors of the operator have their own buffers, which are not used by executions.
+    auto buffer = std::make_shared<UDBuffer>();
+    buffer->in = op->getInTensors();
+    buffer->out = op->getOutTensors();
+    buffer->data = op->getDataTensors();
+
+    auto time_of = [&](const TuningConfig& candidate, double* ms) {
+        ParallelScope scope(pool, candidate.thread_num, candidate.grain_scale, core_affinity);
+        *ms = std::numeric_limits<double>::max();
+        for (int i = 0; i <= REPEAT; ++i) {  // the first is a warm up
+            auto start = std::chrono::steady_clock::now();
+            if (op->execute(buffer) != ENN_RET_SUCCESS) return false;
+            auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start);
+            if (i > 0) *ms = std::min(*ms, elapsed.count());
+        }
+        return true;
+    };
+
+    *config = {thread_num, 1};
+    double best_ms;
+    if (!time_of(*config, &best_ms)) return false;
+    const double default_ms = best_ms;
+
+    std::vector<uint32_t> thread_nums;
+    for (uint32_t num = 1; num < thread_num; num *= 2) thread_nums.push_back(num);
+    thread_nums.push_back(thread_num);
+    for (uint32_t num : thread_nums) {
+        for (uint32_t grain_scale : {1u, 4u, 16u}) {
+            TuningConfig candidate{num, grain_scale};
+            double ms;
+            if ((num == thread_num && grain_scale == 1) || !time_of(candidate, &ms)) continue;
+            if (ms < best_ms && ms < default_ms * (1.0 - MIN_GAIN)) {
+                best_ms = ms;
+                *config = candidate;
+            }
+        }
+    }
+    ENN_INFO_PRINT("%s: %.3f ms by default, %.3f ms on %u threads by grain x%u\n", op->getName().c_str(), default_ms,
+                   best_ms, config->thread_num, config->grain_scale);
+    return true;
+}
+
+void OperationTuner::load() {
+    if (loaded_) return;
+    loaded_ = true;
+    if (cache_path_.empty()) return;
+
+    std::ifstream file(cache_path_);
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream fields(line);
+        std::string signature;
+        TuningConfig config;
+        if (fields >> signature >> config.thread_num >> config.grain_scale && config.thread_num > 0 &&
+            config.grain_scale > 0) {
+            cache_[signature] = config;
+        }
+    }
+    ENN_DBG_PRINT("%zu configs are loaded from %s\n", cache_.size(), cache_path_.c_str());
+}
+
+EnnReturn OperationTuner::save() {
+    if (cache_path_.empty()) return ENN_RET_SUCCESS;
+    // Written to a temporary file and renamed, so that a reader never sees a part of it.
+    const std::string temp_path = cache_path_ + ".tmp";
+    {
+        std::ofstream file(temp_path, std::ios::trunc);
+        for (auto& entry : cache_) {
+            file << entry.first << " " << entry.second.thread_num << " " << entry.second.grain_scale << "\n";
+        }
+        if (!file.good()) {
+            ENN_WARN_PRINT("Can not write %s\n", temp_path.c_str());
+            return ENN_RET_FAILED;
+        }
+    }
+    if (std::rename(temp_path.c_str(), cache_path_.c_str()) != 0) {
+        ENN_WARN_PRINT("Can not write %s\n", cache_path_.c_str());
+        std::remove(temp_path.c_str());
+        return ENN_RET_FAILED;
+    }
+    return ENN_RET_SUCCESS;
+}
+
+}  // namespace cpu
+}  // namespace ud
+}  // namespace enn
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2021 Samsung Electronics Co. LTD
+ *
+ * This software is proprietary of Samsung Electronics.
+ * No part of this software, either material or conceptual may be copied or
+ * distributed, transmitted, transcribed, stored in a retrieval system or
+ * translated into any human or computer language in any form by any means,
+ * electronic, mechanical, manual or otherwise, or disclosed to third parties
+ * without the express written permission of Samsung Electronics.
+ */
+
+/**
+ * @file    cpu_op_tuner.h
+ * @brief   This is ENN CPU Userdriver Operation Tuner API
+ * @details This header defines the autotuning of loops of CPU operators.
+ */
+#ifndef USERDRIVER_CPU_CPU_OP_TUNER_H_
+#define USERDRIVER_CPU_CPU_OP_TUNER_H_
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "userdriver/common/operator_interfaces/userdriver_operator.h"
+#include "userdriver/cpu/common/NEONThreadPool.hpp"
+
+namespace enn {
+namespace ud {
+namespace cpu {
+
+// Loops of an operator run on thread_num threads at most, by grain_scale times of the grain of the operator.
+struct TuningConfig {
+    uint32_t thread_num;
+    uint32_t grain_scale;
+};
+
+// OperationTuner times candidate configs of each operator for its shapes, on the tensors of the operator, and
+// keeps the fastest by signature of the operator. The cache is a text file of "signature thread_num grain_scale"
+// lines, so that later opens reuse the configs without measuring. With an empty cache_path, configs are kept
+// only in the tuner.
+class OperationTuner {
+public:
+    static constexpr int REPEAT = 3;
+    // A candidate replaces the default config, all threads by the grain of the operator, if it is faster by this.
+    static constexpr double MIN_GAIN = 0.05;
+
+    explicit OperationTuner(const std::string& cache_path) : cache_path_(cache_path), loaded_(false), measured_num_(0) {}
+
+    // Replace the operators by ones running with their configs, on thread_num threads of the pool at most.
+    //  They are measured on the cores of core_affinity, where they are executed.
+    EnnReturn tune(UDOperators& operators, ThreadPool* pool, uint32_t thread_num, uint32_t core_affinity = 0);
+
+    // Name, data types and dims of the tensors of the operator, and threads, e.g. "Softmax(0:1x21x1x1)->(0:1x21x1x1)/8"
+    static std::string get_signature(const std::shared_ptr<UDOperator>& op, uint32_t thread_num);
+
+    // Number of operators measured so far, not found in the cache.
+    size_t get_measured_num() const {
+        return measured_num_;
+    }
+
+private:
+    void load();
+    EnnReturn save();
+    bool measure(const std::shared_ptr<UDOperator>& op, ThreadPool* pool, uint32_t thread_num, uint32_t core_affinity,
+                 TuningConfig* config);
+
+    std::string cache_path_;
+    std::mutex mutex_;
+    std::map<std::string, TuningConfig> cache_;
+    bool loaded_;
+    size_t measured_num_;
+};
+
+// Operator running the loops of another with its config, in the ParallelScope of the caller.
+class TunedUDOperator : public UDOperator {
+public:
+    TunedUDOperator(const std::shared_ptr<UDOperator>& op, const TuningConfig& config)
+        : UDOperator(op->getName(), op->getId(), op->getInTensors(), op->getOutTensors(), op->getDataTensors(),
+                     op->isSupportFP32InputForFP16(), op->isSupportCPUOutputForFP16()),
+          op_(op),
+          config_(config) {}
+
+    EnnReturn execute(const std::shared_ptr<UDBuffer>& buffer) override {
+        const auto context = ParallelScope::current();
+        ParallelScope scope(context.pool, std::min(context.thread_num, config_.thread_num), config_.grain_scale,
+                            context.core_affinity);
+        return op_->execute(buffer);
+    }
+
+    EnnReturn release() override {
+        return op_->release();
+    }
+
+    const TuningConfig& get_config() const {
+        return config_;
+    }
+
+private:
+    std::shared_ptr<UDOperator> op_;
+    TuningConfig config_;
+};
+
+}  // namespace cpu
+}  // namespace ud
+}  // namespace enn
+
+#endif  // USERDRIVER_CPU_CPU_OP_TUNER_H_
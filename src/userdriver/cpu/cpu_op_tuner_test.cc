@@ -0,0 +1,179 @@
+/*
+ * Copyright (C) 2021 Samsung Electronics Co. LTD
+ *
+ * This software is proprietary of Samsung Electronics.
+ * No part of this software, either material or conceptual may be copied or
+ * distributed, transmitted, transcribed, stored in a retrieval system or
+ * translated into any human or computer language in any form by any means,
+ * electronic, mechanical, manual or otherwise, or disclosed to third parties
+ * without the express written permission of Samsung Electronics.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "userdriver/cpu/common/NEONTensor.hpp"
+#include "userdriver/cpu/cpu_op_tuner.h"
+
+namespace enn {
+namespace ud {
+namespace cpu {
+
+// Operator summing its input in a loop, which records the loops it runs.
+class LoopOperator : public UDOperator {
+public:
+    LoopOperator(const std::string& name, const NDims& dims, bool is_failing = false)
+        : UDOperator(name, 0, {std::make_shared<NEONTensor<float>>(dims, PrecisionType::FP32)},
+                     {std::make_shared<NEONTensor<int8_t>>(dims, PrecisionType::INT8)}, {}),
+          is_failing_(is_failing) {}
+
+    EnnReturn execute(const std::shared_ptr<UDBuffer>& buffer) override {
+        ++executions;
+        thread_num = ParallelScope::current().thread_num;
+        grain_scale = ParallelScope::current().grain_scale;
+        auto input = std::static_pointer_cast<NEONTensor<float>>(buffer->in[0])->getBufferPtr();
+        std::atomic<size_t> count{0};
+        parallel_for(buffer->in[0]->getTotalSizeFromDims(), 64, [&](size_t begin, size_t end) {
+            float sum = 0;
+            for (size_t i = begin; i < end; ++i) sum += input[i];
+            count += (end - begin) + (sum != 0);
+        });
+        return is_failing_ ? ENN_RET_FAILED : ENN_RET_SUCCESS;
+    }
+
+    EnnReturn release() override {
+        return ENN_RET_SUCCESS;
+    }
+
+    int executions = 0;
+    uint32_t thread_num = 0;
+    uint32_t grain_scale = 0;
+
+private:
+    bool is_failing_;
+};
+
+class ENN_GT_UNIT_TEST_CPU_OP_TUNER : public testing::Test {
+protected:
+    void SetUp() override {
+        cache_path_ = testing::TempDir() + "cpu_tuning.cache";
+        std::remove(cache_path_.c_str());
+    }
+
+    void TearDown() override {
+        std::remove(cache_path_.c_str());
+    }
+
+    static UDOperators create_operators(const std::shared_ptr<UDOperator>& op) {
+        return std::make_shared<std::vector<std::shared_ptr<UDOperator>>>(1, op);
+    }
+
+    std::string cache_path_;
+};
+
+TEST_F(ENN_GT_UNIT_TEST_CPU_OP_TUNER, signature_of_shapes) {
+    auto op = std::make_shared<LoopOperator>("Loop Op", NDims{1, 3, 4, 5});
+    std::string expected = "Loop_Op(" + std::to_string(static_cast<int>(DataType::FLOAT)) + ":1x3x4x5)->(" +
+                           std::to_string(static_cast<int>(DataType::INT8)) + ":1x3x4x5)/4";
+    EXPECT_EQ(OperationTuner::get_signature(op, 4), expected);
+    EXPECT_NE(OperationTuner::get_signature(op, 2), expected);
+    EXPECT_NE(OperationTuner::get_signature(std::make_shared<LoopOperator>("Loop Op", NDims{1, 3, 5, 4}), 4), expected);
+}
+
+TEST_F(ENN_GT_UNIT_TEST_CPU_OP_TUNER, reuses_cached_config) {
+    ThreadPool pool(4);
+    auto op = std::make_shared<LoopOperator>("Loop", NDims{1, 16, 64, 64});
+    auto operators = create_operators(op);
+    OperationTuner tuner(cache_path_);
+    EXPECT_EQ(tuner.tune(operators, &pool, 4), ENN_RET_SUCCESS);
+    EXPECT_EQ(tuner.get_measured_num(), 1);
+    EXPECT_GT(op->executions, 1);
+    auto tuned = std::dynamic_pointer_cast<TunedUDOperator>(operators->at(0));
+    ASSERT_NE(tuned, nullptr);
+    EXPECT_LE(tuned->get_config().thread_num, 4);
+
+    std::ifstream file(cache_path_);
+    std::string signature;
+    TuningConfig config{0, 0};
+    file >> signature >> config.thread_num >> config.grain_scale;
+    EXPECT_EQ(signature, OperationTuner::get_signature(op, 4));
+    EXPECT_EQ(config.thread_num, tuned->get_config().thread_num);
+    EXPECT_EQ(config.grain_scale, tuned->get_config().grain_scale);
+
+    // Another open of the same shapes is not measured.
+    auto reopened = std::make_shared<LoopOperator>("Loop", NDims{1, 16, 64, 64});
+    operators = create_operators(reopened);
+    OperationTuner loaded(cache_path_);
+    EXPECT_EQ(loaded.tune(operators, &pool, 4), ENN_RET_SUCCESS);
+    EXPECT_EQ(loaded.get_measured_num(), 0);
+    EXPECT_EQ(reopened->executions, 0);
+    tuned = std::dynamic_pointer_cast<TunedUDOperator>(operators->at(0));
+    ASSERT_NE(tuned, nullptr);
+    EXPECT_EQ(tuned->get_config().thread_num, config.thread_num);
+    EXPECT_EQ(tuned->get_config().grain_scale, config.grain_scale);
+}
+
+TEST_F(ENN_GT_UNIT_TEST_CPU_OP_TUNER, keeps_configs_in_tuner_without_cache_path) {
+    ThreadPool pool(4);
+    OperationTuner tuner("");
+    auto op = std::make_shared<LoopOperator>("Loop", NDims{1, 16, 64, 64});
+    auto operators = create_operators(op);
+    EXPECT_EQ(tuner.tune(operators, &pool, 4), ENN_RET_SUCCESS);
+    EXPECT_EQ(tuner.get_measured_num(), 1);
+    EXPECT_FALSE(std::ifstream(cache_path_).good());
+
+    // Another open in the process is not measured.
+    auto reopened = std::make_shared<LoopOperator>("Loop", NDims{1, 16, 64, 64});
+    operators = create_operators(reopened);
+    EXPECT_EQ(tuner.tune(operators, &pool, 4), ENN_RET_SUCCESS);
+    EXPECT_EQ(tuner.get_measured_num(), 1);
+    EXPECT_EQ(reopened->executions, 0);
+}
+
+TEST_F(ENN_GT_UNIT_TEST_CPU_OP_TUNER, runs_with_config_in_scope) {
+    ThreadPool pool(4);
+    auto op = std::make_shared<LoopOperator>("Loop", NDims{1, 1, 32, 32});
+    TunedUDOperator tuned(op, {2, 16});
+    auto buffer = std::make_shared<UDBuffer>();
+    buffer->in = op->getInTensors();
+    buffer->out = op->getOutTensors();
+    {
+        ParallelScope scope(&pool, 4);
+        EXPECT_EQ(tuned.execute(buffer), ENN_RET_SUCCESS);
+        EXPECT_EQ(op->thread_num, 2);
+        EXPECT_EQ(op->grain_scale, 16);
+        EXPECT_EQ(ParallelScope::current().thread_num, 4);
+        EXPECT_EQ(ParallelScope::current().grain_scale, 1);
+    }
+    {
+        // Cores of the operator list bound the threads.
+        ParallelScope scope(&pool, 1);
+        EXPECT_EQ(tuned.execute(buffer), ENN_RET_SUCCESS);
+        EXPECT_EQ(op->thread_num, 1);
+    }
+}
+
+TEST_F(ENN_GT_UNIT_TEST_CPU_OP_TUNER, keeps_failing_operator) {
+    ThreadPool pool(4);
+    auto op = std::make_shared<LoopOperator>("Loop", NDims{1, 1, 8, 8}, true);
+    auto operators = create_operators(op);
+    OperationTuner tuner(cache_path_);
+    EXPECT_EQ(tuner.tune(operators, &pool, 4), ENN_RET_SUCCESS);
+    EXPECT_EQ(tuner.get_measured_num(), 0);
+    EXPECT_EQ(operators->at(0), op);
+    EXPECT_FALSE(std::ifstream(cache_path_).good());
+
+    // Nothing to tune on a thread.
+    auto single = std::make_shared<LoopOperator>("Loop", NDims{1, 1, 8, 8});
+    operators = create_operators(single);
+    EXPECT_EQ(tuner.tune(operators, &pool, 1), ENN_RET_SUCCESS);
+    EXPECT_EQ(single->executions, 0);
+    EXPECT_EQ(operators->at(0), single);
+}
+
+}  // namespace cpu
+}  // namespace ud
+}  // namespace enn
@@ -10,6 +10,7 @@
  */
 
 #include "common/enn_debug.h"
+#include "common/enn_utils.h"
 #include "userdriver/cpu/cpu_userdriver.h"
 #include "userdriver/cpu/common/NEONComputeLibrary.h"
 #include "tool/profiler/include/ExynosNnProfilerApi.h"
@@ -20,6 +21,14 @@ namespace ud {
 
 namespace cpu {
 
+// Number of threads running a CPU operator, including the caller. Default is the number of cores(8 at most).
+const std::string CPU_THREAD_NUM_PROPERTY{"vendor.enn.cpu.threads"};
+// Non-zero to time threads and grains of each operator at OpenSubGraph, and keep the fastest.
+const std::string CPU_TUNING_PROPERTY{"vendor.enn.cpu.tuning"};
+// Path of the file the configs are kept in across processes, e.g. /data/vendor/enn/cpu_tuning.cache.
+//  Without it, they are kept only in the process.
+const std::string CPU_TUNING_CACHE_PROPERTY{"vendor.enn.cpu.tuning.cache"};
+
 CpuUserDriver& CpuUserDriver::get_instance(void) {
     static CpuUserDriver cpu_userdriver_instance;
     return cpu_userdriver_instance;
@@ -32,6 +41,8 @@ CpuUserDriver::~CpuUserDriver(void) {
 
     op_executor.reset();
 
+    thread_pool.reset();
+
     ENN_DBG_PRINT("ended successfully\n");
 }
 
@@ -44,6 +55,25 @@ EnnReturn CpuUserDriver::Initialize(void) {
     std::lock_guard<std::mutex> lock_guard_exec_buffers_map(mutex_exec_buffers_map);
     exec_buffers_map.clear();
 
+    uint64_t thread_num = ThreadPool::get_default_thread_num();
+    if (util::get_environment_property(CPU_THREAD_NUM_PROPERTY, &thread_num) == ENN_RET_SUCCESS) {
+        ENN_INFO_PRINT("%s = %" PRIu64 "\n", CPU_THREAD_NUM_PROPERTY.c_str(), thread_num);
+    }
+    thread_num = std::min<uint64_t>(thread_num, ThreadPool::MAX_THREADS);
+    thread_pool = std::make_unique<ThreadPool>(static_cast<uint32_t>(thread_num));
+    ENN_DBG_PRINT("thread_num = %u\n", thread_pool->get_thread_num());
+
+    uint64_t tuning = 0;
+    if (util::get_environment_property(CPU_TUNING_PROPERTY, &tuning) == ENN_RET_SUCCESS && tuning != 0) {
+        std::string cache_path;
+        util::get_environment_property(CPU_TUNING_CACHE_PROPERTY, &cache_path);
+        ENN_INFO_PRINT("%s = %" PRIu64 ", cache: %s\n", CPU_TUNING_PROPERTY.c_str(), tuning,
+                       cache_path.empty() ? "(not kept)" : cache_path.c_str());
+        op_tuner = std::make_unique<OperationTuner>(cache_path);
+    } else {
+        op_tuner.reset();
+    }
+
     auto compute_library = std::make_shared<NEONComputeLibrary>();
 
     op_constructor = std::unique_ptr<IOperationConstructor>(std::make_unique<OperationConstructor>(compute_library));
@@ -65,10 +95,32 @@ EnnReturn CpuUserDriver::OpenSubGraph(const model::component::OperatorList& oper
         }
     }
 
+    EnnReturn ret = op_constructor->fuse_ud_operators(operator_list);
+    if (ret != ENN_RET_SUCCESS) {
+        return ret;
+    }
+
     uint64_t operator_list_id = operator_list.get_id().get();
-    ENN_DBG_PRINT("operator_list_id = 0x%" PRIx64 "\n", operator_list_id);
+    ENN_DBG_PRINT("operator_list_id = 0x%" PRIx64 ", core_affinity = 0x%X\n", operator_list_id,
+                  operator_list.get_core_affinity());
+
+    UDOperators operators = op_constructor->get_ud_operators();
+    if (op_tuner != nullptr) {
+        // Measured as executed, on the cores of the operator list.
+        uint32_t core_affinity = operator_list.get_core_affinity();
+        if (op_tuner->tune(operators, thread_pool.get(), get_thread_num(core_affinity), core_affinity) !=
+            ENN_RET_SUCCESS) {
+            ENN_WARN_PRINT("Tuning of operator_list_id = 0x%" PRIx64 " is not saved\n", operator_list_id);
+        }
+    }
 
-    return add_ud_operators(operator_list_id, op_constructor->get_ud_operators());
+    ret = add_ud_operators(operator_list_id, operators);
+    if (ret == ENN_RET_SUCCESS) {
+        std::lock_guard<std::mutex> lock_guard(mutex_operators_map);
+        core_affinity_map[operator_list_id] = operator_list.get_core_affinity();
+    }
+
+    return ret;
 }
 
 EnnReturn CpuUserDriver::PrepareSubGraph(const enn::runtime::ExecutableOperatorList& executable_operator_list) {
@@ -110,28 +162,75 @@ EnnReturn CpuUserDriver::ExecuteSubGraph(const enn::runtime::OperatorListExecute
     PROFILE_SCOPE("CPU_UD_Execution_#" + std::to_string(executable_id), util::chop_into_model_id(operator_list_id));
 
     UDOperators operators;
+    UDBuffers buffers;
+    auto& buffer_table = operator_list_execute_reqeust.get_buffer_table();
 
-    if (get_ud_operators(operator_list_id, operators) != ENN_RET_SUCCESS) {
+    if (get_prepared_subgraph(operator_list_execute_reqeust, operators, buffers) != ENN_RET_SUCCESS) {
         return ENN_RET_FAILED;
     }
 
+    uint32_t core_affinity = get_core_affinity(operator_list_id);
+    ParallelScope parallel_scope(thread_pool.get(), get_thread_num(core_affinity), 1, core_affinity);
+
+    return op_executor->execute(operators, buffers, buffer_table);
+}
+
+UserDriver::BoundExecution CpuUserDriver::BindSubGraph(
+    const enn::runtime::OperatorListExecuteRequest& operator_list_execute_reqeust) {
+    ENN_DBG_PRINT("started\n");
+
+    uint64_t operator_list_id = operator_list_execute_reqeust.get_operator_list_id().get();
+    uint64_t executable_id = operator_list_execute_reqeust.get_executable_operator_list_id().get();
+    ENN_DBG_PRINT("operator_list_id = 0x%" PRIx64 ", executable_id = 0x%" PRIx64 "\n", operator_list_id, executable_id);
+
+    UDOperators operators;
     UDBuffers buffers;
+
+    if (get_prepared_subgraph(operator_list_execute_reqeust, operators, buffers) != ENN_RET_SUCCESS) {
+        return nullptr;
+    }
+
+    // Operators and buffers are shared with the maps, and kept alive by the execution even if the
+    //  operator list is closed. The label of profiling is built here once.
+    uint32_t core_affinity = get_core_affinity(operator_list_id);
+    uint32_t thread_num = get_thread_num(core_affinity);
+    std::string label = "CPU_UD_Execution_#" + std::to_string(executable_id);
     auto& buffer_table = operator_list_execute_reqeust.get_buffer_table();
 
-    if (get_executable_buffers(executable_id, buffers) != ENN_RET_SUCCESS) {
-        if (op_executor->prepare(operators, buffers, buffer_table) != ENN_RET_SUCCESS) {
+    return [this, operators, buffers, &buffer_table, core_affinity, thread_num, label, operator_list_id]() mutable {
+        PROFILE_SCOPE(label, util::chop_into_model_id(operator_list_id));
+        ParallelScope parallel_scope(thread_pool.get(), thread_num, 1, core_affinity);
+        return op_executor->execute(operators, buffers, buffer_table);
+    };
+}
+
+// Look up operators of the operator list and its buffers for the executable operator list,
+//  which are prepared here on first use.
+EnnReturn CpuUserDriver::get_prepared_subgraph(
+    const enn::runtime::OperatorListExecuteRequest& operator_list_execute_reqeust,
+    UDOperators& out_ud_operators, UDBuffers& out_executable_buffers) {
+    uint64_t operator_list_id = operator_list_execute_reqeust.get_operator_list_id().get();
+    uint64_t executable_id = operator_list_execute_reqeust.get_executable_operator_list_id().get();
+
+    if (get_ud_operators(operator_list_id, out_ud_operators) != ENN_RET_SUCCESS) {
+        return ENN_RET_FAILED;
+    }
+
+    if (get_executable_buffers(executable_id, out_executable_buffers) != ENN_RET_SUCCESS) {
+        if (op_executor->prepare(out_ud_operators, out_executable_buffers,
+                                 operator_list_execute_reqeust.get_buffer_table()) != ENN_RET_SUCCESS) {
             return ENN_RET_FAILED;
         }
 
         std::lock_guard<std::mutex> lock_guard_executable_id_map(mutex_executable_id_map);
         executable_id_map[operator_list_id].push_back(executable_id);
 
-        if (add_executable_buffers(executable_id, buffers) != ENN_RET_SUCCESS) {
+        if (add_executable_buffers(executable_id, out_executable_buffers) != ENN_RET_SUCCESS) {
             return ENN_RET_FAILED;
         }
     }
 
-    return op_executor->execute(operators, buffers, buffer_table);
+    return ENN_RET_SUCCESS;
 }
 
 EnnReturn CpuUserDriver::CloseSubGraph(const model::component::OperatorList& operator_list) {
@@ -159,6 +258,7 @@ EnnReturn CpuUserDriver::Deinitialize(void) {
 
     std::lock_guard<std::mutex> lock_guard_operators_map(mutex_operators_map);
     ud_operators_map.clear();
+    core_affinity_map.clear();
     if (!ud_operators_map.empty()) {
         ENN_ERR_PRINT("ud_operators_map was not cleared.\n");
         ret = ENN_RET_FAILED;
@@ -212,6 +312,7 @@ EnnReturn CpuUserDriver::remove_ud_operators(uint64_t id) {
     EnnReturn ret = ENN_RET_SUCCESS;
 
     std::lock_guard<std::mutex> lock_guard(mutex_operators_map);
+    core_affinity_map.erase(id);
     if (ud_operators_map.erase(id) != 1) {
         ENN_ERR_PRINT("remove ud_operators_map[%" PRIx64 "] failed.\n", id);
         ret = ENN_RET_FAILED;
@@ -220,6 +321,22 @@ EnnReturn CpuUserDriver::remove_ud_operators(uint64_t id) {
     return ret;
 }
 
+uint32_t CpuUserDriver::get_core_affinity(uint64_t id) {
+    std::lock_guard<std::mutex> lock_guard(mutex_operators_map);
+    auto core_affinity = core_affinity_map.find(id);
+    return core_affinity == core_affinity_map.end() ? 0 : core_affinity->second;
+}
+
+// Loops of operators are split over the cores of core_affinity, or all threads of the pool if not set.
+// The affinity is given to the pool per loop, so operator lists on different cores don't affect each other.
+uint32_t CpuUserDriver::get_thread_num(uint32_t core_affinity) {
+    uint32_t thread_num = thread_pool->get_thread_num();
+    if (core_affinity != 0) {
+        thread_num = std::min<uint32_t>(thread_num, __builtin_popcount(core_affinity));
+    }
+    return thread_num;
+}
+
 EnnReturn CpuUserDriver::add_executable_buffers(uint64_t id, const UDBuffers& executable_buffers) {
     ENN_DBG_PRINT("started, id = 0x%" PRIx64 "\n", id);
 
@@ -25,6 +25,8 @@
 #include "userdriver/common/operator_interfaces/userdriver_operator.h"
 #include "userdriver/cpu/cpu_op_constructor.h"
 #include "userdriver/cpu/cpu_op_executor.h"
+#include "userdriver/cpu/cpu_op_tuner.h"
+#include "userdriver/cpu/common/NEONThreadPool.hpp"
 
 namespace enn {
 namespace ud {
@@ -40,6 +42,7 @@ public:
     EnnReturn OpenSubGraph(const model::component::OperatorList& operator_list) override;
     EnnReturn PrepareSubGraph(const enn::runtime::ExecutableOperatorList& executable_operator_list) override;
     EnnReturn ExecuteSubGraph(const enn::runtime::OperatorListExecuteRequest& operator_list_execute_reqeust) override;
+    BoundExecution BindSubGraph(const enn::runtime::OperatorListExecuteRequest& operator_list_execute_reqeust) override;
     EnnReturn CloseSubGraph(const model::component::OperatorList& operator_list) override;
     EnnReturn Deinitialize(void) override;
 
@@ -55,17 +58,27 @@ private:
     std::unique_ptr<IOperationConstructor> op_constructor;
     std::unique_ptr<IOperationExecutor> op_executor;
 
+    // Operators run their loops on this pool, on the cores of core_affinity of the operator list.
+    std::unique_ptr<ThreadPool> thread_pool;
+    // Loops of operators are tuned at OpenSubGraph if set, see CPU_TUNING_PROPERTY.
+    std::unique_ptr<OperationTuner> op_tuner;
+
     std::mutex mutex_operators_map;
     std::unordered_map<uint64_t, UDOperators> ud_operators_map;
+    std::unordered_map<uint64_t, uint32_t> core_affinity_map;
     EnnReturn add_ud_operators(uint64_t id, UDOperators ud_operators);
     EnnReturn get_ud_operators(uint64_t id, UDOperators& out_ud_operators);
     EnnReturn remove_ud_operators(uint64_t id);
+    uint32_t get_core_affinity(uint64_t id);
+    uint32_t get_thread_num(uint32_t core_affinity);
 
     std::mutex mutex_exec_buffers_map;
     std::unordered_map<uint64_t, UDBuffers> exec_buffers_map;
     EnnReturn add_executable_buffers(uint64_t id, const UDBuffers& executable_buffers);
     EnnReturn get_executable_buffers(uint64_t id, UDBuffers& out_executable_buffers);
     EnnReturn remove_executable_buffers(uint64_t id);
+    EnnReturn get_prepared_subgraph(const enn::runtime::OperatorListExecuteRequest& operator_list_execute_reqeust,
+                                    UDOperators& out_ud_operators, UDBuffers& out_executable_buffers);
 
     std::mutex mutex_executable_id_map;
     std::unordered_map<uint64_t, std::vector<uint64_t>> executable_id_map;
@@ -495,6 +495,30 @@ protected:
         return opr;
     }
 
+    enn::model::component::Operator::Ptr create_custom_pad(const int32_t& pad_mode) {
+        enn::model::component::OperatorBuilder operator_builder;
+        enn::model::component::ParameterBuilder parameter_builder;
+
+        std::string op_name = "Pad";
+
+        std::shared_ptr<enn::model::component::Parameter> param_pad_mode = parameter_builder.set_name("PAD_MODE")
+                                                                               .set_buffer_addr(&pad_mode)
+                                                                               .set_buffer_size(sizeof(pad_mode))
+                                                                               .set_data_type(TFlite::TensorType_INT32)
+                                                                               .create();
+
+        enn::model::component::Operator::Ptr opr = operator_builder.set_id(op_name.length())
+                                                                   .set_name(op_name)
+                                                                   .set_code((TFlite::BuiltinOperator)UNDEFINED)
+                                                                   .set_accelerator(model::Accelerator::CPU)
+                                                                   .add_in_tensor(param_pad_mode)
+                                                                   .create();
+
+        add_edges(opr, 1, 1, TFlite::TensorType_FLOAT32, TFlite::TensorType_FLOAT32);
+
+        return opr;
+    }
+
     enn::model::component::Operator::Ptr create_builtin_softmax(float beta, int32_t axis) {
         enn::model::component::OperatorBuilder operator_builder;
 
@@ -627,6 +651,24 @@ TEST_F(ENN_GT_UNIT_TEST_CPU_UD, cpu_ud_test_custom_operator_open_prepare_exec_cl
     EXPECT_EQ(ENN_RET_SUCCESS, cpu_ud.Deinitialize());
 }
 
+TEST_F(ENN_GT_UNIT_TEST_CPU_UD, cpu_ud_test_custom_operator_pad_mode) {
+    ud::cpu::CpuUserDriver& cpu_ud = ud::cpu::CpuUserDriver::get_instance();
+
+    EXPECT_EQ(ENN_RET_SUCCESS, cpu_ud.Initialize());
+
+    auto edge_pad = operator_list_builder.build(MODEL_ID).add_operator(create_custom_pad(2)).create();
+    EXPECT_EQ(ENN_RET_SUCCESS, cpu_ud.OpenSubGraph(*edge_pad));
+    EXPECT_EQ(ENN_RET_SUCCESS, cpu_ud.CloseSubGraph(*edge_pad));
+
+    // Unknown modes are not taken as constant padding.
+    for (int32_t pad_mode : {-1, 3}) {
+        auto unknown_pad = operator_list_builder.build(MODEL_ID).add_operator(create_custom_pad(pad_mode)).create();
+        EXPECT_NE(ENN_RET_SUCCESS, cpu_ud.OpenSubGraph(*unknown_pad));
+    }
+
+    EXPECT_EQ(ENN_RET_SUCCESS, cpu_ud.Deinitialize());
+}
+
 TEST_F(ENN_GT_UNIT_TEST_CPU_UD, cpu_ud_test_custom_operators_Normalization_Dequantization) {
     ud::cpu::CpuUserDriver& cpu_ud = ud::cpu::CpuUserDriver::get_instance();
 
@@ -802,6 +844,37 @@ TEST_F(ENN_GT_UNIT_TEST_CPU_UD, cpu_ud_test_builtin_operator_without_prepare) {
     EXPECT_EQ(ENN_RET_SUCCESS, cpu_ud.Deinitialize());
 }
 
+TEST_F(ENN_GT_UNIT_TEST_CPU_UD, cpu_ud_test_builtin_operator_bind_execute) {
+    ud::cpu::CpuUserDriver& cpu_ud = ud::cpu::CpuUserDriver::get_instance();
+
+    EXPECT_EQ(ENN_RET_SUCCESS, cpu_ud.Initialize());
+
+    auto opr_list = operator_list_builder.build(MODEL_ID).add_operator(create_builtin_softmax(0.5f, 2)).create();
+
+    EXPECT_EQ(ENN_RET_SUCCESS, cpu_ud.OpenSubGraph(*opr_list));
+
+    float in[10], out[10];
+    auto buffer_table = create_buffer_table(in, 10, out, 10);
+
+    auto exec_model_id = EXEC_MODEL_ID(4);
+    auto executable_operator_list = std::make_shared<runtime::ExecutableOperatorList>(exec_model_id, opr_list, buffer_table);
+    EXPECT_EQ(ENN_RET_SUCCESS, cpu_ud.PrepareSubGraph(*executable_operator_list));
+
+    // The bound execution runs the operators prepared for the request without looking them up.
+    auto operator_list_execute_request = runtime::OperatorListExecuteRequest(executable_operator_list, buffer_table);
+    auto execution = cpu_ud.BindSubGraph(operator_list_execute_request);
+    ASSERT_TRUE(execution);
+    EXPECT_EQ(ENN_RET_SUCCESS, execution());
+    EXPECT_EQ(ENN_RET_SUCCESS, execution());
+
+    EXPECT_EQ(ENN_RET_SUCCESS, cpu_ud.CloseSubGraph(*opr_list));
+
+    // Operator list closed can't be bound.
+    EXPECT_FALSE(cpu_ud.BindSubGraph(operator_list_execute_request));
+
+    EXPECT_EQ(ENN_RET_SUCCESS, cpu_ud.Deinitialize());
+}
+
 TEST_F(ENN_GT_UNIT_TEST_CPU_UD, cpu_ud_test_builtin_operator_prepare_execute_multiple) {
     ud::cpu::CpuUserDriver& cpu_ud = ud::cpu::CpuUserDriver::get_instance();
 
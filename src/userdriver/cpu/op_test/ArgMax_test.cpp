@@ -25,13 +25,19 @@ class ArgMaxTester {
         return *this;
     }
 
-    void TestRun(float* input_data, const float* reference_output_data) {
+    ArgMaxTester& Precision(const PrecisionType& precision) {
+        precision_ = precision;
+        return *this;
+    }
+
+    template <typename T>
+    void TestRun(T* input_data, const float* reference_output_data) {
         size_t input_size = GetDimSize(input_dims_);
         size_t output_size = GetDimSize(output_dims_);
-        std::shared_ptr<NEONTensor<float>> input_tensor = std::make_shared<NEONTensor<float>>(input_dims_, PrecisionType::FP32);
-        memcpy(input_tensor->getDataPtr().get(), input_data, input_size * sizeof(float));
+        std::shared_ptr<NEONTensor<T>> input_tensor = std::make_shared<NEONTensor<T>>(input_dims_, precision_);
+        memcpy(input_tensor->getDataPtr().get(), input_data, input_size * sizeof(T));
         std::shared_ptr<NEONTensor<int>> output_tensor = std::make_shared<NEONTensor<int>>(output_dims_, PrecisionType::INT32);
-        ArgMax _argmax(PrecisionType::FP32);
+        ArgMax _argmax(precision_);
         EXPECT_EQ(_argmax.initialize(input_tensor, axis_, output_tensor), Status::SUCCESS);
         EXPECT_EQ(_argmax.execute(input_tensor, output_tensor), Status::SUCCESS);
         EXPECT_EQ(_argmax.release(), Status::SUCCESS);
@@ -43,6 +49,7 @@ class ArgMaxTester {
     Dim4 input_dims_;
     Dim4 output_dims_;
     uint32_t axis_;
+    PrecisionType precision_ = PrecisionType::FP32;
 };
 
 TEST(ENN_CPU_OP_UT_ArgMax, SimpleAxis0) {
@@ -109,6 +116,34 @@ TEST(ENN_CPU_OP_UT_ArgMax, SimpleAxis3) {
     .TestRun(input_data, reference_output_data);
 }
 
+TEST(ENN_CPU_OP_UT_ArgMax, Uint8ChannelAxis) {
+    // The last channel of the max for ties, on positions of more than a vector.
+    uint8_t input_data[] = {5, 1, 9, 3, 3, 0, 7, 2, 8, 4,  // channel1
+                            5, 6, 2, 3, 1, 0, 7, 9, 8, 1,  // channel2
+                            1, 6, 2, 4, 3, 0, 1, 9, 2, 4
+                           };
+    float reference_output_data[] = {1, 2, 0, 2, 2, 2, 1, 2, 1, 2};
+    ArgMaxTester(1e-5)
+    .Precision(PrecisionType::UINT8)
+    .InputDims({1, 3, 2, 5})
+    .Axis(1)
+    .OutputDims({1, 1, 2, 5})
+    .TestRun(input_data, reference_output_data);
+}
+
+TEST(ENN_CPU_OP_UT_ArgMax, Int8LastAxis) {
+    int8_t input_data[] = {-3, 7, -128, 7, 0, 5, 7, -1, 2, 6, -128,
+                           4, -5, 4, 127, -5, 3, 1, 0, -5, 1, 127
+                          };
+    float reference_output_data[] = {6, 10};
+    ArgMaxTester(1e-5)
+    .Precision(PrecisionType::INT8)
+    .InputDims({1, 1, 2, 11})
+    .Axis(3)
+    .OutputDims({1, 1, 2, 1})
+    .TestRun(input_data, reference_output_data);
+}
+
 }   // namespace cpu
 }   // namespace ud
 }  // namespace enn
@@ -1,4 +1,10 @@
 #include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+
 #include "userdriver/cpu/operators/Detection.hpp"
 #include "userdriver/common/op_test/test_utils.h"
 
@@ -109,6 +115,62 @@ public:
         }
     }
 
+    // SSD-like inputs of num_priors random priors, instead of the 4 fixed ones of TestPrepare().
+    DetectionTester& Randomize(const uint32_t& num_priors) {
+        num_priors_ = num_priors;
+        std::mt19937 gen(0);
+        std::uniform_real_distribution<float> unit(0, 1), offset(-1, 1);
+        in_prior_.reset(new float[num_ * 2 * num_priors_ * 4], std::default_delete<float[]>());
+        for (uint32_t p = 0; p < num_priors_; ++p) {
+            float center_x = unit(gen), center_y = unit(gen);
+            float width = 0.05 + 0.3 * unit(gen), height = 0.05 + 0.3 * unit(gen);
+            float* prior = in_prior_.get() + p * 4;
+            prior[0] = center_x - width / 2;
+            prior[1] = center_y - height / 2;
+            prior[2] = center_x + width / 2;
+            prior[3] = center_y + height / 2;
+            float* variance = in_prior_.get() + (num_priors_ + p) * 4;
+            variance[0] = variance[1] = 0.1;
+            variance[2] = variance[3] = 0.2;
+        }
+        in_conf_.reset(new float[num_ * num_priors_ * num_classes_], std::default_delete<float[]>());
+        for (uint32_t i = 0; i < num_ * num_priors_ * num_classes_; ++i) {
+            in_conf_.get()[i] = std::pow(unit(gen), 8.0f);
+        }
+        in_loc_.reset(new float[num_ * num_priors_ * num_loc_classes_ * 4], std::default_delete<float[]>());
+        for (uint32_t i = 0; i < num_ * num_priors_ * num_loc_classes_ * 4; ++i) {
+            in_loc_.get()[i] = offset(gen);
+        }
+        return *this;
+    }
+
+    // Average latency of execute() in ms over repeat runs, after a warm-up run.
+    double Benchmark(Dim4& output_dim, const int& repeat) {
+        loc_dim_ = {num_, num_priors_ * num_loc_classes_ * 4, 1, 1};
+        auto input_tensor_loc = std::make_shared<NEONTensor<float>>(in_loc_.get(), loc_dim_, precision_);
+        conf_dim_ = {num_, num_priors_ * num_classes_, 1, 1};
+        auto input_tensor_conf = std::make_shared<NEONTensor<float>>(in_conf_.get(), conf_dim_, precision_);
+        prior_dim_ = {num_, 2, num_priors_ * 4, 1};
+        auto input_tensor_prior = std::make_shared<NEONTensor<float>>(in_prior_.get(), prior_dim_, precision_);
+        auto output_tensor = std::make_shared<NEONTensor<float>>(output_dim, PrecisionType::FP32);
+
+        Detection _detection(PrecisionType::FP32);
+        EXPECT_EQ(_detection.initialize(loc_dim_, conf_dim_, prior_dim_, output_dim, num_classes_, share_location_,
+                                        nms_threshold_, background_label_id_, nms_top_k_, keep_top_k_, code_type_,
+                                        confidence_threshold_, nms_eta_, variance_encoded_in_target_),
+                  Status::SUCCESS);
+        EXPECT_EQ(_detection.execute(input_tensor_loc, input_tensor_conf, input_tensor_prior, output_tensor),
+                  Status::SUCCESS);
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < repeat; ++i) {
+            EXPECT_EQ(_detection.execute(input_tensor_loc, input_tensor_conf, input_tensor_prior, output_tensor),
+                      Status::SUCCESS);
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        EXPECT_EQ(_detection.release(), Status::SUCCESS);
+        return std::chrono::duration<double, std::milli>(elapsed).count() / repeat;
+    }
+
 private:
     PrecisionType precision_;
     float error_threshold_;
@@ -213,6 +275,19 @@ TEST(ENN_CPU_OP_UT_Detection, detection_test_4) {
         .TestRun(output_dim, output_expect);
 }
 
+// SSD300 on COCO: 8732 priors of 91 classes, for a batch of 2 images.
+TEST(ENN_CPU_OP_UT_Detection, DISABLED_benchmark_ssd300) {
+    const uint32_t num_classes = 91;
+    const int32_t nms_top_k = 400;
+    const int32_t keep_top_k = 200;
+    Dim4 output_dim = {1, 1, 2 * keep_top_k, 7};
+    double latency = DetectionTester(1e-5)
+                         .TestPrepare(num_classes, true, 0.45f, 0, nms_top_k, keep_top_k, 1, 0.3f, 1.0f, false)
+                         .Randomize(8732)
+                         .Benchmark(output_dim, 5);
+    std::cout << "[          ] Detection(2x8732 priors, 91 classes): " << latency << " ms" << std::endl;
+}
+
 }  // namespace cpu
 }  // namespace ud
 }  // namespace enn
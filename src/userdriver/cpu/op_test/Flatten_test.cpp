@@ -25,6 +25,12 @@ public:
         return *this;
     }
 
+    // The output is a view of the input, as the memory planner places them.
+    FlattenTester &InPlace(bool in_place) {
+        in_place_ = in_place;
+        return *this;
+    }
+
     void TestRun(const int start_axis, const int end_axis) {
         int size = GetDimSize(input_dims_);
         float *input_data = new float[size];
@@ -33,11 +39,14 @@ public:
             std::make_shared<NEONTensor<float>>(input_data, input_dims_, PrecisionType::FP32);
         std::shared_ptr<NEONTensor<float>> output_tensor =
             std::make_shared<NEONTensor<float>>(output_dims_, PrecisionType::FP32);
+        if (in_place_) {
+            output_tensor->set_buffer_ptr(input_tensor->getBufferPtr());
+        }
         std::vector<uint32_t> output_dim;
         Flatten flatten(PrecisionType::FP32);
         flatten.initialize(start_axis, end_axis);
-        flatten.execute(input_tensor, output_tensor, &output_dim);
-        Compare(output_tensor->getDataPtr().get(), input_data, size, error_threshold_);
+        EXPECT_EQ(flatten.execute(input_tensor, output_tensor, &output_dim), Status::SUCCESS);
+        Compare(output_tensor->getBufferPtr(), input_data, size, error_threshold_);
         EXPECT_EQ(num_axis_, output_dim.size());
         for (size_t i = 0; i < output_dim.size(); ++i) {
             if (i == 0) {
@@ -57,6 +66,7 @@ public:
 private:
     std::shared_ptr<float> data_;
     float error_threshold_;
+    bool in_place_ = false;
     uint32_t num_axis_;
     Dim4 input_dims_;
     Dim4 output_dims_;
@@ -93,6 +103,13 @@ TEST(FlattenTester, start_f3_end_3) {
     FlattenTester(0).InputDim({4, 5, 6, 7}).OutputDim({4, 5 * 6 * 7, 1, 1}).NumAxis(2).TestRun(start_axis, end_axis);
 }
 
+TEST(FlattenTester, start_1_end_3_in_place) {
+    int start_axis = 1;
+    int end_axis = 3;
+    FlattenTester(0).InputDim({2, 3, 4, 5}).OutputDim({2, 3 * 4 * 5, 1, 1}).NumAxis(2).InPlace(true).TestRun(start_axis,
+                                                                                                           end_axis);
+}
+
 TEST(FlattenTester, start_0_end_0) {
     int start_axis = 0;
     int end_axis = 0;
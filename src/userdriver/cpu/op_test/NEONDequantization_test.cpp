@@ -1,4 +1,6 @@
 #include <gtest/gtest.h>
+#include <cstring>
+#include "userdriver/cpu/common/NEONThreadPool.hpp"
 #include "userdriver/cpu/operators/NEONDequantization.hpp"
 #include "userdriver/common/op_test/test_utils.h"
 
@@ -20,6 +22,12 @@ public:
         return *this;
     }
 
+    // The output is placed on the input, as the memory planner does when the input dies at the operator.
+    DequantizationTester& InPlace(bool in_place) {
+        in_place_ = in_place;
+        return *this;
+    }
+
     template <typename T>
     void TestRun(T* input_data, int32_t* frac_len, const float* reference_output_data, Status status = Status::SUCCESS) {
         PrecisionType precision = getPrecisionType(input_data);
@@ -28,6 +36,13 @@ public:
         auto input_tensor = std::make_shared<NEONTensor<T>>(input_data, input_dims_, precision);
         auto output_tensor = std::make_shared<NEONTensor<float>>(output_dims_, PrecisionType::FP32);
         auto frac_tensor = std::make_shared<NEONTensor<int32_t>>(frac_len, frac_dims_, PrecisionType::INT32);
+        std::vector<float> shared_buffer;
+        if (in_place_) {
+            shared_buffer.resize(output_size);
+            std::memcpy(shared_buffer.data(), input_data, output_size * sizeof(T));
+            input_tensor->set_buffer_ptr(shared_buffer.data());
+            output_tensor->set_buffer_ptr(shared_buffer.data());
+        }
 
         uint32_t img_size = input_dims_.h * input_dims_.w;
         int32_t data_num = input_dims_.c * img_size;
@@ -37,11 +52,12 @@ public:
         EXPECT_EQ(_neon_dequantize.release(), Status::SUCCESS);
 
         if (status == Status::SUCCESS)
-            Compare(output_tensor->getDataPtr().get(), reference_output_data, output_size, error_threshold_);
+            Compare(output_tensor->getBufferPtr(), reference_output_data, output_size, error_threshold_);
     }
 
 private:
     float error_threshold_;
+    bool in_place_ = false;
     Dim4 input_dims_;
     Dim4 output_dims_;
     Dim4 frac_dims_;
@@ -61,7 +77,7 @@ void DeQuantizationRef(const T* input, float* output, const uint32_t& input_size
 }
 
 template <typename UnitType>
-void TEST_COMMON(Dim4& input_dims, Status status = Status::SUCCESS) {
+void TEST_COMMON(Dim4& input_dims, Status status = Status::SUCCESS, bool in_place = false) {
     size_t array_size = GetDimSize(input_dims);
     std::shared_ptr<UnitType> in;
     in.reset(new UnitType[array_size], std::default_delete<UnitType[]>());
@@ -73,7 +89,8 @@ void TEST_COMMON(Dim4& input_dims, Status status = Status::SUCCESS) {
 
     float* refer_output = new float[array_size];
     DeQuantizationRef(in.get(), refer_output, array_size, frac_len.get(), input_dims.c);
-    DequantizationTester().InputDims(input_dims).TestRun(in.get(), frac_len.get(), refer_output, status);
+    DequantizationTester().InputDims(input_dims).InPlace(in_place).TestRun(in.get(), frac_len.get(), refer_output,
+                                                                           status);
 
     delete[] refer_output;
 }
@@ -108,6 +125,15 @@ TEST(ENN_CPU_OP_UT_Dequantization, InceptionV3Input) {
     TEST_COMMON<int8_t>(input_dims);
 }
 
+TEST(ENN_CPU_OP_UT_Dequantization, InPlace) {
+    // Threads take ranges of elements, whose outputs never overwrite the inputs of others not read yet.
+    ThreadPool pool(4);
+    ParallelScope scope(&pool, 4);
+    Dim4 input_dims = {1, 3, 61, 67};
+    TEST_COMMON<int8_t>(input_dims, Status::SUCCESS, true);
+    TEST_COMMON<int16_t>(input_dims, Status::SUCCESS, true);
+}
+
 TEST(ENN_CPU_OP_UT_Dequantization, INVALID_INPUT) {
     Dim4 input_dims = {0, 0, 0, 0};
     int8_t* input_data = NULL;
@@ -0,0 +1,202 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "userdriver/cpu/operators/AsymmDequantization.hpp"
+#include "userdriver/cpu/operators/AsymmQuantization.hpp"
+#include "userdriver/cpu/operators/NEONDequantization.hpp"
+#include "userdriver/cpu/operators/NEONFusedPipeline.hpp"
+#include "userdriver/cpu/operators/Normalization.hpp"
+#include "userdriver/cpu/operators/Quantization.hpp"
+#include "userdriver/cpu/operators/Softmax.hpp"
+#include "userdriver/common/op_test/test_utils.h"
+
+namespace enn {
+namespace ud {
+namespace cpu {
+
+// The fused pipeline gives the same bits as its operators executed one by one.
+class ENN_CPU_OP_UT_NEONFusedPipeline : public testing::Test {
+protected:
+    template <typename T>
+    static std::vector<uint8_t> bytes_of(const std::shared_ptr<NEONTensor<T>>& tensor) {
+        auto data = reinterpret_cast<const uint8_t*>(tensor->getBufferPtr());
+        return std::vector<uint8_t>(data, data + tensor->getTotalSizeFromDims() * sizeof(T));
+    }
+
+    std::shared_ptr<NEONTensor<uint8_t>> image(const Dim4& dims) {
+        image_.resize(GetDimSize(dims));
+        GenerateRandom<uint8_t>(image_.data(), image_.size(), 0, 255);
+        return std::make_shared<NEONTensor<uint8_t>>(image_.data(), dims, PrecisionType::UINT8);
+    }
+
+    std::shared_ptr<Normalization> normalization(const std::shared_ptr<ITensor>& input) {
+        mean_tensor_ = std::make_shared<NEONTensor<float>>(mean_, Dim4{1, 3, 1, 1}, PrecisionType::FP32);
+        scale_tensor_ = std::make_shared<NEONTensor<float>>(scale_, Dim4{1, 3, 1, 1}, PrecisionType::FP32);
+        auto op = std::make_shared<Normalization>(PrecisionType::UINT8);
+        EXPECT_EQ(op->initialize(input, mean_tensor_, scale_tensor_, 0), Status::SUCCESS);
+        return op;
+    }
+
+    std::vector<uint8_t> image_;
+    float mean_[3] = {123.675f, 116.28f, 103.53f};
+    float scale_[3] = {0.0171f, 0.0175f, 0.0174f};
+    std::shared_ptr<NEONTensor<float>> mean_tensor_, scale_tensor_;
+};
+
+TEST_F(ENN_CPU_OP_UT_NEONFusedPipeline, normalization_quantization) {
+    Dim4 dims = {1, 3, 37, 53};
+    auto input = image(dims);
+    auto normalized = std::make_shared<NEONTensor<float>>(dims, PrecisionType::FP32);
+    auto norm = normalization(input);
+    PipelineStage norm_stage;
+    ASSERT_TRUE(norm->getPipelineStage(input, &norm_stage));
+    ASSERT_EQ(norm->execute(input, normalized), Status::SUCCESS);
+
+    int32_t frac_lens[] = {3, 5, 4};
+    auto frac_tensor = std::make_shared<NEONTensor<int32_t>>(frac_lens, Dim4{1, 3, 1, 1}, PrecisionType::INT32);
+    for (auto precision : {PrecisionType::INT8, PrecisionType::INT16}) {
+        Quantization quantization(precision);
+        ASSERT_EQ(quantization.initialize(normalized, dims.c, dims.h, dims.w, frac_tensor), Status::SUCCESS);
+        PipelineStage quantize_stage;
+        ASSERT_TRUE(quantization.getPipelineStage(normalized, &quantize_stage));
+
+        NEONFusedPipeline pipeline(precision);
+        ASSERT_EQ(pipeline.initialize(input, {norm_stage, quantize_stage}), Status::SUCCESS);
+        if (precision == PrecisionType::INT8) {
+            auto expected = std::make_shared<NEONTensor<int8_t>>(dims, precision);
+            auto output = std::make_shared<NEONTensor<int8_t>>(dims, precision);
+            ASSERT_EQ(quantization.execute(normalized, expected), Status::SUCCESS);
+            ASSERT_EQ(pipeline.execute(input, output), Status::SUCCESS);
+            EXPECT_TRUE(bytes_of(output) == bytes_of(expected));
+        } else {
+            auto expected = std::make_shared<NEONTensor<int16_t>>(dims, precision);
+            auto output = std::make_shared<NEONTensor<int16_t>>(dims, precision);
+            ASSERT_EQ(quantization.execute(normalized, expected), Status::SUCCESS);
+            ASSERT_EQ(pipeline.execute(input, output), Status::SUCCESS);
+            EXPECT_TRUE(bytes_of(output) == bytes_of(expected));
+        }
+    }
+}
+
+TEST_F(ENN_CPU_OP_UT_NEONFusedPipeline, normalization_asymm_quantization) {
+    Dim4 dims = {1, 3, 16, 31};
+    auto input = image(dims);
+    auto normalized = std::make_shared<NEONTensor<float>>(dims, PrecisionType::FP32);
+    auto norm = normalization(input);
+    PipelineStage norm_stage, quantize_stage;
+    ASSERT_TRUE(norm->getPipelineStage(input, &norm_stage));
+    ASSERT_EQ(norm->execute(input, normalized), Status::SUCCESS);
+
+    AsymmQuantization quantization(PrecisionType::UINT8);
+    ASSERT_EQ(quantization.initialize(normalized, dims.c, dims.w, dims.h, 0.0157f, 128), Status::SUCCESS);
+    ASSERT_TRUE(quantization.getPipelineStage(normalized, &quantize_stage));
+    auto expected = std::make_shared<NEONTensor<uint8_t>>(dims, PrecisionType::UINT8);
+    ASSERT_EQ(quantization.execute(normalized, expected), Status::SUCCESS);
+
+    NEONFusedPipeline pipeline(PrecisionType::UINT8);
+    ASSERT_EQ(pipeline.initialize(input, {norm_stage, quantize_stage}), Status::SUCCESS);
+    auto output = std::make_shared<NEONTensor<uint8_t>>(dims, PrecisionType::UINT8);
+    ASSERT_EQ(pipeline.execute(input, output), Status::SUCCESS);
+    EXPECT_TRUE(bytes_of(output) == bytes_of(expected));
+}
+
+TEST_F(ENN_CPU_OP_UT_NEONFusedPipeline, dequantization_softmax) {
+    // Softmax over the classes of detection(rows) and of segmentation(channels).
+    for (int32_t axis : {3, 1}) {
+        Dim4 dims = {1, 21, 9, 13};
+        uint32_t img_size = dims.h * dims.w;
+        std::vector<int8_t> logits(GetDimSize(dims));
+        GenerateRandom<int8_t>(logits.data(), logits.size(), -128, 127);
+        auto input = std::make_shared<NEONTensor<int8_t>>(logits.data(), dims, PrecisionType::INT8);
+        auto dequantized = std::make_shared<NEONTensor<float>>(dims, PrecisionType::FP32);
+        auto expected = std::make_shared<NEONTensor<float>>(dims, PrecisionType::FP32);
+        auto output = std::make_shared<NEONTensor<float>>(dims, PrecisionType::FP32);
+
+        auto softmax = std::make_shared<Softmax>(PrecisionType::FP32);
+        ASSERT_EQ(softmax->initialize(dequantized, dims.w, dims.h, dims.c, dims.n, 1.0f, axis), Status::SUCCESS);
+
+        AsymmDequantization asymm(PrecisionType::INT8);
+        ASSERT_EQ(asymm.initialize(input, logits.size(), 0.0625f, -3, img_size), Status::SUCCESS);
+        PipelineStage stage;
+        ASSERT_TRUE(asymm.getPipelineStage(input, &stage));
+        ASSERT_EQ(asymm.execute(input, dequantized), Status::SUCCESS);
+        ASSERT_EQ(softmax->execute(dequantized, expected), Status::SUCCESS);
+
+        NEONFusedPipeline pipeline(PrecisionType::FP32);
+        ASSERT_EQ(pipeline.initialize(input, {stage}, softmax), Status::SUCCESS);
+        ASSERT_EQ(pipeline.execute(input, output), Status::SUCCESS);
+        EXPECT_TRUE(bytes_of(output) == bytes_of(expected)) << "AsymmDequantization, axis " << axis;
+
+        std::vector<int32_t> frac_lens(dims.c);
+        GenerateRandom<int32_t>(frac_lens.data(), frac_lens.size(), 1, 5);
+        auto frac_tensor = std::make_shared<NEONTensor<int32_t>>(frac_lens.data(), Dim4{1, dims.c, 1, 1},
+                                                                 PrecisionType::INT32);
+        NEONDequantization dequantization(PrecisionType::INT8);
+        ASSERT_EQ(dequantization.initialize(input, dims.c * img_size, frac_tensor, img_size), Status::SUCCESS);
+        ASSERT_TRUE(dequantization.getPipelineStage(input, &stage));
+        ASSERT_EQ(dequantization.execute(input, dequantized), Status::SUCCESS);
+        ASSERT_EQ(softmax->execute(dequantized, expected), Status::SUCCESS);
+
+        ASSERT_EQ(pipeline.initialize(input, {stage}, softmax), Status::SUCCESS);
+        ASSERT_EQ(pipeline.execute(input, output), Status::SUCCESS);
+        EXPECT_TRUE(bytes_of(output) == bytes_of(expected)) << "NEONDequantization, axis " << axis;
+    }
+}
+
+TEST_F(ENN_CPU_OP_UT_NEONFusedPipeline, invalid_stages) {
+    PipelineStage affine, quantize;
+    affine.means = affine.scales = {1.0f};
+    quantize.type = PipelineStage::Type::QUANTIZE;
+    quantize.means = quantize.scales = {1.0f};
+    auto softmax = std::make_shared<Softmax>(PrecisionType::FP32);
+
+    NEONFusedPipeline pipeline(PrecisionType::FP32);
+    EXPECT_EQ(pipeline.initialize(nullptr, {}), Status::INVALID_PARAMS);
+    EXPECT_EQ(pipeline.initialize(nullptr, {quantize, affine}), Status::INVALID_PARAMS);
+    EXPECT_EQ(pipeline.initialize(nullptr, {affine, quantize}, softmax), Status::INVALID_PARAMS);
+    EXPECT_EQ(pipeline.initialize(nullptr, {affine, quantize}), Status::SUCCESS);
+}
+
+// Input side of a 1080p camera frame, uint8 NCHW to int8 of the model, as two operators and fused.
+TEST_F(ENN_CPU_OP_UT_NEONFusedPipeline, DISABLED_benchmark_1080p) {
+    constexpr int kRepeat = 10;
+    Dim4 dims = {1, 3, 1080, 1920};
+    auto input = image(dims);
+    auto normalized = std::make_shared<NEONTensor<float>>(dims, PrecisionType::FP32);
+    auto separate = std::make_shared<NEONTensor<int8_t>>(dims, PrecisionType::INT8);
+    auto fused = std::make_shared<NEONTensor<int8_t>>(dims, PrecisionType::INT8);
+    auto norm = normalization(input);
+
+    int32_t frac_lens[] = {4, 4, 4};
+    auto frac_tensor = std::make_shared<NEONTensor<int32_t>>(frac_lens, Dim4{1, 3, 1, 1}, PrecisionType::INT32);
+    Quantization quantization(PrecisionType::INT8);
+    ASSERT_EQ(quantization.initialize(normalized, dims.c, dims.h, dims.w, frac_tensor), Status::SUCCESS);
+    PipelineStage norm_stage, quantize_stage;
+    ASSERT_TRUE(norm->getPipelineStage(input, &norm_stage));
+    ASSERT_TRUE(quantization.getPipelineStage(normalized, &quantize_stage));
+    NEONFusedPipeline pipeline(PrecisionType::INT8);
+    ASSERT_EQ(pipeline.initialize(input, {norm_stage, quantize_stage}), Status::SUCCESS);
+
+    auto measure = [](const std::function<void()>& execute) {
+        execute();  // warm up
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < kRepeat; ++i) execute();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / kRepeat;
+    };
+    double separate_ms = measure([&]() {
+        EXPECT_EQ(norm->execute(input, normalized), Status::SUCCESS);
+        EXPECT_EQ(quantization.execute(normalized, separate), Status::SUCCESS);
+    });
+    double fused_ms = measure([&]() { EXPECT_EQ(pipeline.execute(input, fused), Status::SUCCESS); });
+    EXPECT_TRUE(bytes_of(fused) == bytes_of(separate));
+    std::cout << "[          ] Normalization+Quantization(1x3x1080x1920): separate " << separate_ms << " ms, fused "
+              << fused_ms << " ms (x" << separate_ms / fused_ms << ")" << std::endl;
+}
+
+}  // namespace cpu
+}  // namespace ud
+}  // namespace enn
@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "userdriver/cpu/common/NEONTensor.hpp"
+
+namespace enn {
+namespace ud {
+namespace cpu {
+
+TEST(ENN_CPU_OP_UT_NEONTensor, view_refers_to_buffer_set) {
+    NDims ndim = {1, 3, 4, 5};
+    std::vector<int16_t> buffer(60);
+    for (size_t i = 0; i < buffer.size(); ++i) buffer[i] = static_cast<int16_t>(i);
+
+    NEONTensorView<int16_t> view(ndim, PrecisionType::INT16, 7, 2);
+    EXPECT_EQ(view.getDataType(), DataType::INT16);
+    EXPECT_EQ(view.getNumOfBytes(), buffer.size() * sizeof(int16_t));
+    EXPECT_EQ(view.getDim().c, 3);
+    EXPECT_EQ(view.get_buffer_type(), 7);
+    EXPECT_EQ(view.get_buffer_index(), 2);
+
+    view.set_buffer_ptr(buffer.data());
+    EXPECT_EQ(view.getBufferPtr(), buffer.data());
+    EXPECT_EQ(view.getDataPtr().get(), buffer.data());
+
+    std::vector<int16_t> read(buffer.size());
+    EXPECT_EQ(view.readData(read.data()), Status::SUCCESS);
+    EXPECT_EQ(read, buffer);
+    std::vector<int16_t> written(buffer.size(), 5);
+    EXPECT_EQ(view.writeData(written.data()), Status::SUCCESS);
+    EXPECT_EQ(buffer, written);
+}
+
+TEST(ENN_CPU_OP_UT_NEONTensor, view_out_of_buffer_table_has_own_buffer) {
+    NEONTensorView<float> view(NDims{2, 8}, PrecisionType::FP32);
+    view.set_buffer_ptr(nullptr);
+    ASSERT_NE(view.getBufferPtr(), nullptr);
+    for (uint32_t i = 0; i < view.getTotalSizeFromDims(); ++i) EXPECT_EQ(view.getBufferPtr()[i], 0.0f);
+    EXPECT_EQ(view.getDataPtr().get(), view.getBufferPtr());
+}
+
+// Prepare of a model-like subgraph, clones of tensors given buffers of the buffer table, with tensors
+// owning a buffer as before and with views.
+class ENN_CPU_OP_UT_NEONTensorPrepare : public testing::Test {
+protected:
+    static constexpr int kOperators = 64;
+    static constexpr int kRepeat = 5;
+
+    static size_t resident_bytes() {
+        size_t total_pages = 0, resident_pages = 0;
+        std::ifstream statm("/proc/self/statm");
+        statm >> total_pages >> resident_pages;
+        return resident_pages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    }
+
+    template <typename Tensor>
+    static void prepare(const char* name) {
+        NDims ndim = {1, 32, 64, 64};
+        std::vector<float> buffer_table(2 * kOperators * 32 * 64 * 64);
+        double ms = 0;
+        size_t grown = 0;
+        for (int repeat = 0; repeat < kRepeat; ++repeat) {
+            std::vector<std::shared_ptr<ITensor>> tensors;
+            size_t resident = resident_bytes();
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < 2 * kOperators; ++i) {
+                auto tensor = std::make_shared<Tensor>(ndim, PrecisionType::FP32, 0, i);
+                tensor->set_buffer_ptr(buffer_table.data() + static_cast<size_t>(i) * 32 * 64 * 64);
+                tensors.push_back(tensor);
+            }
+            ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            grown = std::max(grown, resident_bytes() - std::min(resident_bytes(), resident));
+        }
+        std::cout << "[          ] " << name << ": prepare of " << kOperators << " operators " << ms / kRepeat
+                  << " ms, RSS +" << grown / 1024 << " KB" << std::endl;
+    }
+};
+
+TEST_F(ENN_CPU_OP_UT_NEONTensorPrepare, DISABLED_owning_tensor_vs_view) {
+    prepare<NEONTensor<float>>("NEONTensor");
+    prepare<NEONTensorView<float>>("NEONTensorView");
+}
+
+}  // namespace cpu
+}  // namespace ud
+}  // namespace enn
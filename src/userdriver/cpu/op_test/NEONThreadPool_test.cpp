@@ -0,0 +1,242 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "userdriver/cpu/common/NEONThreadPool.hpp"
+#include "userdriver/cpu/operators/NEONCFUConverter.hpp"
+#include "userdriver/cpu/operators/NEONDequantization.hpp"
+#include "userdriver/cpu/operators/Normalization.hpp"
+#include "userdriver/cpu/operators/Softmax.hpp"
+#include "userdriver/common/op_test/test_utils.h"
+
+namespace enn {
+namespace ud {
+namespace cpu {
+
+TEST(ENN_CPU_OP_UT_ThreadPool, covers_all_items_once) {
+    for (uint32_t thread_num = 1; thread_num <= ThreadPool::MAX_THREADS; ++thread_num) {
+        ThreadPool pool(thread_num);
+        ParallelScope scope(&pool, thread_num);
+        for (size_t size : {1, 7, 100, 12345}) {
+            for (size_t grain : {1, 10, 1000}) {
+                std::vector<std::atomic<int>> counts(size);
+                parallel_for(size, grain, [&](size_t begin, size_t end) {
+                    EXPECT_LT(begin, end);
+                    EXPECT_TRUE(end - begin >= std::min(grain, size) || end == size);
+                    for (size_t i = begin; i < end; ++i) ++counts[i];
+                });
+                for (size_t i = 0; i < size; ++i) ASSERT_EQ(counts[i], 1) << thread_num << ", " << size << ", " << i;
+            }
+        }
+    }
+}
+
+TEST(ENN_CPU_OP_UT_ThreadPool, runs_on_calling_thread_without_scope) {
+    ThreadPool pool(4);
+    int calls = 0;
+    parallel_for(1000, 1, [&](size_t begin, size_t end) {
+        EXPECT_EQ(begin, 0);
+        EXPECT_EQ(end, 1000);
+        EXPECT_EQ(ParallelScope::current().pool, nullptr);
+        ++calls;
+    });
+    EXPECT_EQ(calls, 1);
+
+    {
+        ParallelScope scope(&pool, 4);
+        EXPECT_EQ(ParallelScope::current().pool, &pool);
+        // Inner loops are done by each thread of the outer one, without waiting for workers.
+        std::atomic<int> outer_calls{0};
+        parallel_for(8, 1, [&](size_t begin, size_t end) {
+            int inner_calls = 0;
+            parallel_for(1000, 1, [&](size_t, size_t) { ++inner_calls; });
+            EXPECT_GE(inner_calls, 1);
+            outer_calls += end - begin;
+        });
+        EXPECT_EQ(outer_calls, 8);
+    }
+    EXPECT_EQ(ParallelScope::current().pool, nullptr);
+}
+
+TEST(ENN_CPU_OP_UT_ThreadPool, shares_workers_between_callers) {
+    ThreadPool pool(4);
+    std::vector<std::thread> callers;
+    std::vector<uint64_t> sums(8, 0);
+    for (size_t caller = 0; caller < sums.size(); ++caller) {
+        callers.emplace_back([&, caller]() {
+            // Callers of operator lists on different cores.
+            ParallelScope scope(&pool, 4, 1, caller % 2 ? 0x1 : 0x3);
+            for (int repeat = 0; repeat < 100; ++repeat) {
+                std::atomic<uint64_t> sum{0};
+                parallel_for(1000, 10, [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; ++i) sum += i;
+                });
+                sums[caller] += sum;
+            }
+        });
+    }
+    for (auto& caller : callers) caller.join();
+    for (auto sum : sums) EXPECT_EQ(sum, 100 * 999 * 1000 / 2);
+}
+
+#if defined(__linux__)
+TEST(ENN_CPU_OP_UT_ThreadPool, moves_workers_to_cores_of_each_loop) {
+    ThreadPool pool(2);
+    cpu_set_t caller_cores;
+    ASSERT_EQ(sched_getaffinity(0, sizeof(caller_cores), &caller_cores), 0);
+    const auto caller = std::this_thread::get_id();
+
+    // Cores of the worker joining a loop on the cores of core_affinity.
+    auto cores_of_worker = [&](uint32_t core_affinity) {
+        ParallelScope scope(&pool, 2, 1, core_affinity);
+        std::atomic<bool> joined{false};
+        cpu_set_t worker_cores;
+        CPU_ZERO(&worker_cores);
+        parallel_for(2, 1, [&](size_t, size_t) {
+            if (std::this_thread::get_id() != caller) {
+                if (!joined) sched_getaffinity(0, sizeof(worker_cores), &worker_cores);
+                joined = true;
+                return;
+            }
+            // The caller holds its task until the worker joins, which it is notified for.
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+            while (!joined && std::chrono::steady_clock::now() < deadline) std::this_thread::yield();
+        });
+        EXPECT_TRUE(joined.load());
+        return worker_cores;
+    };
+
+    cpu_set_t worker_cores = cores_of_worker(0x1);
+    EXPECT_EQ(CPU_COUNT(&worker_cores), 1);
+    EXPECT_TRUE(CPU_ISSET(0, &worker_cores));
+    // Any core for the next loop without affinity.
+    worker_cores = cores_of_worker(0);
+    EXPECT_TRUE(CPU_ISSET(0, &worker_cores));
+    EXPECT_GE(CPU_COUNT(&worker_cores), CPU_COUNT(&caller_cores));
+
+    // The calling thread stays where it is.
+    cpu_set_t cores;
+    ASSERT_EQ(sched_getaffinity(0, sizeof(cores), &cores), 0);
+    EXPECT_TRUE(CPU_EQUAL(&cores, &caller_cores));
+}
+#endif
+
+TEST(ENN_CPU_OP_UT_ThreadPool, runs_element_wise_loop_in_place) {
+    constexpr size_t kSize = 10007;
+    for (uint32_t thread_num = 1; thread_num <= ThreadPool::MAX_THREADS; ++thread_num) {
+        ThreadPool pool(thread_num);
+        ParallelScope scope(&pool, thread_num);
+        // Wider output, int8 to float.
+        std::vector<float> buffer(kSize);
+        auto bytes = reinterpret_cast<int8_t*>(buffer.data());
+        for (size_t i = 0; i < kSize; ++i) bytes[i] = static_cast<int8_t>(i % 251 - 125);
+        parallel_for_in_place(bytes, sizeof(int8_t), buffer.data(), sizeof(float), kSize, 100,
+                              [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) buffer[i] = bytes[i] * 0.5f;
+        });
+        for (size_t i = 0; i < kSize; ++i) ASSERT_EQ(buffer[i], (static_cast<int>(i % 251) - 125) * 0.5f) << i;
+
+        // Narrower output, float to int16.
+        auto halves = reinterpret_cast<int16_t*>(buffer.data());
+        parallel_for_in_place(buffer.data(), sizeof(float), halves, sizeof(int16_t), kSize, 100,
+                              [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) halves[i] = static_cast<int16_t>(buffer[i] * 2);
+        });
+        for (size_t i = 0; i < kSize; ++i) ASSERT_EQ(halves[i], static_cast<int>(i % 251) - 125) << i;
+    }
+}
+
+// Operators on 2 to 8 threads give the same output as on a thread.
+class ENN_CPU_OP_UT_ThreadScaling : public testing::Test {
+protected:
+    template <typename Func>
+    static void scale(const char* name, Func execute, const std::function<std::vector<uint8_t>()>& output) {
+        std::vector<uint8_t> expected;
+        for (uint32_t thread_num = 1; thread_num <= ThreadPool::MAX_THREADS; thread_num *= 2) {
+            ThreadPool pool(thread_num);
+            ParallelScope scope(&pool, thread_num);
+            EXPECT_EQ(execute(), Status::SUCCESS);
+            if (thread_num == 1) {
+                expected = output();
+            } else {
+                EXPECT_TRUE(output() == expected) << name << " on " << thread_num << " threads";
+            }
+        }
+    }
+
+    template <typename T>
+    static std::vector<uint8_t> bytes_of(const std::shared_ptr<NEONTensor<T>>& tensor) {
+        auto data = reinterpret_cast<const uint8_t*>(tensor->getDataPtr().get());
+        return std::vector<uint8_t>(data, data + GetDimSize(tensor->getDim()) * sizeof(T));
+    }
+};
+
+TEST_F(ENN_CPU_OP_UT_ThreadScaling, Softmax) {
+    // Logits of segmentation, softmax over channels.
+    Dim4 dims = {1, 21, 512, 512};
+    std::vector<float> input(GetDimSize(dims));
+    GenerateRandom<float>(input.data(), input.size(), -10, 10);
+    auto input_tensor = std::make_shared<NEONTensor<float>>(input.data(), dims, PrecisionType::FP32);
+    auto output_tensor = std::make_shared<NEONTensor<float>>(dims, PrecisionType::FP32);
+
+    Softmax softmax(PrecisionType::FP32);
+    ASSERT_EQ(softmax.initialize(input_tensor, dims.w, dims.h, dims.c, dims.n, 1.0f, 1), Status::SUCCESS);
+    scale("Softmax(1x21x512x512, axis 1)", [&]() { return softmax.execute(input_tensor, output_tensor); },
+          [&]() { return bytes_of(output_tensor); });
+}
+
+TEST_F(ENN_CPU_OP_UT_ThreadScaling, Normalization) {
+    Dim4 dims = {1, 3, 1024, 1024};
+    std::vector<uint8_t> input(GetDimSize(dims));
+    GenerateRandom<uint8_t>(input.data(), input.size(), 0, 255);
+    float mean[] = {123.675f, 116.28f, 103.53f};
+    float scale_data[] = {0.0171f, 0.0175f, 0.0174f};
+    auto input_tensor = std::make_shared<NEONTensor<uint8_t>>(input.data(), dims, PrecisionType::UINT8);
+    auto output_tensor = std::make_shared<NEONTensor<float>>(dims, PrecisionType::FP32);
+    auto mean_tensor = std::make_shared<NEONTensor<float>>(mean, Dim4{1, 3, 1, 1}, PrecisionType::FP32);
+    auto scale_tensor = std::make_shared<NEONTensor<float>>(scale_data, Dim4{1, 3, 1, 1}, PrecisionType::FP32);
+
+    Normalization normalization(PrecisionType::UINT8);
+    ASSERT_EQ(normalization.initialize(input_tensor, mean_tensor, scale_tensor, 1), Status::SUCCESS);
+    scale("Normalization(1x3x1024x1024, bgr)", [&]() { return normalization.execute(input_tensor, output_tensor); },
+          [&]() { return bytes_of(output_tensor); });
+}
+
+TEST_F(ENN_CPU_OP_UT_ThreadScaling, NEONDequantization) {
+    Dim4 dims = {1, 64, 256, 256};
+    std::vector<int16_t> input(GetDimSize(dims));
+    GenerateRandom<int16_t>(input.data(), input.size(), -32768, 32767);
+    std::vector<int32_t> frac_lens(dims.c);
+    GenerateRandom<int32_t>(frac_lens.data(), frac_lens.size(), 1, 8);
+    auto input_tensor = std::make_shared<NEONTensor<int16_t>>(input.data(), dims, PrecisionType::INT16);
+    auto output_tensor = std::make_shared<NEONTensor<float>>(dims, PrecisionType::FP32);
+    auto frac_tensor = std::make_shared<NEONTensor<int32_t>>(frac_lens.data(), Dim4{1, dims.c, 1, 1}, PrecisionType::INT32);
+
+    NEONDequantization dequantization(PrecisionType::INT16);
+    uint32_t img_size = dims.h * dims.w;
+    ASSERT_EQ(dequantization.initialize(input_tensor, dims.c * img_size, frac_tensor, img_size), Status::SUCCESS);
+    scale("NEONDequantization(1x64x256x256, int16)", [&]() { return dequantization.execute(input_tensor, output_tensor); },
+          [&]() { return bytes_of(output_tensor); });
+}
+
+TEST_F(ENN_CPU_OP_UT_ThreadScaling, NEONCFUConverter) {
+    Dim4 input_dims = {1, 100, 256, 256};
+    Dim4 output_dims = {1, 128, 256, 256};  // padded to interleaved slices
+    std::vector<int8_t> input(GetDimSize(input_dims));
+    GenerateRandom<int8_t>(input.data(), input.size(), -128, 127);
+    auto input_tensor = std::make_shared<NEONTensor<int8_t>>(input.data(), input_dims, PrecisionType::INT8);
+    auto output_tensor = std::make_shared<NEONTensor<int8_t>>(output_dims, PrecisionType::INT8);
+
+    NEONCFUConverter converter(PrecisionType::INT8, enn::platform::EXYNOS2100);
+    ASSERT_EQ(converter.initialize(input_tensor, input_dims.w, input_dims.h, input_dims.c, 1, 1, 32), Status::SUCCESS);
+    scale("NEONCFUConverter(1x100x256x256, int8)", [&]() { return converter.execute(input_tensor, output_tensor); },
+          [&]() { return bytes_of(output_tensor); });
+}
+
+}  // namespace cpu
+}  // namespace ud
+}  // namespace enn
@@ -0,0 +1,262 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "userdriver/cpu/common/NEONIncludes.hpp"
+
+namespace enn {
+namespace ud {
+namespace cpu {
+
+// Every back end compiled is checked against Scalar.
+template <typename V>
+class NEONVectorTest : public testing::Test {
+protected:
+    static constexpr size_t kSize = 1000003;  // not multiple of lanes, to cover remainders
+    static constexpr int kRepeat = 20;
+
+    template <typename T>
+    static std::vector<T> random_data(size_t size, float low, float high) {
+        std::mt19937 random(size);
+        std::uniform_real_distribution<float> distribution(low, high);
+        std::vector<T> data(size);
+        for (auto& value : data) value = static_cast<T>(distribution(random));
+        return data;
+    }
+
+    // Giga elements per second of the function over kSize elements.
+    template <typename Func>
+    static double measure(Func func) {
+        func();  // warm up
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < kRepeat; ++i) func();
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return static_cast<double>(kSize) * kRepeat / seconds / 1e9;
+    }
+
+    static void report(const char* kernel, double scalar, double vector) {
+        std::cout << "[          ] " << kernel << ": Scalar " << scalar << " Gelem/s, " << V::name << " " << vector
+                  << " Gelem/s (x" << vector / scalar << ")" << std::endl;
+    }
+};
+
+using Backends = testing::Types<simd::Scalar
+#if defined(__SSE4_1__)
+                                , simd::Sse4
+#endif
+#if defined(__AVX2__)
+                                , simd::Avx2
+#endif
+#if defined(NEON_OPT)
+                                , simd::Neon
+#endif
+                                >;
+TYPED_TEST_SUITE(NEONVectorTest, Backends);
+
+TYPED_TEST(NEONVectorTest, dequantize_matches_scalar) {
+    auto input = this->template random_data<int16_t>(this->kSize, -32768, 32767);
+    std::vector<float> expected(this->kSize), output(this->kSize);
+    kernel::dequantize<simd::Scalar>(input.data(), expected.data(), input.size(), 1.0f / 128);
+    kernel::dequantize<TypeParam>(input.data(), output.data(), input.size(), 1.0f / 128);
+    EXPECT_EQ(output, expected);
+
+    // In place, the input placed in the front of the output.
+    std::vector<float> in_place(this->kSize);
+    auto input8 = this->template random_data<int8_t>(this->kSize, -128, 127);
+    std::memcpy(in_place.data(), input8.data(), input8.size());
+    kernel::dequantize<simd::Scalar>(input8.data(), expected.data(), input8.size(), 0.25f);
+    kernel::dequantize<TypeParam>(reinterpret_cast<int8_t*>(in_place.data()), in_place.data(), input8.size(), 0.25f);
+    EXPECT_EQ(in_place, expected);
+}
+
+TYPED_TEST(NEONVectorTest, normalize_quantize_matches_scalar) {
+    // Out of the range of int8 on both sides, to cover the clip.
+    auto input = this->template random_data<float>(this->kSize, -300.0f, 300.0f);
+    input[0] = 2.5f;  // halves are rounded away from zero
+    input[1] = -2.5f;
+    input[2] = 0.49999997f;
+    std::vector<int8_t> expected(this->kSize), output(this->kSize);
+    kernel::normalize_quantize<simd::Scalar>(input.data(), expected.data(), input.size(), 0.0, 1.0f);
+    kernel::normalize_quantize<TypeParam>(input.data(), output.data(), input.size(), 0.0, 1.0f);
+    EXPECT_EQ(output, expected);
+    EXPECT_EQ(output[0], 3);
+    EXPECT_EQ(output[1], -3);
+    EXPECT_EQ(output[2], 0);
+    for (size_t i = 0; i < input.size(); ++i) {
+        auto value = static_cast<int32_t>(std::round(input[i]));
+        ASSERT_EQ(output[i], kernel::clip_to_sign_bit<int8_t>(value)) << i;
+    }
+
+    auto pixels = this->template random_data<uint8_t>(this->kSize, 0, 255);
+    std::vector<int16_t> expected16(this->kSize), output16(this->kSize);
+    kernel::normalize_quantize<simd::Scalar>(pixels.data(), expected16.data(), pixels.size(), 127.5, 256.0f);
+    kernel::normalize_quantize<TypeParam>(pixels.data(), output16.data(), pixels.size(), 127.5, 256.0f);
+    EXPECT_EQ(output16, expected16);
+}
+
+TYPED_TEST(NEONVectorTest, deinterleave16_matches_scalar) {
+    auto input = this->template random_data<int8_t>(this->kSize / 32 * 32, -128, 127);
+    std::vector<int8_t> expected(input.size()), output(input.size());
+    const size_t half = input.size() / 2;
+    for (size_t i = 0; i < input.size(); i += 32) {
+        kernel::deinterleave16<simd::Scalar>(input.data() + i, expected.data() + i / 2, expected.data() + half + i / 2);
+        kernel::deinterleave16<TypeParam>(input.data() + i, output.data() + i / 2, output.data() + half + i / 2);
+    }
+    EXPECT_EQ(output, expected);
+    EXPECT_EQ(output[0], input[0]);
+    EXPECT_EQ(output[half], input[1]);
+}
+
+TYPED_TEST(NEONVectorTest, mark_class_in_use_matches_scalar) {
+    constexpr uint32_t kClasses = 91;
+    const uint32_t priors = this->kSize / kClasses;
+    auto conf = this->template random_data<float>(kClasses * priors, -10.0f, 1.0f);
+    std::vector<uint32_t> expected(kClasses, 0), output(kClasses, 0);
+    kernel::mark_class_in_use<simd::Scalar>(conf.data(), kClasses, priors, 0.999f, expected.data());
+    kernel::mark_class_in_use<TypeParam>(conf.data(), kClasses, priors, 0.999f, output.data());
+    for (uint32_t c = 0; c < kClasses; ++c) EXPECT_EQ(output[c] != 0, expected[c] != 0) << c;
+}
+
+// Throughput of the back end against Scalar. Run with --gtest_also_run_disabled_tests.
+TYPED_TEST(NEONVectorTest, DISABLED_throughput_against_scalar) {
+    auto input = this->template random_data<int16_t>(this->kSize, -32768, 32767);
+    std::vector<float> output(this->kSize);
+    double scalar = this->measure([&]() {
+        kernel::dequantize<simd::Scalar>(input.data(), output.data(), input.size(), 1.0f / 128);
+    });
+    double vector = this->measure([&]() {
+        kernel::dequantize<TypeParam>(input.data(), output.data(), input.size(), 1.0f / 128);
+    });
+    this->report("dequantize(int16)", scalar, vector);
+
+    auto pixels = this->template random_data<uint8_t>(this->kSize, 0, 255);
+    std::vector<int16_t> output16(this->kSize);
+    scalar = this->measure([&]() {
+        kernel::normalize_quantize<simd::Scalar>(pixels.data(), output16.data(), pixels.size(), 127.5, 256.0f);
+    });
+    vector = this->measure([&]() {
+        kernel::normalize_quantize<TypeParam>(pixels.data(), output16.data(), pixels.size(), 127.5, 256.0f);
+    });
+    this->report("normalize_quantize(uint8->int16)", scalar, vector);
+
+    auto input8 = this->template random_data<int8_t>(this->kSize / 32 * 32, -128, 127);
+    std::vector<int8_t> output8(input8.size());
+    const size_t half = input8.size() / 2;
+    auto deinterleave = [&](auto backend) {
+        using V = decltype(backend);
+        for (size_t i = 0; i < input8.size(); i += 32) {
+            kernel::deinterleave16<V>(input8.data() + i, output8.data() + i / 2, output8.data() + half + i / 2);
+        }
+    };
+    scalar = this->measure([&]() { deinterleave(simd::Scalar{}); });
+    vector = this->measure([&]() { deinterleave(TypeParam{}); });
+    this->report("deinterleave16", scalar, vector);
+
+    constexpr uint32_t kClasses = 91;
+    const uint32_t priors = this->kSize / kClasses;
+    auto conf = this->template random_data<float>(kClasses * priors, -10.0f, 1.0f);
+    std::vector<uint32_t> in_use(kClasses, 0);
+    scalar = this->measure([&]() {
+        kernel::mark_class_in_use<simd::Scalar>(conf.data(), kClasses, priors, 0.999f, in_use.data());
+    });
+    vector = this->measure([&]() {
+        kernel::mark_class_in_use<TypeParam>(conf.data(), kClasses, priors, 0.999f, in_use.data());
+    });
+    this->report("mark_class_in_use", scalar, vector);
+
+    constexpr size_t kChannels = 21;
+    const size_t positions = this->kSize / kChannels;
+    auto classes = this->template random_data<uint8_t>(kChannels * positions, 0.0f, 16.0f);
+    std::vector<int32_t> arg_max(positions);
+    scalar = this->measure([&]() {
+        kernel::arg_extreme_channels<simd::Scalar>(classes.data(), arg_max.data(), kChannels, positions, positions, true);
+    });
+    vector = this->measure([&]() {
+        kernel::arg_extreme_channels<TypeParam>(classes.data(), arg_max.data(), kChannels, positions, positions, true);
+    });
+    this->report("arg_extreme_channels(uint8)", scalar, vector);
+}
+
+TYPED_TEST(NEONVectorTest, exp_matches_std) {
+    auto input = this->template random_data<float>(this->kSize / 8 * 8, -100.0f, 0.0f);
+    input[0] = 0.0f;
+    input[1] = -87.0f;
+    std::vector<float> output(input.size());
+    for (size_t i = 0; i < input.size(); i += 8) {
+        TypeParam::store(output.data() + i, kernel::exp<TypeParam>(TypeParam::load(input.data() + i)));
+    }
+    EXPECT_EQ(output[0], 1.0f);
+    for (size_t i = 0; i < input.size(); ++i) {
+        float expected = std::exp(input[i]);
+        if (input[i] >= -87.0f) {
+            ASSERT_NEAR(output[i], expected, expected * 1e-6f) << input[i];
+        } else {
+            ASSERT_LT(output[i], 1e-37f) << input[i];
+        }
+    }
+}
+
+TYPED_TEST(NEONVectorTest, DISABLED_exp_throughput_against_std) {
+    auto input = this->template random_data<float>(this->kSize / 8 * 8, -100.0f, 0.0f);
+    std::vector<float> output(input.size());
+    double scalar = this->measure([&]() {
+        for (size_t i = 0; i < input.size(); ++i) output[i] = std::exp(input[i]);
+    });
+    double vector = this->measure([&]() {
+        for (size_t i = 0; i < input.size(); i += 8) {
+            TypeParam::store(output.data() + i, kernel::exp<TypeParam>(TypeParam::load(input.data() + i)));
+        }
+    });
+    std::cout << "[          ] exp: std::exp " << scalar << " Gelem/s, " << TypeParam::name << " " << vector
+              << " Gelem/s (x" << vector / scalar << ")" << std::endl;
+}
+
+TYPED_TEST(NEONVectorTest, softmax_row_matches_scalar) {
+    auto input = this->template random_data<float>(1001, -20.0f, 20.0f);
+    std::vector<float> expected(input.size()), output(input.size());
+    for (bool log_softmax : {false, true}) {
+        kernel::softmax_row<simd::Scalar>(input.data(), expected.data(), input.size(), 1.5f, log_softmax);
+        kernel::softmax_row<TypeParam>(input.data(), output.data(), input.size(), 1.5f, log_softmax);
+        for (size_t i = 0; i < input.size(); ++i) ASSERT_NEAR(output[i], expected[i], 1e-6f) << i;
+    }
+    // Probabilities of log softmax sum to 1.
+    double sum = std::accumulate(output.begin(), output.end(), 0.0, [](double sum, float z) { return sum + std::exp(z); });
+    EXPECT_NEAR(sum, 1.0, 1e-5);
+}
+
+TYPED_TEST(NEONVectorTest, arg_extreme_matches_reference) {
+    // Few distinct values, so that ties are everywhere: the last of them for max, the first of them for min.
+    constexpr size_t kChannels = 21;
+    const size_t positions = this->kSize / kChannels;
+    auto input = this->template random_data<uint8_t>(kChannels * positions, 0.0f, 16.0f);
+    std::vector<int32_t> output(positions);
+    for (bool is_max : {true, false}) {
+        kernel::arg_extreme_channels<TypeParam>(input.data(), output.data(), kChannels, positions, positions, is_max);
+        for (size_t i = 0; i < positions; ++i) {
+            int32_t expected = 0;
+            for (size_t c = 1; c < kChannels; ++c) {
+                uint8_t value = input[c * positions + i], extreme = input[expected * positions + i];
+                if (is_max ? value >= extreme : value < extreme) expected = static_cast<int32_t>(c);
+            }
+            ASSERT_EQ(output[i], expected) << i;
+        }
+    }
+
+    auto row = this->template random_data<int8_t>(1001, -128.0f, 127.0f);
+    for (size_t size : {size_t(1), size_t(7), size_t(8), size_t(1001)}) {
+        auto max = std::max_element(row.begin(), row.begin() + size);
+        auto last_max = std::find(row.rbegin() + (row.size() - size), row.rend(), *max);
+        EXPECT_EQ(kernel::arg_extreme_row<TypeParam>(row.data(), size, true), row.rend() - last_max - 1) << size;
+        auto first_min = std::min_element(row.begin(), row.begin() + size);
+        EXPECT_EQ(kernel::arg_extreme_row<TypeParam>(row.data(), size, false), first_min - row.begin()) << size;
+    }
+}
+
+}  // namespace cpu
+}  // namespace ud
+}  // namespace enn
@@ -168,6 +168,19 @@ TEST(Normalization, CHANNEL_GT_THAN_THREE) {
     TEST_COMMON<uint8_t>(input_dims, 1, Status::FAILURE);
 }
 
+TEST(Normalization, BGR_IN_PLACE) {
+    Dim4 input_dims = {1, 3, 4, 4};
+    float mean[3] = {0.f, 0.f, 0.f}, scale[3] = {1.f, 1.f, 1.f};
+    auto tensor = std::make_shared<NEONTensor<float>>(input_dims, PrecisionType::FP32);
+    auto mean_tensor = std::make_shared<NEONTensor<float>>(mean, Dim4{1, 1, 1, 3}, PrecisionType::FP32);
+    auto scale_tensor = std::make_shared<NEONTensor<float>>(scale, Dim4{1, 1, 1, 3}, PrecisionType::FP32);
+
+    // Planes move with bgr_transpose, so it fails rather than copying the input when the output is on it.
+    Normalization normalize(PrecisionType::FP32);
+    EXPECT_EQ(normalize.initialize(tensor, mean_tensor, scale_tensor, 1), Status::SUCCESS);
+    EXPECT_EQ(normalize.execute(tensor, tensor), Status::FAILURE);
+}
+
 }  // namespace cpu
 }  // namespace ud
 }  // namespace enn
@@ -1,4 +1,6 @@
 #include <gtest/gtest.h>
+#include <chrono>
+#include <iostream>
 #include "userdriver/cpu/operators/Softmax.hpp"
 #include "userdriver/common/op_test/test_utils.h"
 
@@ -101,6 +103,144 @@ TEST(ENN_CPU_OP_UT_Softmax, INVALID_DATATYPE) {
         .TestRun(input_data, reference_output_data, 0.2, 0, Status::FAILURE);
 }
 
+// Softmax in double over channel_number elements of stride inner_number, as the kernel was before vectorized.
+template <typename T>
+static void ReferenceSoftmax(const T* input, float* output, const Dim4& dims, int32_t axis, float coef, bool log_softmax) {
+    int32_t out_number = axis == 1 ? dims.n : dims.n * dims.c * dims.h;
+    int32_t channel_number = axis == 1 ? dims.c : dims.w;
+    int32_t inner_number = axis == 1 ? dims.h * dims.w : 1;
+    for (int32_t j = 0; j < out_number; j++) {
+        for (int32_t i = 0; i < inner_number; i++) {
+            size_t offset = static_cast<size_t>(j) * channel_number * inner_number + i;
+            double max = input[offset] * coef, sum = 0;
+            for (int32_t c = 1; c < channel_number; c++) {
+                max = std::max<double>(max, input[offset + c * inner_number] * coef);
+            }
+            for (int32_t c = 0; c < channel_number; c++) sum += exp(input[offset + c * inner_number] * coef - max);
+            for (int32_t c = 0; c < channel_number; c++) {
+                double z = input[offset + c * inner_number] * coef - max;
+                output[offset + c * inner_number] = log_softmax ? z - log(sum) : exp(z) / sum;
+            }
+        }
+    }
+}
+
+TEST(ENN_CPU_OP_UT_Softmax, LOG_SOFTMAX) {
+    for (int32_t axis : {1, 3}) {
+        Dim4 dims = {2, 19, 5, 37};
+        std::vector<float> input(GetDimSize(dims)), expected(input.size());
+        GenerateRandom<float>(input.data(), input.size(), -50, 50);
+        ReferenceSoftmax(input.data(), expected.data(), dims, axis, 0.5f, true);
+
+        auto input_tensor = std::make_shared<NEONTensor<float>>(input.data(), dims, PrecisionType::FP32);
+        auto output_tensor = std::make_shared<NEONTensor<float>>(dims, PrecisionType::FP32);
+        Softmax softmax(PrecisionType::FP32);
+        EXPECT_EQ(softmax.initialize(input_tensor, dims.w, dims.h, dims.c, dims.n, 0.5f, axis, true), Status::SUCCESS);
+        EXPECT_EQ(softmax.execute(input_tensor, output_tensor), Status::SUCCESS);
+        Compare(output_tensor->getDataPtr().get(), expected.data(), expected.size(), 1e-4);
+    }
+}
+
+TEST(ENN_CPU_OP_UT_Softmax, IN_PLACE) {
+    Dim4 dims = {1, 10, 9, 11};
+    std::vector<float> input(GetDimSize(dims)), expected(input.size());
+    GenerateRandom<float>(input.data(), input.size(), -10, 10);
+    ReferenceSoftmax(input.data(), expected.data(), dims, 1, 1.0f, false);
+
+    auto tensor = std::make_shared<NEONTensor<float>>(input.data(), dims, PrecisionType::FP32);
+    Softmax softmax(PrecisionType::FP32);
+    EXPECT_EQ(softmax.initialize(tensor, dims.w, dims.h, dims.c, dims.n, 1.0f, 1), Status::SUCCESS);
+    EXPECT_EQ(softmax.execute(tensor, tensor), Status::SUCCESS);
+    Compare(tensor->getDataPtr().get(), expected.data(), expected.size(), ERROR_THRESHOLD);
+}
+
+// Quantized inputs are dequantized by their scale in the kernel, the zero point does not change softmax.
+TEST(ENN_CPU_OP_UT_Softmax, DEQUANTIZE_AND_SOFTMAX) {
+    Dim4 dims = {1, 21, 17, 33};
+    std::vector<int8_t> input8(GetDimSize(dims));
+    std::vector<int16_t> input16(input8.size());
+    std::vector<float> expected(input8.size());
+    GenerateRandom<int8_t>(input8.data(), input8.size(), -128, 127);
+    GenerateRandom<int16_t>(input16.data(), input16.size(), -32768, 32767);
+
+    for (int32_t axis : {1, 3}) {
+        ReferenceSoftmax(input8.data(), expected.data(), dims, axis, 0.05f * 2.0f, false);
+        auto input_tensor = std::make_shared<NEONTensor<int8_t>>(input8.data(), dims, PrecisionType::INT8, 0, UNDEFINED,
+                                                                 0.05f, 3);
+        auto output_tensor = std::make_shared<NEONTensor<float>>(dims, PrecisionType::FP32);
+        Softmax softmax(PrecisionType::INT8);
+        EXPECT_EQ(softmax.initialize(input_tensor, dims.w, dims.h, dims.c, dims.n, 2.0f, axis), Status::SUCCESS);
+        EXPECT_EQ(softmax.execute(input_tensor, output_tensor), Status::SUCCESS);
+        Compare(output_tensor->getDataPtr().get(), expected.data(), expected.size(), ERROR_THRESHOLD);
+
+        ReferenceSoftmax(input16.data(), expected.data(), dims, axis, 1.0f / 2048, true);
+        auto input16_tensor = std::make_shared<NEONTensor<int16_t>>(input16.data(), dims, PrecisionType::INT16, 0,
+                                                                    UNDEFINED, 1.0f / 2048);
+        EXPECT_EQ(softmax.initialize(input16_tensor, dims.w, dims.h, dims.c, dims.n, 1.0f, axis, true), Status::SUCCESS);
+        EXPECT_EQ(softmax.execute(input16_tensor, output_tensor), Status::SUCCESS);
+        Compare(output_tensor->getDataPtr().get(), expected.data(), expected.size(), 1e-4);
+    }
+}
+
+// Speed of the kernel compared with the reference, as the kernel was before(scalar exp in double), and of
+// dequantize+softmax of int8 compared with dequantization to a buffer and softmax of it.
+class ENN_CPU_OP_UT_SoftmaxBenchmark : public testing::Test {
+protected:
+    static constexpr int kRepeat = 5;
+
+    template <typename Func>
+    static double measure(Func func) {
+        func();  // warm up
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < kRepeat; ++i) func();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / kRepeat;
+    }
+
+    static void run(const char* name, const Dim4& dims, int32_t axis) {
+        std::vector<float> input(GetDimSize(dims)), expected(input.size());
+        GenerateRandom<float>(input.data(), input.size(), -10, 10);
+        auto input_tensor = std::make_shared<NEONTensor<float>>(input.data(), dims, PrecisionType::FP32);
+        auto output_tensor = std::make_shared<NEONTensor<float>>(dims, PrecisionType::FP32);
+        Softmax softmax(PrecisionType::FP32);
+        ASSERT_EQ(softmax.initialize(input_tensor, dims.w, dims.h, dims.c, dims.n, 1.0f, axis), Status::SUCCESS);
+
+        double reference = measure([&]() { ReferenceSoftmax(input.data(), expected.data(), dims, axis, 1.0f, false); });
+        double kernel = measure([&]() { softmax.execute(input_tensor, output_tensor); });
+        Compare(output_tensor->getDataPtr().get(), expected.data(), expected.size(), ERROR_THRESHOLD);
+        std::cout << "[          ] " << name << ": reference " << reference << " ms, kernel " << kernel << " ms (x"
+                  << reference / kernel << ")" << std::endl;
+    }
+};
+
+TEST_F(ENN_CPU_OP_UT_SoftmaxBenchmark, DISABLED_segmentation_over_channels) {
+    run("Softmax(1x21x512x512, axis 1)", {1, 21, 512, 512}, 1);
+}
+
+TEST_F(ENN_CPU_OP_UT_SoftmaxBenchmark, DISABLED_classification_over_rows) {
+    run("Softmax(64x1x1x1001, axis 3)", {64, 1, 1, 1001}, 3);
+}
+
+TEST_F(ENN_CPU_OP_UT_SoftmaxBenchmark, DISABLED_dequantize_and_softmax) {
+    Dim4 dims = {1, 21, 512, 512};
+    std::vector<int8_t> input(GetDimSize(dims));
+    GenerateRandom<int8_t>(input.data(), input.size(), -128, 127);
+    auto input_tensor = std::make_shared<NEONTensor<int8_t>>(input.data(), dims, PrecisionType::INT8, 0, UNDEFINED, 0.1f);
+    auto dequantized_tensor = std::make_shared<NEONTensor<float>>(dims, PrecisionType::FP32);
+    auto output_tensor = std::make_shared<NEONTensor<float>>(dims, PrecisionType::FP32);
+    Softmax softmax(PrecisionType::INT8);
+    ASSERT_EQ(softmax.initialize(input_tensor, dims.w, dims.h, dims.c, dims.n, 1.0f, 1), Status::SUCCESS);
+    Softmax float_softmax(PrecisionType::FP32);
+    ASSERT_EQ(float_softmax.initialize(dequantized_tensor, dims.w, dims.h, dims.c, dims.n, 1.0f, 1), Status::SUCCESS);
+
+    double separate = measure([&]() {
+        kernel::dequantize(input.data(), dequantized_tensor->getBufferPtr(), input.size(), 0.1f);
+        float_softmax.execute(dequantized_tensor, output_tensor);
+    });
+    double fused = measure([&]() { softmax.execute(input_tensor, output_tensor); });
+    std::cout << "[          ] Dequantize+Softmax(1x21x512x512, int8): separate " << separate << " ms, fused " << fused
+              << " ms (x" << separate / fused << ")" << std::endl;
+}
+
 }  // namespace cpu
 }  // namespace ud
 }  // namespace enn
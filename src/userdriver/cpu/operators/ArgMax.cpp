@@ -30,12 +30,7 @@ Status ArgMax::initialize(const std::shared_ptr<ITensor> input, const int32_t& a
 }
 
 Status ArgMax::execute(const std::shared_ptr<ITensor> input, std::shared_ptr<ITensor> output) {
-    if (precision_ == PrecisionType::UINT8) {
-        DEBUG_PRINT("CPU ArgMax UINT8 is not supported\n");
-        return Status::FAILURE;
-    } else {
-        return evalFloat(input, output, axis_, true);
-    }
+    return evalArgExtreme(input, output, axis_, true);
 }
 
 Status ArgMax::release() {
@@ -30,12 +30,7 @@ Status ArgMin::initialize(const std::shared_ptr<ITensor> input, const int32_t& a
 }
 
 Status ArgMin::execute(const std::shared_ptr<ITensor> input, std::shared_ptr<ITensor> output) {
-    if (precision_ == PrecisionType::UINT8) {
-        DEBUG_PRINT("CPU ArgMin UINT8 is not supported\n");
-        return Status::FAILURE;
-    } else {
-        return evalFloat(input, output, axis_, false);
-    }
+    return evalArgExtreme(input, output, axis_, false);
 }
 
 Status ArgMin::release() {
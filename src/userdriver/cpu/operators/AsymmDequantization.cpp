@@ -37,6 +37,7 @@ Status AsymmDequantization::executeKernel(const std::shared_ptr<NEONTensor<T1>>
     DEBUG_PRINT("data_num=[%d], channel=[%d], scale=[%f], zero_point=[%d]\n",
                 data_num, data_num / img_size, scale, zero_point);
 
+    // Backward, so that the wider output may be on the input.
     if (input_data_type == DataType::UINT8) {
         for (int32_t idx = data_num - 1; idx >= 0; idx--) {
             output_data[idx] = (static_cast<float>(static_cast<uint8_t>(input_data[idx])) - zero_point) * scale;
@@ -79,6 +80,27 @@ Status AsymmDequantization::execute(const std::shared_ptr<ITensor> input, std::s
     }
 }
 
+bool AsymmDequantization::getPipelineStage(const std::shared_ptr<ITensor> input, PipelineStage* stage) {
+    if (data_num <= 0) {
+        return false;
+    }
+    switch (input->getDataType()) {
+        case DataType::INT16:
+        case DataType::INT8:
+        case DataType::UINT8:
+            stage->input_type = input->getDataType();
+            break;
+        default:
+            return false;
+    }
+    stage->type = PipelineStage::Type::AFFINE;
+    stage->plane_size = data_num;
+    stage->channel = 1;
+    stage->means = {static_cast<float>(zero_point)};
+    stage->scales = {scale};
+    return true;
+}
+
 Status AsymmDequantization::release() {
     return Status::SUCCESS;
 }
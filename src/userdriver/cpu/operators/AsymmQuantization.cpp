@@ -39,6 +39,7 @@ Status AsymmQuantization::executeKernel(const std::shared_ptr<NEONTensor<T1>> in
     DEBUG_PRINT("width=[%d], height=[%d], channel=[%d], scale=[%f], zero_point=[%d]\n", width, height, channel, scale,
                 zero_point);
 
+    // Forward, so that the narrower output may be on the input.
     int32_t data_num = width * height * channel;
     if (output_data_type == DataType::UINT8) {
         int val;
@@ -84,6 +85,19 @@ Status AsymmQuantization::execute(const std::shared_ptr<ITensor> input, std::sha
     }
 }
 
+bool AsymmQuantization::getPipelineStage(const std::shared_ptr<ITensor> input, PipelineStage* stage) {
+    if (input->getDataType() != DataType::FLOAT) {
+        return false;
+    }
+    stage->type = PipelineStage::Type::ASYMM_QUANTIZE;
+    stage->input_type = DataType::FLOAT;
+    stage->plane_size = channel * width * height;
+    stage->channel = 1;
+    stage->means = {static_cast<float>(zero_point)};
+    stage->scales = {scale};
+    return true;
+}
+
 Status AsymmQuantization::release() {
     return Status::SUCCESS;
 }
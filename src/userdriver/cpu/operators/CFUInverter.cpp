@@ -83,19 +83,19 @@ Status CFUInverter::executeKernel_impl_common(T* src_addr, T* dest_addr, int32_t
         cell_size *= interleaved_slices;
     }
     int frame_size = height * width;
-    int slice, num_slices = channel / cell_size, partial_slice = channel % cell_size;
-    int counter = 0, source_index = 0, total_slices = (partial_slice != 0) ? num_slices + 1 : num_slices;
-    // iterating through the bytes in cell formatted data
-    for (slice = 0; slice <= num_slices; ++slice) {
-        if (slice == num_slices) {
-            cell_size = partial_slice;
-        }
-
-        for (int cs = 0; cs < cell_size; ++cs) {
+    int num_slices = channel / cell_size, partial_slice = channel % cell_size;
+    int total_slices = (partial_slice != 0) ? num_slices + 1 : num_slices;
+    int byte_size = (data_type == DataType::INT16) ? 2 : 1;
+    // A channel is a line of frame_size in the output, and channels are split over threads.
+    parallel_for(channel, parallel_grain(frame_size * byte_size), [&](size_t begin, size_t end) {
+        for (int line = begin; line < static_cast<int>(end); ++line) {
+            int slice = line / cell_size, cs = line % cell_size;
+            int counter = line * frame_size * byte_size;
+            // iterating through the bytes in cell formatted data
             for (int f = 0; f < frame_size; ++f) {
                 // calculating the offset from starting pointer
                 // storing the output in correct sequence one byte at a time
-                source_index = cs + f * interleaved_slices + slice * frame_size * interleaved_slices;
+                int source_index = cs + f * interleaved_slices + slice * frame_size * interleaved_slices;
                 if (counter < output_size) {
                     dest_addr[counter] = src_addr[source_index];
                 } else {
@@ -109,7 +109,7 @@ Status CFUInverter::executeKernel_impl_common(T* src_addr, T* dest_addr, int32_t
                 }
             }
         }
-    }
+    });
 
     return Status::SUCCESS;
 }
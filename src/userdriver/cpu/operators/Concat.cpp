@@ -4,6 +4,37 @@ namespace enn {
 namespace ud {
 namespace cpu {
 
+namespace {
+
+template <size_t BYTES>
+void copyIntervals(uint8_t* out, const uint8_t* in, size_t out_stride, size_t num) {
+    for (size_t j = 0; j < num; ++j) {
+        memcpy(out + j * out_stride, in + j * BYTES, BYTES);
+    }
+}
+
+// Copy num intervals of bytes from in to out, where the intervals of out are out_stride bytes apart.
+void copyIntervals(uint8_t* out, const uint8_t* in, size_t bytes, size_t out_stride, size_t num) {
+    switch (bytes) {
+        case 1:
+            return copyIntervals<1>(out, in, out_stride, num);
+        case 2:
+            return copyIntervals<2>(out, in, out_stride, num);
+        case 4:
+            return copyIntervals<4>(out, in, out_stride, num);
+        case 8:
+            return copyIntervals<8>(out, in, out_stride, num);
+        case 16:
+            return copyIntervals<16>(out, in, out_stride, num);
+        default:
+            for (size_t j = 0; j < num; ++j) {
+                memcpy(out + j * out_stride, in + j * bytes, bytes);
+            }
+    }
+}
+
+}  // namespace
+
 Concat::Concat(const PrecisionType& precision) {
     precision_ = precision;
     inputNum = 0;
@@ -30,57 +61,107 @@ template <typename T>
 Status Concat::executeKernel(const std::vector<std::shared_ptr<ITensor>> input_tensor,
                              std::shared_ptr<NEONTensor<T>> output_tensor) {
     T* output = output_tensor->getBufferPtr();
-    T** inputs = new T*[input_tensor.size()];
-    for (uint32_t i = 0; i < input_tensor.size(); i++) {
-        auto input = std::static_pointer_cast<NEONTensor<T>>(input_tensor.at(i));
-        inputs[i] = input->getBufferPtr();
-    }
-
-    // only 2 input is handled
-    if ((!inputs) || (!inputs[0]) || (!inputs[1]) || (!output) || (inputNum != 2) || (channel <= 0) || (height <= 0) ||
-        (width <= 0)) {
+    if ((!output) || (inputNum <= 0) || (input_tensor.size() < static_cast<size_t>(inputNum)) || (number <= 0) ||
+        (channel <= 0) || (height <= 0) || (width <= 0)) {
         ERROR_PRINT("Invalid parameter\n");
-        delete[] inputs;
         return Status::INVALID_PARAMS;
     }
-
-    uint32_t loopNum;
-    uint32_t interval;
-    if (axis == 0) {
-        loopNum = 1;
-        interval = number * channel * height * width;
-    } else if (axis == 1) {
-        loopNum = number;
-        interval = channel * height * width;
-    } else if (axis == 2) {
-        loopNum = number * channel;
-        interval = height * width;
-    } else if (axis == 3) {
-        loopNum = number * channel * height;
-        interval = width;
-    } else {
+    if ((axis < 0) || (axis > 3)) {
         ERROR_PRINT("Un-supported axis value : %d\n", axis);
-        delete[] inputs;
         return Status::INVALID_PARAMS;
     }
 
-    for (uint32_t i = 0; i < inputNum; ++i) {
-        for (uint32_t j = 0; j < loopNum; ++j) {
-            uint32_t inIdx = j * interval;
-            uint32_t outIdx = (i + j * inputNum) * interval;
-            memcpy(output + outIdx, inputs[i] + inIdx, sizeof(uint8_t) * interval);
+    // The output is loopNum slices, each of which is an interval of every input in turn: the input's elements of
+    // the dims from axis.
+    const uint32_t dims[] = {static_cast<uint32_t>(number), static_cast<uint32_t>(channel),
+                             static_cast<uint32_t>(height), static_cast<uint32_t>(width)};
+    uint32_t loopNum = 1;
+    for (int32_t d = 0; d < axis; ++d) {
+        loopNum *= dims[d];
+    }
+    std::vector<const T*> inputs(inputNum);
+    std::vector<size_t> intervals(inputNum);
+    size_t outInterval = 0;
+    for (int32_t i = 0; i < inputNum; ++i) {
+        const Dim4& input_dim = input_tensor[i]->getDim();
+        const uint32_t input_dims[] = {input_dim.n, input_dim.c, input_dim.h, input_dim.w};
+        intervals[i] = 1;
+        for (int32_t d = 0; d < 4; ++d) {
+            if ((d != axis) && (input_dims[d] != dims[d])) {
+                ERROR_PRINT("Dims of input %d do not match : %u != %u at %d\n", i, input_dims[d], dims[d], d);
+                return Status::INVALID_PARAMS;
+            }
+            if (d >= axis) {
+                intervals[i] *= input_dims[d];
+            }
         }
+        inputs[i] = std::static_pointer_cast<NEONTensor<T>>(input_tensor[i])->getBufferPtr();
+        if (!inputs[i]) {
+            ERROR_PRINT("Invalid parameter\n");
+            return Status::INVALID_PARAMS;
+        }
+        outInterval += intervals[i];
     }
-    delete[] inputs;
+
+    parallel_for(loopNum, parallel_grain(outInterval), [&](size_t begin, size_t end) {
+        if (axis == 3) {
+            // Intervals along width are a few elements, so an input at a time is copied to all the slices, by a
+            // load and a store for each of them if possible.
+            T* out = output + begin * outInterval;
+            for (int32_t i = 0; i < inputNum; ++i) {
+                const T* in = inputs[i] + begin * intervals[i];
+                copyIntervals(reinterpret_cast<uint8_t*>(out), reinterpret_cast<const uint8_t*>(in),
+                              sizeof(T) * intervals[i], sizeof(T) * outInterval, end - begin);
+                out += intervals[i];
+            }
+            return;
+        }
+        // Slices are written in turn, so the output is written sequentially.
+        for (size_t j = begin; j < end; ++j) {
+            T* out = output + j * outInterval;
+            for (int32_t i = 0; i < inputNum; ++i) {
+                memcpy(out, inputs[i] + j * intervals[i], sizeof(T) * intervals[i]);
+                out += intervals[i];
+            }
+        }
+    });
     return Status::SUCCESS;
 }
 
 Status Concat::execute(const std::vector<std::shared_ptr<ITensor>> input, std::shared_ptr<ITensor> output) {
     switch (input[0]->getDataType()) {
+        case DataType::FLOAT: {
+            DEBUG_PRINT("DataType::FLOAT\n");
+            return executeKernel(input, std::static_pointer_cast<NEONTensor<float>>(output));
+        }
+        case DataType::HALF:
+        case DataType::FLOAT16: {
+            DEBUG_PRINT("DataType::FLOAT16\n");
+            return executeKernel(input, std::static_pointer_cast<NEONTensor<_Float16_t>>(output));
+        }
+        case DataType::INT32: {
+            DEBUG_PRINT("DataType::INT32\n");
+            return executeKernel(input, std::static_pointer_cast<NEONTensor<int32_t>>(output));
+        }
+        case DataType::INT16: {
+            DEBUG_PRINT("DataType::INT16\n");
+            return executeKernel(input, std::static_pointer_cast<NEONTensor<int16_t>>(output));
+        }
+        case DataType::UINT16: {
+            DEBUG_PRINT("DataType::UINT16\n");
+            return executeKernel(input, std::static_pointer_cast<NEONTensor<uint16_t>>(output));
+        }
+        case DataType::INT8: {
+            DEBUG_PRINT("DataType::INT8\n");
+            return executeKernel(input, std::static_pointer_cast<NEONTensor<int8_t>>(output));
+        }
         case DataType::UINT8: {
             DEBUG_PRINT("DataType::UINT8\n");
-            auto output_tensor = std::static_pointer_cast<NEONTensor<uint8_t>>(output);
-            return executeKernel(input, output_tensor);
+            return executeKernel(input, std::static_pointer_cast<NEONTensor<uint8_t>>(output));
+        }
+        case DataType::BOOL: {
+            DEBUG_PRINT("DataType::BOOL\n");
+            return executeKernel(input, std::static_pointer_cast<NEONTensor<bool>>(output));
         }
         default: {
             ERROR_PRINT("Data type is not supported\n");
@@ -1,13 +1,19 @@
 #pragma once
 
+#include <cstring>
+#include <vector>
+
 #include "userdriver/common/operator_interfaces/common/Common.hpp"
 #include "userdriver/common/operator_interfaces/interfaces/operators/IConcat.hpp"
 #include "userdriver/cpu/common/NEONTensor.hpp"
+#include "userdriver/cpu/common/NEONIncludes.hpp"
 
 namespace enn {
 namespace ud {
 namespace cpu {
 
+// Concatenation of inputNum inputs along axis of NCHW. Dims of the inputs but axis are the same as number, channel,
+// height and width of the first input, and the inputs can be of any data type.
 class Concat : public IConcat {
 public:
     explicit Concat(const PrecisionType& precision);
@@ -1,5 +1,7 @@
 #include "userdriver/common/operator_interfaces/common/Debug.hpp"
 #include "userdriver/cpu/operators/neon_impl/BboxUtil.hpp"
+#include "userdriver/cpu/operators/neon_impl/FastNMS.hpp"
+#include "userdriver/cpu/common/NEONIncludes.hpp"
 #include "userdriver/cpu/operators/Detection.hpp"
 
 namespace enn {
@@ -80,77 +82,72 @@ void Detection::Detect(const uint32_t &num_input, const uint32_t &num_classes, c
                        const float *loc_data, const float *conf_data, const float *prior_data, float *output_data,
                        uint32_t &output_channel, uint32_t &output_height, uint32_t &output_width) {
     int num_loc_classes = share_location ? 1 : num_classes;
-    // Retrieve all location predictions.
-    std::vector<Label_bbox> all_loc_preds;
-    GetLocPredictions(loc_data, num_input, num_priors, num_loc_classes, share_location, &all_loc_preds);
-    // Retrieve all confidences.
-    std::vector<std::map<int, std::vector<float>>> all_conf_scores;
-    GetConfidenceScores(conf_data, num_input, num_priors, num_classes, &all_conf_scores);
     // Retrieve all prior bboxes. It is same within a batch since we assume all
     // images in a batch are of same dimension.
     std::vector<NormalizedBBox> prior_bboxes;
     std::vector<std::vector<float>> prior_variances;
     GetPriorBBoxes(prior_data, num_priors, &prior_bboxes, &prior_variances);
-    // Decode all loc predictions to bboxes.
-    std::vector<Label_bbox> all_decode_bboxes;
+    // Decode all loc predictions to bboxes, all_decode_bboxes[i * num_loc_classes + c] for the loc class c of image i.
+    // Those of the background are left empty.
     const bool clip_bbox = false;
-    DecodeBBoxesAll(all_loc_preds, prior_bboxes, prior_variances, num_input, share_location, num_loc_classes,
-                    background_label_id, code_type, variance_encoded_in_target, clip_bbox, &all_decode_bboxes);
-    int num_kept = 0;
-    std::vector<std::map<int, std::vector<int>>> all_indices;
+    std::vector<BBoxArray> all_decode_bboxes(num_input * num_loc_classes);
     for (uint32_t i = 0; i < num_input; ++i) {
-        const Label_bbox &decode_bboxes = all_decode_bboxes[i];
-        const std::map<int, std::vector<float>> &conf_scores = all_conf_scores[i];
-        std::map<int, std::vector<int>> indices;
-        int num_det = 0;
-        for (uint32_t c = 0; c < num_classes; ++c) {
-            if ((background_label_id >= 0) && (c == static_cast<uint32_t>(background_label_id))) {
-                // Ignore background class.
-                continue;
-            }
-            if (conf_scores.find(c) == conf_scores.end()) {
-                // Something bad happened if there are no predictions for current label.
-            }
-            const std::vector<float> &scores = conf_scores.find(c)->second;
+        for (int c = 0; c < num_loc_classes; ++c) {
             int label = share_location ? -1 : c;
-            if (decode_bboxes.find(label) == decode_bboxes.end()) {
-                // Something bad happened if there are no predictions for current label.
+            if (label == background_label_id) {
+                // Ignore background class.
                 continue;
             }
-            const std::vector<NormalizedBBox> &bboxes = decode_bboxes.find(label)->second;
-            ApplyNMSFast(bboxes, scores, confidence_threshold, nms_threshold, eta, top_k, &(indices[c]));
-            num_det += indices[c].size();
+            BBoxArray &decode_bboxes = all_decode_bboxes[i * num_loc_classes + c];
+            decode_bboxes.resize(num_priors);
+            const float *loc_preds = loc_data + (static_cast<size_t>(i) * num_priors * num_loc_classes + c) * 4;
+            parallel_for(num_priors, parallel_grain(8), [&](size_t begin, size_t end) {
+                for (size_t p = begin; p < end; ++p) {
+                    const float *loc_pred = loc_preds + p * num_loc_classes * 4;
+                    NormalizedBBox bbox, decode_bbox;
+                    bbox.set_xmin(loc_pred[0]);
+                    bbox.set_ymin(loc_pred[1]);
+                    bbox.set_xmax(loc_pred[2]);
+                    bbox.set_ymax(loc_pred[3]);
+                    DecodeBBox(prior_bboxes[p], prior_variances[p], code_type, variance_encoded_in_target, clip_bbox, bbox,
+                               &decode_bbox);
+                    decode_bboxes.set(p, decode_bbox);
+                }
+            });
         }
-        if (keep_top_k > -1 && num_det > keep_top_k) {
-            std::vector<std::pair<float, std::pair<int, int>>> score_index_pairs;
-            std::map<int, std::vector<int>>::iterator it;
-            for (it = indices.begin(); it != indices.end(); it++) {
-                int label = it->first;
-                const std::vector<int> &label_indices = it->second;
-                if (conf_scores.find(label) == conf_scores.end()) {
-                    // Something bad happened for current label.
+    }
+    int num_kept = 0;
+    std::vector<std::vector<std::vector<int>>> all_indices(num_input);
+    for (uint32_t i = 0; i < num_input; ++i) {
+        // Detections of class c are all_indices[i][c]. NMS of classes are independent, so they are split over threads.
+        const float *conf_scores = conf_data + static_cast<size_t>(i) * num_priors * num_classes;
+        std::vector<std::vector<int>> &indices = all_indices[i];
+        indices.resize(num_classes);
+        parallel_for(num_classes, parallel_grain(num_priors), [&](size_t begin, size_t end) {
+            std::vector<std::pair<float, int>> score_index_vec;
+            for (uint32_t c = begin; c < end; ++c) {
+                if ((background_label_id >= 0) && (c == static_cast<uint32_t>(background_label_id))) {
+                    // Ignore background class.
                     continue;
                 }
-                const std::vector<float> &scores = conf_scores.find(label)->second;
-                for (size_t j = 0; j < label_indices.size(); ++j) {
-                    int idx = label_indices[j];
-                    score_index_pairs.push_back(std::make_pair(scores[idx], std::make_pair(label, idx)));
+                const BBoxArray &bboxes = all_decode_bboxes[i * num_loc_classes + (share_location ? 0 : c)];
+                if (bboxes.count() == 0) {
+                    // No predictions for current label.
+                    continue;
                 }
+                getTopKScoreIndex(conf_scores + c, num_priors, num_classes, confidence_threshold, top_k, &score_index_vec);
+                applyNMSFast(bboxes, score_index_vec, nms_threshold, eta, &indices[c]);
             }
+        });
+        int num_det = 0;
+        for (uint32_t c = 0; c < num_classes; ++c) {
+            num_det += indices[c].size();
+        }
+        if (keep_top_k > -1 && num_det > keep_top_k) {
             // Keep top k results per image
-            std::sort(score_index_pairs.begin(), score_index_pairs.end(), SortScorePairDescend<std::pair<int, int>>);
-            score_index_pairs.resize(keep_top_k);
-            // Store the new indices.
-            std::map<int, std::vector<int>> new_indices;
-            for (size_t j = 0; j < score_index_pairs.size(); ++j) {
-                int label = score_index_pairs[j].second.first;
-                int idx = score_index_pairs[j].second.second;
-                new_indices[label].push_back(idx);
-            }
-            all_indices.push_back(new_indices);
+            keepTopK(conf_scores, num_classes, keep_top_k, &indices);
             num_kept += keep_top_k;
         } else {
-            all_indices.push_back(indices);
             num_kept += num_det;
         }
     }
@@ -175,34 +172,20 @@ void Detection::Detect(const uint32_t &num_input, const uint32_t &num_classes, c
     }
     int count = 0;
     for (uint32_t i = 0; i < num_input; i++) {
-        const std::map<int, std::vector<float>> &conf_scores = all_conf_scores[i];
-        const Label_bbox &decode_bboxes = all_decode_bboxes[i];
-        std::map<int, std::vector<int>>::iterator it;
-        for (it = all_indices[i].begin(); it != all_indices[i].end(); it++) {
-            int label = it->first;
-            if (conf_scores.find(label) == conf_scores.end()) {
-                // Something bad happened if there are no predictions for current label.
-                continue;
-            }
-            const std::vector<float> &scores = conf_scores.find(label)->second;
-            int loc_label = share_location ? -1 : label;
-            if (decode_bboxes.find(loc_label) == decode_bboxes.end()) {
-                // Something bad happened if there are no predictions for current label.
-                continue;
-            }
-            const std::vector<NormalizedBBox> &bboxes = decode_bboxes.find(loc_label)->second;
-            std::vector<int> &indices = it->second;
+        const float *conf_scores = conf_data + static_cast<size_t>(i) * num_priors * num_classes;
+        for (uint32_t label = 0; label < num_classes; ++label) {
+            const BBoxArray &bboxes = all_decode_bboxes[i * num_loc_classes + (share_location ? 0 : label)];
+            const std::vector<int> &indices = all_indices[i][label];
             float *output_data_beg_ptr = output_data;
             for (size_t j = 0; j < indices.size(); ++j) {
                 int idx = indices[j];
                 *(output_data_beg_ptr + count * 7) = i;
                 *(output_data_beg_ptr + count * 7 + 1) = label;
-                *(output_data_beg_ptr + count * 7 + 2) = scores[idx];
-                const NormalizedBBox &bbox = bboxes[idx];
-                *(output_data_beg_ptr + count * 7 + 3) = bbox.xmin();
-                *(output_data_beg_ptr + count * 7 + 4) = bbox.ymin();
-                *(output_data_beg_ptr + count * 7 + 5) = bbox.xmax();
-                *(output_data_beg_ptr + count * 7 + 6) = bbox.ymax();
+                *(output_data_beg_ptr + count * 7 + 2) = conf_scores[idx * num_classes + label];
+                *(output_data_beg_ptr + count * 7 + 3) = bboxes.xmin[idx];
+                *(output_data_beg_ptr + count * 7 + 4) = bboxes.ymin[idx];
+                *(output_data_beg_ptr + count * 7 + 5) = bboxes.xmax[idx];
+                *(output_data_beg_ptr + count * 7 + 6) = bboxes.ymax[idx];
                 ++count;
             }
             output_data_beg_ptr = nullptr;
@@ -45,8 +45,11 @@ Status Flatten::executeKernel(const std::shared_ptr<NEONTensor<T>> input_tensor,
         }
     }
 
-    uint32_t size = input_tensor->getTotalSizeFromDims();
-    memcpy(output_data, input_data, sizeof(T) * size);
+    // The output is a view of the input, when they share the buffer.
+    if (output_data != input_data) {
+        uint32_t size = input_tensor->getTotalSizeFromDims();
+        memcpy(output_data, input_data, sizeof(T) * size);
+    }
 
     return Status::SUCCESS;
 }
@@ -65,9 +65,7 @@ Status NEONCFUConverter::executeKernel_impl_common(T* src_addr, T* dest_addr, in
     DEBUG_PRINT("called\n");
 
     int cell_size = cols_in_cell * lines_in_cell * interleaved_slices;
-    int source_index = 0;
-    int counter = 0;
-    int slice, num_slices = channel / cell_size, partial_slice = channel % cell_size;
+    int num_slices = channel / cell_size, partial_slice = channel % cell_size;
     int frame_size = height * width;
     int byte_size = 1;
 
@@ -75,32 +73,35 @@ Status NEONCFUConverter::executeKernel_impl_common(T* src_addr, T* dest_addr, in
         byte_size = 2;
     }
 
-    for (int byte = 0; byte < byte_size; ++byte) {
-        int cs_iter = cell_size;
-        // assuming CHW format of data with C being the outermost dimension
-        for (slice = 0; slice <= num_slices; ++slice) {
-            if (slice == num_slices) {
-                cs_iter = partial_slice;
+    // assuming CHW format of data with C being the outermost dimension
+    // A pixel of a slice is a line of the output, which is padded to interleaved_slices in the partial slice.
+    // Lines have fixed places in the output, so they are split over threads.
+    const int slice_size = num_slices + (partial_slice ? 1 : 0);
+    const int byte_plane_size = (num_slices * cell_size + (partial_slice ? interleaved_slices : 0)) * frame_size;
+    parallel_for(byte_size * slice_size * frame_size, parallel_grain(cell_size), [&](size_t begin, size_t end) {
+        for (int line = begin; line < static_cast<int>(end); ++line) {
+            int byte = line / (slice_size * frame_size);
+            int slice = line / frame_size % slice_size;
+            int f = line % frame_size;
+            int cs_iter = (slice == num_slices) ? partial_slice : cell_size;
+            int line_size = (slice == num_slices) ? interleaved_slices : cell_size;
+            int counter = byte * byte_plane_size + slice * frame_size * cell_size + f * line_size;
+            for (int cs = 0; cs < cs_iter; ++cs) {
+                int source_index = (f + frame_size * cs + frame_size * slice * cell_size);
+                dest_addr[counter] = src_addr[source_index * byte_size + byte];
+                counter++;
             }
-            for (int f = 0; f < frame_size; ++f) {
-                for (int cs = 0; cs < cs_iter; ++cs) {
-                    source_index = (f + frame_size * cs + frame_size * slice * cell_size);
-                    dest_addr[counter] = src_addr[source_index * byte_size + byte];
-                    counter++;
-                }
-                // if partial_slice is 0, it isn't required to clear padding
-                // because counter is same with dest_addr's length.
-                if (partial_slice && slice == num_slices) {
-                    if (data_type == DataType::FLOAT16) {
-                        memset(dest_addr + counter, 0, (interleaved_slices - partial_slice) * sizeof(_Float16_t));
-                    } else {
-                        memset(dest_addr + counter, pad_value, interleaved_slices - partial_slice);
-                    }
-                    counter += (interleaved_slices - partial_slice);
+            // if partial_slice is 0, it isn't required to clear padding
+            // because counter is same with dest_addr's length.
+            if (slice == num_slices) {
+                if (data_type == DataType::FLOAT16) {
+                    memset(dest_addr + counter, 0, (interleaved_slices - partial_slice) * sizeof(_Float16_t));
+                } else {
+                    memset(dest_addr + counter, pad_value, interleaved_slices - partial_slice);
                 }
             }
         }
-    }
+    });
 
     return Status::SUCCESS;
 }
@@ -109,12 +110,9 @@ Status NEONCFUConverter::executeKernel_impl_KITT(int16_t* src_addr, int16_t* des
                                                  int32_t channel, int32_t pad_value) {
     DEBUG_PRINT("called\n");
 
-    int out_index = 0;
     int unit_size = 2;
     int idps = 4;
-    int idp_fst_slice = 0, idp_base_slices = 0, idp_slices = 0, idp_idx = 0;
-    int fst_slice_gr_idx = 0, fst_line_stripe_idx = 0, fst_col_stripe_idx = 0, slice_idx = 0, line_idx = 0, col_idx = 0;
-    int valid_idp_slices = 0, valid_slices = 0, valid_lines = 0, valid_cols = 0, inbuf_slice_ofs = 0;
+    int idp_base_slices = 0, idp_slices = 0;
     int npu_cols_size = 0, npu_lines_size = 0;
     // Columns = width, Lines = height
     int cols_in_cell = 16, lines_in_cell = 8;
@@ -137,82 +135,51 @@ Status NEONCFUConverter::executeKernel_impl_KITT(int16_t* src_addr, int16_t* des
 
     int8_t* pSrc = (int8_t*)src_addr;
     int8_t* pDest = (int8_t*)dest_addr;
-    int32_t flag = 0;
     int32_t cell_size = lines_in_cell * cols_in_cell;
-
-    for (idp_idx = 0; idp_idx < idps; idp_idx++) {
-        idp_fst_slice = idp_idx * idp_base_slices;
-        valid_idp_slices = std::min(channel - idp_fst_slice, idp_base_slices);
-        for (fst_slice_gr_idx = 0; fst_slice_gr_idx < idp_slices; fst_slice_gr_idx += interleaved_slices) {
-            valid_slices = std::min(valid_idp_slices - fst_slice_gr_idx, interleaved_slices);
-            // If number of channels is not divided by num idp (usually 4), last idp will contain
-            // less number of slices than others and in this case valid_slices will be negative.
-            // Catch this now.
-            if (valid_slices < 0) {
-                valid_slices = 0;
-            }
-            for (slice_idx = fst_slice_gr_idx; slice_idx < fst_slice_gr_idx + valid_slices; slice_idx++) {
-                inbuf_slice_ofs = (2 * width) * height * (idp_fst_slice + slice_idx);
-                for (fst_line_stripe_idx = 0; fst_line_stripe_idx < npu_lines_size; fst_line_stripe_idx += lines_in_cell) {
-                    valid_lines = std::min(height - fst_line_stripe_idx, lines_in_cell);
-                    for (fst_col_stripe_idx = 0; fst_col_stripe_idx < npu_cols_size; fst_col_stripe_idx += cols_in_cell) {
-                        valid_cols = std::min(width - fst_col_stripe_idx, cols_in_cell);
-                        for (line_idx = fst_line_stripe_idx; line_idx < fst_line_stripe_idx + valid_lines; line_idx++) {
-#ifndef NEON_OPT
-                            for (col_idx = fst_col_stripe_idx; col_idx < fst_col_stripe_idx + valid_cols; col_idx++) {
+    // Slices of idps follow each other in the order of channels, and each of them takes two cells(lower and
+    // upper bytes) per stripe. So slices have fixed places in the output and are split over threads.
+    const int stripe_num = (npu_lines_size / lines_in_cell) * (npu_cols_size / cols_in_cell);
+    const int slice_out_size = stripe_num * 2 * cell_size;
+
+    parallel_for(channel, parallel_grain(slice_out_size), [&](size_t begin, size_t end) {
+        for (int slice = begin; slice < static_cast<int>(end); slice++) {
+            int out_index = slice * slice_out_size;
+            int inbuf_slice_ofs = (2 * width) * height * slice;
+            for (int fst_line_stripe_idx = 0; fst_line_stripe_idx < npu_lines_size; fst_line_stripe_idx += lines_in_cell) {
+                int valid_lines = std::min(height - fst_line_stripe_idx, lines_in_cell);
+                for (int fst_col_stripe_idx = 0; fst_col_stripe_idx < npu_cols_size; fst_col_stripe_idx += cols_in_cell) {
+                    int valid_cols = std::min(width - fst_col_stripe_idx, cols_in_cell);
+                    for (int line_idx = fst_line_stripe_idx; line_idx < fst_line_stripe_idx + valid_lines; line_idx++) {
+                        if (valid_cols < cols_in_cell) {
+                            for (int col_idx = fst_col_stripe_idx; col_idx < fst_col_stripe_idx + valid_cols; col_idx++) {
                                 pDest[out_index] = pSrc[inbuf_slice_ofs + line_idx * (2 * width) + (col_idx * 2)];
                                 pDest[out_index + cell_size] =
                                     pSrc[inbuf_slice_ofs + line_idx * (2 * width) + ((col_idx * 2) + 1)];
                                 out_index++;
                             }
-#else
-                            if (valid_cols < 16) {
-                                for (col_idx = fst_col_stripe_idx; col_idx < fst_col_stripe_idx + valid_cols; col_idx++) {
-                                    pDest[out_index] = pSrc[inbuf_slice_ofs + line_idx * (2 * width) + (col_idx * 2)];
-                                    pDest[out_index + cell_size] =
-                                        pSrc[inbuf_slice_ofs + line_idx * (2 * width) + ((col_idx * 2) + 1)];
-                                    out_index++;
-                                }
-                            } else {
-                                int8x16x2_t input =
-                                    vld2q_s8(pSrc + inbuf_slice_ofs + line_idx * (2 * width) + (col_idx * 2));
-                                vst1q_s8(pDest + out_index, input.val[0]);
-                                vst1q_s8(pDest + out_index + cell_size, input.val[1]);
-                                out_index += valid_cols;
-                            }
-#endif
-                            for (col_idx = fst_col_stripe_idx + valid_cols; col_idx < fst_col_stripe_idx + cols_in_cell;
-                                 col_idx++) {
-                                pDest[out_index] = pad_value;
-                                pDest[out_index + cell_size] = pad_value;
-                                out_index++;
-                            }
-                            flag = 1;
-                        }
-                        for (line_idx = fst_line_stripe_idx + valid_lines; line_idx < fst_line_stripe_idx + lines_in_cell;
-                             line_idx++) {
-#ifndef NEON_OPT
-                            for (col_idx = 0; col_idx < cols_in_cell; col_idx++) {
-                                pDest[out_index] = pad_value;
-                                pDest[out_index + cell_size] = pad_value;
-                                out_index++;
-                            }
-#else
-                            vst1q_s8(pDest + out_index, vmovq_n_s8(0));
-                            vst1q_s8(pDest + out_index + cell_size, vmovq_n_s8(0));
-                            out_index += cols_in_cell;
-#endif
-                            flag = 1;
+                        } else {
+                            int8_t* line = pSrc + inbuf_slice_ofs + line_idx * (2 * width) + (fst_col_stripe_idx * 2);
+                            kernel::deinterleave16(line, pDest + out_index, pDest + out_index + cell_size);
+                            out_index += valid_cols;
                         }
-                        if (flag == 1) {
-                            out_index += cell_size;
-                            flag = 0;
+                        for (int col_idx = fst_col_stripe_idx + valid_cols; col_idx < fst_col_stripe_idx + cols_in_cell;
+                             col_idx++) {
+                            pDest[out_index] = pad_value;
+                            pDest[out_index + cell_size] = pad_value;
+                            out_index++;
                         }
                     }
+                    for (int line_idx = fst_line_stripe_idx + valid_lines; line_idx < fst_line_stripe_idx + lines_in_cell;
+                         line_idx++) {
+                        memset(pDest + out_index, pad_value, cols_in_cell);
+                        memset(pDest + out_index + cell_size, pad_value, cols_in_cell);
+                        out_index += cols_in_cell;
+                    }
+                    out_index += cell_size;
                 }
             }
         }
-    }
+    });
 
     return Status::SUCCESS;
 }
@@ -222,12 +189,9 @@ Status NEONCFUConverter::executeKernel_impl_KITT(int8_t* src_addr, int8_t* dest_
     DEBUG_PRINT("called\n");
     UNUSED(pad_value);
 
-    int out_index = 0;
     int unit_size = 2;
     int idps = 4;
-    int idp_fst_slice = 0, idp_base_slices = 0, idp_slices = 0, idp_idx = 0;
-    int fst_slice_gr_idx = 0, fst_line_stripe_idx = 0, fst_col_stripe_idx = 0, slice_idx = 0, line_idx = 0, col_idx = 0;
-    int valid_idp_slices = 0, valid_slices = 0, valid_lines = 0, valid_cols = 0, inbuf_slice_ofs = 0;
+    int idp_base_slices = 0, idp_slices = 0;
     int npu_cols_size = 0, npu_lines_size = 0;
     // Columns = width, Lines = height
     int cols_in_cell = 16, lines_in_cell = 8;
@@ -248,65 +212,57 @@ Status NEONCFUConverter::executeKernel_impl_KITT(int8_t* src_addr, int8_t* dest_
     DEBUG_PRINT("idps=[%d], idp_base_slices=[%d], idp_slices=[%d]\n", idps, idp_base_slices, idp_slices);
     DEBUG_PRINT("width=[%d], height=[%d], channel=[%d]\n", width, height, channel);
 
-    for (idp_idx = 0; idp_idx < idps; idp_idx++) {
-        idp_fst_slice = idp_idx * idp_base_slices;
-        valid_idp_slices = std::min(channel - idp_fst_slice, idp_base_slices);
-        for (fst_slice_gr_idx = 0; fst_slice_gr_idx < idp_slices; fst_slice_gr_idx += interleaved_slices) {
-            valid_slices = std::min(valid_idp_slices - fst_slice_gr_idx, interleaved_slices);
+    // Each slice group of idps takes interleaved_slices cells per stripe, padded if the slices are not valid.
+    // So slice groups have fixed places in the output and are split over threads.
+    const int group_num = idp_slices / interleaved_slices;
+    const int stripe_num = (npu_lines_size / lines_in_cell) * (npu_cols_size / cols_in_cell);
+    const int group_out_size = stripe_num * interleaved_slices * lines_in_cell * cols_in_cell;
+
+    parallel_for(idps * group_num, parallel_grain(group_out_size), [&](size_t begin, size_t end) {
+        for (int group = begin; group < static_cast<int>(end); group++) {
+            int out_index = group * group_out_size;
+            int idp_fst_slice = group / group_num * idp_base_slices;
+            int fst_slice_gr_idx = group % group_num * interleaved_slices;
+            int valid_idp_slices = std::min(channel - idp_fst_slice, idp_base_slices);
+            int valid_slices = std::min(valid_idp_slices - fst_slice_gr_idx, interleaved_slices);
             // If number of channels is not divided by num idp (usually 4), last idp will contain
             // less number of slices than others and in this case valid_slices will be negative.
             // Catch this now.
             if (valid_slices < 0) {
                 valid_slices = 0;
             }
-            for (fst_line_stripe_idx = 0; fst_line_stripe_idx < npu_lines_size; fst_line_stripe_idx += lines_in_cell) {
-                valid_lines = std::min(height - fst_line_stripe_idx, lines_in_cell);
-                for (fst_col_stripe_idx = 0; fst_col_stripe_idx < npu_cols_size; fst_col_stripe_idx += cols_in_cell) {
-                    valid_cols = std::min(width - fst_col_stripe_idx, cols_in_cell);
-                    for (slice_idx = fst_slice_gr_idx; slice_idx < fst_slice_gr_idx + valid_slices; slice_idx++) {
-                        inbuf_slice_ofs = width * height * (idp_fst_slice + slice_idx);
-                        for (line_idx = fst_line_stripe_idx; line_idx < fst_line_stripe_idx + valid_lines; line_idx++) {
-#ifndef NEON_OPT
-                            for (col_idx = fst_col_stripe_idx; col_idx < fst_col_stripe_idx + valid_cols; col_idx++) {
-                                dest_addr[out_index++] = src_addr[inbuf_slice_ofs + line_idx * width + col_idx];
-                            }
-#else
-                            int8x16_t input = vld1q_s8(src_addr + inbuf_slice_ofs + line_idx * width + fst_col_stripe_idx);
-                            vst1q_s8(dest_addr + out_index, input);
+            for (int fst_line_stripe_idx = 0; fst_line_stripe_idx < npu_lines_size; fst_line_stripe_idx += lines_in_cell) {
+                int valid_lines = std::min(height - fst_line_stripe_idx, lines_in_cell);
+                for (int fst_col_stripe_idx = 0; fst_col_stripe_idx < npu_cols_size; fst_col_stripe_idx += cols_in_cell) {
+                    int valid_cols = std::min(width - fst_col_stripe_idx, cols_in_cell);
+                    for (int slice_idx = fst_slice_gr_idx; slice_idx < fst_slice_gr_idx + valid_slices; slice_idx++) {
+                        int inbuf_slice_ofs = width * height * (idp_fst_slice + slice_idx);
+                        for (int line_idx = fst_line_stripe_idx; line_idx < fst_line_stripe_idx + valid_lines; line_idx++) {
+                            memcpy(dest_addr + out_index, src_addr + inbuf_slice_ofs + line_idx * width + fst_col_stripe_idx,
+                                   valid_cols);
                             out_index += valid_cols;
-#endif
-                            for (col_idx = fst_col_stripe_idx + valid_cols; col_idx < fst_col_stripe_idx + cols_in_cell;
+                            for (int col_idx = fst_col_stripe_idx + valid_cols; col_idx < fst_col_stripe_idx + cols_in_cell;
                                  col_idx++) {
                                 dest_addr[out_index++] = 0;
                             }
                         }
-                        for (line_idx = fst_line_stripe_idx + valid_lines; line_idx < fst_line_stripe_idx + lines_in_cell;
-                             line_idx++) {
-#ifndef NEON_OPT
-                            for (col_idx = 0; col_idx < cols_in_cell; col_idx++)
-                                dest_addr[out_index++] = 0;
-#else
-                            vst1q_s8(dest_addr + out_index, vmovq_n_s8(0));
+                        for (int line_idx = fst_line_stripe_idx + valid_lines;
+                             line_idx < fst_line_stripe_idx + lines_in_cell; line_idx++) {
+                            memset(dest_addr + out_index, 0, cols_in_cell);
                             out_index += cols_in_cell;
-#endif
                         }
                     }
-                    for (slice_idx = fst_slice_gr_idx + valid_slices; slice_idx < fst_slice_gr_idx + interleaved_slices;
+                    for (int slice_idx = fst_slice_gr_idx + valid_slices; slice_idx < fst_slice_gr_idx + interleaved_slices;
                          slice_idx++) {
-                        for (line_idx = 0; line_idx < lines_in_cell; line_idx++) {
-#ifndef NEON_OPT
-                            for (col_idx = 0; col_idx < cols_in_cell; col_idx++)
-                                dest_addr[out_index++] = 0;
-#else
-                            vst1q_s8(dest_addr + out_index, vmovq_n_s8(0));
+                        for (int line_idx = 0; line_idx < lines_in_cell; line_idx++) {
+                            memset(dest_addr + out_index, 0, cols_in_cell);
                             out_index += cols_in_cell;
-#endif
                         }
                     }
                 }
             }
         }
-    }
+    });
 
     return Status::SUCCESS;
 }
@@ -18,14 +18,14 @@ Status NEONDequantization::initialize(const std::shared_ptr<ITensor> input, cons
     this->img_size = img_size;
     this->frac_lens_ = std::static_pointer_cast<NEONTensor<int32_t>>(frac_lens);
 
-#ifdef NEON_OPT
-    check_mono_frac_len((data_num / img_size), frac_lens_->getDataPtr().get());
-#endif
+    // Invalid parameters are reported by execute().
+    if (img_size > 0 && frac_lens_ != nullptr) {
+        check_mono_frac_len((data_num / img_size), frac_lens_->getDataPtr().get());
+    }
 
     return Status::SUCCESS;
 }
 
-#ifdef NEON_OPT
 void NEONDequantization::check_mono_frac_len(int32_t channel, int32_t* frac_lens) {
     for (int32_t i = 0; i < channel - 1; ++i) {
         if (frac_lens[i] != frac_lens[i + 1]) {
@@ -36,17 +36,13 @@ void NEONDequantization::check_mono_frac_len(int32_t channel, int32_t* frac_lens
     DEBUG_PRINT("is_mono_frac_len : %s\n", is_mono_frac_len ? "true" : "false");
 }
 
-inline int16x8_t intermediate_get_int16x8_t(int16_t* input_data, int index) {
-    int16x8_t input_16x8 = vld1q_s16(input_data + index);
-    return input_16x8;
-}
-
-inline int16x8_t intermediate_get_int16x8_t(int8_t* input_data, int index) {
-    int8x8_t input_8x8 = vld1_s8(input_data + index);
-    int16x8_t input_16x8 = vmovl_s8(input_8x8);
-    return input_16x8;
+// 2^-frac_len
+float NEONDequantization::get_frac_scale(int32_t frac_len) {
+    if (-63 <= frac_len && frac_len <= 63) {
+        return (frac_len & (1 << 31)) ? (1 << (-frac_len)) : 1.0f / (1 << frac_len);
+    }
+    return 1.0f / (static_cast<float>(pow(2, frac_len)));
 }
-#endif
 
 template <typename T>
 Status NEONDequantization::executeKernel(const std::shared_ptr<NEONTensor<T>> input_tensor,
@@ -61,8 +57,6 @@ Status NEONDequantization::executeKernel(const std::shared_ptr<NEONTensor<T>> in
     }
 
     int32_t channel = data_num / img_size;
-    int32_t index;
-    float temp;
 
     DEBUG_PRINT("data_num=[%d], channel=[%d]\n", data_num, channel);
 
@@ -80,87 +74,27 @@ Status NEONDequantization::executeKernel(const std::shared_ptr<NEONTensor<T>> in
     DEBUG_PRINT("frac_lens(%d) = {%s}\n", channel, str_frac_len.c_str());
 #endif
 
-    const bool OPTIMIZED = true;
-    // Optimization: copy input to output, and write output backward
-    //               it is to improve cache write hit.
-    // TODO(hj2020.kim): Add Memory Optimizer to use memory reuse
-    if (OPTIMIZED) {
-        DEBUG_PRINT("OPTIMIZED: enabled\n");
-        memcpy(reinterpret_cast<T*>(output_data), input_data, sizeof(T) * data_num);
-    }
-
-#ifdef NEON_OPT
-    DEBUG_PRINT("NEON_OPT: enabled\n");
-    int32_t lane = 8;  // No. of data processing at a time.
-    float32x4_t _temp32x4, res1_32x4, res2_32x4;
-    int32x4_t input1_32x4, input2_32x4;
-    int16x8_t input_16x8;
-
-    // 1-D tensor (H*W = 1, channel = N) cannot benefit from NEON intrinsics because it is arranged in C-order.
-    // If FracLens are identical in all channels, we can swap dims (H*W and channel) to make NEON loops workable.
-    if (img_size == 1 && is_mono_frac_len) {
-        img_size = channel;
+    DEBUG_PRINT("SIMD: %s\n", simd::Native::name);
+    // 1-D tensor (H*W = 1, channel = N) cannot benefit from vector loops because it is arranged in C-order.
+    // If FracLens are identical in all channels, we can swap dims (H*W and channel) to make vector loops workable.
+    int32_t plane_size = img_size;
+    if (plane_size == 1 && is_mono_frac_len) {
+        plane_size = channel;
         channel = 1;
     }
 
-    int last_index = img_size % lane;
-    for (int32_t c = channel - 1; c >= 0; c--) {
-        int32_t fL = frac_lens[c];
-        if (-63 <= fL && fL <= 63) {
-            temp = (fL & (1 << 31)) ? (1 << (-fL)) : 1.0f / (1 << fL);
-        } else {
-            temp = 1.0f / (static_cast<float>(pow(2, fL)));
-        }
-        _temp32x4 = vmovq_n_f32(temp);
-        index = c * img_size;
-
-        for (int32_t idx = img_size - lane; idx >= last_index; idx -= lane) {
-            if (OPTIMIZED) {
-                input_16x8 = intermediate_get_int16x8_t(reinterpret_cast<T*>(output_data), index + idx);
-            } else {
-                input_16x8 = intermediate_get_int16x8_t(input_data, index + idx);
-            }
-            // convert into 32-bit signed integer
-            input1_32x4 = vmovl_s16(vget_low_s16(input_16x8));
-            input2_32x4 = vmovl_s16(vget_high_s16(input_16x8));
-            // convert to 32-bit float
-            res1_32x4 = vcvtq_f32_s32(input1_32x4);
-            res2_32x4 = vcvtq_f32_s32(input2_32x4);
-
-            res1_32x4 = vmulq_f32(res1_32x4, _temp32x4);
-            res2_32x4 = vmulq_f32(res2_32x4, _temp32x4);
-
-            vst1q_f32(output_data + index + idx, res1_32x4);
-            vst1q_f32(output_data + index + idx + 4, res2_32x4);
-        }
-
-        for (int32_t idx = last_index - 1; idx >= 0; idx--) {
-            if (OPTIMIZED) {
-                output_data[index + idx] = static_cast<float>((reinterpret_cast<T*>(output_data))[index + idx]) * temp;
-            } else {
-                output_data[index + idx] = static_cast<float>(input_data[index + idx]) * temp;
-            }
-        }
-    }
-#else /* pow() function is called for channel times*/
-    DEBUG_PRINT("NEON_OPT: disabled\n");
-    for (int32_t c = channel - 1; c >= 0; c--) {
-        int32_t fL = frac_lens[c];
-        if (-63 <= fL && fL <= 63) {
-            temp = (fL & (1 << 31)) ? (1 << (-fL)) : 1.0f / (1 << fL);
-        } else {
-            temp = 1.0f / (static_cast<float>(pow(2, fL)));
-        }
-        index = c * img_size;
-        for (int32_t idx = img_size - 1; idx >= 0; idx--) {
-            if (OPTIMIZED) {
-                output_data[index + idx] = static_cast<float>((reinterpret_cast<T*>(output_data))[index + idx]) * temp;
-            } else {
-                output_data[index + idx] = static_cast<float>(input_data[index + idx]) * temp;
-            }
+    // Elements of all channels are split over threads, by segments of the same channel. The output may be on the
+    // input, when the input dies here.
+    parallel_for_in_place(input_data, sizeof(T), output_data, sizeof(float), static_cast<size_t>(channel) * plane_size,
+                          PARALLEL_GRAIN, [&](size_t begin, size_t end) {
+        for (size_t index = begin; index < end;) {
+            int32_t c = index / plane_size;
+            size_t segment_end = std::min<size_t>(end, static_cast<size_t>(c + 1) * plane_size);
+            kernel::dequantize(input_data + index, output_data + index, segment_end - index,
+                               get_frac_scale(frac_lens[c]));
+            index = segment_end;
         }
-    }
-#endif
+    });
 
     return Status::SUCCESS;
 }
@@ -189,6 +123,32 @@ Status NEONDequantization::execute(const std::shared_ptr<ITensor> input, std::sh
     }
 }
 
+bool NEONDequantization::getPipelineStage(const std::shared_ptr<ITensor> input, PipelineStage* stage) {
+    if (!frac_lens_ || img_size == 0 || data_num <= 0 || frac_lens_->getTotalSizeFromDims() < data_num / img_size) {
+        return false;
+    }
+    switch (input->getDataType()) {
+        case DataType::INT16:
+            stage->input_type = DataType::INT16;
+            break;
+        case DataType::INT8:
+        case DataType::UINT8:
+            stage->input_type = DataType::INT8;  // as execute()
+            break;
+        default:
+            return false;
+    }
+    stage->type = PipelineStage::Type::AFFINE;
+    stage->plane_size = img_size;
+    stage->channel = data_num / img_size;
+    stage->means.assign(stage->channel, 0.0f);
+    stage->scales.resize(stage->channel);
+    for (uint32_t c = 0; c < stage->channel; ++c) {
+        stage->scales[c] = get_frac_scale(frac_lens_->getDataPtr().get()[c]);
+    }
+    return true;
+}
+
 Status NEONDequantization::release() {
     return Status::SUCCESS;
 }
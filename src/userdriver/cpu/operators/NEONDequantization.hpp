@@ -20,6 +20,9 @@ public:
 
     Status release();
 
+    // The operator as a step of NEONFusedPipeline, false if it cannot be.
+    bool getPipelineStage(const std::shared_ptr<ITensor> input, PipelineStage* stage);
+
 private:
     PrecisionType precision_;
     DataType input_data_type;
@@ -28,10 +31,9 @@ private:
     uint32_t img_size;
     std::shared_ptr<NEONTensor<int32_t>> frac_lens_;
 
-#ifdef NEON_OPT
     bool is_mono_frac_len = true;
     void check_mono_frac_len(int32_t channel, int32_t* frac_lens);
-#endif
+    static float get_frac_scale(int32_t frac_len);
 
     template <typename T>
     Status executeKernel(const std::shared_ptr<NEONTensor<T>> input_tensor,
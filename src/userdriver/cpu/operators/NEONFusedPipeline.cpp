@@ -0,0 +1,160 @@
+#include "NEONFusedPipeline.hpp"
+
+namespace enn {
+namespace ud {
+namespace cpu {
+
+NEONFusedPipeline::NEONFusedPipeline(const PrecisionType& precision) {
+    precision_ = precision;
+}
+
+Status NEONFusedPipeline::initialize(const std::shared_ptr<ITensor> input, const std::vector<PipelineStage>& stages,
+                                     const std::shared_ptr<Softmax> softmax) {
+    ENN_UNUSED(input);
+    if (stages.empty()) {
+        ERROR_PRINT("Invalid parameter\n");
+        return Status::INVALID_PARAMS;
+    }
+    for (size_t i = 0; i < stages.size(); ++i) {
+        const auto& stage = stages[i];
+        bool is_last_float = (i + 1 == stages.size()) && !softmax;
+        if ((stage.type != PipelineStage::Type::AFFINE && !is_last_float) || stage.plane_size == 0 ||
+            stage.channel == 0 || stage.means.size() < stage.channel || stage.scales.size() < stage.channel ||
+            (i > 0 && stage.input_type != DataType::FLOAT)) {
+            ERROR_PRINT("Invalid stage %zu\n", i);
+            return Status::INVALID_PARAMS;
+        }
+    }
+
+    stages_ = stages;
+    softmax_ = softmax;
+    // A step of the same parameters in all channels is done over all planes in a row.
+    for (auto& stage : stages_) {
+        bool is_mono = true;
+        for (uint32_t c = 1; c < stage.channel && is_mono; ++c) {
+            is_mono = stage.means[c] == stage.means[0] && stage.scales[c] == stage.scales[0];
+        }
+        if (is_mono) {
+            stage.plane_size = UINT32_MAX;
+            stage.channel = 1;
+        }
+    }
+    return Status::SUCCESS;
+}
+
+template <typename T1, typename T2>
+void NEONFusedPipeline::run(const T1* input, T2* output, size_t index, size_t count) {
+    const PipelineStage& last = stages_.back();
+    float tile[TILE];
+    for (const size_t end = index + count; index < end;) {
+        // Up to the end of the plane of the step where the channel changes first.
+        size_t size = std::min(end - index, TILE);
+        for (const auto& stage : stages_) {
+            size = std::min<size_t>(size, stage.plane_size - index % stage.plane_size);
+        }
+
+        kernel::dequantize(input + index, tile, size, 1.0f);  // to float
+        for (const auto& stage : stages_) {
+            if (stage.type == PipelineStage::Type::AFFINE) {
+                const uint32_t c = index / stage.plane_size % stage.channel;
+                kernel::normalize(tile, size, stage.means[c], stage.scales[c]);
+            }
+        }
+
+        const uint32_t c = index / last.plane_size % last.channel;
+        T2* out = output + index;
+        if constexpr (std::is_integral<T2>::value) {
+            if (last.type == PipelineStage::Type::QUANTIZE) {
+                // As Quantization, the lower bits of the rounded value with the sign bit of the input.
+                constexpr int32_t MAX_LIMIT = std::numeric_limits<T2>::max();
+                for (size_t k = 0; k < size; ++k) {
+                    int32_t value = std::round(tile[k] * last.scales[c]);
+                    out[k] = static_cast<T2>(tile[k] < 0 ? (value | ~MAX_LIMIT) : (value & MAX_LIMIT));
+                }
+            } else {
+                for (size_t k = 0; k < size; ++k) {
+                    int32_t value = std::round(tile[k] / last.scales[c] + last.means[c]);
+                    if (std::is_same<T2, uint8_t>::value) {
+                        value = (value & (~0xFF)) ? (-value) >> 31 : value;  // clamp to [0, 255], as AsymmQuantization
+                    }
+                    out[k] = static_cast<T2>(value);
+                }
+            }
+        } else {
+            std::memcpy(out, tile, size * sizeof(float));
+        }
+        index += size;
+    }
+}
+
+template <typename T1, typename T2>
+Status NEONFusedPipeline::executeKernel(const std::shared_ptr<NEONTensor<T1>> input_tensor,
+                                        std::shared_ptr<NEONTensor<T2>> output_tensor) {
+    T1* input_data = input_tensor->getBufferPtr();
+    T2* output_data = output_tensor->getBufferPtr();
+    if ((!input_data) || (!output_data) || stages_.empty()) {
+        ERROR_PRINT("Invalid parameter\n");
+        return Status::INVALID_PARAMS;
+    }
+
+    if (softmax_) {
+        float* output = reinterpret_cast<float*>(output_data);  // T2 is float with softmax
+        return softmax_->executeFused([&](size_t index, size_t count) { run(input_data, output, index, count); },
+                                      output);
+    }
+
+    parallel_for_in_place(input_data, sizeof(T1), output_data, sizeof(T2), input_tensor->getTotalSizeFromDims(),
+                          PARALLEL_GRAIN, [&](size_t begin, size_t end) {
+        run(input_data, output_data, begin, end - begin);
+    });
+    return Status::SUCCESS;
+}
+
+template <typename T1>
+Status NEONFusedPipeline::executeInput(const std::shared_ptr<NEONTensor<T1>> input_tensor,
+                                       std::shared_ptr<ITensor> output) {
+    const auto type = stages_.back().type;
+    const DataType output_data_type = output->getDataType();
+    if (type == PipelineStage::Type::AFFINE && output_data_type == DataType::FLOAT) {
+        return executeKernel(input_tensor, std::static_pointer_cast<NEONTensor<float>>(output));
+    } else if (type != PipelineStage::Type::AFFINE && !softmax_ && output_data_type == DataType::INT16) {
+        return executeKernel(input_tensor, std::static_pointer_cast<NEONTensor<int16_t>>(output));
+    } else if (type != PipelineStage::Type::AFFINE && !softmax_ && output_data_type == DataType::INT8) {
+        return executeKernel(input_tensor, std::static_pointer_cast<NEONTensor<int8_t>>(output));
+    } else if (type == PipelineStage::Type::QUANTIZE && output_data_type == DataType::UINT8) {
+        return executeKernel(input_tensor, std::static_pointer_cast<NEONTensor<int8_t>>(output));  // as Quantization
+    } else if (type == PipelineStage::Type::ASYMM_QUANTIZE && output_data_type == DataType::UINT8) {
+        return executeKernel(input_tensor, std::static_pointer_cast<NEONTensor<uint8_t>>(output));
+    }
+    ERROR_PRINT("Data type is not supported\n");
+    return Status::FAILURE;
+}
+
+Status NEONFusedPipeline::execute(const std::shared_ptr<ITensor> input, std::shared_ptr<ITensor> output) {
+    if (stages_.empty()) {
+        ERROR_PRINT("Not initialized\n");
+        return Status::FAILURE;
+    }
+    switch (stages_.front().input_type) {
+        case DataType::FLOAT:
+            return executeInput(std::static_pointer_cast<NEONTensor<float>>(input), output);
+        case DataType::UINT8:
+            return executeInput(std::static_pointer_cast<NEONTensor<uint8_t>>(input), output);
+        case DataType::INT8:
+            return executeInput(std::static_pointer_cast<NEONTensor<int8_t>>(input), output);
+        case DataType::INT16:
+            return executeInput(std::static_pointer_cast<NEONTensor<int16_t>>(input), output);
+        default: {
+            ERROR_PRINT("Data type is not supported\n");
+            return Status::FAILURE;
+        }
+    }
+}
+
+Status NEONFusedPipeline::release() {
+    return Status::SUCCESS;
+}
+
+}  // namespace cpu
+}  // namespace ud
+}  // namespace enn
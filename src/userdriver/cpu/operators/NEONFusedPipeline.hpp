@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "userdriver/common/operator_interfaces/common/Common.hpp"
+#include "userdriver/common/operator_interfaces/interfaces/operators/IFusedPipeline.hpp"
+#include "userdriver/cpu/common/NEONTensor.hpp"
+#include "userdriver/cpu/common/NEONIncludes.hpp"
+#include "userdriver/cpu/operators/Softmax.hpp"
+
+namespace enn {
+namespace ud {
+namespace cpu {
+
+// NEONFusedPipeline runs a chain of element-wise operators, e.g. Normalization and Quantization on the input side or
+// Dequantization and Softmax on the output side, as one operator. Elements are streamed through all steps by tiles
+// in cache, instead of passing the whole tensor to the memory between operators.
+class NEONFusedPipeline : public IFusedPipeline {
+public:
+    explicit NEONFusedPipeline(const PrecisionType& precision);
+
+    // Steps are done in order. Only the last one may quantize, and softmax, if any, follows float steps.
+    Status initialize(const std::shared_ptr<ITensor> input, const std::vector<PipelineStage>& stages,
+                      const std::shared_ptr<Softmax> softmax = nullptr);
+
+    Status execute(const std::shared_ptr<ITensor> input, std::shared_ptr<ITensor> output);
+
+    Status release();
+
+private:
+    // Elements of a step at a time, in float on the stack.
+    static constexpr size_t TILE = 1024;
+
+    PrecisionType precision_;
+    std::vector<PipelineStage> stages_;
+    std::shared_ptr<Softmax> softmax_;
+
+    template <typename T1>
+    Status executeInput(const std::shared_ptr<NEONTensor<T1>> input_tensor, std::shared_ptr<ITensor> output);
+
+    template <typename T1, typename T2>
+    Status executeKernel(const std::shared_ptr<NEONTensor<T1>> input_tensor,
+                         std::shared_ptr<NEONTensor<T2>> output_tensor);
+
+    // All steps for elements [index, index + count).
+    template <typename T1, typename T2>
+    void run(const T1* input, T2* output, size_t index, size_t count);
+};
+
+}  // namespace cpu
+}  // namespace ud
+}  // namespace enn
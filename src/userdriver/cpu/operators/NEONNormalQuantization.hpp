@@ -35,17 +35,9 @@ private:
     std::shared_ptr<NEONTensor<double>> scales_;
     std::shared_ptr<NEONTensor<int32_t>> frac_lens_;
 
-    template <typename T1, typename T2, typename T3>
+    template <typename T1, typename T2>
     Status executeKernel(const std::shared_ptr<NEONTensor<T1>> input_tensor,
-                         std::shared_ptr<NEONTensor<T2>> output_tensor, T3 array_type);
-
-#ifdef NEON_OPT
-    float32x4x2_t intermediate_get_float32x4x2_t(float* input);
-    float32x4x2_t intermediate_get_float32x4x2_t(uint8_t* input);
-
-    void intermediate_vst1(int16_t* output, int16x8_t array);
-    void intermediate_vst1(int8_t* output, int8x8_t array);
-#endif
+                         std::shared_ptr<NEONTensor<T2>> output_tensor);
 };
 
 }  // namespace cpu
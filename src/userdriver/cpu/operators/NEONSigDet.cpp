@@ -56,11 +56,7 @@ Status NEONSigDet::initialize(const Dim4 &location_dim, const Dim4 &confidence_d
     conf_thresh_unnormalized_ =
         -1.0f * logf(1.0f / (confidence_threshold_ + 1e-7) - 1.0f);  // inverse function of sigmoid: -ln(1/y - 1)
     class_in_use_.resize(num_classes, 0);
-    all_decode_bboxes_.resize(loc_dim_.n);
-    Label_bbox &decode_bboxes = all_decode_bboxes_[0];
-    if (share_location) {
-        decode_bboxes[-1].resize(num_priors_);
-    }
+    decode_bboxes_.resize(num_priors_);
 
     return Status::SUCCESS;
 }
@@ -88,7 +84,7 @@ Status NEONSigDet::execute(const std::shared_ptr<ITensor> &input_location, const
     detection(loc_dim_.n, num_classes_, share_location_, nms_threshold_, background_label_id_, nms_top_k_, keep_top_k_,
               static_cast<PriorBoxCodingType>(code_type_), confidence_threshold_, nms_eta_, variance_encoded_in_target_,
               num_priors_, loc_data, conf_data, prior_data, out_0->getBufferPtr(), output_channel, output_height,
-              output_width, IS_CONF_THRESH_UNNORMALIZED, conf_thresh_unnormalized_, &all_decode_bboxes_, &class_in_use_);
+              output_width, IS_CONF_THRESH_UNNORMALIZED, conf_thresh_unnormalized_, &decode_bboxes_, &class_in_use_);
 
     // detection output fixed 1*1*target_num*7, even though batch is bigger than one
     Dim4 expected_out_dim = {1, output_channel, output_height, output_width};
@@ -2,7 +2,7 @@
 
 #include "userdriver/common/operator_interfaces/common/Common.hpp"
 #include "userdriver/common/operator_interfaces/interfaces/operators/ISigDet.hpp"
-#include "userdriver/cpu/operators/neon_impl/NormalizedBbox.hpp"
+#include "userdriver/cpu/operators/neon_impl/FastNMS.hpp"
 #include "userdriver/cpu/common/NEONIncludes.hpp"
 #include "userdriver/cpu/common/NEONTensor.hpp"
 
@@ -39,7 +39,7 @@ private:
     Dim4 loc_dim_;
     Dim4 prior_dim_;
     std::vector<uint32_t> class_in_use_;
-    std::vector<Label_bbox> all_decode_bboxes_;
+    BBoxArray decode_bboxes_;
 };  // class NEONSigDet
 
 /**
@@ -53,40 +53,7 @@ private:
  */
 static inline void exploitClassInUse(float *conf, uint32_t num_classes, uint32_t num_priors, float conf_thesh_unnormalized,
                                      uint32_t *class_in_use) {
-#ifdef NEON_OPT
-    const float32x4_t _conf_thresh = vdupq_n_f32(conf_thesh_unnormalized);
-    {  // compute class_in_use
-        size_t npack4 = num_classes >> 2;
-        size_t nremain = num_classes - (npack4 << 2);
-        for (size_t p = 0; p < num_priors; ++p) {
-            float *input_ptr = conf + p * num_classes;
-            uint32_t *output_ptr = class_in_use;
-            size_t nn = npack4;
-            size_t remain = nremain;
-            for (; nn > 0; nn--) {
-                float32x4_t _p = vld1q_f32(input_ptr);
-                uint32x4_t _q = vld1q_u32(output_ptr);
-                uint32x4_t _conf_thresh_mask_u32 = vcgeq_f32(_p, _conf_thresh);
-                _q = vqaddq_u32(_q, _conf_thresh_mask_u32);
-                vst1q_u32(output_ptr, _q);
-                input_ptr += 4;
-                output_ptr += 4;
-            }
-            for (; remain > 0; remain--) {
-                uint32_t conf_thresh_mask = (*input_ptr > conf_thesh_unnormalized ? 1 : 0);
-                *output_ptr |= conf_thresh_mask;
-                input_ptr++;
-                output_ptr++;
-            }
-        }
-    }
-#else
-    ENN_UNUSED(conf);
-    ENN_UNUSED(num_classes);
-    ENN_UNUSED(num_priors);
-    ENN_UNUSED(conf_thesh_unnormalized);
-    ENN_UNUSED(class_in_use);
-#endif
+    kernel::mark_class_in_use(conf, num_classes, num_priors, conf_thesh_unnormalized, class_in_use);
 }
 
 }  // namespace cpu
@@ -26,9 +26,6 @@ Status Normalization::executeKernel(const std::shared_ptr<NEONTensor<T>> input_t
     float* mean = mean_->getDataPtr().get();
     float* scale = scale_->getDataPtr().get();
 
-    uint32_t i, j, k, n;
-    T num;
-    uint32_t idx;
     uint32_t batch = input_tensor->getDim().n;
     uint32_t channel = input_tensor->getDim().c;
     uint32_t height = input_tensor->getDim().h;
@@ -43,45 +40,44 @@ Status Normalization::executeKernel(const std::shared_ptr<NEONTensor<T>> input_t
     if (bgr_transpose_ == 1) {
         // normalization & bgr_transpose
         enum { B = 0, G = 1, R = 2 };
-        float normalized;
-        int b_idx = B;
-        int g_idx = height * width * G;
-        int r_idx = height * width * R;
-        // optimize the reminder
-        for (n = 0; n < batch; n++) {
-            for (i = 0; i < channel; i++) {
-                for (j = 0; j < height; j++) {
-                    for (k = 0; k < width; k++) {
-                        idx = (n * channel * height * width) + (i * height * width) + (j * width) + k;
-                        num = input_data[idx];
-                        normalized = ((float)num - mean[i]) * scale[i];
-                        if (i == B) {
-                            output_data[b_idx++] = normalized;
-                        } else if (i == G) {
-                            output_data[g_idx++] = normalized;
-                        } else if (i == R) {
-                            output_data[r_idx++] = normalized;
-                        } else {
-                            DEBUG_PRINT("Channel greater > 3 is not supported for bgr transpose");
-                            return Status::FAILURE;
+        if (channel > R + 1) {
+            DEBUG_PRINT("Channel greater > 3 is not supported for bgr transpose");
+            return Status::FAILURE;
+        }
+        // Planes move, so the output can't be on the input. The generator aliases only normalizations of models,
+        //  which are initialized without bgr_transpose.
+        if (static_cast<void*>(input_data) == static_cast<void*>(output_data)) {
+            ERROR_PRINT("bgr_transpose is not supported in place\n");
+            return Status::FAILURE;
+        }
+        // Planes of batches overlap in the output, so lines are split over threads and batches are kept in order.
+        const uint32_t plane_size = height * width;
+        parallel_for(height, parallel_grain(batch * channel * width), [&](size_t begin, size_t end) {
+            for (uint32_t n = 0; n < batch; n++) {
+                for (uint32_t i = 0; i < channel; i++) {
+                    for (uint32_t j = begin; j < end; j++) {
+                        uint32_t idx = (n * channel + i) * plane_size + j * width;
+                        uint32_t out_idx = (i + n) * plane_size + j * width;
+                        for (uint32_t k = 0; k < width; k++) {
+                            output_data[out_idx + k] = (static_cast<float>(input_data[idx + k]) - mean[i]) * scale[i];
                         }
                     }
                 }
             }
-        }
+        });
     } else {
-        // just normalization
-        for (n = 0; n < batch; n++) {
-            for (i = 0; i < channel; i++) {
-                for (j = 0; j < height; j++) {
-                    for (k = 0; k < width; k++) {
-                        idx = (n * channel * height * width) + (i * height * width) + (j * width) + k;
-                        num = input_data[idx];
-                        output_data[idx] = (static_cast<float>(num) - mean[i]) * scale[i];
-                    }
+        // just normalization, split over segments of the same plane. The output may be on the input.
+        const size_t plane_size = static_cast<size_t>(height) * width;
+        parallel_for_in_place(input_data, sizeof(T), output_data, sizeof(float), batch * channel * plane_size,
+                              PARALLEL_GRAIN, [&](size_t begin, size_t end) {
+            for (size_t idx = begin; idx < end;) {
+                uint32_t i = idx / plane_size % channel;
+                size_t segment_end = std::min(end, (idx / plane_size + 1) * plane_size);
+                for (; idx < segment_end; idx++) {
+                    output_data[idx] = (static_cast<float>(input_data[idx]) - mean[i]) * scale[i];
                 }
             }
-        }
+        });
     }
     return Status::SUCCESS;
 }
@@ -104,6 +100,25 @@ Status Normalization::execute(const std::shared_ptr<ITensor> input, std::shared_
     }
 }
 
+bool Normalization::getPipelineStage(const std::shared_ptr<ITensor> input, PipelineStage* stage) {
+    // bgr_transpose moves planes, so it is not element-wise.
+    const Dim4& dims = input->getDim();
+    if (bgr_transpose_ != 0 || !mean_ || !scale_ || mean_->getTotalSizeFromDims() < dims.c ||
+        scale_->getTotalSizeFromDims() < dims.c) {
+        return false;
+    }
+    if (input->getDataType() != DataType::UINT8 && input->getDataType() != DataType::FLOAT) {
+        return false;
+    }
+    stage->type = PipelineStage::Type::AFFINE;
+    stage->input_type = input->getDataType();
+    stage->plane_size = dims.h * dims.w;
+    stage->channel = dims.c;
+    stage->means.assign(mean_->getDataPtr().get(), mean_->getDataPtr().get() + dims.c);
+    stage->scales.assign(scale_->getDataPtr().get(), scale_->getDataPtr().get() + dims.c);
+    return true;
+}
+
 Status Normalization::release() {
     return Status::SUCCESS;
 }
@@ -5,6 +5,7 @@
 #include "userdriver/common/operator_interfaces/common/Common.hpp"
 #include "userdriver/common/operator_interfaces/interfaces/operators/INormalization.hpp"
 #include "userdriver/cpu/common/NEONTensor.hpp"
+#include "userdriver/cpu/common/NEONIncludes.hpp"
 
 namespace enn {
 namespace ud {
@@ -25,6 +26,9 @@ public:
 
     Status release();
 
+    // The operator as a step of NEONFusedPipeline, false if it cannot be.
+    bool getPipelineStage(const std::shared_ptr<ITensor> input, PipelineStage* stage);
+
 private:
     std::shared_ptr<NEONTensor<float>> mean_;
     std::shared_ptr<NEONTensor<float>> scale_;
@@ -5,24 +5,62 @@ namespace ud {
 namespace cpu {
 namespace {
 enum { NUMBER = 0, CHANNEL, HEIGHT, WIDTH, SIZE };
+
+// Index of the input for index of the output along an axis, where front is the padding before the input of size.
+// -1 if it is a padding by value.
+inline int32_t getSourceIndex(int32_t index, int32_t front, int32_t size, PadMode mode) {
+    int32_t source = index - front;
+    if (source >= 0 && source < size) {
+        return source;
+    }
+    switch (mode) {
+        case PadMode::REFLECT:
+            return source < 0 ? -source : 2 * (size - 1) - source;
+        case PadMode::EDGE:
+            return source < 0 ? 0 : size - 1;
+        default:
+            return -1;
+    }
 }
 
-#define PUT_PADDING(LOOP, OUTPUT, VALUE, SIZE)   \
-    for (int32_t idx = 0; idx < (LOOP); idx++) { \
-        *OUTPUT++ = VALUE;                       \
-        SIZE++;                                  \
+// A row along width, which is the input row in a copy between the padding of front and end elements.
+template <typename T>
+inline void padRow(T* output, const T* input, int32_t width, int32_t front, int32_t end, PadMode mode,
+                   const T& frontValue, const T& endValue) {
+    T* output_end = output + front + width;
+    switch (mode) {
+        case PadMode::REFLECT:
+            for (int32_t w = 0; w < front; ++w) {
+                output[w] = input[front - w];
+            }
+            for (int32_t w = 0; w < end; ++w) {
+                output_end[w] = input[width - 2 - w];
+            }
+            break;
+        case PadMode::EDGE:
+            std::fill_n(output, front, input[0]);
+            std::fill_n(output_end, end, input[width - 1]);
+            break;
+        default:
+            std::fill_n(output, front, frontValue);
+            std::fill_n(output_end, end, endValue);
     }
+    memcpy(output + front, input, sizeof(T) * width);
+}
+
+}  // namespace
 
 Pad::Pad(const PrecisionType& precision) {
     precision_ = precision;
     width = 0;
     height = 0;
     channel = 0;
+    padMode = PadMode::CONSTANT;
 }
 
 Status Pad::initialize(const std::shared_ptr<ITensor> input, const int32_t& width, const int32_t& height,
                        const int32_t& channel, const std::vector<int32_t>& padFront, const std::vector<int32_t>& padEnd,
-                       const std::vector<float>& padValue) {
+                       const std::vector<float>& padValue, const PadMode& padMode) {
     ENN_UNUSED(input);
     this->width = width;
     this->height = height;
@@ -30,6 +68,7 @@ Status Pad::initialize(const std::shared_ptr<ITensor> input, const int32_t& widt
     this->padFront = padFront;
     this->padEnd = padEnd;
     this->padValue = padValue;
+    this->padMode = padMode;
     return Status::SUCCESS;
 }
 
@@ -38,7 +77,8 @@ Status Pad::executeKernel(const std::shared_ptr<NEONTensor<T>> input_tensor, std
     T* input_data = input_tensor->getBufferPtr();
     T* output_data = output_tensor->getBufferPtr();
 
-    if ((!input_data) || (!output_data) || (padFront.size() != padEnd.size())) {
+    if ((!input_data) || (!output_data) || (padFront.size() != SIZE) || (padEnd.size() != SIZE) || (channel <= 0) ||
+        (height <= 0) || (width <= 0)) {
         ERROR_PRINT("Invalid parameter\n");
         return Status::INVALID_PARAMS;
     }
@@ -51,95 +91,116 @@ Status Pad::executeKernel(const std::shared_ptr<NEONTensor<T>> input_tensor, std
         DEBUG_PRINT("padValue[%d]=[%f]\n", idx, padValue[idx]);
     }
 
-    int32_t validLeft[3];
-    int32_t validRight[3];
-
-    int32_t padFrontWidth = padFront[WIDTH];
-    int32_t padEndWidth = padEnd[WIDTH];
-    int32_t padFrontHeight = padFront[HEIGHT];
-    int32_t padEndHeight = padEnd[HEIGHT];
-    int32_t padFrontChannel = padFront[CHANNEL];
-    int32_t padEndChannel = padEnd[CHANNEL];
-
-    validLeft[0] = padFrontWidth;
-    validRight[0] = padFrontWidth + width;
-    validLeft[1] = padFrontHeight;
-    validRight[1] = padFrontHeight + height;
-    validLeft[2] = padFrontChannel;
-    validRight[2] = padFrontChannel + channel;
-
-    int32_t outputWidth = padFrontWidth + width + padEndWidth;
-    int32_t outputHeight = padFrontHeight + height + padEndHeight;
-
-    // Padding value can be anything.
-    // @todo Now only one padding value is supported.
-    static const int32_t MAX_NUM_OF_PAD_VALUE = 1;
-    float padValues[MAX_NUM_OF_PAD_VALUE];
-    uint32_t numOfPadValue = padValue.size();
-    if (numOfPadValue > MAX_NUM_OF_PAD_VALUE) {
-        ERROR_PRINT("Oops, now Pad for NPU only supports for [%d] padValue...other values are ignored..\n",
-                    MAX_NUM_OF_PAD_VALUE);
-        numOfPadValue = MAX_NUM_OF_PAD_VALUE;
-    }
-    for (uint32_t idx = 0; idx < numOfPadValue; idx++) {
-        padValues[idx] = padValue[idx];
-    }
-    for (uint32_t idx = numOfPadValue; idx < MAX_NUM_OF_PAD_VALUE; idx++) {
-        padValues[idx] = 0;
+    const int32_t sizes[SIZE] = {1, channel, height, width};
+    for (int32_t axis = CHANNEL; axis < SIZE; axis++) {
+        if ((padFront[axis] < 0) || (padEnd[axis] < 0)) {
+            ERROR_PRINT("Invalid padding [%d, %d] of axis %d\n", padFront[axis], padEnd[axis], axis);
+            return Status::INVALID_PARAMS;
+        }
+        // Mirror of the input without the edge is at most size - 1 elements.
+        if ((padMode == PadMode::REFLECT) && (std::max(padFront[axis], padEnd[axis]) >= sizes[axis])) {
+            ERROR_PRINT("Padding [%d, %d] of axis %d is larger than the input to reflect\n", padFront[axis],
+                        padEnd[axis], axis);
+            return Status::INVALID_PARAMS;
+        }
     }
-    float paddingValue = padValues[0];
-
-    int _size_ = 0;
-    int imgSize = height * width;
-
-    // First, put front padding for channel
-    PUT_PADDING(padFrontChannel * outputHeight * outputWidth, output_data, paddingValue, _size_);
-
-    // Second, memcpy real data
-    for (int32_t c = 0; c < channel; c++) {
-        // First, put front padding for height
-        PUT_PADDING(padFrontHeight * outputWidth, output_data, paddingValue, _size_);
 
-        // Second, memcpy real data
-        for (int32_t h = 0; h < height; h++) {
-            // First, put front padding for width
-            PUT_PADDING(padFrontWidth, output_data, paddingValue, _size_);
-
-            // Second, memcpy real data
-            for (int32_t w = 0; w < width; w++) {
-                *output_data++ = input_data[c * imgSize + h * width + w];
-            }
-            _size_ += width;
-
-            // Third, put end padding for width
-            PUT_PADDING(padEndWidth, output_data, paddingValue, _size_);
+    // Values of the front and the end padding of each axis.
+    T frontValues[SIZE];
+    T endValues[SIZE];
+    if (padValue.size() == 2 * SIZE) {
+        for (int32_t axis = 0; axis < SIZE; axis++) {
+            frontValues[axis] = static_cast<T>(padValue[axis]);
+            endValues[axis] = static_cast<T>(padValue[SIZE + axis]);
         }
-
-        // Third, put end padding for height
-        PUT_PADDING(padEndHeight * outputWidth, output_data, paddingValue, _size_);
+    } else {
+        if (padValue.size() > 1) {
+            ERROR_PRINT("Oops, Pad supports one padValue or [%d] of each edge...other values are ignored..\n",
+                        2 * SIZE);
+        }
+        std::fill_n(frontValues, SIZE, static_cast<T>(padValue.empty() ? 0.0f : padValue[0]));
+        std::fill_n(endValues, SIZE, static_cast<T>(padValue.empty() ? 0.0f : padValue[0]));
     }
 
-    // Third, put end padding for channel
-    PUT_PADDING(padEndChannel * outputHeight * outputWidth, output_data, paddingValue, _size_);
+    const int32_t outputWidth = padFront[WIDTH] + width + padEnd[WIDTH];
+    const int32_t outputHeight = padFront[HEIGHT] + height + padEnd[HEIGHT];
+    const int32_t outputChannel = padFront[CHANNEL] + channel + padEnd[CHANNEL];
+
+    // Each row of the output is either a padding of channel or height, or a row of the input padded along width.
+    parallel_for(outputChannel * outputHeight, parallel_grain(outputWidth), [&](size_t begin, size_t end) {
+        for (size_t row = begin; row < end; ++row) {
+            const int32_t c = row / outputHeight;
+            const int32_t h = row % outputHeight;
+            T* output = output_data + row * outputWidth;
+            const int32_t source_c = getSourceIndex(c, padFront[CHANNEL], channel, padMode);
+            if (source_c < 0) {
+                std::fill_n(output, outputWidth, c < padFront[CHANNEL] ? frontValues[CHANNEL] : endValues[CHANNEL]);
+                continue;
+            }
+            const int32_t source_h = getSourceIndex(h, padFront[HEIGHT], height, padMode);
+            if (source_h < 0) {
+                std::fill_n(output, outputWidth, h < padFront[HEIGHT] ? frontValues[HEIGHT] : endValues[HEIGHT]);
+                continue;
+            }
+            padRow(output, input_data + (source_c * height + source_h) * width, width, padFront[WIDTH], padEnd[WIDTH],
+                   padMode, frontValues[WIDTH], endValues[WIDTH]);
+        }
+    });
 
     return Status::SUCCESS;
 }
 
 Status Pad::execute(const std::shared_ptr<ITensor> input, std::shared_ptr<ITensor> output) {
     switch (input->getDataType()) {
+        case DataType::FLOAT: {
+            DEBUG_PRINT("DataType::FLOAT\n");
+            auto input_tensor = std::static_pointer_cast<NEONTensor<float>>(input);
+            auto output_tensor = std::static_pointer_cast<NEONTensor<float>>(output);
+            return executeKernel(input_tensor, output_tensor);
+        }
+        case DataType::HALF:
+        case DataType::FLOAT16: {
+            DEBUG_PRINT("DataType::FLOAT16\n");
+            auto input_tensor = std::static_pointer_cast<NEONTensor<_Float16_t>>(input);
+            auto output_tensor = std::static_pointer_cast<NEONTensor<_Float16_t>>(output);
+            return executeKernel(input_tensor, output_tensor);
+        }
+        case DataType::INT32: {
+            DEBUG_PRINT("DataType::INT32\n");
+            auto input_tensor = std::static_pointer_cast<NEONTensor<int32_t>>(input);
+            auto output_tensor = std::static_pointer_cast<NEONTensor<int32_t>>(output);
+            return executeKernel(input_tensor, output_tensor);
+        }
         case DataType::INT16: {
             DEBUG_PRINT("DataType::INT16\n");
             auto input_tensor = std::static_pointer_cast<NEONTensor<int16_t>>(input);
             auto output_tensor = std::static_pointer_cast<NEONTensor<int16_t>>(output);
             return executeKernel(input_tensor, output_tensor);
         }
-        case DataType::INT8:
-        case DataType::UINT8: {
-            DEBUG_PRINT("DataType::INT8 or DataType::UINT8\n");
+        case DataType::UINT16: {
+            DEBUG_PRINT("DataType::UINT16\n");
+            auto input_tensor = std::static_pointer_cast<NEONTensor<uint16_t>>(input);
+            auto output_tensor = std::static_pointer_cast<NEONTensor<uint16_t>>(output);
+            return executeKernel(input_tensor, output_tensor);
+        }
+        case DataType::INT8: {
+            DEBUG_PRINT("DataType::INT8\n");
             auto input_tensor = std::static_pointer_cast<NEONTensor<int8_t>>(input);
             auto output_tensor = std::static_pointer_cast<NEONTensor<int8_t>>(output);
             return executeKernel(input_tensor, output_tensor);
         }
+        case DataType::UINT8: {
+            DEBUG_PRINT("DataType::UINT8\n");
+            auto input_tensor = std::static_pointer_cast<NEONTensor<uint8_t>>(input);
+            auto output_tensor = std::static_pointer_cast<NEONTensor<uint8_t>>(output);
+            return executeKernel(input_tensor, output_tensor);
+        }
+        case DataType::BOOL: {
+            DEBUG_PRINT("DataType::BOOL\n");
+            auto input_tensor = std::static_pointer_cast<NEONTensor<bool>>(input);
+            auto output_tensor = std::static_pointer_cast<NEONTensor<bool>>(output);
+            return executeKernel(input_tensor, output_tensor);
+        }
         default: {
             ERROR_PRINT("Data type is not supported\n");
             return Status::FAILURE;
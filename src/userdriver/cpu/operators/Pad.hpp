@@ -1,20 +1,28 @@
 #pragma once
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
 #include "userdriver/common/operator_interfaces/common/Common.hpp"
 #include "userdriver/common/operator_interfaces/interfaces/operators/IPad.hpp"
 #include "userdriver/cpu/common/NEONTensor.hpp"
+#include "userdriver/cpu/common/NEONIncludes.hpp"
 
 namespace enn {
 namespace ud {
 namespace cpu {
 
+// Padding of channel, height and width of an input of any data type. padFront and padEnd are of NCHW, and padValue is
+// either one value for all the padding, or the values of padFront followed by those of padEnd, for each edge.
+// Where edges of several axes overlap, the value of the outer axis is used.
 class Pad : public IPad {
 public:
     explicit Pad(const PrecisionType& precision);
 
     Status initialize(const std::shared_ptr<ITensor> input, const int32_t& width, const int32_t& height,
                       const int32_t& channel, const std::vector<int32_t>& padFront, const std::vector<int32_t>& padEnd,
-                      const std::vector<float>& padValue);
+                      const std::vector<float>& padValue, const PadMode& padMode = PadMode::CONSTANT);
 
     Status execute(const std::shared_ptr<ITensor> input, std::shared_ptr<ITensor> output);
 
@@ -30,6 +38,7 @@ private:
     std::vector<int32_t> padFront;
     std::vector<int32_t> padEnd;
     std::vector<float> padValue;
+    PadMode padMode;
 
     template <typename T>
     Status executeKernel(const std::shared_ptr<NEONTensor<T>> input_tensor, std::shared_ptr<NEONTensor<T>> output_tensor);
@@ -60,12 +60,17 @@ Status Quantization::executeKernel(const std::shared_ptr<NEONTensor<T1>> input_t
         CONST_HEX_3 = 0x7FFF;
     }
 
-    for (int32_t c = 0; c < channel; c++) {
-        for (int32_t h = 0; h < height; h++) {
-            for (int32_t w = 0; w < width; w++) {
-                int32_t index = (c * height * width) + (h * width) + w;
+    // Elements of all channels are split over threads, by segments of the same channel. The output may be on the
+    // input, when the input dies here.
+    const size_t plane_size = static_cast<size_t>(height) * width;
+    parallel_for_in_place(input_data, sizeof(T1), output_data, sizeof(T2), channel * plane_size, PARALLEL_GRAIN,
+                          [&](size_t begin, size_t end) {
+        for (size_t index = begin; index < end;) {
+            int32_t c = index / plane_size;
+            float frac_scale = static_cast<float>(pow(2, frac_lens[c]));
+            for (size_t segment_end = std::min(end, (c + 1) * plane_size); index < segment_end; index++) {
                 float num = input_data[index];
-                int32_t temp = round(num * static_cast<float>(pow(2, frac_lens[c])));
+                int32_t temp = round(num * frac_scale);
                 T2 result = 0;
                 // Set or clear sign bit
                 if (num < 0) {
@@ -76,7 +81,7 @@ Status Quantization::executeKernel(const std::shared_ptr<NEONTensor<T1>> input_t
                 output_data[index] = result;
             }
         }
-    }
+    });
 
     return Status::SUCCESS;
 }
@@ -105,6 +110,23 @@ Status Quantization::execute(const std::shared_ptr<ITensor> input, std::shared_p
     }
 }
 
+bool Quantization::getPipelineStage(const std::shared_ptr<ITensor> input, PipelineStage* stage) {
+    if (!frac_lens_ || channel <= 0 || height <= 0 || width <= 0 ||
+        frac_lens_->getTotalSizeFromDims() < static_cast<uint32_t>(channel) || input->getDataType() != DataType::FLOAT) {
+        return false;
+    }
+    stage->type = PipelineStage::Type::QUANTIZE;
+    stage->input_type = DataType::FLOAT;
+    stage->plane_size = height * width;
+    stage->channel = channel;
+    stage->means.assign(channel, 0.0f);
+    stage->scales.resize(channel);
+    for (int32_t c = 0; c < channel; ++c) {
+        stage->scales[c] = static_cast<float>(pow(2, frac_lens_->getDataPtr().get()[c]));
+    }
+    return true;
+}
+
 Status Quantization::release() {
     return Status::SUCCESS;
 }
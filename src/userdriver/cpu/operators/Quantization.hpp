@@ -3,6 +3,7 @@
 #include "userdriver/common/operator_interfaces/common/Common.hpp"
 #include "userdriver/common/operator_interfaces/interfaces/operators/IQuantization.hpp"
 #include "userdriver/cpu/common/NEONTensor.hpp"
+#include "userdriver/cpu/common/NEONIncludes.hpp"
 
 namespace enn {
 namespace ud {
@@ -19,6 +20,9 @@ public:
 
     Status release();
 
+    // The operator as a step of NEONFusedPipeline, false if it cannot be.
+    bool getPipelineStage(const std::shared_ptr<ITensor> input, PipelineStage* stage);
+
 private:
     PrecisionType precision_;
     DataType output_data_type;
@@ -12,10 +12,15 @@ Softmax::Softmax(const PrecisionType& precision) {
     number = 0;
     beta = 0.f;
     axis = 0;
+    log_softmax = false;
+    out_number = 0;
+    channel_number = 0;
+    inner_number = 0;
 }
 
 Status Softmax::initialize(const std::shared_ptr<ITensor> input, const int32_t& width, const int32_t& height,
-                           const int32_t& channel, const int32_t& number, const float& beta, const int32_t& axis) {
+                           const int32_t& channel, const int32_t& number, const float& beta, const int32_t& axis,
+                           const bool& log_softmax) {
     ENN_UNUSED(input);
     this->width = width;
     this->height = height;
@@ -23,100 +28,137 @@ Status Softmax::initialize(const std::shared_ptr<ITensor> input, const int32_t&
     this->number = number;
     this->beta = beta;
     this->axis = axis;
+    this->log_softmax = log_softmax;
+
+    int new_axis = axis;
+    if (new_axis < 0) {
+        new_axis = axis + 4;
+    }
+    if (new_axis == 0) {
+        out_number = 1;
+        channel_number = number;
+        inner_number = channel * height * width;
+    } else if (new_axis == 1) {
+        out_number = number;
+        channel_number = channel;
+        inner_number = height * width;
+    } else if (new_axis == 2) {
+        out_number = number * channel;
+        channel_number = height;
+        inner_number = width;
+    } else {
+        out_number = number * channel * height;
+        channel_number = width;
+        inner_number = 1;
+    }
     return Status::SUCCESS;
 }
 
 template <typename T>
 Status Softmax::executeKernel(const std::shared_ptr<NEONTensor<T>> input_tensor,
-                              std::shared_ptr<NEONTensor<T>> output_tensor) {
+                              std::shared_ptr<NEONTensor<float>> output_tensor, const float& coef) {
     T* input_data = input_tensor->getBufferPtr();
-    T* output_data = output_tensor->getBufferPtr();
+    float* output_data = output_tensor->getBufferPtr();
 
     if ((!input_data) || (!output_data)) {
         ERROR_PRINT("Invalid parameter\n");
         return Status::INVALID_PARAMS;
     }
 
-    DEBUG_PRINT("beta=[%f], axis=[%d]\n", beta, axis);
+    DEBUG_PRINT("beta=[%f], axis=[%d], log_softmax=[%d]\n", beta, axis, log_softmax);
 
-    int32_t out_number = 0;
-    int32_t channel_number = 0;
-    int32_t inner_number = 0;
-    int32_t dim = 0;
+    const size_t dim = static_cast<size_t>(channel_number) * inner_number;
+    if (inner_number == 1) {
+        parallel_for(out_number, parallel_grain(channel_number * 3), [&](size_t begin, size_t end) {
+            for (size_t j = begin; j < end; j++) {
+                kernel::softmax_row(input_data + j * dim, output_data + j * dim, channel_number, coef, log_softmax);
+            }
+        });
+        return Status::SUCCESS;
+    }
 
-    uint32_t input_batch = number;
-    uint32_t input_channel = channel;
-    uint32_t input_height = height;
-    uint32_t input_width = width;
-    size_t bottom_size = input_batch * input_channel * input_height * input_width;
+    // Items are (out, inner) pairs, split over threads. Each range is done by tiles of the same out, channel by
+    //  channel, so that the inner ones are accessed in a row.
+    parallel_for(static_cast<size_t>(out_number) * inner_number, parallel_grain(channel_number * 3),
+                 [&](size_t begin, size_t end) {
+        float max[CHANNEL_TILE];
+        float sum[CHANNEL_TILE];
+        for (size_t item = begin; item < end;) {
+            const size_t j = item / inner_number;
+            const size_t i = item % inner_number;
+            const size_t size = std::min<size_t>({static_cast<size_t>(inner_number) - i, end - item, CHANNEL_TILE});
+            const size_t offset = j * dim + i;
+            kernel::softmax_channels(input_data + offset, output_data + offset, channel_number, inner_number, size, coef,
+                                     log_softmax, max, sum);
+            item += size;
+        }
+    });
+    return Status::SUCCESS;
+}
 
-    // Nice to have, ToDo(empire.jung, TBD): make it member(). Use member variable for out_number, channel_number, ....
-    int new_axis = axis;
-    if (new_axis < 0) {
-        new_axis = axis + 4;
-    }
-    if (new_axis == 0) {
-        out_number = 1;
-        channel_number = input_batch;
-        inner_number = input_channel * input_height * input_width;
-        dim = bottom_size / out_number;
-    } else if (new_axis == 1) {
-        out_number = input_batch;
-        channel_number = input_channel;
-        inner_number = input_height * input_width;
-        dim = bottom_size / out_number;
-    } else if (new_axis == 2) {
-        out_number = input_batch * input_channel;
-        channel_number = input_height;
-        inner_number = input_width;
-        dim = bottom_size / out_number;
-    } else {
-        out_number = input_batch * input_channel * input_height;
-        channel_number = input_width;
-        inner_number = 1;
-        dim = bottom_size / out_number;
+Status Softmax::executeFused(const std::function<void(size_t, size_t)>& produce, float* output) {
+    if (!output) {
+        ERROR_PRINT("Invalid parameter\n");
+        return Status::INVALID_PARAMS;
     }
 
-    std::shared_ptr<float> channel_max_ptr(new float[inner_number], std::default_delete<float[]>());
-    auto channel_max = channel_max_ptr.get();
-    float channel_sum = 0.0;
-
-    // Nice to have, ToDo(empire.jung, TBD): Make some comment for each inner for-loop. Or make it as a function.
-    // Optional: Performance Opt.
-    for (int j = 0; j < out_number; j++) {
-        int offset = j * dim;
-        for (int i = 0; i < inner_number; i++) {
-            channel_max[i] = input_data[i + offset];
-            for (int c = 1; c < channel_number; c++) {
-                if (input_data[offset + i + inner_number * c] > channel_max[i]) {
-                    channel_max[i] = input_data[offset + i + inner_number * c];
-                }
-            }
-        }
-        for (int i = 0; i < inner_number; i++) {
-            channel_sum = 0.0;
-            for (int c = 0; c < channel_number; c++) {
-                int data_offset = offset + i + inner_number * c;
-                output_data[data_offset] = exp((input_data[data_offset] - channel_max[i]) * beta);
-                channel_sum += output_data[data_offset];
+    const size_t dim = static_cast<size_t>(channel_number) * inner_number;
+    if (inner_number == 1) {
+        parallel_for(out_number, parallel_grain(channel_number * 3), [&](size_t begin, size_t end) {
+            for (size_t j = begin; j < end; j++) {
+                produce(j * dim, channel_number);
+                kernel::softmax_row(output + j * dim, output + j * dim, channel_number, beta, log_softmax);
             }
+        });
+        return Status::SUCCESS;
+    }
 
-            for (int c = 0; c < channel_number; c++) {
-                int data_offset = offset + i + inner_number * c;
-                output_data[data_offset] /= channel_sum;
+    parallel_for(static_cast<size_t>(out_number) * inner_number, parallel_grain(channel_number * 3),
+                 [&](size_t begin, size_t end) {
+        float max[CHANNEL_TILE];
+        float sum[CHANNEL_TILE];
+        for (size_t item = begin; item < end;) {
+            const size_t j = item / inner_number;
+            const size_t i = item % inner_number;
+            const size_t size = std::min<size_t>({static_cast<size_t>(inner_number) - i, end - item, CHANNEL_TILE});
+            const size_t offset = j * dim + i;
+            for (int32_t c = 0; c < channel_number; c++) {
+                produce(offset + static_cast<size_t>(c) * inner_number, size);
             }
+            kernel::softmax_channels(output + offset, output + offset, channel_number, inner_number, size, beta,
+                                     log_softmax, max, sum);
+            item += size;
         }
-    }
+    });
     return Status::SUCCESS;
 }
 
 Status Softmax::execute(const std::shared_ptr<ITensor> input, std::shared_ptr<ITensor> output) {
+    if (output->getDataType() != DataType::FLOAT) {
+        ERROR_PRINT("Data type is not supported\n");
+        return Status::FAILURE;
+    }
+    auto output_tensor = std::static_pointer_cast<NEONTensor<float>>(output);
+    // Softmax is invariant to the zero point, so a quantized input is dequantized only by the scale.
     switch (input->getDataType()) {
         case DataType::FLOAT: {
             DEBUG_PRINT("DataType::FLOAT\n");
-            auto input_tensor = std::static_pointer_cast<NEONTensor<float>>(input);
-            auto output_tensor = std::static_pointer_cast<NEONTensor<float>>(output);
-            return executeKernel(input_tensor, output_tensor);
+            return executeKernel(std::static_pointer_cast<NEONTensor<float>>(input), output_tensor, beta);
+        }
+        case DataType::INT8: {
+            DEBUG_PRINT("DataType::INT8\n");
+            return executeKernel(std::static_pointer_cast<NEONTensor<int8_t>>(input), output_tensor,
+                                 beta * input->getScale());
+        }
+        case DataType::UINT8: {
+            DEBUG_PRINT("DataType::UINT8\n");
+            return executeKernel(std::static_pointer_cast<NEONTensor<uint8_t>>(input), output_tensor,
+                                 beta * input->getScale());
+        }
+        case DataType::INT16: {
+            DEBUG_PRINT("DataType::INT16\n");
+            return executeKernel(std::static_pointer_cast<NEONTensor<int16_t>>(input), output_tensor,
+                                 beta * input->getScale());
         }
         default: {
             ERROR_PRINT("Data type is not supported\n");
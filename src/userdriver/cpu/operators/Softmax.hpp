@@ -3,6 +3,7 @@
 #include "userdriver/common/operator_interfaces/common/Common.hpp"
 #include "userdriver/common/operator_interfaces/interfaces/operators/ISoftmax.hpp"
 #include "userdriver/cpu/common/NEONTensor.hpp"
+#include "userdriver/cpu/common/NEONIncludes.hpp"
 
 namespace enn {
 namespace ud {
@@ -12,14 +13,25 @@ class Softmax : public ISoftmax {
 public:
     explicit Softmax(const PrecisionType& precision);
 
+    // log_softmax gives log(softmax(input)), e.g. for LOG_SOFTMAX.
     Status initialize(const std::shared_ptr<ITensor> input, const int32_t& width, const int32_t& height,
-                      const int32_t& channel, const int32_t& number, const float& beta, const int32_t& axis);
+                      const int32_t& channel, const int32_t& number, const float& beta, const int32_t& axis,
+                      const bool& log_softmax = false);
 
+    // The output is float. Quantized inputs(int8, uint8, int16) are dequantized by their scale on the fly.
     Status execute(const std::shared_ptr<ITensor> input, std::shared_ptr<ITensor> output);
 
+    // Softmax in place of the output, whose input is written block by block by produce(index, count) for elements
+    // [index, index + count) right before the block is used. A chain of element-wise operators is fused so, without
+    // an intermediate buffer.
+    Status executeFused(const std::function<void(size_t, size_t)>& produce, float* output);
+
     Status release();
 
 private:
+    // Positions of the channel kernel done together, so that max and sum of them are on the stack.
+    static constexpr int32_t CHANNEL_TILE = 256;
+
     PrecisionType precision_;
 
     // Nice to have, ToDo(empire.jung, TBD): Consider changing to use dim4 struct.
@@ -29,9 +41,17 @@ private:
     int32_t number;
     float beta;
     int32_t axis;
+    bool log_softmax;
+
+    // Input is [out_number, channel_number, inner_number] around the axis, chosen in initialize().
+    // inner_number 1 is softmax of rows in a row(softmax_row), others of channels in stride(softmax_channels).
+    int32_t out_number;
+    int32_t channel_number;
+    int32_t inner_number;
 
     template <typename T>
-    Status executeKernel(const std::shared_ptr<NEONTensor<T>> input_tensor, std::shared_ptr<NEONTensor<T>> output_tensor);
+    Status executeKernel(const std::shared_ptr<NEONTensor<T>> input_tensor, std::shared_ptr<NEONTensor<float>> output_tensor,
+                         const float& coef);
 };
 
 }  // namespace cpu
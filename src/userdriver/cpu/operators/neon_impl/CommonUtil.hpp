@@ -1,42 +1,71 @@
 #pragma once
 
 #include "userdriver/common/operator_interfaces/common/Includes.hpp"
+#include "userdriver/cpu/common/NEONKernels.hpp"
 #include "userdriver/cpu/common/NEONTensor.hpp"
+#include "userdriver/cpu/common/NEONThreadPool.hpp"
 
 namespace enn {
 namespace ud {
 namespace cpu {
 
-static Status evalFloat(const std::shared_ptr<ITensor> input, std::shared_ptr<ITensor> output, int32_t axis, bool max) {
-    auto input_tensor = std::static_pointer_cast<NEONTensor<float>>(input);
-    auto output_tensor = std::static_pointer_cast<NEONTensor<int>>(output);
-    float* input_data = input_tensor->getBufferPtr();
-    int* output_data = output_tensor->getBufferPtr();
+// Index of the max(the last of ties) or the min(the first of ties) along the axis, over dims of outer x dim x inner.
+// Rows of the innermost axis are reduced one by one, and positions of the other axes, e.g. of the channel axis of
+// NCHW, are reduced together, channel by channel.
+template <typename T>
+static Status evalArgExtreme(const std::shared_ptr<ITensor> input, std::shared_ptr<ITensor> output, int32_t axis,
+                             bool max) {
+    const T* input_data = std::static_pointer_cast<NEONTensor<T>>(input)->getBufferPtr();
+    int32_t* output_data = std::static_pointer_cast<NEONTensor<int32_t>>(output)->getBufferPtr();
 
-    Dim4 input_dim = input_tensor->getDim();
-    uint32_t dim = getDim(input_dim, axis);
-    int axis_dist = 1;
-    for (int i = axis + 1; i < 4; ++i) {
-        axis_dist *= getDim(input_dim, i);
-    }
-    int num = 0;
+    const NDims& dims = input->getDims();
+    const size_t dim = dims[axis];
     if (dim == 0) {
         return Status::FAILURE;
-    } else {
-        num = input_tensor->getTotalSizeFromDims() / dim;
-    }
-    std::vector<std::pair<float, int>> vec(dim);
-    for (int i = 0; i < num; ++i) {
-        for (uint32_t j = 0; j < dim; ++j) {
-            vec[j] = std::make_pair(input_data[(i / axis_dist * dim + j) * axis_dist + i % axis_dist], j);
-        }
-        std::sort(vec.begin(), vec.end(), std::greater<std::pair<float, int>>());
-        output_data[(i / axis_dist) * axis_dist + i % axis_dist] = max ? vec[0].second : vec.back().second;
     }
+    size_t outer = 1, inner = 1;
+    for (int32_t i = 0; i < axis; ++i) outer *= dims[i];
+    for (size_t i = axis + 1; i < dims.size(); ++i) inner *= dims[i];
 
+    if (inner == 1) {
+        parallel_for(outer, parallel_grain(dim), [&](size_t begin, size_t end) {
+            for (size_t o = begin; o < end; ++o) output_data[o] = kernel::arg_extreme_row(input_data + o * dim, dim, max);
+        });
+    } else {
+        // Output of the position (o, i) is at o * inner + i, so that a range of them is split by rows of inner.
+        parallel_for(outer * inner, parallel_grain(dim), [&](size_t begin, size_t end) {
+            while (begin < end) {
+                const size_t o = begin / inner, i = begin % inner;
+                const size_t size = std::min(end - begin, inner - i);
+                kernel::arg_extreme_channels(input_data + o * dim * inner + i, output_data + begin, dim, inner, size, max);
+                begin += size;
+            }
+        });
+    }
     return Status::SUCCESS;
 }
 
+static Status evalArgExtreme(const std::shared_ptr<ITensor> input, std::shared_ptr<ITensor> output, int32_t axis,
+                             bool max) {
+    if (output->getDataType() != DataType::INT32) {
+        ERROR_PRINT("Output of ArgMax/ArgMin should be INT32\n");
+        return Status::FAILURE;
+    }
+    switch (input->getDataType()) {
+        case DataType::FLOAT:
+            return evalArgExtreme<float>(input, output, axis, max);
+        case DataType::UINT8:
+            return evalArgExtreme<uint8_t>(input, output, axis, max);
+        case DataType::INT8:
+            return evalArgExtreme<int8_t>(input, output, axis, max);
+        case DataType::INT16:
+            return evalArgExtreme<int16_t>(input, output, axis, max);
+        default:
+            ERROR_PRINT("Unsupported data type of ArgMax/ArgMin: %d\n", static_cast<int>(input->getDataType()));
+            return Status::FAILURE;
+    }
+}
+
 }  // namespace cpu
 }  // namespace ud
 }  // namespace enn
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "BboxUtil_batch_single.hpp"
+#include "FastNMS.hpp"
 
 namespace enn {
 namespace ud {
@@ -13,7 +14,7 @@ void detection(const uint32_t &num_input, const uint32_t &num_classes, const boo
                const float *conf_data, const float *prior_data, float *output_data,
                uint32_t &output_channel, uint32_t &output_height, uint32_t &output_width,
                bool is_conf_thresh_unnormalized = false, float conf_thresh_unnormalized = .0f,
-               std::vector<Label_bbox> *all_decode_bboxes = nullptr, std::vector<uint32_t> *class_in_use = nullptr);
+               BBoxArray *decode_bboxes = nullptr, std::vector<uint32_t> *class_in_use = nullptr);
 
 }  // namespace cpu
 }  // namespace ud
@@ -0,0 +1,144 @@
+#include "FastNMS.hpp"
+#include "BboxUtil_batch_single.hpp"
+#include "userdriver/cpu/common/NEONVector.hpp"
+
+namespace enn {
+namespace ud {
+namespace cpu {
+
+void BBoxArray::resize(size_t num) {
+    xmin.resize(num);
+    ymin.resize(num);
+    xmax.resize(num);
+    ymax.resize(num);
+    size.resize(num);
+}
+
+void BBoxArray::set(size_t i, const NormalizedBBox &bbox) {
+    xmin[i] = bbox.xmin();
+    ymin[i] = bbox.ymin();
+    xmax[i] = bbox.xmax();
+    ymax[i] = bbox.ymax();
+    size[i] = bboxSize(bbox);
+}
+
+void BBoxArray::push_back(const BBoxArray &bboxes, size_t i) {
+    xmin.push_back(bboxes.xmin[i]);
+    ymin.push_back(bboxes.ymin[i]);
+    xmax.push_back(bboxes.xmax[i]);
+    ymax.push_back(bboxes.ymax[i]);
+    size.push_back(bboxes.size[i]);
+}
+
+namespace {
+
+// Descending order of score, ascending order of index for the same score.
+template <typename T>
+bool greaterScore(const std::pair<float, T> &pair1, const std::pair<float, T> &pair2) {
+    return pair1.first > pair2.first || (pair1.first == pair2.first && pair1.second < pair2.second);
+}
+
+// Whether JaccardOverlap() of box i and any of kept is not <= threshold. Operands of min and max are in the order of
+// std::min(bbox1, bbox2) and std::max(bbox1, bbox2) of intersectBBox(), so the overlaps are the same bits.
+template <typename V = simd::Native>
+bool overlapsAny(const BBoxArray &kept, const BBoxArray &bboxes, size_t i, float threshold) {
+    const size_t num = kept.count();
+    size_t k = 0;
+    if (num >= static_cast<size_t>(V::LANES)) {
+        const auto xmin = V::dup(bboxes.xmin[i]);
+        const auto ymin = V::dup(bboxes.ymin[i]);
+        const auto xmax = V::dup(bboxes.xmax[i]);
+        const auto ymax = V::dup(bboxes.ymax[i]);
+        const auto size = V::dup(bboxes.size[i]);
+        float widths[V::LANES], heights[V::LANES], overlaps[V::LANES];
+        for (; k + V::LANES <= num; k += V::LANES) {
+            auto width = V::sub(V::min(V::load(&kept.xmax[k]), xmax), V::max(V::load(&kept.xmin[k]), xmin));
+            auto height = V::sub(V::min(V::load(&kept.ymax[k]), ymax), V::max(V::load(&kept.ymin[k]), ymin));
+            auto intersect_size = V::mul(width, height);
+            V::store(widths, width);
+            V::store(heights, height);
+            V::store(overlaps, V::div(intersect_size, V::sub(V::add(size, V::load(&kept.size[k])), intersect_size)));
+            for (int l = 0; l < V::LANES; ++l) {
+                if (widths[l] > 0 && heights[l] > 0 && !(overlaps[l] <= threshold)) {
+                    return true;
+                }
+            }
+        }
+    }
+    for (; k < num; ++k) {
+        float width = std::min(bboxes.xmax[i], kept.xmax[k]) - std::max(bboxes.xmin[i], kept.xmin[k]);
+        float height = std::min(bboxes.ymax[i], kept.ymax[k]) - std::max(bboxes.ymin[i], kept.ymin[k]);
+        if (width > 0 && height > 0) {
+            float intersect_size = width * height;
+            if (!(intersect_size / (bboxes.size[i] + kept.size[k] - intersect_size) <= threshold)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
+void getTopKScoreIndex(const float *scores, uint32_t num, uint32_t stride, const float &threshold, const int32_t &top_k,
+                       std::vector<std::pair<float, int>> *score_index_vec) {
+    score_index_vec->clear();
+    for (uint32_t i = 0; i < num; ++i) {
+        float score = scores[static_cast<size_t>(i) * stride];
+        if (score > threshold) {
+            score_index_vec->push_back(std::make_pair(score, i));
+        }
+    }
+    // Only the top_k are sorted, instead of all candidates.
+    if (top_k >= 0 && static_cast<size_t>(top_k) < score_index_vec->size()) {
+        std::partial_sort(score_index_vec->begin(), score_index_vec->begin() + top_k, score_index_vec->end(),
+                          greaterScore<int>);
+        score_index_vec->resize(top_k);
+    } else {
+        std::sort(score_index_vec->begin(), score_index_vec->end(), greaterScore<int>);
+    }
+}
+
+void applyNMSFast(const BBoxArray &bboxes, const std::vector<std::pair<float, int>> &score_index_vec,
+                  const float &nms_threshold, const float &eta, std::vector<int> *indices) {
+    float adaptive_threshold = nms_threshold;
+    indices->clear();
+    BBoxArray kept;
+    for (auto &score_index_pair : score_index_vec) {
+        const int idx = score_index_pair.second;
+        bool keep = !overlapsAny(kept, bboxes, idx, adaptive_threshold);
+        if (keep) {
+            indices->push_back(idx);
+            kept.push_back(bboxes, idx);
+        }
+        if (keep && eta < 1 && adaptive_threshold > 0.5) {
+            adaptive_threshold *= eta;
+        }
+    }
+}
+
+void keepTopK(const float *conf_data, uint32_t num_classes, const int32_t &keep_top_k,
+              std::vector<std::vector<int>> *indices) {
+    std::vector<std::pair<float, std::pair<int, int>>> score_index_pairs;
+    for (uint32_t c = 0; c < indices->size(); ++c) {
+        for (int idx : (*indices)[c]) {
+            score_index_pairs.push_back(std::make_pair(conf_data[idx * num_classes + c], std::make_pair(c, idx)));
+        }
+    }
+    if (keep_top_k < 0 || score_index_pairs.size() <= static_cast<size_t>(keep_top_k)) {
+        return;
+    }
+    std::partial_sort(score_index_pairs.begin(), score_index_pairs.begin() + keep_top_k, score_index_pairs.end(),
+                      greaterScore<std::pair<int, int>>);
+    score_index_pairs.resize(keep_top_k);
+    for (auto &class_indices : *indices) {
+        class_indices.clear();
+    }
+    for (auto &score_index_pair : score_index_pairs) {
+        (*indices)[score_index_pair.second.first].push_back(score_index_pair.second.second);
+    }
+}
+
+}  // namespace cpu
+}  // namespace ud
+}  // namespace enn
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "userdriver/common/operator_interfaces/common/Includes.hpp"
+#include "NormalizedBbox.hpp"
+
+namespace enn {
+namespace ud {
+namespace cpu {
+
+// Boxes in structure of arrays, so that IoU of a box is computed against several boxes at once.
+// size is bboxSize() of the box, 0 for an invalid one.
+struct BBoxArray {
+    std::vector<float> xmin;
+    std::vector<float> ymin;
+    std::vector<float> xmax;
+    std::vector<float> ymax;
+    std::vector<float> size;
+
+    size_t count() const {
+        return size.size();
+    }
+    void resize(size_t num);
+    void set(size_t i, const NormalizedBBox &bbox);
+    void push_back(const BBoxArray &bboxes, size_t i);
+};
+
+// Scores of scores[i * stride] greater than threshold with their indices, top_k highest at most(all if top_k < 0),
+// in descending order of score. Ties are in ascending order of index, as stable_sort of them gives.
+void getTopKScoreIndex(const float *scores, uint32_t num, uint32_t stride, const float &threshold, const int32_t &top_k,
+                       std::vector<std::pair<float, int>> *score_index_vec);
+
+// Greedy NMS of the candidates in their order, the same as applyNMSFast(). The boxes kept so far are compared
+// with a candidate by LANES at a time, until one overlaps more than the threshold.
+void applyNMSFast(const BBoxArray &bboxes, const std::vector<std::pair<float, int>> &score_index_vec,
+                  const float &nms_threshold, const float &eta, std::vector<int> *indices);
+
+// Keep the keep_top_k highest detections of an image over classes, where indices[c] are the detections of class c and
+// conf_data[idx * num_classes + c] is the score of idx. Detections of a class stay in descending order of score.
+void keepTopK(const float *conf_data, uint32_t num_classes, const int32_t &keep_top_k,
+              std::vector<std::vector<int>> *indices);
+
+}  // namespace cpu
+}  // namespace ud
+}  // namespace enn
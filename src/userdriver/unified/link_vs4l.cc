@@ -851,22 +851,14 @@ EnnReturn UdLink::__link_req_done(accelerator_device acc, int32_t device_fd, str
     ENN_UNUSED(timer_arg);
     std::shared_ptr<bin_data> bin_instance = nullptr;
 
-    bool bin_exist = false;
-
     {
         std::lock_guard<std::mutex> guard(mutex_bin_instance_);
-        for (auto &itr : map_bin_instance_[acc]) {
-            if (itr.second) {
-                int32_t dev_fd = itr.second->device_fd;
-                if (dev_fd == device_fd) {
-                    bin_exist = true;
-                    bin_instance = itr.second;
-                    break;
-                }
-            }
+        auto found = map_fd_bin_instance_[acc].find(device_fd);
+        if (found != map_fd_bin_instance_[acc].end()) {
+            bin_instance = found->second;
         }
     }
-    if (bin_exist == false) {
+    if (bin_instance == nullptr) {
         ENN_ERR_PRINT_FORCE("ERR: Fail to find bin_instance : %d\n", device_fd);
         return ENN_RET_FAILED;
     }
@@ -1531,6 +1523,7 @@ EnnReturn UdLink::link_open_model(accelerator_device acc, model_info_t* model_in
     {
         std::lock_guard<std::mutex> guard(mutex_bin_instance_);
         map_bin_instance_[acc].insert(std::make_pair(bin_instance->unique_id, bin_instance));
+        map_fd_bin_instance_[acc][device_fd] = bin_instance;
     }
 
     ENN_DBG_PRINT("(-)\n");
@@ -2290,6 +2283,7 @@ EnnReturn UdLink::link_close_model(accelerator_device acc, uint64_t model_id) {
     {
         std::lock_guard<std::mutex> guard(mutex_bin_instance_);
         map_bin_instance_[acc].erase(bin_instance->unique_id);
+        map_fd_bin_instance_[acc].erase(bin_instance->device_fd);
     }
 
     uint32_t in_fmap_count_final = bin_instance->in_fmap_count;
@@ -21,6 +21,7 @@
 
 #include <map>
 #include <atomic>
+#include <unordered_map>
 #include <setjmp.h>
 #include <stdbool.h>
 #include <pthread.h>
@@ -301,6 +302,8 @@ class UdLink {
         std::atomic<int32_t> flag_sram_full_[NUM_ACCELERATOR];
         /* bin ion fd is unique id. */
         std::map <uint32_t, std::shared_ptr<bin_data>> map_bin_instance_[NUM_ACCELERATOR];
+        /* device fd to find bin instance of completion */
+        std::unordered_map<int32_t, std::shared_ptr<bin_data>> map_fd_bin_instance_[NUM_ACCELERATOR];
         static constexpr uint32_t REQ_PRIORITY_DEFAULT = 0;
         static constexpr uint32_t REQ_PRIORITY_MIN = 0;
         static constexpr uint32_t REQ_PRIORITY_MAX = 256;
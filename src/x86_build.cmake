@@ -21,6 +21,18 @@ message("Thread Sanitizer is enabled")
 set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -fsanitize=thread -g")
 endif()
 
+# SIMD back end of the CPU userdriver on x86 host: AVX2, SSE4 or SCALAR.
+#  SSE4 by default, which every x86-64 host of validation farms supports.
+set(CPU_SIMD "SSE4" CACHE STRING "SIMD back end of the CPU userdriver (AVX2, SSE4 or SCALAR)")
+if(CMAKE_SYSTEM_PROCESSOR MATCHES "x86_64|AMD64|i.86")
+    if(CPU_SIMD STREQUAL "AVX2")
+        set(CPU_SIMD_FLAGS "-mavx2 -mfma")
+    elseif(CPU_SIMD STREQUAL "SSE4")
+        set(CPU_SIMD_FLAGS "-msse4.1")
+    endif()
+    message("-- CPU_SIMD: ${CPU_SIMD}")
+endif()
+
 add_library(enn_dbg_utils   SHARED  ${SRC_TOP}/common/enn_debug.cc ${SRC_TOP}/common/enn_utils.cc)
 target_include_directories(enn_dbg_utils PRIVATE ${SRC_TOP})
 
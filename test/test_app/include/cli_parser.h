@@ -36,6 +36,9 @@ struct CliOptions {
     CLI :: Option* priority;
     CLI :: Option* tile_num;
     CLI :: Option* core_affinity;
+    CLI :: Option* session;
+    CLI :: Option* pipeline;
+    CLI :: Option* statistics;
 
     CLI :: Option* delay;
     CLI :: Option* error;
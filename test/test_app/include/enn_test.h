@@ -41,6 +41,8 @@ class EnnTest {
     EnnTestReturn Execute_iter(const EnnModelId model_id, TestBuffers& test_buffer,
                                const int32_t thread_id = 0);
     EnnTestReturn Execute_duration(const EnnModelId model_id, TestBuffers& test_buffer);
+    EnnTestReturn Execute_pipeline(const EnnModelId model_id, TestBuffers& test_buffer);
+    void PrintStatistics(const EnnModelId model_id);
     void DumpOutput(TestBuffers& test_buffer);
     void ReleaseBuffer(TestBuffers& test_buffer);
     void CloseModel(const EnnModelId model_id);
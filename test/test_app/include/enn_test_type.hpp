@@ -131,6 +131,8 @@ typedef struct _TestParams {
     uint32_t priority;
     uint32_t tile_num;
     uint32_t core_affinity;
+    uint32_t pipeline_depth;
+    bool statistics;
 
     uint32_t delay;
     int32_t error;
@@ -139,7 +141,7 @@ typedef struct _TestParams {
                     iter(1), duration(0), repeat(1), threshold(0), skipMatch(false), reportPath(""),
                     isAsync(false), session_num(1), thread_num(1), dump_output(false),
                     preset_id(0), target_latency(0), priority(0), tile_num(0), core_affinity(0),
-                    delay(0), error(0) {
+                    pipeline_depth(0), statistics(false), delay(0), error(0) {
         inputPath.clear();
         goldenPath.clear();
     }
@@ -190,6 +192,15 @@ typedef struct _TestParams {
         if (core_affinity > 0) {
             PRINT(" * core_affinity : %d\n", core_affinity);
         }
+        if (session_num > 1) {
+            PRINT(" * session : %d\n", session_num);
+        }
+        if (pipeline_depth > 0) {
+            PRINT(" * pipeline depth : %d\n", pipeline_depth);
+        }
+        if (statistics) {
+            PRINT(" * Print latency statistics\n");
+        }
 
         if (!reportPath.empty()) {
             PRINT(" * reportPath : %s\n", reportPath.c_str());
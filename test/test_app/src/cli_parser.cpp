@@ -153,6 +153,19 @@ int32_t CliParser::parse_commandline(int argc, char** argv, enn_test::TestParams
     cli_options.core_affinity = app.add_option("--core_affinity", test_param.core_affinity, "Apply given core affinity.");
     cli_options.core_affinity->group("Optional")->check(CLI::NonNegativeNumber);
 
+    cli_options.session = app.add_option("--session", test_param.session_num, "Number of buffer sets(sessions) "
+                    "executed in turn. (default : 1)");
+    cli_options.session->group("Optional")->check(CLI::PositiveNumber);
+
+    cli_options.pipeline = app.add_option("--pipeline", test_param.pipeline_depth, "Execute sessions in turn "
+                    "through the pipeline of given queue depth, and report throughput compared to sequential "
+                    "execution. (default : 0, disabled)");
+    cli_options.pipeline->group("Optional")->check(CLI::NonNegativeNumber);
+
+    cli_options.statistics = app.add_flag("--statistics", test_param.statistics, "Print latency statistics "
+                    "(p50/p90/p99/p99.9) of the model kept by the framework before closing it");
+    cli_options.statistics->group("Optional");
+
     cli_options.delay = app.add_option("--delay", test_param.delay, "");
     cli_options.delay->group("Optional")->check(CLI::PositiveNumber);
 
@@ -77,7 +77,9 @@ EnnTestReturn EnnTest::run() {
         }
 
         if (test_params.thread_num == 1) {
-            if (test_params.duration == 0) {
+            if (test_params.pipeline_depth > 0) {
+                ret = Execute_pipeline(model_ids[default_thread_id], test_buffers[default_thread_id]);
+            } else if (test_params.duration == 0) {
                 ret = Execute_iter(model_ids[default_thread_id], test_buffers[default_thread_id]);
             } else {
                 ret = Execute_duration(model_ids[default_thread_id], test_buffers[default_thread_id]);
@@ -106,6 +108,10 @@ EnnTestReturn EnnTest::run() {
             DumpOutput(test_buffers[default_thread_id]);
         }
 
+        if (test_params.statistics) {
+            PrintStatistics(model_ids[default_thread_id]);
+        }
+
         for (int thread_id = 0; thread_id < test_params.thread_num; ++thread_id) {
             ReleaseBuffer(test_buffers[thread_id]);
 
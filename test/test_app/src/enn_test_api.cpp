@@ -10,6 +10,7 @@
 
 #include <vector>
 #include <chrono>
+#include <algorithm>
 
 #include "enn_test.h"
 #include "enn_test_log.h"
@@ -394,6 +395,105 @@ EnnTestReturn EnnTest::Execute_duration(const EnnModelId model_id, TestBuffers&
     return ret;
 }
 
+// Execute "iter" frames in turn over sessions, first one by one and then through the pipeline,
+//  and report throughput of both.
+EnnTestReturn EnnTest::Execute_pipeline(const EnnModelId model_id, TestBuffers& test_buffer) {
+    ENN_TEST_DEBUG("(+)");
+    EnnTestReturn ret = RET_SUCCESS;
+    const int32_t frame_num = test_params.iter;
+    const int32_t session_num = test_params.session_num;
+    EnnReturn enn_ret;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frame_num; ++frame) {
+        EnnTest::Execute(model_id, frame % session_num);
+    }
+    std::chrono::duration<double> sequential = std::chrono::steady_clock::now() - start;
+
+    enn_ret = EnnSetExecutionPipeline(model_id, test_params.pipeline_depth);
+    if (enn_ret != ENN_RET_SUCCESS) {
+        ENN_TEST_ERR("EnnSetExecutionPipeline failed : %d\n", enn_ret);
+        throw RET_EXECUTE_FAILED;
+    }
+
+    // A session should be waited before it is requested again, as a session can be in the pipeline only once.
+    std::vector<bool> in_flight(session_num, false);
+    auto wait = [&](int32_t session_id, int32_t frame) {
+        if (EnnExecuteModelWithSessionIdWait(model_id, session_id) != ENN_RET_SUCCESS) {
+            ENN_TEST_ERR("EnnExecuteModelWithSessionIdWait failed\n");
+            throw RET_EXECUTE_FAILED;
+        }
+        in_flight[session_id] = false;
+        if (test_params.skipMatch) {
+            test_reporter[0][session_id]->IncreasePass();
+        } else if (EnnTest::CompareGolden(test_buffer, frame, session_id) == RET_SUCCESS) {
+            test_reporter[0][session_id]->IncreasePass();
+        } else {
+            ret = RET_GOLDEN_MISMATCH;
+        }
+    };
+
+    start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frame_num; ++frame) {
+        const int32_t session_id = frame % session_num;
+        if (in_flight[session_id]) {
+            wait(session_id, frame - session_num + 1);
+        }
+        enn_ret = EnnExecuteModelWithSessionIdAsync(model_id, session_id);
+        if (enn_ret != ENN_RET_SUCCESS) {
+            ENN_TEST_ERR("EnnExecuteModelWithSessionIdAsync failed : %d\n", enn_ret);
+            throw RET_EXECUTE_FAILED;
+        }
+        in_flight[session_id] = true;
+    }
+    for (int frame = std::max(0, frame_num - session_num); frame < frame_num; ++frame) {
+        wait(frame % session_num, frame + 1);
+    }
+    std::chrono::duration<double> pipelined = std::chrono::steady_clock::now() - start;
+
+    EnnSetExecutionPipeline(model_id, 0);
+
+    PRINT("[Pipeline] frames : %d, sessions : %d, depth : %d\n", frame_num, session_num, test_params.pipeline_depth);
+    PRINT("[Pipeline] sequential : %.3f sec (%.2f fps)\n", sequential.count(), frame_num / sequential.count());
+    PRINT("[Pipeline] pipelined  : %.3f sec (%.2f fps)\n", pipelined.count(), frame_num / pipelined.count());
+    ENN_TEST_DEBUG("(-)");
+    return ret;
+}
+
+void EnnTest::PrintStatistics(const EnnModelId model_id) {
+    ENN_TEST_DEBUG("(+)");
+    EnnModelStatistics statistics;
+    EnnReturn ret = EnnGetModelStatistics(model_id, &statistics);
+    if (ret != ENN_RET_SUCCESS) {
+        // Statistics are informative, so that the test goes on without them.
+        ENN_TEST_ERR("EnnGetModelStatistics failed : %d\n", ret);
+        return;
+    }
+
+    static const char* userdriver_names[ENN_USERDRIVER_SIZE] = {"NPU", "DSP", "CPU", "GPU", "UNIFIED"};
+    auto print = [](const std::string& name, const EnnLatencyStatistics& latency) {
+        if (latency.count == 0) return;
+        PRINT("[Statistics] %-16s count : %6llu, mean : %9.1f, p50 : %9.1f, p90 : %9.1f, p99 : %9.1f, "
+              "p99.9 : %9.1f, max : %9.1f (us)\n", name.c_str(), static_cast<unsigned long long>(latency.count),
+              latency.mean_ns / 1e3, latency.p50_ns / 1e3, latency.p90_ns / 1e3, latency.p99_ns / 1e3,
+              latency.p999_ns / 1e3, latency.max_ns / 1e3);
+    };
+    print("open", statistics.open);
+    print("commit", statistics.commit);
+    print("execute", statistics.execute);
+    print("queue wait", statistics.queue_wait);
+    for (uint32_t idx = 0; idx < statistics.n_operator_list; ++idx) {
+        const uint32_t userdriver = statistics.operator_list_userdriver[idx];
+        print("OpList " + std::to_string(idx) + " (" +
+              (userdriver < ENN_USERDRIVER_SIZE ? userdriver_names[userdriver] : "?") + ")",
+              statistics.operator_list[idx]);
+    }
+    for (int userdriver = 0; userdriver < ENN_USERDRIVER_SIZE; ++userdriver) {
+        print(std::string("UD ") + userdriver_names[userdriver], statistics.userdriver[userdriver]);
+    }
+    ENN_TEST_DEBUG("(-)");
+}
+
 void EnnTest::DumpOutput(TestBuffers& test_buffer) {
     ENN_TEST_DEBUG("(+)");
     for (int idx = 0; idx < test_buffer.output_num; ++idx) {